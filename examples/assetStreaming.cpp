@@ -0,0 +1,113 @@
+#include <levikno/lvn_renderer.h>
+
+
+// NOTE: this program streams a few textures, models and a font with the asset manager while the window keeps rendering
+//       assets are read and decoded on other threads and lvn::assetManagerUpdate creates their graphics objects on the render
+//       thread within the per frame budget, the frame time stays flat while the assets load instead of stalling on each load
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+struct AssetFile
+{
+    LvnAssetType type;
+    const char* filepath;
+    LvnIoPriority priority;
+};
+
+static const AssetFile s_AssetFiles[] =
+{
+    { Lvn_AssetType_Texture, "res/images/debug.png",                   Lvn_IoPriority_High   },
+    { Lvn_AssetType_Texture, "res/images/woodBox.jpg",                 Lvn_IoPriority_Normal },
+    { Lvn_AssetType_Model,   "res/models/sphere.glb",                  Lvn_IoPriority_Normal },
+    { Lvn_AssetType_Font,    "res/fonts/PressStart2P.ttf",             Lvn_IoPriority_Low    },
+    { Lvn_AssetType_Texture, "res/images/debug.png",                   Lvn_IoPriority_Low    }, // shares the first asset
+};
+
+static const char* s_StatusNames[] = { "loading", "decoded", "ready", "failed" };
+
+
+int main(int argc, char** argv)
+{
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.windowapi = Lvn_WindowApi_glfw;
+    lvnCreateInfo.graphicsapi = Lvn_GraphicsApi_opengl;
+    lvnCreateInfo.enableMultithreading = true;
+
+    lvn::createContext(&lvnCreateInfo);
+
+    lvn::renderInit("assetStreaming", 800, 600);
+
+    LvnWindow* window = lvn::getRendererWindow();
+    lvn::windowSetVSync(window, true);
+
+    // a small budget so that the uploads are spread across frames
+    LvnAssetManagerCreateInfo assetManagerCreateInfo{};
+    assetManagerCreateInfo.uploadBudgetBytes = 1024 * 1024;
+    assetManagerCreateInfo.uploadBudgetMs = 1.0f;
+
+    lvn::assetManagerInit(&assetManagerCreateInfo);
+
+    LvnAssetHandle assets[ARRAY_LEN(s_AssetFiles)];
+    for (uint32_t i = 0; i < ARRAY_LEN(s_AssetFiles); i++)
+    {
+        LvnAssetLoadInfo loadInfo{};
+        loadInfo.type = s_AssetFiles[i].type;
+        loadInfo.filepath = s_AssetFiles[i].filepath;
+        loadInfo.priority = s_AssetFiles[i].priority;
+        loadInfo.format = Lvn_TextureFormat_Unorm;
+        loadInfo.minFilter = Lvn_TextureFilter_Linear;
+        loadInfo.magFilter = Lvn_TextureFilter_Linear;
+        loadInfo.wrapS = Lvn_TextureMode_Repeat;
+        loadInfo.wrapT = Lvn_TextureMode_Repeat;
+        loadInfo.fontSize = 32;
+
+        assets[i] = lvn::assetLoad(&loadInfo);
+    }
+
+    LvnAssetStatus lastStatus[ARRAY_LEN(s_AssetFiles)];
+    for (uint32_t i = 0; i < ARRAY_LEN(s_AssetFiles); i++)
+        lastStatus[i] = Lvn_AssetStatus_Loading;
+
+    uint32_t frame = 0;
+    while (lvn::renderWindowOpen())
+    {
+        lvn::windowPollEvents();
+
+        // uploads decoded assets within the budget
+        if (lvn::assetManagerUpdate() > 0)
+        {
+            LvnAssetManagerStats stats = lvn::assetManagerGetStats();
+            printf("[frame %u]: uploaded %u assets, %llu bytes in %.3f ms (%u/%u ready)\n",
+                frame, stats.lastUploadCount, (unsigned long long)stats.lastUploadBytes, stats.lastUploadMs, stats.readyCount, stats.assetCount);
+        }
+
+        for (uint32_t i = 0; i < ARRAY_LEN(s_AssetFiles); i++)
+        {
+            LvnAssetStatus status = lvn::assetGetStatus(assets[i]);
+            if (status != lastStatus[i])
+            {
+                printf("  %s: %s\n", s_AssetFiles[i].filepath, s_StatusNames[status]);
+                lastStatus[i] = status;
+            }
+        }
+
+        lvn::drawBegin();
+        lvn::drawClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+        // a moving rect shows any stalls while the assets load
+        lvn::drawRect({cos(lvn::getContextTime()) * 200.0f, sin(lvn::getContextTime()) * 200.0f}, {40.0f, 40.0f}, {127,127,255,255});
+
+        lvn::drawEnd();
+        frame++;
+    }
+
+    for (uint32_t i = 0; i < ARRAY_LEN(s_AssetFiles); i++)
+        lvn::assetRelease(assets[i]);
+
+    lvn::assetManagerTerminate();
+    lvn::terminateContext();
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <levikno/levikno.h>
+
+// NOTE: this program compares reading a set of files one after another with lvn::loadFileSrcBin against queueing them all
+//       at once with lvn::asyncRead and waiting for the I/O threads to finish
+//       the files are written to the current directory before the timings and removed afterwards
+//       the files were just written so they are most likely still in the OS page cache, the timings show the overhead of
+//       the I/O threads and how well reads overlap rather than the speed of the disk; drop the page cache between runs to
+//       measure cold reads
+
+
+static const uint32_t s_FileCount = 64;
+static const uint32_t s_FileSize = 4 * 1024 * 1024;
+static const uint32_t s_Repeats = 3;      // the best time out of the repeats is reported
+static const uint32_t s_IoThreadCounts[] = { 1, 2, 4, 8 };
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+static void getFilepath(char* buff, size_t size, uint32_t index)
+{
+    snprintf(buff, size, "asyncReadBenchmark_%u.bin", index);
+}
+
+static double readSequential()
+{
+    double best = 1e30;
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        uint64_t totalSize = 0;
+        for (uint32_t i = 0; i < s_FileCount; i++)
+        {
+            char filepath[64];
+            getFilepath(filepath, sizeof(filepath), i);
+            totalSize += lvn::loadFileSrcBin(filepath).size();
+        }
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+
+        if (totalSize != (uint64_t)s_FileCount * s_FileSize)
+            printf("  [warning]: read %llu bytes, expected %llu\n", (unsigned long long)totalSize, (unsigned long long)s_FileCount * s_FileSize);
+    }
+
+    return best;
+}
+
+static double readAsync()
+{
+    double best = 1e30;
+    LvnIoRequest* requests[s_FileCount];
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        for (uint32_t i = 0; i < s_FileCount; i++)
+        {
+            char filepath[64];
+            getFilepath(filepath, sizeof(filepath), i);
+
+            LvnIoReadInfo readInfo{};
+            readInfo.filepath = filepath;
+            readInfo.priority = Lvn_IoPriority_Normal;
+
+            lvn::asyncRead(&readInfo, &requests[i]);
+        }
+
+        for (uint32_t i = 0; i < s_FileCount; i++)
+            lvn::ioWait(requests[i]);
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+
+        uint64_t totalSize = 0;
+        for (uint32_t i = 0; i < s_FileCount; i++)
+        {
+            totalSize += lvn::ioGetData(requests[i]).size();
+            lvn::ioRelease(requests[i]);
+        }
+
+        if (totalSize != (uint64_t)s_FileCount * s_FileSize)
+            printf("  [warning]: read %llu bytes, expected %llu\n", (unsigned long long)totalSize, (unsigned long long)s_FileCount * s_FileSize);
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    // write the files once, every thread count reads the same files
+    LvnUniqueData<uint8_t> contents(s_FileSize);
+    for (uint32_t i = 0; i < s_FileSize; i++)
+        contents[i] = (uint8_t)(i * 31);
+
+    for (uint32_t i = 0; i < s_FileCount; i++)
+    {
+        char filepath[64];
+        getFilepath(filepath, sizeof(filepath), i);
+
+        FILE* fileptr = fopen(filepath, "wb");
+        if (!fileptr)
+        {
+            printf("cannot create file: %s\n", filepath);
+            return -1;
+        }
+        fwrite(contents.data(), sizeof(uint8_t), contents.size(), fileptr);
+        fclose(fileptr);
+    }
+
+    printf("[%u files, %u KiB each]\n", s_FileCount, s_FileSize / 1024);
+
+    for (uint32_t i = 0; i < ARRAY_LEN(s_IoThreadCounts); i++)
+    {
+        LvnContextCreateInfo lvnCreateInfo{};
+        lvnCreateInfo.logging.enableLogging = true;
+        lvnCreateInfo.logging.disableCoreLogging = true;
+        lvnCreateInfo.enableMultithreading = true;
+        lvnCreateInfo.ioThreadCount = s_IoThreadCounts[i];
+
+        lvn::createContext(&lvnCreateInfo);
+
+        if (i == 0)
+        {
+            double sequentialTime = readSequential();
+            printf("  loadFileSrcBin:        %8.2f ms, %8.1f MiB/s\n", sequentialTime, (double)s_FileCount * s_FileSize / (1024.0 * 1024.0) / (sequentialTime / 1000.0));
+        }
+
+        double asyncTime = readAsync();
+        printf("  asyncRead (%u threads): %8.2f ms, %8.1f MiB/s\n", lvn::ioGetThreadCount(), asyncTime, (double)s_FileCount * s_FileSize / (1024.0 * 1024.0) / (asyncTime / 1000.0));
+
+        lvn::terminateContext();
+    }
+
+    for (uint32_t i = 0; i < s_FileCount; i++)
+    {
+        char filepath[64];
+        getFilepath(filepath, sizeof(filepath), i);
+        remove(filepath);
+    }
+
+    return 0;
+}
@@ -0,0 +1,330 @@
+#include <levikno/levikno.h>
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+// NOTE: this program compares LvnHashMap against the previous LvnHashMap and std::unordered_map for integer and string keys
+//       each test inserts a number of keys, looks up every key once (hits), looks up the same number of keys that are not in the map (misses),
+//       then erases every key, timings are the average in nanoseconds per operation
+//       the previous LvnHashMap is copied below as OldHashMap, it only took integral keys so it is not in the string key test
+
+
+static const uint32_t s_KeyCount = 1000000;
+
+
+static uint64_t s_RandState = 12345;
+
+static uint64_t nextRand()
+{
+    s_RandState ^= s_RandState << 13;
+    s_RandState ^= s_RandState >> 7;
+    s_RandState ^= s_RandState << 17;
+    return s_RandState;
+}
+
+// -- OldHashMap
+// ------------------------------------------------------------
+// - the LvnHashMap before the open addressing table, kept here only for comparison (insert, erase and contains)
+// - entries of the same hash are chained through nextIndex, a new entry takes the next free slot after the end of the chain
+// - the hash is taken modulo the capacity and the table grows at a 0.7 load factor
+
+struct OldHashFunc
+{
+    /* splitmix64 */
+    size_t operator()(size_t k) const
+    {
+        k += 0x9E3779B97F4A7C15;
+        k = (k ^ (k >> 30)) * 0xBF58476D1CE4E5B9;
+        k = (k ^ (k >> 27)) * 0x94D049BB133111EB;
+        k = k ^ (k >> 31);
+        return k;
+    }
+};
+
+template <typename K, typename T>
+struct OldHashEntry
+{
+    T data;
+    K key;
+    size_t nextIndex;
+    bool taken, hasNext;
+};
+
+template <typename K, typename T, typename Hash = OldHashFunc>
+class OldHashMap
+{
+    static_assert(std::is_integral_v<K>, "cannot have non integral type as key");
+private:
+    OldHashEntry<K, T>* m_HashEntries;
+    size_t m_Size;
+    size_t m_Capacity;
+    Hash m_Hasher;
+
+    bool erase_recursive(size_t index)
+    {
+        if (m_HashEntries[index].hasNext)
+        {
+            size_t nextIndex = m_HashEntries[index].nextIndex;
+            m_HashEntries[index].key = m_HashEntries[nextIndex].key;
+            m_HashEntries[index].nextIndex = m_HashEntries[nextIndex].nextIndex;
+            m_HashEntries[index].taken = m_HashEntries[nextIndex].taken;
+            m_HashEntries[index].hasNext = m_HashEntries[nextIndex].hasNext;
+            m_HashEntries[index].data = m_HashEntries[nextIndex].data;
+            if (erase_recursive(nextIndex))
+            {
+                m_HashEntries[index].nextIndex = 0;
+                m_HashEntries[index].hasNext = false;
+            }
+        }
+        else /* last entry in chain */
+        {
+            m_HashEntries[index].key = 0;
+            m_HashEntries[index].nextIndex = 0;
+            m_HashEntries[index].taken = false;
+            m_HashEntries[index].hasNext = false;
+            return true;
+        }
+
+        return false;
+    }
+
+public:
+    OldHashMap()
+        : m_HashEntries(nullptr), m_Size(0), m_Capacity(0) {}
+    ~OldHashMap() { lvn::memDelete(m_HashEntries, 0); }
+
+    OldHashMap(const OldHashMap&) = delete;
+    OldHashMap& operator=(const OldHashMap&) = delete;
+
+    void reserve(size_t size)
+    {
+        if (size <= m_Size) return;
+        OldHashEntry<K, T>* temp = m_HashEntries;
+        size_t tempSize = m_Capacity;
+        m_HashEntries = lvn::memNew<OldHashEntry<K, T>>(size);
+        m_Capacity = size;
+
+        m_Size = 0;
+        for (size_t i = 0; i < tempSize; i++)
+        {
+            if (temp[i].taken)
+                insert(temp[i].key, temp[i].data);
+        }
+        lvn::memDelete<OldHashEntry<K, T>>(temp, 0);
+    }
+    void insert(const K& key, const T& value)
+    {
+        if (m_Size * 10 >= m_Capacity * 7)
+            reserve(m_Capacity ? m_Capacity * 2 : 8);
+
+        size_t index = m_Hasher.operator()(key) % m_Capacity;
+        if (m_HashEntries[index].taken && m_HashEntries[index].key == key)
+        {
+            m_HashEntries[index].data = value;
+            return;
+        }
+
+        OldHashEntry<K, T>* entry = &m_HashEntries[index];
+        while (entry->hasNext)
+        {
+            index = entry->nextIndex;
+            entry = &m_HashEntries[entry->nextIndex];
+
+            if (entry->key == key)
+            {
+                entry->data = value;
+                return;
+            }
+        }
+
+        OldHashEntry<K, T>* findEntry = &m_HashEntries[index];
+        while (findEntry->taken)
+        {
+            index = (index + 1) % m_Capacity;
+            findEntry = &m_HashEntries[index];
+        }
+
+        findEntry->key = key;
+        findEntry->data = value;
+        findEntry->taken = true;
+        m_Size++;
+
+        if (entry->key != findEntry->key)
+        {
+            entry->nextIndex = index;
+            entry->hasNext = true;
+        }
+    }
+    void erase(const K& key)
+    {
+        if (m_Size == 0) return;
+
+        size_t index = m_Hasher.operator()(key) % m_Capacity;
+        if (m_HashEntries[index].key == key)
+        {
+            erase_recursive(index);
+            return;
+        }
+
+        OldHashEntry<K, T>* entry = &m_HashEntries[index];
+        while (entry->hasNext)
+        {
+            index = entry->nextIndex;
+            entry = &m_HashEntries[entry->nextIndex];
+
+            if (entry->key == key)
+            {
+                erase_recursive(index);
+                return;
+            }
+        }
+    }
+    bool contains(const K& key)
+    {
+        if (m_Size == 0) return false;
+
+        size_t index = m_Hasher.operator()(key) % m_Capacity;
+        if (key == m_HashEntries[index].key)
+            return true;
+
+        OldHashEntry<K, T>* entry = &m_HashEntries[index];
+        while (entry->hasNext)
+        {
+            index = entry->nextIndex;
+            entry = &m_HashEntries[entry->nextIndex];
+
+            if (entry->key == key)
+                return true;
+        }
+
+        return false;
+    }
+};
+
+
+struct BenchmarkResult
+{
+    double insert, hit, miss, erase;
+};
+
+static void printResult(const char* name, const BenchmarkResult& result)
+{
+    printf("  %-20s insert: %7.2f ns, hit: %7.2f ns, miss: %7.2f ns, erase: %7.2f ns\n", name, result.insert, result.hit, result.miss, result.erase);
+}
+
+// map operations are passed in as lambdas so that both map types share the same benchmark loop
+template <typename Key, typename InsertFunc, typename FindFunc, typename EraseFunc>
+static BenchmarkResult runBenchmark(const Key* keys, const Key* missingKeys, uint32_t count, InsertFunc insertFunc, FindFunc findFunc, EraseFunc eraseFunc)
+{
+    BenchmarkResult result{};
+    LvnTimer timer;
+    size_t found = 0;
+
+    timer.begin();
+    for (uint32_t i = 0; i < count; i++)
+        insertFunc(keys[i], i);
+    result.insert = timer.elapsedms() * 1e6 / count;
+
+    timer.reset();
+    for (uint32_t i = 0; i < count; i++)
+        found += findFunc(keys[i]);
+    result.hit = timer.elapsedms() * 1e6 / count;
+
+    timer.reset();
+    for (uint32_t i = 0; i < count; i++)
+        found += findFunc(missingKeys[i]);
+    result.miss = timer.elapsedms() * 1e6 / count;
+
+    timer.reset();
+    for (uint32_t i = 0; i < count; i++)
+        eraseFunc(keys[i]);
+    result.erase = timer.elapsedms() * 1e6 / count;
+
+    if (found != count)
+        printf("  [warning]: found %zu keys, expected %u\n", found, count);
+
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    // integer keys
+    {
+        std::vector<uint64_t> keys, missingKeys;
+        keys.reserve(s_KeyCount);
+        missingKeys.reserve(s_KeyCount);
+
+        // odd keys are inserted, even keys are never in the map
+        for (uint32_t i = 0; i < s_KeyCount; i++)
+        {
+            keys.push_back(nextRand() | 1);
+            missingKeys.push_back(nextRand() & ~1ull);
+        }
+
+        LvnHashMap<uint64_t, uint32_t> lvnMap;
+        OldHashMap<uint64_t, uint32_t> oldMap;
+        std::unordered_map<uint64_t, uint32_t> stdMap;
+
+        BenchmarkResult lvnResult = runBenchmark(keys.data(), missingKeys.data(), s_KeyCount,
+            [&](uint64_t key, uint32_t value) { lvnMap[key] = value; },
+            [&](uint64_t key) { return lvnMap.find(key) != nullptr; },
+            [&](uint64_t key) { lvnMap.erase(key); });
+
+        BenchmarkResult oldResult = runBenchmark(keys.data(), missingKeys.data(), s_KeyCount,
+            [&](uint64_t key, uint32_t value) { oldMap.insert(key, value); },
+            [&](uint64_t key) { return oldMap.contains(key); },
+            [&](uint64_t key) { oldMap.erase(key); });
+
+        BenchmarkResult stdResult = runBenchmark(keys.data(), missingKeys.data(), s_KeyCount,
+            [&](uint64_t key, uint32_t value) { stdMap[key] = value; },
+            [&](uint64_t key) { return stdMap.find(key) != stdMap.end(); },
+            [&](uint64_t key) { stdMap.erase(key); });
+
+        printf("[uint64_t keys, %u]\n", s_KeyCount);
+        printResult("LvnHashMap", lvnResult);
+        printResult("OldHashMap", oldResult);
+        printResult("std::unordered_map", stdResult);
+    }
+
+    // string keys
+    {
+        std::vector<LvnString> keys, missingKeys;
+        std::vector<std::string> stdKeys, stdMissingKeys;
+        keys.reserve(s_KeyCount);
+        missingKeys.reserve(s_KeyCount);
+        stdKeys.reserve(s_KeyCount);
+        stdMissingKeys.reserve(s_KeyCount);
+
+        char buff[32];
+        for (uint32_t i = 0; i < s_KeyCount; i++)
+        {
+            snprintf(buff, sizeof(buff), "entity_%llu", (unsigned long long)(nextRand() | 1));
+            keys.push_back(LvnString(buff));
+            stdKeys.push_back(std::string(buff));
+
+            snprintf(buff, sizeof(buff), "entity_%llu", (unsigned long long)(nextRand() & ~1ull));
+            missingKeys.push_back(LvnString(buff));
+            stdMissingKeys.push_back(std::string(buff));
+        }
+
+        LvnHashMap<LvnString, uint32_t> lvnMap;
+        std::unordered_map<std::string, uint32_t> stdMap;
+
+        BenchmarkResult lvnResult = runBenchmark(keys.data(), missingKeys.data(), s_KeyCount,
+            [&](const LvnString& key, uint32_t value) { lvnMap[key] = value; },
+            [&](const LvnString& key) { return lvnMap.find(key) != nullptr; },
+            [&](const LvnString& key) { lvnMap.erase(key); });
+
+        BenchmarkResult stdResult = runBenchmark(stdKeys.data(), stdMissingKeys.data(), s_KeyCount,
+            [&](const std::string& key, uint32_t value) { stdMap[key] = value; },
+            [&](const std::string& key) { return stdMap.find(key) != stdMap.end(); },
+            [&](const std::string& key) { stdMap.erase(key); });
+
+        printf("[string keys, %u]\n", s_KeyCount);
+        printResult("LvnHashMap", lvnResult);
+        printResult("std::unordered_map", stdResult);
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include <levikno/levikno.h>
+
+// NOTE: this program compares decoding a set of image files one after another with lvn::loadImageData against decoding them
+//       all at once with lvn::loadImagesBatch, the batch is run with an increasing number of job workers to show how the decode
+//       time scales with the core count
+//       the images are written to the current directory as jpg and png files before the timings and removed afterwards
+
+
+static const uint32_t s_ImageCount = 32;
+static const uint32_t s_ImageWidth = 2048;
+static const uint32_t s_ImageHeight = 2048;
+static const uint32_t s_Repeats = 3;      // the best time out of the repeats is reported
+static const uint32_t s_WorkerCounts[] = { 1, 2, 4, 8 };
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+// even images are written as jpg, odd images as png
+static void getFilepath(char* buff, size_t size, uint32_t index)
+{
+    snprintf(buff, size, "imageDecodeBenchmark_%u.%s", index, index % 2 ? "png" : "jpg");
+}
+
+static double decodeSequential()
+{
+    double best = 1e30;
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        uint64_t totalSize = 0;
+        for (uint32_t i = 0; i < s_ImageCount; i++)
+        {
+            char filepath[64];
+            getFilepath(filepath, sizeof(filepath), i);
+            totalSize += lvn::loadImageData(filepath, 4).size;
+        }
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+
+        if (totalSize != (uint64_t)s_ImageCount * s_ImageWidth * s_ImageHeight * 4)
+            printf("  [warning]: decoded %llu bytes, expected %llu\n", (unsigned long long)totalSize, (unsigned long long)s_ImageCount * s_ImageWidth * s_ImageHeight * 4);
+    }
+
+    return best;
+}
+
+static double decodeBatch()
+{
+    double best = 1e30;
+
+    char filepaths[s_ImageCount][64];
+    LvnImageLoadInfo loadInfos[s_ImageCount]{};
+    for (uint32_t i = 0; i < s_ImageCount; i++)
+    {
+        getFilepath(filepaths[i], sizeof(filepaths[i]), i);
+        loadInfos[i].filepath = filepaths[i];
+        loadInfos[i].forceChannels = 4;
+    }
+
+    LvnImageData images[s_ImageCount];
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        if (lvn::loadImagesBatch(loadInfos, s_ImageCount, images) != Lvn_Result_Success)
+            printf("  [warning]: some images failed to load\n");
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+
+        for (uint32_t i = 0; i < s_ImageCount; i++)
+            images[i] = {};
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    // write the images once, every worker count decodes the same files
+    {
+        LvnContextCreateInfo lvnCreateInfo{};
+        lvnCreateInfo.logging.enableLogging = true;
+        lvnCreateInfo.logging.disableCoreLogging = true;
+
+        lvn::createContext(&lvnCreateInfo);
+
+        LvnUniqueData<uint8_t> pixels(s_ImageWidth * s_ImageHeight * 4);
+
+        for (uint32_t i = 0; i < s_ImageCount; i++)
+        {
+            // smooth gradients with some noise so the files are close to the size of real textures
+            for (uint32_t y = 0; y < s_ImageHeight; y++)
+            {
+                for (uint32_t x = 0; x < s_ImageWidth; x++)
+                {
+                    uint8_t* px = &pixels[(y * s_ImageWidth + x) * 4];
+                    uint32_t noise = (x * 2654435761u ^ y * 40503u) >> 28;
+                    px[0] = (uint8_t)(x / 8 + i * 16 + noise);
+                    px[1] = (uint8_t)(y / 8 + noise);
+                    px[2] = (uint8_t)((x + y) / 16 + i * 8);
+                    px[3] = 255;
+                }
+            }
+
+            LvnImageData imageData{};
+            imageData.width = s_ImageWidth;
+            imageData.height = s_ImageHeight;
+            imageData.channels = 4;
+            imageData.size = pixels.size();
+            imageData.pixels = LvnData<uint8_t>(pixels.data(), pixels.size());
+
+            char filepath[64];
+            getFilepath(filepath, sizeof(filepath), i);
+
+            LvnResult result = i % 2 ? lvn::writeImagePng(imageData, filepath) : lvn::writeImageJpg(imageData, filepath, 90);
+            if (result != Lvn_Result_Success)
+            {
+                printf("cannot write image: %s\n", filepath);
+                lvn::terminateContext();
+                return -1;
+            }
+        }
+
+        lvn::terminateContext();
+    }
+
+    printf("[%u images, %ux%u, jpg and png]\n", s_ImageCount, s_ImageWidth, s_ImageHeight);
+
+    for (uint32_t i = 0; i < ARRAY_LEN(s_WorkerCounts); i++)
+    {
+        LvnContextCreateInfo lvnCreateInfo{};
+        lvnCreateInfo.logging.enableLogging = true;
+        lvnCreateInfo.logging.disableCoreLogging = true;
+        lvnCreateInfo.enableMultithreading = true;
+        lvnCreateInfo.jobWorkerCount = s_WorkerCounts[i];
+
+        lvn::createContext(&lvnCreateInfo);
+
+        if (i == 0)
+        {
+            double sequentialTime = decodeSequential();
+            printf("  loadImageData:              %8.2f ms, %6.2f ms per image\n", sequentialTime, sequentialTime / s_ImageCount);
+        }
+
+        double batchTime = decodeBatch();
+        printf("  loadImagesBatch (%u workers): %8.2f ms, %6.2f ms per image\n", lvn::jobGetWorkerCount(), batchTime, batchTime / s_ImageCount);
+
+        lvn::terminateContext();
+    }
+
+    for (uint32_t i = 0; i < s_ImageCount; i++)
+    {
+        char filepath[64];
+        getFilepath(filepath, sizeof(filepath), i);
+        remove(filepath);
+    }
+
+    return 0;
+}
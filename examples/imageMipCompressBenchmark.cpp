@@ -0,0 +1,130 @@
+#include <levikno/levikno.h>
+
+// NOTE: this program times building the mip chain of a texture on the cpu with lvn::imageGenMipLevels and compressing the full
+//       chain into bc blocks with lvn::imageCompress, the work is split across the job workers so the timings are repeated with an
+//       increasing number of workers
+//       the sizes show how much less memory and upload bandwidth the compressed chain takes compared to the rgba8 level 0 that
+//       textures were uploaded as before
+
+
+static const uint32_t s_Width = 2048;
+static const uint32_t s_Height = 2048;
+static const uint32_t s_Repeats = 3;      // the best time out of the repeats is reported
+static const uint32_t s_WorkerCounts[] = { 1, 2, 4, 8 };
+
+static const LvnTextureCompression s_Compressions[] = { Lvn_TextureCompression_Bc1, Lvn_TextureCompression_Bc3, Lvn_TextureCompression_Bc5, Lvn_TextureCompression_Bc7 };
+static const char* s_CompressionNames[] = { "none", "bc1", "bc3", "bc5", "bc7" };
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+static LvnImageData makeImage(LvnUniqueData<uint8_t>& pixels)
+{
+    // smooth gradients with some noise, close to the content of real color textures
+    for (uint32_t y = 0; y < s_Height; y++)
+    {
+        for (uint32_t x = 0; x < s_Width; x++)
+        {
+            uint8_t* px = &pixels[(y * s_Width + x) * 4];
+            uint32_t noise = (x * 2654435761u ^ y * 40503u) >> 28;
+            px[0] = (uint8_t)(x / 8 + noise);
+            px[1] = (uint8_t)(y / 8 + noise);
+            px[2] = (uint8_t)((x + y) / 16);
+            px[3] = (uint8_t)(255 - (x / 16 + noise));
+        }
+    }
+
+    LvnImageData imageData{};
+    imageData.width = s_Width;
+    imageData.height = s_Height;
+    imageData.channels = 4;
+    imageData.size = pixels.size();
+    imageData.pixels = LvnData<uint8_t>(pixels.data(), pixels.size());
+    return imageData;
+}
+
+static double timeMipLevels(const LvnImageData& imageData, LvnImageData* pMipLevels, uint32_t mipLevelCount, LvnImageMipFilter filter)
+{
+    double best = 1e30;
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+        lvn::imageGenMipLevels(imageData, pMipLevels, mipLevelCount, filter, Lvn_TextureFormat_Srgb);
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+    }
+
+    return best;
+}
+
+// compresses level 0 and every mip level, returns the best time and the size of the compressed chain
+static double timeCompress(const LvnImageData& imageData, const LvnImageData* pMipLevels, uint32_t mipLevelCount, LvnTextureCompression compression, uint64_t* size)
+{
+    double best = 1e30;
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        *size = lvn::imageCompress(imageData, compression).size;
+        for (uint32_t i = 0; i < mipLevelCount; i++)
+            *size += lvn::imageCompress(pMipLevels[i], compression).size;
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t mipLevelCount = lvn::imageGetMipLevelCount(s_Width, s_Height);
+
+    for (uint32_t i = 0; i < ARRAY_LEN(s_WorkerCounts); i++)
+    {
+        LvnContextCreateInfo lvnCreateInfo{};
+        lvnCreateInfo.logging.enableLogging = true;
+        lvnCreateInfo.logging.disableCoreLogging = true;
+        lvnCreateInfo.enableMultithreading = true;
+        lvnCreateInfo.jobWorkerCount = s_WorkerCounts[i];
+
+        lvn::createContext(&lvnCreateInfo);
+
+        // images are released before the context is terminated
+        {
+            LvnUniqueData<uint8_t> pixels(s_Width * s_Height * 4);
+            LvnImageData imageData = makeImage(pixels);
+            LvnVector<LvnImageData> mipLevels(mipLevelCount);
+
+            printf("[%ux%u rgba, %u mip levels, %u workers]\n", s_Width, s_Height, mipLevelCount, lvn::jobGetWorkerCount());
+
+            double boxTime = timeMipLevels(imageData, mipLevels.data(), mipLevelCount, Lvn_ImageMipFilter_Box);
+            double kaiserTime = timeMipLevels(imageData, mipLevels.data(), mipLevelCount, Lvn_ImageMipFilter_Kaiser);
+            printf("  imageGenMipLevels (srgb) box: %8.2f ms, kaiser: %8.2f ms\n", boxTime, kaiserTime);
+
+            uint64_t level0Size = imageData.size;
+            uint64_t chainSize = level0Size;
+            for (uint32_t j = 0; j < mipLevelCount; j++)
+                chainSize += mipLevels[j].size;
+
+            printf("  %-4s chain: %9llu bytes, rgba8 level 0 alone: %llu bytes\n", s_CompressionNames[0], (unsigned long long)chainSize, (unsigned long long)level0Size);
+
+            for (uint32_t j = 0; j < ARRAY_LEN(s_Compressions); j++)
+            {
+                uint64_t compressedSize = 0;
+                double compressTime = timeCompress(imageData, mipLevels.data(), mipLevelCount, s_Compressions[j], &compressedSize);
+
+                printf("  %-4s chain: %9llu bytes (%5.2fx smaller than the rgba8 level 0 alone), imageCompress: %8.2f ms\n",
+                    s_CompressionNames[s_Compressions[j]], (unsigned long long)compressedSize, (double)level0Size / compressedSize, compressTime);
+            }
+        }
+
+        lvn::terminateContext();
+    }
+
+    return 0;
+}
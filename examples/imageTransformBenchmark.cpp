@@ -0,0 +1,208 @@
+#include <levikno/levikno.h>
+
+#include <vector>
+
+// NOTE: this program compares the image transform functions against the previous per channel implementations on 4K images
+//       (the reference functions below), each result is checked against the reference output and the best time out of the
+//       repeats is reported
+//       build with LVN_ENABLE_AVX2 to compare the AVX2 kernels, otherwise the SSE2 kernels are used on x86
+
+
+static const uint32_t s_Width = 3840;
+static const uint32_t s_Height = 2160;
+static const uint32_t s_Repeats = 5;
+static const uint32_t s_Channels[] = { 1, 3, 4 };
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+static uint64_t s_RandState = 12345;
+
+static uint64_t nextRand()
+{
+    s_RandState ^= s_RandState << 13;
+    s_RandState ^= s_RandState >> 7;
+    s_RandState ^= s_RandState << 17;
+    return s_RandState;
+}
+
+static LvnImageData makeImage(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, uint32_t channels)
+{
+    LvnImageData imageData{};
+    imageData.width = width;
+    imageData.height = height;
+    imageData.channels = channels;
+    imageData.size = pixels.size();
+    imageData.pixels = LvnData<uint8_t>(pixels.data(), pixels.size());
+    return imageData;
+}
+
+static bool sameImage(const LvnImageData& a, const LvnImageData& b)
+{
+    return a.width == b.width && a.height == b.height && a.channels == b.channels &&
+        a.pixels.size() == b.pixels.size() && memcmp(a.pixels.data(), b.pixels.data(), a.pixels.size()) == 0;
+}
+
+
+// -- reference functions, pixels are moved one channel at a time
+// ------------------------------------------------------------
+
+static void refFlipHorizontally(LvnImageData& imageData)
+{
+    uint8_t* data = imageData.pixels.data();
+
+    for (uint32_t y = 0; y < imageData.height; y++)
+    {
+        uint8_t* row = data + y * imageData.width * imageData.channels;
+
+        for (uint32_t x = 0; x < imageData.width / 2; x++)
+        {
+            uint8_t* leftpx = row + x * imageData.channels;
+            uint8_t* rightpx = row + (imageData.width - x - 1) * imageData.channels;
+
+            for (uint32_t c = 0; c < imageData.channels; c++)
+            {
+                uint8_t temp = leftpx[c];
+                leftpx[c] = rightpx[c];
+                rightpx[c] = temp;
+            }
+        }
+    }
+}
+
+static void refRotate(LvnImageData& imageData, bool clockwise)
+{
+    const uint8_t* data = static_cast<const LvnData<uint8_t>&>(imageData.pixels).data();
+    uint32_t newWidth = imageData.height;
+    uint32_t newHeight = imageData.width;
+
+    LvnVector<uint8_t> rotated(newWidth * newHeight * imageData.channels);
+
+    for (uint32_t y = 0; y < imageData.height; y++)
+    {
+        for (uint32_t x = 0; x < imageData.width; x++)
+        {
+            for (uint32_t c = 0; c < imageData.channels; c++)
+            {
+                uint32_t srcIndex = (y * imageData.width + x) * imageData.channels + c;
+                uint32_t dstx = clockwise ? imageData.height - 1 - y : y;
+                uint32_t dsty = clockwise ? x : imageData.width - 1 - x;
+                uint32_t dstIndex = (dsty * newWidth + dstx) * imageData.channels + c;
+                rotated[dstIndex] = data[srcIndex];
+            }
+        }
+    }
+
+    imageData.pixels = LvnData<uint8_t>(rotated.data(), rotated.size());
+    imageData.width = newWidth;
+    imageData.height = newHeight;
+}
+
+static void refRotateCW(LvnImageData& imageData) { refRotate(imageData, true); }
+static void refRotateCCW(LvnImageData& imageData) { refRotate(imageData, false); }
+
+static void refRgbToRgba(LvnImageData& imageData)
+{
+    const uint8_t* data = static_cast<const LvnData<uint8_t>&>(imageData.pixels).data();
+    LvnVector<uint8_t> converted(imageData.width * imageData.height * 4);
+
+    for (uint32_t i = 0; i < imageData.width * imageData.height; i++)
+    {
+        for (uint32_t c = 0; c < 3; c++)
+            converted[i * 4 + c] = data[i * 3 + c];
+        converted[i * 4 + 3] = 255;
+    }
+
+    imageData.pixels = LvnData<uint8_t>(converted.data(), converted.size());
+    imageData.channels = 4;
+    imageData.size = converted.size();
+}
+
+static void refRgbaToBgra(LvnImageData& imageData)
+{
+    uint8_t* data = imageData.pixels.data();
+
+    for (uint32_t i = 0; i < imageData.width * imageData.height; i++)
+    {
+        uint8_t temp = data[i * 4];
+        data[i * 4] = data[i * 4 + 2];
+        data[i * 4 + 2] = temp;
+    }
+}
+
+static void refPremultiplyAlpha(LvnImageData& imageData)
+{
+    uint8_t* data = imageData.pixels.data();
+
+    for (uint32_t i = 0; i < imageData.width * imageData.height; i++)
+    {
+        uint32_t alpha = data[i * 4 + 3];
+        for (uint32_t c = 0; c < 3; c++)
+            data[i * 4 + c] = (uint8_t)((data[i * 4 + c] * alpha + 127) / 255);
+    }
+}
+
+static void rgbToRgba(LvnImageData& imageData) { lvn::imageConvertChannels(imageData, 4); }
+static void rgbaToBgra(LvnImageData& imageData) { static const uint32_t bgra[] = { 2, 1, 0, 3 }; lvn::imageSwizzle(imageData, bgra); }
+
+
+// -- benchmark
+// ------------------------------------------------------------
+
+// the image is recreated from the source pixels before every run so each run starts from the same unshared image
+static double timeTransform(const std::vector<uint8_t>& pixels, uint32_t channels, void (*transformFunc)(LvnImageData&), LvnImageData* result)
+{
+    double best = 1e30;
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnImageData imageData = makeImage(pixels, s_Width, s_Height, channels);
+
+        LvnTimer timer;
+        timer.begin();
+        transformFunc(imageData);
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+
+        if (r == 0) *result = imageData;
+    }
+
+    return best;
+}
+
+static void compareTransform(const char* name, const std::vector<uint8_t>& pixels, uint32_t channels, void (*refFunc)(LvnImageData&), void (*func)(LvnImageData&))
+{
+    LvnImageData refResult, result;
+    double refTime = timeTransform(pixels, channels, refFunc, &refResult);
+    double time = timeTransform(pixels, channels, func, &result);
+
+    printf("  %-24s reference: %8.2f ms, levikno: %8.2f ms, %5.2fx%s\n", name, refTime, time, refTime / time, sameImage(refResult, result) ? "" : "  [mismatch]");
+}
+
+int main(int argc, char** argv)
+{
+    for (uint32_t i = 0; i < ARRAY_LEN(s_Channels); i++)
+    {
+        uint32_t channels = s_Channels[i];
+
+        std::vector<uint8_t> pixels((size_t)s_Width * s_Height * channels);
+        for (size_t j = 0; j < pixels.size(); j++)
+            pixels[j] = (uint8_t)nextRand();
+
+        printf("[%ux%u, %u channels]\n", s_Width, s_Height, channels);
+        compareTransform("imageFlipHorizontally", pixels, channels, refFlipHorizontally, lvn::imageFlipHorizontally);
+        compareTransform("imageRotateCW", pixels, channels, refRotateCW, lvn::imageRotateCW);
+        compareTransform("imageRotateCCW", pixels, channels, refRotateCCW, lvn::imageRotateCCW);
+
+        if (channels == 3)
+            compareTransform("imageConvertChannels", pixels, channels, refRgbToRgba, rgbToRgba);
+
+        if (channels == 4)
+        {
+            compareTransform("imageSwizzle", pixels, channels, refRgbaToBgra, rgbaToBgra);
+            compareTransform("imagePremultiplyAlpha", pixels, channels, refPremultiplyAlpha, lvn::imagePremultiplyAlpha);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <levikno/levikno.h>
+
+// NOTE: this program measures how many log messages per second are formatted into a log pattern with lvn::logFormatMessage
+//       the messages are only formatted and not printed so that the timings do not include writing to the console
+//       the default pattern "[%Y-%m-%d] [%T] [%#%l%^] %n: %v%$" is measured with and without the ANSI color codes
+
+
+static const uint32_t s_MessageCount = 1000000;
+static const uint32_t s_Repeats = 3;      // the best time out of the repeats is reported
+
+static const char* s_Patterns[] =
+{
+    "[%Y-%m-%d] [%T] [%#%l%^] %n: %v%$",
+    "%v%$",
+    "[%A %d %B %Y] [%t %P] [%l] %n: %v%$",
+};
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+static double formatMessages(LvnLogger* logger, bool removeANSI)
+{
+    double best = 1e30;
+    size_t totalSize = 0;
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        for (uint32_t i = 0; i < s_MessageCount; i++)
+        {
+            LvnString msg = lvn::logFormatMessage(logger, Lvn_LogLevel_Info, "a log message from the render loop", removeANSI);
+            totalSize += msg.size();
+        }
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+    }
+
+    if (totalSize == 0)
+        printf("  [warning]: no output was formatted\n");
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.logging.disableCoreLogging = true;
+
+    lvn::createContext(&lvnCreateInfo);
+
+    LvnLogger* logger = lvn::logGetClientLogger();
+
+    printf("[%u messages]\n", s_MessageCount);
+    for (uint32_t i = 0; i < ARRAY_LEN(s_Patterns); i++)
+    {
+        lvn::logSetPatternFormat(logger, s_Patterns[i]);
+
+        double ansiTime = formatMessages(logger, false);
+        double plainTime = formatMessages(logger, true);
+
+        printf("  \"%s\"\n", s_Patterns[i]);
+        printf("    with ANSI:    %7.2f ns, %12.0f messages/sec\n", ansiTime * 1e6 / s_MessageCount, s_MessageCount / (ansiTime / 1000.0));
+        printf("    without ANSI: %7.2f ns, %12.0f messages/sec\n", plainTime * 1e6 / s_MessageCount, s_MessageCount / (plainTime / 1000.0));
+    }
+
+    lvn::terminateContext();
+
+    return 0;
+}
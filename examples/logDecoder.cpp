@@ -0,0 +1,43 @@
+#include <cstdio>
+#include <levikno/levikno.h>
+
+// NOTE: this program decodes a binary log file written with Lvn_LogFileFormat_Binary back into text
+//       usage: logDecoder <binary log file> [output file] [pattern format]
+//       messages are written with the pattern of the logger that wrote them unless a pattern format is given,
+//       the file must be decoded on a machine with the same architecture as the one that wrote it
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        printf("usage: %s <binary log file> [output file] [pattern format]\n", argv[0]);
+        return 1;
+    }
+
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+
+    lvn::createContext(&lvnCreateInfo);
+
+    FILE* output = stdout;
+    if (argc > 2)
+    {
+        output = fopen(argv[2], "w");
+        if (!output)
+        {
+            printf("failed to open output file: %s\n", argv[2]);
+            lvn::terminateContext();
+            return 1;
+        }
+    }
+
+    LvnResult result = lvn::logDecodeBinaryFile(argv[1], output, argc > 3 ? argv[3] : nullptr);
+
+    if (output != stdout)
+        fclose(output);
+
+    lvn::terminateContext();
+
+    return result == Lvn_Result_Success ? 0 : 1;
+}
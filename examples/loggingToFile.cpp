@@ -63,6 +63,19 @@ int main(int argc, char** argv)
     lvn::logMessageInfo(logger, "our custom logger output");
     lvn::logMessageWarn(logger, "more log outputs...");
 
+
+    printf("\n");
+
+    // binary log files store the raw message arguments instead of formatted text, which keeps long traced runs small
+    // the file can be turned back into text with lvn::logDecodeBinaryFile or the logDecoder example
+    lvn::logSetFileConfig(logger, true, "logToFileExample.lvnlog", Lvn_FileMode_Write, Lvn_LogFileFormat_Binary);
+
+    for (int i = 0; i < 5; i++)
+        lvn::logMessageTrace(logger, "frame %d took %.3f ms", i, 16.6 + i * 0.1);
+
+    lvn::logSetFileConfig(logger, false);
+    lvn::logDecodeBinaryFile("logToFileExample.lvnlog", stdout);
+
     // terminate context
     lvn::terminateContext();
 
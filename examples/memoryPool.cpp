@@ -16,13 +16,14 @@
 // The base memory block is further divided again into smaller sections for each sType, a LvnMemoryBinding manages the number of objects
 // allocated for this sType with the chunk is it given within the memory blocks
 //
-// When a memory binding is full (all allocations within the binding have been used), a second binding and memory block will be created that is linked
-// at the end of the first binding
+// When a memory binding is full (all allocations within the binding have been used), a new memory block will be allocated for the binding
+// and objects will be taken from the new block from then on
 //
 // Note that further block memories created after the base memory block will be seperate for each sType
 //
-// Later on when an object is destroyed, the memory index of that object will be returned back to the memory binding to be used later again when
-// another object of the same type is created.
+// Later on when an object is destroyed, the memory of that object will be pushed onto the free list of the memory binding to be used later again when
+// another object of the same type is created. The free list is stored within the memory of the destroyed objects themselves, so creating
+// and destroying objects takes constant time and never allocates.
 //
 //
 //  Base Memory Block:
@@ -32,8 +33,8 @@
 //            /-------------------------------------\ /----------------------\ /-------\
 //                  v                                            v
 //           +---------------------------------------+------------------------+---------+
-//  memory:  | X  |    |    |    |    |    |    |    | X  | X  |    |    |    | X  | X  |   <---- Logger LvnBinding is full, levikno allocates a second memory block/binding
-//           +---------------------------------------+------------------------+---------+         and links the second binding to the end of the first
+//  memory:  | X  |    |    |    |    |    |    |    | X  | X  |    |    |    | X  | X  |   <---- Logger LvnBinding is full, levikno allocates a new memory block
+//           +---------------------------------------+------------------------+---------+         for the logger binding
 //  count:   | 1    2    3    4    5    6    7    8  | 1    2    3    4    5  | 1    2
 //                                                |                        |         |
 //                     +--------------------------+                        |         |
@@ -0,0 +1,148 @@
+#include <levikno/levikno.h>
+
+#include <vector>
+
+// NOTE: this program measures the cost of creating and destroying objects with each memory allocation mode
+//       objects are created and destroyed in a random order while keeping a number of them alive to churn through the memory pool free lists
+//
+//       loggers have no api resources so their timings show the cost of the object allocation itself,
+//       buffers, textures and sounds include the cost of creating the graphics and audio resources
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+static const uint32_t s_LiveObjectCount = 64;      // number of objects kept alive during churn
+static const uint32_t s_LoggerIterations = 200000;
+static const uint32_t s_BufferIterations = 20000;
+static const uint32_t s_TextureIterations = 2000;
+static const uint32_t s_SoundIterations = 2000;
+
+
+static uint32_t s_RandState = 12345;
+
+static uint32_t nextRand()
+{
+    s_RandState = s_RandState * 1664525u + 1013904223u;
+    return s_RandState >> 8;
+}
+
+// replaces a random live object with a newly created one for each iteration, returns the average time in microseconds per create/destroy pair
+template <typename T, typename CreateFunc, typename DestroyFunc>
+static double churn(uint32_t iterations, CreateFunc createFunc, DestroyFunc destroyFunc)
+{
+    std::vector<T*> objects(s_LiveObjectCount);
+    for (uint32_t i = 0; i < s_LiveObjectCount; i++)
+        createFunc(&objects[i]);
+
+    LvnTimer timer;
+    timer.begin();
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        uint32_t index = nextRand() % s_LiveObjectCount;
+        destroyFunc(objects[index]);
+        createFunc(&objects[index]);
+    }
+
+    double elapsed = timer.elapsedms();
+
+    for (uint32_t i = 0; i < s_LiveObjectCount; i++)
+        destroyFunc(objects[i]);
+
+    return elapsed * 1000.0 / iterations;
+}
+
+static void runBenchmark(LvnMemAllocMode memAllocMode, const char* name)
+{
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.windowapi = Lvn_WindowApi_glfw;
+    lvnCreateInfo.graphicsapi = Lvn_GraphicsApi_vulkan;
+    lvnCreateInfo.memoryInfo.memAllocMode = memAllocMode;
+
+    // size the pool so that the live objects fit in the base memory block, the churn then only uses the free lists
+    LvnMemoryBindingInfo memoryBindings[] =
+    {
+        { Lvn_Stype_Logger, s_LiveObjectCount },
+        { Lvn_Stype_Buffer, s_LiveObjectCount },
+        { Lvn_Stype_Texture, s_LiveObjectCount },
+        { Lvn_Stype_Sound, s_LiveObjectCount },
+    };
+
+    lvnCreateInfo.memoryInfo.pMemoryBindings = memoryBindings;
+    lvnCreateInfo.memoryInfo.memoryBindingCount = ARRAY_LEN(memoryBindings);
+
+    lvn::createContext(&lvnCreateInfo);
+
+    LvnWindowCreateInfo windowInfo = lvn::configWindowInit("memoryPoolBenchmark", 800, 600);
+    LvnWindow* window;
+    lvn::createWindow(&window, &windowInfo);
+
+
+    // loggers
+    LvnLoggerCreateInfo loggerCreateInfo{};
+    loggerCreateInfo.loggerName = "benchmark";
+    loggerCreateInfo.level = Lvn_LogLevel_None;
+    loggerCreateInfo.format = "[%T] [%l]: %v%$";
+
+    double loggerTime = churn<LvnLogger>(s_LoggerIterations,
+        [&](LvnLogger** logger) { lvn::createLogger(logger, &loggerCreateInfo); },
+        [](LvnLogger* logger) { lvn::destroyLogger(logger); });
+
+
+    // buffers
+    float vertices[] = { 0.0f, 0.5f, 0.0f, -0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f };
+
+    LvnBufferCreateInfo bufferCreateInfo{};
+    bufferCreateInfo.type = Lvn_BufferType_Vertex;
+    bufferCreateInfo.usage = Lvn_BufferUsage_Static;
+    bufferCreateInfo.data = vertices;
+    bufferCreateInfo.size = sizeof(vertices);
+
+    double bufferTime = churn<LvnBuffer>(s_BufferIterations,
+        [&](LvnBuffer** buffer) { lvn::createBuffer(buffer, &bufferCreateInfo); },
+        [](LvnBuffer* buffer) { lvn::destroyBuffer(buffer); });
+
+
+    // textures
+    LvnTextureCreateInfo textureCreateInfo{};
+    textureCreateInfo.imageData = lvn::imageGenWhiteNoise(16, 16, 4, 0);
+    textureCreateInfo.format = Lvn_TextureFormat_Unorm;
+    textureCreateInfo.wrapS = Lvn_TextureMode_Repeat;
+    textureCreateInfo.wrapT = Lvn_TextureMode_Repeat;
+    textureCreateInfo.minFilter = Lvn_TextureFilter_Nearest;
+    textureCreateInfo.magFilter = Lvn_TextureFilter_Nearest;
+
+    double textureTime = churn<LvnTexture>(s_TextureIterations,
+        [&](LvnTexture** texture) { lvn::createTexture(texture, &textureCreateInfo); },
+        [](LvnTexture* texture) { lvn::destroyTexture(texture); });
+
+
+    // sounds
+    LvnSoundCreateInfo soundCreateInfo{};
+    soundCreateInfo.filepath = "res/audio/beep.wav";
+    soundCreateInfo.volume = 1.0f;
+    soundCreateInfo.pitch = 1.0f;
+
+    double soundTime = churn<LvnSound>(s_SoundIterations,
+        [&](LvnSound** sound) { lvn::createSound(sound, &soundCreateInfo); },
+        [](LvnSound* sound) { lvn::destroySound(sound); });
+
+
+    lvn::destroyWindow(window);
+    lvn::terminateContext();
+
+    printf("[%s]\n", name);
+    printf("  logger:  %8.3f us per create/destroy (%u iterations)\n", loggerTime, s_LoggerIterations);
+    printf("  buffer:  %8.3f us per create/destroy (%u iterations)\n", bufferTime, s_BufferIterations);
+    printf("  texture: %8.3f us per create/destroy (%u iterations)\n", textureTime, s_TextureIterations);
+    printf("  sound:   %8.3f us per create/destroy (%u iterations)\n", soundTime, s_SoundIterations);
+}
+
+int main(int argc, char** argv)
+{
+    runBenchmark(Lvn_MemAllocMode_Individual, "individual");
+    runBenchmark(Lvn_MemAllocMode_MemPool, "memory pool");
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <levikno/lvn_renderer.h>
+
+// NOTE: this program compares loading the example models with lvn::loadModel against loading the same models from a scene pack
+//       with lvn::loadPack and lvn::packCreateModel, the pack is baked at the start with lvn::bakePack (the same as the levikno-bake
+//       tool) with the full mip chain of every texture compressed into bc7 blocks
+//       loadModel parses the json, decodes the images, converts the attributes to floats and calculates the tangents on every load,
+//       the pack is mapped and its buffers and textures are created straight from the mapped pages
+//       cold is the first load of the files in the process and warm is the best of the repeats after it, the files are read from the
+//       os file cache in both cases unless the cache is dropped before the program is run (eg. echo 3 > /proc/sys/vm/drop_caches)
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+static const char* s_ModelFilepaths[] =
+{
+    "res/models/eightBall/scene.gltf",
+    "res/models/teapot/teapot.gltf",
+    "res/models/sphere.glb",
+};
+
+static const char* s_PackFilepath = "packLoadBenchmark.lvnpack";
+static const uint32_t s_Repeats = 5;      // the best time out of the repeats is reported as the warm time
+
+
+static double loadModels()
+{
+    LvnTimer timer;
+    timer.begin();
+
+    LvnModel models[ARRAY_LEN(s_ModelFilepaths)];
+    for (uint32_t i = 0; i < ARRAY_LEN(s_ModelFilepaths); i++)
+        models[i] = lvn::loadModel(s_ModelFilepaths[i]);
+
+    double elapsed = timer.elapsedms();
+
+    for (uint32_t i = 0; i < ARRAY_LEN(s_ModelFilepaths); i++)
+        lvn::unloadModel(&models[i]);
+
+    return elapsed;
+}
+
+static double loadPackModels()
+{
+    LvnTimer timer;
+    timer.begin();
+
+    LvnPack* pack = lvn::loadPack(s_PackFilepath);
+    if (!pack) { return 0.0; }
+
+    LvnModel models[ARRAY_LEN(s_ModelFilepaths)];
+    for (uint32_t i = 0; i < lvn::packGetModelCount(pack); i++)
+        models[i] = lvn::packCreateModel(pack, i);
+
+    double elapsed = timer.elapsedms();
+
+    for (uint32_t i = 0; i < lvn::packGetModelCount(pack); i++)
+        lvn::unloadModel(&models[i]);
+
+    lvn::unloadPack(pack);
+    return elapsed;
+}
+
+static double bestOf(double (*func)())
+{
+    double best = 1e30;
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        double elapsed = func();
+        if (elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.logging.disableCoreLogging = true;
+    lvnCreateInfo.windowapi = Lvn_WindowApi_glfw;
+    lvnCreateInfo.graphicsapi = Lvn_GraphicsApi_opengl;
+    lvnCreateInfo.enableMultithreading = true;
+
+    lvn::createContext(&lvnCreateInfo);
+
+    lvn::renderInit("packLoadBenchmark", 800, 600);
+
+    // the pack is baked before any timing so that its file is as cold as the model files
+    LvnPackBakeInfo bakeInfo{};
+    bakeInfo.pModelFilepaths = s_ModelFilepaths;
+    bakeInfo.modelCount = ARRAY_LEN(s_ModelFilepaths);
+    bakeInfo.genMipLevels = true;
+    bakeInfo.mipFilter = Lvn_ImageMipFilter_Box;
+    bakeInfo.compression = Lvn_TextureCompression_Bc7;
+
+    LvnTimer bakeTimer;
+    bakeTimer.begin();
+
+    if (lvn::bakePack(&bakeInfo, s_PackFilepath) != Lvn_Result_Success)
+    {
+        printf("cannot bake pack: %s\n", s_PackFilepath);
+        lvn::terminateContext();
+        return -1;
+    }
+
+    double bakeTime = bakeTimer.elapsedms();
+
+    printf("[%u models, baked into %s in %.2f ms]\n", (uint32_t)ARRAY_LEN(s_ModelFilepaths), s_PackFilepath, bakeTime);
+
+    double modelColdTime = loadModels();
+    double packColdTime = loadPackModels();
+    double modelWarmTime = bestOf(loadModels);
+    double packWarmTime = bestOf(loadPackModels);
+
+    printf("  loadModel (json, decode, tangents):   cold %8.2f ms, warm %8.2f ms\n", modelColdTime, modelWarmTime);
+    printf("  loadPack + packCreateModel (mapped):  cold %8.2f ms, warm %8.2f ms\n", packColdTime, packWarmTime);
+    printf("  pack loads %.1fx faster cold, %.1fx faster warm\n", modelColdTime / packColdTime, modelWarmTime / packWarmTime);
+
+    lvn::terminateContext();
+
+    remove(s_PackFilepath);
+
+    return 0;
+}
@@ -1384,7 +1384,10 @@ int main()
         fps++;
         if (timer.elapsed() >= 1.0f)
         {
-            LVN_TRACE("FPS: %d", fps);
+            LvnFrameStats frameStats = lvn::renderGetFrameStats(window);
+            LVN_TRACE("FPS: %d, frame time (ms) min: %.2f, avg: %.2f, max: %.2f, p99: %.2f, draw calls: %u, uploaded: %llu bytes",
+                fps, frameStats.minFrameTimeMs, frameStats.avgFrameTimeMs, frameStats.maxFrameTimeMs, frameStats.p99FrameTimeMs,
+                frameStats.drawCallCount, (unsigned long long)frameStats.bufferUploadBytes);
             timer.reset();
             fps = 0;
         }
@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <levikno/levikno.h>
+
+// INFO: this example shows how to profile code with LVN_PROFILE_SCOPE and read the results
+//       zones are shown per frame with lvn::profileGetFrameSummary and exported to a chrome trace file
+//       open profileTrace.json in chrome://tracing or https://ui.perfetto.dev to see every zone on a timeline
+
+
+static const uint32_t s_FrameCount = 120;
+static const uint32_t s_ParticleCount = 200000;
+
+static float s_Positions[s_ParticleCount];
+static float s_Velocities[s_ParticleCount];
+
+static void updateParticles(float dt)
+{
+    LVN_PROFILE_FUNCTION();
+
+    // zones recorded on the job workers show up on their own threads in the trace
+    lvn::jobParallelFor(s_ParticleCount, 0, [dt](uint32_t begin, uint32_t end)
+    {
+        LVN_PROFILE_SCOPE("updateParticles batch");
+        for (uint32_t i = begin; i < end; i++)
+        {
+            s_Velocities[i] -= 9.81f * dt;
+            s_Positions[i] += s_Velocities[i] * dt;
+        }
+    });
+}
+
+static void buildDrawList(uint32_t frame)
+{
+    LVN_PROFILE_FUNCTION();
+
+    // every 30th frame does extra work to show what a hitch looks like in the summary
+    LvnTimer timer;
+    timer.begin();
+    double ms = frame % 30 == 0 ? 4.0 : 0.5;
+    while (timer.elapsedms() < ms) {}
+}
+
+int main(int argc, char** argv)
+{
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.enableMultithreading = true;
+    lvnCreateInfo.profiling.enableProfiling = true; // zones are recorded from context creation
+
+    lvn::createContext(&lvnCreateInfo);
+
+    // frames are marked by lvn::renderBeginNextFrame and lvn::renderDrawSubmit when rendering to a window,
+    // this example has no window so the frames are marked manually
+    for (uint32_t frame = 0; frame < s_FrameCount; frame++)
+    {
+        lvn::profileBeginFrame();
+
+        updateParticles(1.0f / 60.0f);
+        buildDrawList(frame);
+
+        lvn::profileEndFrame();
+    }
+
+    // summary of the last completed frame, zones are sorted by their total time
+    LvnProfileFrameStats frameStats{};
+    uint32_t zoneCount = 0;
+    lvn::profileGetFrameSummary(&frameStats, nullptr, &zoneCount);
+
+    LvnVector<LvnProfileZoneStats> zones(zoneCount);
+    lvn::profileGetFrameSummary(&frameStats, zones.data(), &zoneCount);
+
+    LVN_INFO("frame %llu: cpu %.3f ms, frame %.3f ms, %u zones", (unsigned long long)frameStats.frameIndex, frameStats.cpuMs, frameStats.frameMs, frameStats.zoneCount);
+    for (uint32_t i = 0; i < zoneCount; i++)
+        LVN_INFO("  %-24s depth %u, calls %4u, total %.3f ms, max %.3f ms", zones[i].name, zones[i].depth, zones[i].callCount, zones[i].totalMs, zones[i].maxMs);
+
+    if (lvn::profileExportChromeTrace("profileTrace.json") == Lvn_Result_Success)
+        LVN_INFO("wrote profileTrace.json");
+
+    lvn::terminateContext();
+
+    return 0;
+}
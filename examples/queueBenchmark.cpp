@@ -0,0 +1,111 @@
+#include <levikno/levikno.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// NOTE: this program measures the throughput of passing items between threads through LvnSpscQueue, LvnMpmcQueue
+//       and an LvnQueue guarded by an LvnMutex, each test runs 1 to N producer threads against a single consumer thread
+//       timings are the average in nanoseconds per item moved from a producer to the consumer
+
+
+static const uint32_t s_ItemsPerProducer = 1000000;
+static const uint32_t s_QueueCapacity = 4096;
+static const uint32_t s_ProducerCounts[] = { 1, 2, 4, 8 };
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+class MutexQueue
+{
+private:
+    LvnQueue<uint64_t> m_Queue;
+    LvnMutex m_Mutex;
+
+public:
+    bool push(uint64_t value)
+    {
+        LvnLockGaurd lock(m_Mutex);
+        if (m_Queue.size() >= s_QueueCapacity) { return false; }
+        m_Queue.push(value);
+        return true;
+    }
+
+    bool pop(uint64_t& value)
+    {
+        LvnLockGaurd lock(m_Mutex);
+        if (m_Queue.empty()) { return false; }
+        value = m_Queue.front();
+        m_Queue.pop();
+        return true;
+    }
+};
+
+// every producer pushes its items while the consumer pops until all items arrive, the sum is checked so no item is lost
+template <typename Queue>
+static double runBenchmark(Queue& queue, uint32_t producerCount)
+{
+    uint64_t itemCount = (uint64_t)s_ItemsPerProducer * producerCount;
+    uint64_t sum = 0;
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < producerCount; p++)
+    {
+        producers.emplace_back([&queue, &start]()
+        {
+            while (!start.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+            for (uint32_t i = 1; i <= s_ItemsPerProducer; i++)
+                while (!queue.push(i)) { std::this_thread::yield(); }
+        });
+    }
+
+    LvnTimer timer;
+    timer.begin();
+    start.store(true, std::memory_order_release);
+
+    uint64_t value;
+    for (uint64_t received = 0; received < itemCount;)
+    {
+        if (queue.pop(value)) { sum += value; received++; }
+        else { std::this_thread::yield(); }
+    }
+
+    double elapsed = timer.elapsedms();
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    uint64_t expected = (uint64_t)s_ItemsPerProducer * (s_ItemsPerProducer + 1) / 2 * producerCount;
+    if (sum != expected)
+        printf("  [warning]: sum of items %llu, expected %llu\n", (unsigned long long)sum, (unsigned long long)expected);
+
+    return elapsed * 1e6 / itemCount;
+}
+
+int main(int argc, char** argv)
+{
+    printf("[%u items per producer, capacity %u, 1 consumer]\n", s_ItemsPerProducer, s_QueueCapacity);
+
+    // single producer only
+    {
+        LvnSpscQueue<uint64_t> queue(s_QueueCapacity);
+        printf("  %u producer   LvnSpscQueue:          %7.2f ns\n", 1, runBenchmark(queue, 1));
+    }
+
+    for (uint32_t i = 0; i < ARRAY_LEN(s_ProducerCounts); i++)
+    {
+        uint32_t producerCount = s_ProducerCounts[i];
+
+        LvnMpmcQueue<uint64_t> mpmcQueue(s_QueueCapacity);
+        double mpmcTime = runBenchmark(mpmcQueue, producerCount);
+
+        MutexQueue mutexQueue;
+        double mutexTime = runBenchmark(mutexQueue, producerCount);
+
+        printf("  %u producers  LvnMpmcQueue: %7.2f ns   LvnQueue + LvnMutex: %7.2f ns\n", producerCount, mpmcTime, mutexTime);
+    }
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include <levikno/levikno.h>
+
+#include <thread>
+#include <vector>
+
+// NOTE: this program compares the slab allocator (Lvn_MemAllocator_SlabCache) against malloc and free
+//       blocks of random small sizes are allocated and freed in a random order while keeping a number of them alive, first on one
+//       thread and then on several threads at once, and a last test frees on another thread the blocks allocated by the main thread
+//       the slab allocator is called through lvn::getMemAllocFunc and lvn::getMemFreeFunc so the timings do not include the
+//       allocation counting of lvn::memAlloc, timings are the average in nanoseconds per alloc/free pair
+
+
+static const uint32_t s_LiveBlockCount = 1024;     // number of blocks kept alive during churn
+static const uint32_t s_Iterations = 4000000;
+static const uint32_t s_ThreadCount = 4;
+static const uint32_t s_MaxBlockSize = 512;        // sizes are picked from 8 to s_MaxBlockSize bytes, all within the slab size classes
+
+
+struct Allocator
+{
+    void* (*allocFunc)(size_t size, void* userData);
+    void (*freeFunc)(void* ptr, void* userData);
+    void* userData;
+};
+
+static void* mallocWrapper(size_t size, void* userData) { (void)userData; return malloc(size); }
+static void freeWrapper(void* ptr, void* userData) { (void)userData; free(ptr); }
+
+static uint32_t nextRand(uint32_t* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// replaces a random live block with a new block of a random size for each iteration
+static void churn(const Allocator& allocator, uint32_t iterations, uint32_t seed)
+{
+    uint32_t randState = seed;
+    std::vector<void*> blocks(s_LiveBlockCount);
+    for (uint32_t i = 0; i < s_LiveBlockCount; i++)
+        blocks[i] = allocator.allocFunc(8 + nextRand(&randState) % (s_MaxBlockSize - 8), allocator.userData);
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        uint32_t index = nextRand(&randState) % s_LiveBlockCount;
+        allocator.freeFunc(blocks[index], allocator.userData);
+
+        size_t size = 8 + nextRand(&randState) % (s_MaxBlockSize - 8);
+        blocks[index] = allocator.allocFunc(size, allocator.userData);
+        *static_cast<volatile uint8_t*>(blocks[index]) = static_cast<uint8_t>(i); // touch the block so it is not optimized out
+    }
+
+    for (uint32_t i = 0; i < s_LiveBlockCount; i++)
+        allocator.freeFunc(blocks[i], allocator.userData);
+}
+
+static double churnSingleThread(const Allocator& allocator)
+{
+    LvnTimer timer;
+    timer.begin();
+
+    churn(allocator, s_Iterations, 12345);
+
+    return timer.elapsedms() * 1e6 / s_Iterations;
+}
+
+static double churnMultiThread(const Allocator& allocator)
+{
+    uint32_t iterations = s_Iterations / s_ThreadCount;
+
+    LvnTimer timer;
+    timer.begin();
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < s_ThreadCount; i++)
+        threads.emplace_back(churn, allocator, iterations, 12345 + i);
+    for (std::thread& thread : threads)
+        thread.join();
+
+    return timer.elapsedms() * 1e6 / (iterations * s_ThreadCount);
+}
+
+// the main thread allocates every block and a second thread frees them, the slab allocator returns them to the owning thread's slabs
+static double remoteFree(const Allocator& allocator)
+{
+    uint32_t randState = 12345;
+    std::vector<void*> blocks(s_Iterations / 4);
+
+    LvnTimer timer;
+    timer.begin();
+
+    for (uint32_t i = 0; i < blocks.size(); i++)
+        blocks[i] = allocator.allocFunc(8 + nextRand(&randState) % (s_MaxBlockSize - 8), allocator.userData);
+
+    std::thread thread([&]()
+    {
+        for (uint32_t i = 0; i < blocks.size(); i++)
+            allocator.freeFunc(blocks[i], allocator.userData);
+    });
+    thread.join();
+
+    return timer.elapsedms() * 1e6 / blocks.size();
+}
+
+static void printResult(const char* name, double single, double multi, double remote)
+{
+    printf("  %-8s single thread: %7.2f ns, %u threads: %7.2f ns, remote free: %7.2f ns\n", name, single, s_ThreadCount, multi, remote);
+}
+
+int main(int argc, char** argv)
+{
+    Allocator mallocAllocator = { mallocWrapper, freeWrapper, nullptr };
+
+    double mallocSingle = churnSingleThread(mallocAllocator);
+    double mallocMulti = churnMultiThread(mallocAllocator);
+    double mallocRemote = remoteFree(mallocAllocator);
+
+    // the slab allocator is installed by the context and stays installed after the context is terminated
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.logging.disableCoreLogging = true;
+    lvnCreateInfo.memoryInfo.allocator = Lvn_MemAllocator_SlabCache;
+
+    lvn::createContext(&lvnCreateInfo);
+
+    Allocator slabAllocator = { lvn::getMemAllocFunc(), lvn::getMemFreeFunc(), lvn::getMemUserData() };
+
+    double slabSingle = churnSingleThread(slabAllocator);
+    double slabMulti = churnMultiThread(slabAllocator);
+    double slabRemote = remoteFree(slabAllocator);
+
+    uint32_t statCount = 0;
+    lvn::memGetSlabStats(nullptr, &statCount);
+    std::vector<LvnMemSlabStats> stats(statCount);
+    lvn::memGetSlabStats(stats.data(), &statCount);
+
+    lvn::terminateContext();
+
+    printf("[%u live blocks, 8 to %u bytes, %u iterations]\n", s_LiveBlockCount, s_MaxBlockSize, s_Iterations);
+    printResult("malloc", mallocSingle, mallocMulti, mallocRemote);
+    printResult("slab", slabSingle, slabMulti, slabRemote);
+
+    printf("[slab size classes used]\n");
+    for (uint32_t i = 0; i < statCount; i++)
+    {
+        if (stats[i].allocCount == 0) continue;
+        printf("  %4u bytes: %6llu slabs, %10llu allocs, %10llu remote frees\n", stats[i].blockSize,
+            (unsigned long long)stats[i].slabCount, (unsigned long long)stats[i].allocCount, (unsigned long long)stats[i].remoteFreeCount);
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include <levikno/levikno.h>
+
+// NOTE: this program compares loading textures from png files, which are decoded by stb_image, against loading the same textures
+//       from dds files that hold bc7 blocks and the full mip chain, dds (and ktx2) files are not decoded, lvn::loadImageData maps
+//       the file and the levels point straight into the mapping so the load time is only the time to read the bytes
+//       the files are written to the current directory before the timings and removed afterwards, the dds files are built with
+//       lvn::imageGenMipLevels and lvn::imageCompress and written with the small dds writer below
+
+
+static const uint32_t s_ImageCount = 16;
+static const uint32_t s_ImageWidth = 2048;
+static const uint32_t s_ImageHeight = 2048;
+static const uint32_t s_Repeats = 3;      // the best time out of the repeats is reported
+
+static volatile uint64_t s_Sink;          // keeps the reads of the mapped pages from being optimized out
+
+
+static void getFilepath(char* buff, size_t size, uint32_t index, const char* extension)
+{
+    snprintf(buff, size, "textureContainerBenchmark_%u.%s", index, extension);
+}
+
+static void write32(FILE* fileptr, uint32_t value)
+{
+    fwrite(&value, sizeof(uint32_t), 1, fileptr);
+}
+
+// writes a dds file with a DX10 header (DXGI_FORMAT_BC7_UNORM), the levels follow the headers from the full size level down
+static bool writeDdsBc7(const char* filepath, const LvnImageData& image, const LvnImageData* pMipLevels, uint32_t mipLevelCount)
+{
+    FILE* fileptr = fopen(filepath, "wb");
+    if (!fileptr) { return false; }
+
+    uint32_t header[31]{};
+    header[0] = 124;                                          // dwSize
+    header[1] = 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000; // caps, height, width, pixel format, mip count, linear size
+    header[2] = image.height;
+    header[3] = image.width;
+    header[4] = (uint32_t)image.size;
+    header[6] = 1 + mipLevelCount;
+    header[18] = 32;                                          // ddspf.dwSize
+    header[19] = 0x4;                                         // DDPF_FOURCC
+    header[20] = 0x30315844;                                  // "DX10"
+    header[26] = 0x1000 | 0x400000 | 0x8;                     // texture, mipmap, complex
+
+    write32(fileptr, 0x20534444);                             // "DDS "
+    fwrite(header, sizeof(header), 1, fileptr);
+
+    write32(fileptr, 98);                                     // DXGI_FORMAT_BC7_UNORM
+    write32(fileptr, 3);                                      // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+    write32(fileptr, 0);
+    write32(fileptr, 1);                                      // array size
+    write32(fileptr, 0);
+
+    const LvnData<uint8_t>& pixels = image.pixels;
+    fwrite(pixels.data(), 1, pixels.size(), fileptr);
+    for (uint32_t i = 0; i < mipLevelCount; i++)
+    {
+        const LvnData<uint8_t>& levelPixels = pMipLevels[i].pixels;
+        fwrite(levelPixels.data(), 1, levelPixels.size(), fileptr);
+    }
+
+    fclose(fileptr);
+    return true;
+}
+
+static double loadFiles(const char* extension, uint64_t* totalSize)
+{
+    double best = 1e30;
+
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        *totalSize = 0;
+        for (uint32_t i = 0; i < s_ImageCount; i++)
+        {
+            char filepath[64];
+            getFilepath(filepath, sizeof(filepath), i, extension);
+
+            LvnImageData imageData = lvn::loadImageData(filepath, 4);
+
+            // level 0 is read page by page so that the pages of the mapped dds files are counted as loaded
+            const LvnData<uint8_t>& pixels = imageData.pixels;
+            uint64_t sum = 0;
+            for (size_t j = 0; j < pixels.size(); j += 4096)
+                sum += pixels[j];
+            s_Sink = s_Sink + sum;
+            *totalSize += imageData.size;
+
+            for (uint32_t j = 0; j < imageData.mipLevels.size(); j++)
+                *totalSize += imageData.mipLevels[j].size;
+        }
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.logging.disableCoreLogging = true;
+    lvnCreateInfo.enableMultithreading = true;
+
+    lvn::createContext(&lvnCreateInfo);
+
+    // write every texture as a png and as a dds with bc7 blocks and mip levels
+    {
+        LvnUniqueData<uint8_t> pixels(s_ImageWidth * s_ImageHeight * 4);
+        uint32_t mipLevelCount = lvn::imageGetMipLevelCount(s_ImageWidth, s_ImageHeight);
+
+        for (uint32_t i = 0; i < s_ImageCount; i++)
+        {
+            // smooth gradients with some noise so the files are close to the size of real textures
+            for (uint32_t y = 0; y < s_ImageHeight; y++)
+            {
+                for (uint32_t x = 0; x < s_ImageWidth; x++)
+                {
+                    uint8_t* px = &pixels[(y * s_ImageWidth + x) * 4];
+                    uint32_t noise = (x * 2654435761u ^ y * 40503u) >> 28;
+                    px[0] = (uint8_t)(x / 8 + i * 16 + noise);
+                    px[1] = (uint8_t)(y / 8 + noise);
+                    px[2] = (uint8_t)((x + y) / 16 + i * 8);
+                    px[3] = 255;
+                }
+            }
+
+            LvnImageData imageData{};
+            imageData.width = s_ImageWidth;
+            imageData.height = s_ImageHeight;
+            imageData.channels = 4;
+            imageData.size = pixels.size();
+            imageData.pixels = LvnData<uint8_t>(pixels.data(), pixels.size());
+
+            LvnVector<LvnImageData> mipLevels(mipLevelCount);
+            lvn::imageGenMipLevels(imageData, mipLevels.data(), mipLevelCount, Lvn_ImageMipFilter_Box, Lvn_TextureFormat_Srgb);
+
+            LvnImageData compressed = lvn::imageCompress(imageData, Lvn_TextureCompression_Bc7);
+            for (uint32_t j = 0; j < mipLevelCount; j++)
+                mipLevels[j] = lvn::imageCompress(mipLevels[j], Lvn_TextureCompression_Bc7);
+
+            char pngFilepath[64], ddsFilepath[64];
+            getFilepath(pngFilepath, sizeof(pngFilepath), i, "png");
+            getFilepath(ddsFilepath, sizeof(ddsFilepath), i, "dds");
+
+            if (lvn::writeImagePng(imageData, pngFilepath) != Lvn_Result_Success || !writeDdsBc7(ddsFilepath, compressed, mipLevels.data(), mipLevelCount))
+            {
+                printf("cannot write texture files: %s, %s\n", pngFilepath, ddsFilepath);
+                lvn::terminateContext();
+                return -1;
+            }
+        }
+    }
+
+    printf("[%u textures, %ux%u rgba]\n", s_ImageCount, s_ImageWidth, s_ImageHeight);
+
+    uint64_t pngSize = 0, ddsSize = 0;
+    double pngTime = loadFiles("png", &pngSize);
+    double ddsTime = loadFiles("dds", &ddsSize);
+
+    printf("  png  (decoded, level 0 only):  %8.2f ms, %6.2f ms per texture, %llu bytes to upload\n", pngTime, pngTime / s_ImageCount, (unsigned long long)pngSize);
+    printf("  dds  (bc7, full mip chain):    %8.2f ms, %6.2f ms per texture, %llu bytes to upload\n", ddsTime, ddsTime / s_ImageCount, (unsigned long long)ddsSize);
+    printf("  dds loads %.1fx faster\n", pngTime / ddsTime);
+
+    lvn::terminateContext();
+
+    for (uint32_t i = 0; i < s_ImageCount; i++)
+    {
+        char filepath[64];
+        getFilepath(filepath, sizeof(filepath), i, "png");
+        remove(filepath);
+        getFilepath(filepath, sizeof(filepath), i, "dds");
+        remove(filepath);
+    }
+
+    return 0;
+}
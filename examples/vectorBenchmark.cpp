@@ -0,0 +1,75 @@
+#include <levikno/levikno.h>
+
+#include <vector>
+#include <string>
+
+// NOTE: this program measures push_back throughput of LvnVector against std::vector from 1e3 to 1e7 elements
+//       a trivially copyable type is relocated with memcpy when the vector grows, a type holding a heap allocated
+//       string is relocated with its move constructor, timings are the average in nanoseconds per push_back
+
+
+static const uint32_t s_ElementCounts[] = { 1000, 10000, 100000, 1000000, 10000000 };
+static const uint32_t s_Repeats = 5;      // the best time out of the repeats is reported
+
+
+#define ARRAY_LEN(x) (sizeof(x) / sizeof(x[0]))
+
+struct DrawCommand
+{
+    uint32_t vertexOffset, vertexCount;
+    uint32_t indexOffset, indexCount;
+    float transform[4];
+};
+
+struct NamedCommand
+{
+    std::string name;
+    uint32_t id;
+};
+
+template <typename Vector, typename MakeFunc>
+static double pushBack(uint32_t count, MakeFunc makeFunc)
+{
+    double best = 1e30;
+    for (uint32_t r = 0; r < s_Repeats; r++)
+    {
+        LvnTimer timer;
+        timer.begin();
+
+        Vector vec;
+        for (uint32_t i = 0; i < count; i++)
+            vec.push_back(makeFunc(i));
+
+        double elapsed = timer.elapsedms();
+        if (elapsed < best) best = elapsed;
+    }
+
+    return best * 1e6 / count;
+}
+
+template <typename T, typename MakeFunc>
+static void runBenchmark(const char* name, MakeFunc makeFunc)
+{
+    printf("[%s]\n", name);
+    for (uint32_t i = 0; i < ARRAY_LEN(s_ElementCounts); i++)
+    {
+        // named commands allocate a string per element, keep the largest counts short
+        uint32_t count = s_ElementCounts[i];
+        if (!std::is_trivially_copyable_v<T> && count > 1000000)
+            continue;
+
+        double lvnTime = pushBack<LvnVector<T>>(count, makeFunc);
+        double stdTime = pushBack<std::vector<T>>(count, makeFunc);
+
+        printf("  %9u elements   LvnVector: %7.2f ns   std::vector: %7.2f ns\n", count, lvnTime, stdTime);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    runBenchmark<uint32_t>("uint32_t", [](uint32_t i) { return i; });
+    runBenchmark<DrawCommand>("DrawCommand (32 bytes, memcpy relocation)", [](uint32_t i) { return DrawCommand{ i, 3, i, 3, { 1.0f, 0.0f, 0.0f, 1.0f } }; });
+    runBenchmark<NamedCommand>("NamedCommand (move relocation)", [](uint32_t i) { return NamedCommand{ "command name that is not sso", i }; });
+
+    return 0;
+}
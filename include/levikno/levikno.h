@@ -12,6 +12,7 @@
 // -- [SUBSECT]: Memory Alloc Defines
 // -- [SUBSECT]: Misc Defines
 // -- [SUBSECT]: Log Defines
+// -- [SUBSECT]: Profile Defines
 // -- [SUBSECT]: Includes
 // [SECTION]: Enums
 // -- [SUBSECT]: Core Enums
@@ -140,9 +141,9 @@
 // -- [SUBSECT]: Memory Alloc Defines
 // ------------------------------------------------------------
 
-// allocation
+// allocation, the file and line are recorded as the allocation site when memory tracking is enabled
 #ifndef LVN_MALLOC
-    #define LVN_MALLOC(sz) ::lvn::memAlloc(sz)
+    #define LVN_MALLOC(sz) ::lvn::memAlloc(sz, LVN_FILE_NAME, LVN_LINE)
 #endif
 
 #ifndef LVN_FREE
@@ -153,6 +154,8 @@
     #define LVN_REALLOC(p,sz) ::lvn::memRealloc(p,sz)
 #endif
 
+#define LVN_MEM_NEW(type, count) ::lvn::memNew<type>(count, true, LVN_FILE_NAME, LVN_LINE)
+
 // storage
 #define LVN_TYPE_BUFF(name,sz) alignas(alignof(max_align_t)) uint8_t name[sz]
 
@@ -167,9 +170,17 @@
 #define LVN_LINE __LINE__
 #define LVN_FUNC_NAME __func__
 
+#ifdef _MSC_VER
+    #define LVN_FUNC_SIG __FUNCSIG__
+#else
+    #define LVN_FUNC_SIG __PRETTY_FUNCTION__
+#endif
+
 #define LVN_STR(x) #x
 #define LVN_STRINGIFY(x) LVN_STR(x)
 
+#define LVN_CACHE_LINE_SIZE (64)
+
 #ifndef M_PI
     #define M_PI 3.1415926535897932384626433832795
 #endif
@@ -230,21 +241,98 @@
 #define LVN_LOG_COLOR_RESET                     "\x1b[0m"
 
 
-// Core Log macros
-#define LVN_CORE_TRACE(...)                     ::lvn::logMessageTrace(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_DEBUG(...)                     ::lvn::logMessageDebug(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_INFO(...)                      ::lvn::logMessageInfo(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_WARN(...)                      ::lvn::logMessageWarn(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_ERROR(...)                     ::lvn::logMessageError(lvn::logGetCoreLogger(), ##__VA_ARGS__)
-#define LVN_CORE_FATAL(...)                     ::lvn::logMessageFatal(lvn::logGetCoreLogger(), ##__VA_ARGS__)
+// Log levels for LVN_LOG_MIN_LEVEL, same values as LvnLogLevel
+#define LVN_LOG_LEVEL_TRACE                     (1)
+#define LVN_LOG_LEVEL_DEBUG                     (2)
+#define LVN_LOG_LEVEL_INFO                      (3)
+#define LVN_LOG_LEVEL_WARN                      (4)
+#define LVN_LOG_LEVEL_ERROR                     (5)
+#define LVN_LOG_LEVEL_FATAL                     (6)
+#define LVN_LOG_LEVEL_OFF                       (7)
+
+// log macros below LVN_LOG_MIN_LEVEL compile to nothing and their arguments are never evaluated
+// eg. define LVN_LOG_MIN_LEVEL=LVN_LOG_LEVEL_INFO in release builds to strip trace and debug messages
+#ifndef LVN_LOG_MIN_LEVEL
+    #define LVN_LOG_MIN_LEVEL LVN_LOG_LEVEL_TRACE
+#endif
+
+// the level is checked before the arguments are evaluated, messages that the logger would discard cost one call
+// logger is evaluated once and passed to a lambda so the macro stays an expression
+#define LVN_LOG_MESSAGE(logger, level, ...)     ([&](LvnLogger* lvnLogMacroLogger) { if (::lvn::logIsEnabled(lvnLogMacroLogger, level)) ::lvn::logMessageFmt(lvnLogMacroLogger, level, ##__VA_ARGS__); }(logger))
+
+// levels removed by LVN_LOG_MIN_LEVEL are never evaluated, the arguments stay in an unevaluated branch so they still count as used
+#define LVN_LOG_DISCARD(logger, level, ...)     (false ? ::lvn::logMessageFmt(logger, level, ##__VA_ARGS__) : (void)0)
+
+// Core and Client Log macros
+#if LVN_LOG_MIN_LEVEL <= LVN_LOG_LEVEL_TRACE
+    #define LVN_CORE_TRACE(...)                 LVN_LOG_MESSAGE(::lvn::logGetCoreLogger(), Lvn_LogLevel_Trace, ##__VA_ARGS__)
+    #define LVN_TRACE(...)                      LVN_LOG_MESSAGE(::lvn::logGetClientLogger(), Lvn_LogLevel_Trace, ##__VA_ARGS__)
+#else
+    #define LVN_CORE_TRACE(...)                 LVN_LOG_DISCARD(::lvn::logGetCoreLogger(), Lvn_LogLevel_Trace, ##__VA_ARGS__)
+    #define LVN_TRACE(...)                      LVN_LOG_DISCARD(::lvn::logGetClientLogger(), Lvn_LogLevel_Trace, ##__VA_ARGS__)
+#endif
+
+#if LVN_LOG_MIN_LEVEL <= LVN_LOG_LEVEL_DEBUG
+    #define LVN_CORE_DEBUG(...)                 LVN_LOG_MESSAGE(::lvn::logGetCoreLogger(), Lvn_LogLevel_Debug, ##__VA_ARGS__)
+    #define LVN_DEBUG(...)                      LVN_LOG_MESSAGE(::lvn::logGetClientLogger(), Lvn_LogLevel_Debug, ##__VA_ARGS__)
+#else
+    #define LVN_CORE_DEBUG(...)                 LVN_LOG_DISCARD(::lvn::logGetCoreLogger(), Lvn_LogLevel_Debug, ##__VA_ARGS__)
+    #define LVN_DEBUG(...)                      LVN_LOG_DISCARD(::lvn::logGetClientLogger(), Lvn_LogLevel_Debug, ##__VA_ARGS__)
+#endif
+
+#if LVN_LOG_MIN_LEVEL <= LVN_LOG_LEVEL_INFO
+    #define LVN_CORE_INFO(...)                  LVN_LOG_MESSAGE(::lvn::logGetCoreLogger(), Lvn_LogLevel_Info, ##__VA_ARGS__)
+    #define LVN_INFO(...)                       LVN_LOG_MESSAGE(::lvn::logGetClientLogger(), Lvn_LogLevel_Info, ##__VA_ARGS__)
+#else
+    #define LVN_CORE_INFO(...)                  LVN_LOG_DISCARD(::lvn::logGetCoreLogger(), Lvn_LogLevel_Info, ##__VA_ARGS__)
+    #define LVN_INFO(...)                       LVN_LOG_DISCARD(::lvn::logGetClientLogger(), Lvn_LogLevel_Info, ##__VA_ARGS__)
+#endif
+
+#if LVN_LOG_MIN_LEVEL <= LVN_LOG_LEVEL_WARN
+    #define LVN_CORE_WARN(...)                  LVN_LOG_MESSAGE(::lvn::logGetCoreLogger(), Lvn_LogLevel_Warn, ##__VA_ARGS__)
+    #define LVN_WARN(...)                       LVN_LOG_MESSAGE(::lvn::logGetClientLogger(), Lvn_LogLevel_Warn, ##__VA_ARGS__)
+#else
+    #define LVN_CORE_WARN(...)                  LVN_LOG_DISCARD(::lvn::logGetCoreLogger(), Lvn_LogLevel_Warn, ##__VA_ARGS__)
+    #define LVN_WARN(...)                       LVN_LOG_DISCARD(::lvn::logGetClientLogger(), Lvn_LogLevel_Warn, ##__VA_ARGS__)
+#endif
+
+#if LVN_LOG_MIN_LEVEL <= LVN_LOG_LEVEL_ERROR
+    #define LVN_CORE_ERROR(...)                 LVN_LOG_MESSAGE(::lvn::logGetCoreLogger(), Lvn_LogLevel_Error, ##__VA_ARGS__)
+    #define LVN_ERROR(...)                      LVN_LOG_MESSAGE(::lvn::logGetClientLogger(), Lvn_LogLevel_Error, ##__VA_ARGS__)
+#else
+    #define LVN_CORE_ERROR(...)                 LVN_LOG_DISCARD(::lvn::logGetCoreLogger(), Lvn_LogLevel_Error, ##__VA_ARGS__)
+    #define LVN_ERROR(...)                      LVN_LOG_DISCARD(::lvn::logGetClientLogger(), Lvn_LogLevel_Error, ##__VA_ARGS__)
+#endif
+
+#if LVN_LOG_MIN_LEVEL <= LVN_LOG_LEVEL_FATAL
+    #define LVN_CORE_FATAL(...)                 LVN_LOG_MESSAGE(::lvn::logGetCoreLogger(), Lvn_LogLevel_Fatal, ##__VA_ARGS__)
+    #define LVN_FATAL(...)                      LVN_LOG_MESSAGE(::lvn::logGetClientLogger(), Lvn_LogLevel_Fatal, ##__VA_ARGS__)
+#else
+    #define LVN_CORE_FATAL(...)                 LVN_LOG_DISCARD(::lvn::logGetCoreLogger(), Lvn_LogLevel_Fatal, ##__VA_ARGS__)
+    #define LVN_FATAL(...)                      LVN_LOG_DISCARD(::lvn::logGetClientLogger(), Lvn_LogLevel_Fatal, ##__VA_ARGS__)
+#endif
+
+
+// -- [SUBSECT]: Profile Defines
+// ------------------------------------------------------------
+// - LVN_PROFILE_SCOPE records a zone from the macro to the end of the enclosing scope, zones are only recorded while profiling is enabled
+// - zone names must be string literals or otherwise outlive the profiler, the name pointer is stored and not copied
+// - define LVN_DISABLE_PROFILER to compile every zone out
+
+#ifndef LVN_DISABLE_PROFILER
+    #define LVN_PROFILE_CONCAT_IMPL(a, b)       a##b
+    #define LVN_PROFILE_CONCAT(a, b)            LVN_PROFILE_CONCAT_IMPL(a, b)
+    #define LVN_PROFILE_SCOPE(name)             LvnProfileScope LVN_PROFILE_CONCAT(lvnProfileScope, __LINE__)(name)
+    #define LVN_PROFILE_FUNCTION()              LVN_PROFILE_SCOPE(LVN_FUNC_NAME)
+#else
+    #define LVN_PROFILE_SCOPE(name)             ((void)0)
+    #define LVN_PROFILE_FUNCTION()              ((void)0)
+#endif
 
-// Client Log macros
-#define LVN_TRACE(...)                          ::lvn::logMessageTrace(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_DEBUG(...)                          ::lvn::logMessageDebug(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_INFO(...)                           ::lvn::logMessageInfo(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_WARN(...)                           ::lvn::logMessageWarn(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_ERROR(...)                          ::lvn::logMessageError(lvn::logGetClientLogger(), ##__VA_ARGS__)
-#define LVN_FATAL(...)                          ::lvn::logMessageFatal(lvn::logGetClientLogger(), ##__VA_ARGS__)
+// number of frame times kept per window for the min/avg/max/p99 of lvn::renderGetFrameStats
+#ifndef LVN_FRAME_STATS_HISTORY
+    #define LVN_FRAME_STATS_HISTORY             (256)
+#endif
 
 
 // -- [SUBSECT]: Includes
@@ -257,6 +345,20 @@
 #include <cstring> // strlen
 #include <cmath>
 #include <new>
+#include <type_traits>
+#include <atomic>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define LVN_SIMD_SSE2
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define LVN_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h> // _BitScanForward
+#endif
 
 
 using std::abs;
@@ -288,6 +390,8 @@ using std::fmod;
 typedef void* (*LvnMemAllocFunc)(size_t sz, void* userData);
 typedef void  (*LvnMemFreeFunc)(void* ptr, void* userData);
 typedef void* (*LvnMemReallocFunc)(void* ptr, size_t sz, void* userData);
+typedef void  (*LvnJobFunc)(void* data);
+typedef void  (*LvnIoCallbackFunc)(struct LvnIoRequest* request, void* userData);
 
 
 // ------------------------------------------------------------
@@ -332,6 +436,12 @@ enum LvnMemAllocMode
     Lvn_MemAllocMode_MemPool,
 };
 
+enum LvnMemAllocator
+{
+    Lvn_MemAllocator_Default,      // use malloc or the functions set with lvn::setMemFuncs
+    Lvn_MemAllocator_SlabCache,    // size class slab allocator with per thread caches for small allocations, larger allocations are passed to the default functions
+};
+
 enum LvnClipRegion
 {
     Lvn_ClipRegion_ApiSpecific,
@@ -352,6 +462,25 @@ enum LvnFileMode
     Lvn_FileMode_Append,
 };
 
+// I/O threads always take the oldest request of the highest priority first
+enum LvnIoPriority
+{
+    Lvn_IoPriority_Low,
+    Lvn_IoPriority_Normal,
+    Lvn_IoPriority_High,
+
+    Lvn_IoPriority_Max_Value,
+};
+
+enum LvnIoStatus
+{
+    Lvn_IoStatus_Pending,          // queued and waiting for an I/O thread
+    Lvn_IoStatus_Reading,          // an I/O thread is reading the file
+    Lvn_IoStatus_Complete,         // the data was read, get it with lvn::ioGetData
+    Lvn_IoStatus_Failed,           // the file could not be opened or read
+    Lvn_IoStatus_Cancelled,        // the request was cancelled with lvn::ioCancel or when the context was terminated
+};
+
 enum LvnLoadFont
 {
     Lvn_LoadFont_Default              = (0),
@@ -552,6 +681,21 @@ enum LvnLogLevel
     Lvn_LogLevel_Fatal      = 6,
 };
 
+// how messages are written to the log file of a logger
+enum LvnLogFileFormat
+{
+    Lvn_LogFileFormat_Text = 0,                 // messages are formatted into the log pattern of the logger, without the ANSI color codes
+    Lvn_LogFileFormat_Binary,                   // compact binary records with the raw message arguments, decode the file with lvn::logDecodeBinaryFile
+};
+
+// what a caller does when the async log queue is full
+enum LvnLogOverflowPolicy
+{
+    Lvn_LogOverflowPolicy_Block = 0,            // wait until the log thread has made room in the queue
+    Lvn_LogOverflowPolicy_Drop,                 // discard the message
+    Lvn_LogOverflowPolicy_DropAndCount,         // discard the message and count it, the log thread reports the number of dropped messages
+};
+
 enum LvnEventType
 {
     Lvn_EventType_None = 0,
@@ -761,6 +905,21 @@ enum LvnStencilOperation
     Lvn_StencilOp_DecrementAndWrap  = 7,
 };
 
+enum LvnImageMipFilter
+{
+    Lvn_ImageMipFilter_Box,     // averages the pixels each mip pixel covers, fastest
+    Lvn_ImageMipFilter_Kaiser,  // kaiser windowed sinc, keeps more detail in the smaller levels
+};
+
+enum LvnTextureCompression
+{
+    Lvn_TextureCompression_None = 0,
+    Lvn_TextureCompression_Bc1  = 1,  // rgb with 1 bit alpha, 8 bytes per 4x4 block
+    Lvn_TextureCompression_Bc3  = 2,  // rgba, 16 bytes per 4x4 block
+    Lvn_TextureCompression_Bc5  = 3,  // two channels (rg), 16 bytes per 4x4 block, eg. normal maps
+    Lvn_TextureCompression_Bc7  = 4,  // rgba, 16 bytes per 4x4 block, higher quality than bc1 and bc3
+};
+
 enum LvnTextureFilter
 {
     Lvn_TextureFilter_Nearest,
@@ -843,6 +1002,23 @@ enum LvnAnimationPath
     Lvn_AnimationPath_Scale,
 };
 
+enum LvnAssetType
+{
+    Lvn_AssetType_Texture,       // image file decoded with stb_image into a texture
+    Lvn_AssetType_Model,         // gltf, glb or obj model
+    Lvn_AssetType_Font,          // ttf font, the font atlas is created as a texture
+
+    Lvn_AssetType_Max_Value,
+};
+
+enum LvnAssetStatus
+{
+    Lvn_AssetStatus_Loading,     // the file is being read or decoded off the render thread
+    Lvn_AssetStatus_Decoded,     // decoded and waiting for lvn::assetManagerUpdate to create its graphics objects
+    Lvn_AssetStatus_Ready,       // the asset can be used
+    Lvn_AssetStatus_Failed,      // the file could not be read, decoded or uploaded, or the handle is stale
+};
+
 
 // -- [SUBSECT]: Audio Enums
 // ------------------------------------------------------------
@@ -893,6 +1069,10 @@ struct LvnAnimation;
 struct LvnAnimationChannel;
 struct LvnAppRenderEvent;
 struct LvnAppTickEvent;
+struct LvnAsset;
+struct LvnAssetLoadInfo;
+struct LvnAssetManagerCreateInfo;
+struct LvnAssetManagerStats;
 struct LvnBuffer;
 struct LvnBufferCreateInfo;
 struct LvnCamera;
@@ -915,9 +1095,15 @@ struct LvnFrameBuffer;
 struct LvnFrameBufferColorAttachment;
 struct LvnFrameBufferCreateInfo;
 struct LvnFrameBufferDepthAttachment;
+struct LvnFrameStats;
 struct LvnGraphicsContext;
 struct LvnImageData;
 struct LvnImageHdrData;
+struct LvnImageLoadInfo;
+struct LvnIoReadInfo;
+struct LvnIoRequest;
+struct LvnJob;
+struct LvnJobCounter;
 struct LvnKeyHoldEvent;
 struct LvnKeyPressedEvent;
 struct LvnKeyReleasedEvent;
@@ -929,6 +1115,9 @@ struct LvnLogMessage;
 struct LvnLogPattern;
 struct LvnMaterial;
 struct LvnMemoryBindingInfo;
+struct LvnMemObjectStats;
+struct LvnMemSlabStats;
+struct LvnMemTrackStats;
 struct LvnMesh;
 struct LvnMeshTextureBindings;
 struct LvnModel;
@@ -938,6 +1127,10 @@ struct LvnMouseMovedEvent;
 struct LvnMouseScrolledEvent;
 struct LvnNode;
 struct LvnOrthoCamera;
+struct LvnPack;
+struct LvnPackBakeInfo;
+struct LvnPackFontInfo;
+struct LvnPackImageInfo;
 struct LvnPacket;
 struct LvnPhysicalDevice;
 struct LvnPhysicalDeviceFeatures;
@@ -956,6 +1149,8 @@ struct LvnPipelineSpecification;
 struct LvnPipelineStencilAttachment;
 struct LvnPipelineViewport;
 struct LvnPrimitive;
+struct LvnProfileFrameStats;
+struct LvnProfileZoneStats;
 struct LvnRenderPass;
 struct LvnSampler;
 struct LvnSamplerCreateInfo;
@@ -1001,9 +1196,15 @@ struct LvnPair;
 template <typename T1, typename T2>
 struct LvnDoublePair;
 
-template <typename T>
+struct LvnHeapAllocator;
+struct LvnFrameAllocator;
+
+template <typename T, typename Alloc = LvnHeapAllocator>
 class LvnVector;
 
+template <typename T>
+using LvnFrameVector = LvnVector<T, LvnFrameAllocator>;
+
 template <typename T>
 struct LvnLinkedIndexNode;
 
@@ -1015,6 +1216,10 @@ class LvnArenaList;
 
 template <typename T, typename Container>
 class LvnQueue;
+template <typename T>
+class LvnSpscQueue;
+template <typename T>
+class LvnMpmcQueue;
 
 struct LvnHash;
 template <typename K, typename T>
@@ -1025,13 +1230,28 @@ class LvnHashMap;
 template <typename T>
 class LvnUniquePtr;
 
+template <typename T>
+struct LvnHandle;
+typedef LvnHandle<LvnPipeline> LvnPipelineHandle;
+typedef LvnHandle<LvnFrameBuffer> LvnFrameBufferHandle;
+typedef LvnHandle<LvnBuffer> LvnBufferHandle;
+typedef LvnHandle<LvnSampler> LvnSamplerHandle;
+typedef LvnHandle<LvnTexture> LvnTextureHandle;
+typedef LvnHandle<LvnCubemap> LvnCubemapHandle;
+typedef LvnHandle<LvnAsset> LvnAssetHandle;
+
 class LvnString;
+class LvnStringView;
+class LvnFrameString;
 
 template <typename T>
 class LvnData;
 typedef LvnData<uint8_t> LvnBin;
+template <typename T>
+class LvnUniqueData;
 
 class LvnTimer;
+class LvnProfileScope;
 class LvnThread;
 class LvnMutex;
 class LvnLockGaurd;
@@ -1269,7 +1489,8 @@ namespace lvn
 
     LVN_API LvnString               loadFileSrc(const char* filepath);                                     // get the src contents from a text file format, filepath must be a valid path to a text file
     LVN_API LvnBin                  loadFileSrcBin(const char* filepath);                                  // get the binary data contents (in unsigned char*) from a binary file (eg .spv), filepath must be a valid path to a binary file
-    LVN_API void                    writeFileSrc(const char* filename, const char* src, LvnFileMode mode); // write to a file given the file name, the source content of the file and the mode to write to the file
+    LVN_API LvnBin                  mapFile(const char* filepath);                                         // map a file into memory as a read only view without copying, slices of the view keep the file mapped until the last one is destroyed
+    LVN_API void                    writeFileSrc(const char* filename, LvnStringView src, LvnFileMode mode); // write to a file given the file name, the source content of the file and the mode to write to the file
 
     LVN_API LvnFont                 loadFontFromFileTTF(const char* filepath, uint32_t fontSize, const uint32_t* pCodepoints = nullptr, uint32_t codepointCount = 0, LvnLoadFontFlagBits flags = Lvn_LoadFont_Default);    // get the font data from a ttf font file, font data will be stored in a LvnImageData struct which is an atlas texture containing all the font glyphs and their UV positions
     LVN_API LvnFont                 loadFontFromFileTTFMemory(const uint8_t* fontData, uint64_t fontDataSize, uint32_t fontSize, const uint32_t* pCodepoints = nullptr, uint32_t codepointCount = 0, LvnLoadFontFlagBits flags = Lvn_LoadFont_Default);
@@ -1277,7 +1498,7 @@ namespace lvn
     LVN_API uint32_t                decodeCodepointUTF8(const char* str, uint32_t* next);
     LVN_API LvnData<uint32_t>       getDefaultSupportedCodepoints();
 
-    LVN_API void*                   memAlloc(size_t size);                              // custom memory allocation function that allocates memory given the size of memory, note that function is connected with the context and will keep track of allocation counts, will increment number of allocations per use
+    LVN_API void*                   memAlloc(size_t size, const char* file = nullptr, int line = 0); // custom memory allocation function that allocates memory given the size of memory, note that function is connected with the context and will keep track of allocation counts, will increment number of allocations per use
     LVN_API void                    memFree(void* ptr);                                 // custom memory free function, note that it keeps track of memory allocations remaining, decrements number of allocations per use with lvn::memAlloc
     LVN_API void*                   memRealloc(void* ptr, size_t size);                 // custom memory realloc function
 
@@ -1286,20 +1507,71 @@ namespace lvn
     LVN_API LvnMemFreeFunc          getMemFreeFunc();
     LVN_API LvnMemReallocFunc       getMemReallocFunc();
     LVN_API void*                   getMemUserData();
+    LVN_API void                    memGetSlabStats(LvnMemSlabStats* pStats, uint32_t* statCount); // get the stats of each size class of the slab allocator, pass nullptr to pStats to get the number of size classes
+
+    LVN_API bool                    memIsTrackingEnabled();                             // returns true if the context was created with memoryInfo.enableMemoryTracking
+    LVN_API void                    memTrackAlloc(void* ptr, size_t size, const char* name, const char* file, int line); // used by lvn::memNew and lvn::memAlloc, records the allocation under its type name and site
+    LVN_API void                    memTrackFree(void* ptr);                            // used by lvn::memDelete and lvn::memFree, pointers that were not recorded are ignored
+    LVN_API void                    memGetTrackedTypes(LvnMemTrackStats* pStats, uint32_t* statCount); // get the bytes allocated for each lvn::memNew type and lvn::memAlloc sorted by peak bytes, pass nullptr to pStats to get the number of types
+    LVN_API void                    memGetTrackedSites(LvnMemTrackStats* pStats, uint32_t* statCount); // get the bytes allocated from each LVN_MEM_NEW and LVN_MALLOC site sorted by peak bytes, pass nullptr to pStats to get the number of sites
+    LVN_API void                    memGetObjectStats(LvnMemObjectStats* pStats, uint32_t* statCount); // get the live and peak objects of each sType and the high-water marks of the memory pool bindings, statCount is the capacity of pStats and is set to the number written, pass nullptr to pStats to get the number of sTypes
+
+    LVN_API void*                   frameArenaAlloc(size_t size, size_t alignment = alignof(max_align_t)); // allocate transient memory from the per frame arena of the context, memory is never freed individually and is only valid until the next two calls to lvn::frameArenaReset, meant for per frame data of the render thread
+    LVN_API void                    frameArenaReset();                                  // moves to the next frame arena and resets it, called by lvn::renderBeginNextFrame, call manually when not rendering
+    LVN_API size_t                  frameArenaGetUsedSize();                            // get the number of bytes allocated from the current frame arena
+
+    LVN_API void                    jobSubmit(const LvnJob* pJobs, uint32_t jobCount, LvnJobCounter* counter = nullptr); // submit jobs to the job system, the counter is incremented by the job count and decremented as each job finishes, jobs run on the calling thread if multithreading is not enabled
+    LVN_API void                    jobWait(LvnJobCounter* counter);                    // wait until the counter reaches zero, the calling thread runs other jobs while waiting
+    LVN_API void                    jobParallelFor(uint32_t count, uint32_t batchSize, void (*func)(uint32_t begin, uint32_t end, void* data), void* data); // split the range [0, count) into batches run across the workers and wait for them to finish, a batch size of 0 picks one from the worker count
+    LVN_API uint32_t                jobGetWorkerCount();                                // get the number of workers including the thread that created the context, returns 1 if multithreading is not enabled
+
+    LVN_API LvnResult               asyncRead(const LvnIoReadInfo* readInfo, LvnIoRequest** request = nullptr); // queue a file read on the I/O threads, pass request to wait on or query the read later and release it with lvn::ioRelease; the file is read on the calling thread if multithreading is not enabled
+    LVN_API LvnIoStatus             ioGetStatus(LvnIoRequest* request);
+    LVN_API LvnBin                  ioGetData(LvnIoRequest* request);                   // get the data of a completed request, empty if the request has not completed
+    LVN_API void                    ioWait(LvnIoRequest* request);                      // block until the request has completed, failed or was cancelled
+    LVN_API bool                    ioCancel(LvnIoRequest* request);                    // cancel a pending or running request, returns false if the request had already finished; the callback is still called with the cancelled status
+    LVN_API void                    ioRelease(LvnIoRequest* request);                   // release a request returned by lvn::asyncRead, the read itself is not cancelled
+    LVN_API uint32_t                ioDispatchCallbacks();                              // call the deferred callbacks of finished requests on the calling thread (eg. once per frame on the render thread), returns the number of callbacks called
+    LVN_API uint32_t                ioGetThreadCount();                                 // get the number of I/O threads, returns 0 if multithreading is not enabled
+
+    LVN_API void                    profileEnable(bool enable);                         // start or stop recording LVN_PROFILE_SCOPE zones, zones already recorded are kept
+    LVN_API bool                    profileIsEnabled();
+    LVN_API uint64_t                profileGetTicks();                                  // get the current profiler time in ticks (rdtsc on x86, steady clock nanoseconds otherwise)
+    LVN_API uint64_t                profileBeginZone();                                 // used by LvnProfileScope, returns the start ticks of the zone
+    LVN_API void                    profileEndZone(const char* name, uint64_t startTicks); // used by LvnProfileScope, records the zone into the calling thread's event buffer
+    LVN_API void                    profileSetThreadName(const char* name);             // set the name of the calling thread shown in the exported trace
+    LVN_API void                    profileBeginFrame();                                // marks the start of a frame, called by lvn::renderBeginNextFrame
+    LVN_API void                    profileEndFrame();                                  // marks the end of a frame, called by lvn::renderDrawSubmit
+    LVN_API LvnResult               profileGetFrameSummary(LvnProfileFrameStats* pFrameStats, LvnProfileZoneStats* pZoneStats, uint32_t* zoneCount); // get the zones of the last completed frame sorted by total time, pass nullptr to pZoneStats to get the number of zones
+    LVN_API LvnResult               profileExportChromeTrace(const char* filepath);     // write every recorded zone and frame to a chrome trace json file (chrome://tracing, perfetto)
+
+    template <typename F>
+    LVN_API void jobParallelFor(uint32_t count, uint32_t batchSize, F func)
+    {
+        lvn::jobParallelFor(count, batchSize, [](uint32_t begin, uint32_t end, void* data) { (*static_cast<F*>(data))(begin, end); }, &func);
+    }
 
 #ifdef LVN_CONFIG_DEBUG
-    LVN_API inline size_t i_ObjectAllocationCount = 0;
-    LVN_API inline size_t getObjectAllocationCount() { return i_ObjectAllocationCount; }
+    LVN_API inline std::atomic<size_t> i_ObjectAllocationCount{0};
+    LVN_API inline size_t getObjectAllocationCount() { return i_ObjectAllocationCount.load(std::memory_order_relaxed); }
 #endif
 
+    LVN_API inline std::atomic<bool> i_MemTrackingEnabled{false};
+
+    // the memory tracker takes the type name out of the function signature
     template <typename T>
-    LVN_API constexpr T* memNew(size_t size = 1, bool construct = true)
+    LVN_API constexpr const char* memTypeName() { return LVN_FUNC_SIG; }
+
+    template <typename T>
+    LVN_API constexpr T* memNew(size_t size = 1, bool construct = true, const char* file = nullptr, int line = 0)
     {
         if (size == 0) { return nullptr; }
     #ifdef LVN_CONFIG_DEBUG
-        i_ObjectAllocationCount++;
+        i_ObjectAllocationCount.fetch_add(1, std::memory_order_relaxed);
     #endif
         T* memalloc = (T*)(*lvn::getMemAllocFunc())(size * sizeof(T), lvn::getMemUserData());
+        if (i_MemTrackingEnabled.load(std::memory_order_relaxed))
+            lvn::memTrackAlloc(memalloc, size * sizeof(T), lvn::memTypeName<T>(), file, line);
         if (construct)
         {
             for (size_t i = 0; i < size; i++)
@@ -1313,8 +1585,10 @@ namespace lvn
     {
         if (ptr == nullptr) { return; }
     #ifdef LVN_CONFIG_DEBUG
-        i_ObjectAllocationCount--;
+        i_ObjectAllocationCount.fetch_sub(1, std::memory_order_relaxed);
     #endif
+        if (i_MemTrackingEnabled.load(std::memory_order_relaxed))
+            lvn::memTrackFree(ptr);
         if (!std::is_trivially_destructible_v<T>)
         {
             for (size_t i = 0; i < size; i++)
@@ -1373,13 +1647,28 @@ namespace lvn
     //
     // Ex: The default log pattern is: "[%Y-%m-%d] [%T] [%#%l%^] %n: %v%$"
     //     Which could output: "[04-06-2025] [14:25:11] [\x1b[0;32minfo\x1b[0m] CORE: some informational message\n"
+    //
+    // The pattern format is compiled into a list of instructions when it is set, user patterns must be added with lvn::logAddPatterns before
+    // the format that uses them is set. The date patterns use the time the message was logged
+    //
+    // Async logging (LvnContextCreateInfo::logging.enableAsyncLogging):
+    // - the calling thread only packs the level, time, logger, format string pointer and arguments into a record and pushes it to a lock-free queue
+    // - a background thread formats the records in batches and writes each batch to the console and log files
+    // - the format string must outlive the message (eg. a string literal), %s arguments are copied into the record
+    // - call lvn::logFlush to wait until every pushed message has been written, eg. before reading a log file
+    //
+    // Binary log files (Lvn_LogFileFormat_Binary):
+    // - each message is written as a record of the time in nanoseconds, level, logger id, format string id and the packed arguments
+    // - format strings, logger names and patterns are written once to a string table in the same file the first time they are used
+    // - format strings are matched by their text and not their address, a buffer reused for a different format gets a new id
+    // - the file is decoded back to text with lvn::logDecodeBinaryFile on a machine with the same architecture that wrote it
 
     LVN_API void                        logEnable(bool enable);                                                           // enable or disable logging
     LVN_API void                        logEnableCoreLogging(bool enable);                                                // enable or disable logging from the core logger
     LVN_API void                        logSetLevel(LvnLogger* logger, LvnLogLevel level);                                // sets the log level of logger, will only print messages with set log level and higher
-    LVN_API void                        logSetFileConfig(LvnLogger* logger, bool enable, const char* filename = "", LvnFileMode filemode = Lvn_FileMode_Write);  // sets the log file config, whether to enable logging and the log file name and mode
+    LVN_API void                        logSetFileConfig(LvnLogger* logger, bool enable, const char* filename = "", LvnFileMode filemode = Lvn_FileMode_Write, LvnLogFileFormat format = Lvn_LogFileFormat_Text);  // sets the log file config, whether to enable logging and the log file name, mode and format
     LVN_API bool                        logCheckLevel(LvnLogger* logger, LvnLogLevel level);                              // checks level with loger, returns true if level is the same or higher level than the level of the logger
-    LVN_API void                        logRenameLogger(LvnLogger* logger, const char* name);                             // renames the name of the logger
+    LVN_API void                        logRenameLogger(LvnLogger* logger, LvnStringView name);                           // renames the name of the logger
     LVN_API void                        logOutputMessage(LvnLogger* logger, LvnLogMessage* msg);                          // prints the log message
     LVN_API LvnString                   logFormatMessage(LvnLogger* logger, LvnLogLevel level, const char* msg, bool removeANSI = false); // formats the log message into the log pattern set by the logger
     LVN_API void                        logMessage(LvnLogger* logger, LvnLogLevel level, const char* msg);                // log message with given log level
@@ -1389,11 +1678,16 @@ namespace lvn
     LVN_API void                        logMessageWarn(LvnLogger* logger, const char* fmt, ...);                          // log message with level warn;  ANSI code "\x1b[1;33m"
     LVN_API void                        logMessageError(LvnLogger* logger, const char* fmt, ...);                         // log message with level error; ANSI code "\x1b[1;31m"
     LVN_API void                        logMessageFatal(LvnLogger* logger, const char* fmt, ...);                         // log message with level fatal; ANSI code "\x1b[1;37;41m"
+    LVN_API void                        logMessageFmt(LvnLogger* logger, LvnLogLevel level, const char* fmt, ...);        // log message with given log level without checking the level, used by the log macros after lvn::logIsEnabled
+    LVN_API bool                        logIsEnabled(LvnLogger* logger, LvnLogLevel level);                               // returns true if a message with level from the logger would be output; checks logging, core logging and the level of the logger
     LVN_API LvnLogger*                  logGetCoreLogger();
     LVN_API LvnLogger*                  logGetClientLogger();
     LVN_API const char*                 logGetANSIcodeColor(LvnLogLevel level);                                           // get the ANSI color code of the log level in a string
     LVN_API LvnResult                   logSetPatternFormat(LvnLogger* logger, const char* patternfmt);                   // set the log pattern of the logger; messages outputed from that logger will be in this format
     LVN_API LvnResult                   logAddPatterns(LvnLogPattern* pLogPatterns, uint32_t count);                      // add user defined log patterns to the library
+    LVN_API void                        logFlush();                                                                       // blocks until every message logged so far is written and flushed to the console and log files
+    LVN_API uint64_t                    logGetDroppedMessageCount();                                                      // get the number of messages discarded by the async log queue with Lvn_LogOverflowPolicy_DropAndCount
+    LVN_API LvnResult                   logDecodeBinaryFile(const char* filepath, FILE* output, const char* patternfmt = nullptr); // decodes a binary log file into text written to output, each message uses the pattern of its logger unless patternfmt is set
 
     LVN_API LvnResult                   createLogger(LvnLogger** logger, const LvnLoggerCreateInfo* loggerCreateInfo);
     LVN_API void                        destroyLogger(LvnLogger* logger);
@@ -1480,6 +1774,7 @@ namespace lvn
 
     LVN_API void                        renderBeginNextFrame(LvnWindow* window);                                                                          // begins the next frame of the window
     LVN_API void                        renderDrawSubmit(LvnWindow* window);                                                                              // submits all draw commands recorded and presents to window
+    LVN_API LvnFrameStats               renderGetFrameStats(LvnWindow* window);                                                                           // get the counters and frame times of the last frame submitted to the window
     LVN_API void                        renderBeginCommandRecording(LvnWindow* window);                                                                   // begins command buffer when recording draw commands start
     LVN_API void                        renderEndCommandRecording(LvnWindow* window);                                                                     // ends command buffer when finished recording draw commands
     LVN_API void                        renderCmdDraw(LvnWindow* window, uint32_t vertexCount);
@@ -1520,6 +1815,32 @@ namespace lvn
     LVN_API void                        destroyTexture(LvnTexture* texture);                                                                              // destroy texture object
     LVN_API void                        destroyCubemap(LvnCubemap* cubemap);                                                                              // destroy cubemap object
 
+    // handle variants of the create and destroy functions, objects are referenced by a generational handle instead of a pointer so that
+    // handles to destroyed objects can be detected; objects created with a handle must be destroyed with the handle
+    // the objects are stored in the context's per type handle tables, the pointer returned by get* stays valid until the object is destroyed
+    LVN_API LvnResult                   createPipeline(LvnPipelineHandle* pipeline, const LvnPipelineCreateInfo* createInfo);
+    LVN_API LvnResult                   createFrameBuffer(LvnFrameBufferHandle* frameBuffer, const LvnFrameBufferCreateInfo* createInfo);
+    LVN_API LvnResult                   createBuffer(LvnBufferHandle* buffer, const LvnBufferCreateInfo* createInfo);
+    LVN_API LvnResult                   createSampler(LvnSamplerHandle* sampler, const LvnSamplerCreateInfo* createInfo);
+    LVN_API LvnResult                   createTexture(LvnTextureHandle* texture, const LvnTextureCreateInfo* createInfo);
+    LVN_API LvnResult                   createTexture(LvnTextureHandle* texture, const LvnTextureSamplerCreateInfo* createInfo);
+    LVN_API LvnResult                   createCubemap(LvnCubemapHandle* cubemap, const LvnCubemapCreateInfo* createInfo);
+    LVN_API LvnResult                   createCubemap(LvnCubemapHandle* cubemap, const LvnCubemapHdrCreateInfo* createInfo);
+
+    LVN_API void                        destroyPipeline(LvnPipelineHandle pipeline);                                                                      // destroy the object of the handle, stale handles are ignored
+    LVN_API void                        destroyFrameBuffer(LvnFrameBufferHandle frameBuffer);
+    LVN_API void                        destroyBuffer(LvnBufferHandle buffer);
+    LVN_API void                        destroySampler(LvnSamplerHandle sampler);
+    LVN_API void                        destroyTexture(LvnTextureHandle texture);
+    LVN_API void                        destroyCubemap(LvnCubemapHandle cubemap);
+
+    LVN_API LvnPipeline*                getPipeline(LvnPipelineHandle pipeline);                                                                          // get the object of the handle, returns nullptr if the handle is null or stale
+    LVN_API LvnFrameBuffer*             getFrameBuffer(LvnFrameBufferHandle frameBuffer);
+    LVN_API LvnBuffer*                  getBuffer(LvnBufferHandle buffer);
+    LVN_API LvnSampler*                 getSampler(LvnSamplerHandle sampler);
+    LVN_API LvnTexture*                 getTexture(LvnTextureHandle texture);
+    LVN_API LvnCubemap*                 getCubemap(LvnCubemapHandle cubemap);
+
     LVN_API uint32_t                    getAttributeFormatSize(LvnAttributeFormat format);
     LVN_API uint32_t                    getAttributeFormatComponentSize(LvnAttributeFormat format);
     LVN_API bool                        isAttributeFormatNormalizedType(LvnAttributeFormat format);
@@ -1540,20 +1861,30 @@ namespace lvn
     LVN_API void                        frameBufferSetClearColor(LvnFrameBuffer* frameBuffer, uint32_t attachmentIndex, float r, float g, float b, float a);      // set the background color for the framebuffer for offscreen rendering
     LVN_API LvnDepthImageFormat         findSupportedDepthImageFormat(LvnDepthImageFormat* pDepthImageFormats, uint32_t count);
 
-    LVN_API LvnImageData                loadImageData(const char* filepath, int forceChannels = 0, bool flipVertically = false);
+    LVN_API LvnImageData                loadImageData(const char* filepath, int forceChannels = 0, bool flipVertically = false); // ktx2 and dds files are not decoded, their blocks and mip levels are returned as stored (forceChannels and flipVertically are ignored for them)
     LVN_API LvnImageData                loadImageDataMemory(const uint8_t* data, int length, int forceChannels = 0, bool flipVertically = false);
     LVN_API LvnImageData                loadImageDataThread(const LvnString filepath, int forceChannels = 0, bool flipVertically = false);
     LVN_API LvnImageData                loadImageDataMemoryThread(const uint8_t* data, int length, int forceChannels = 0, bool flipVertically = false);
+    LVN_API LvnResult                   loadImagesBatch(const LvnImageLoadInfo* pLoadInfos, uint32_t count, LvnImageData* pImages, uint32_t maxConcurrency = 0); // decodes a list of image files or memory blobs across the job workers, at most maxConcurrency images are decoded at once (0 uses the worker count), images that are invalid or fail to load are logged and left empty (size 0) while the rest are still decoded, the function then returns failure
     LVN_API LvnImageHdrData             loadHdrImageData(const char* filepath, int forceChannels = 0, bool flipVertically = false);
 
     LVN_API LvnResult                   writeImagePng(const LvnImageData& imageData, const char* filename);               // writes the image data into a png file with the filename/filepath
     LVN_API LvnResult                   writeImageJpg(const LvnImageData& imageData, const char* filename, int quality);  // writes the image data into a jpg file with the filename/filepath and the jpg quality (from 0...100)
     LVN_API LvnResult                   writeImageBmp(const LvnImageData& imageData, const char* filename);               // writes the image data into a bmp file with the filename/filepath
 
+    // the transform functions work on uncompressed pixels only and are also applied to each of imageData.mipLevels
     LVN_API void                        imageFlipVertically(LvnImageData& imageData);                                     // flips the image vertically
     LVN_API void                        imageFlipHorizontally(LvnImageData& imageData);                                   // flips the image horizontally
     LVN_API void                        imageRotateCW(LvnImageData& imageData);                                           // rotates the image clockwise (right)
     LVN_API void                        imageRotateCCW(LvnImageData& imageData);                                          // rotates the image counter clockwise (left)
+    LVN_API void                        imageConvertChannels(LvnImageData& imageData, uint32_t channels);                 // converts the image to a different number of channels (1...4), eg. rgb to rgba; gray is copied into rgb, rgb is reduced to gray by luma, a missing alpha is set to 255
+    LVN_API void                        imageSwizzle(LvnImageData& imageData, const uint32_t* pSwizzle);                  // reorders the channels of each pixel, pSwizzle holds the source channel index for each channel of the image, eg. {2,1,0,3} for rgba to bgra
+    LVN_API void                        imagePremultiplyAlpha(LvnImageData& imageData);                                   // multiplies the color channels by the alpha channel, the image must have 2 (gray alpha) or 4 (rgba) channels
+
+    LVN_API uint32_t                    imageGetMipLevelCount(uint32_t width, uint32_t height);                           // number of mip levels below the full size image down to 1x1, eg. 10 for a 1024x512 image
+    LVN_API LvnResult                   imageGenMipLevels(const LvnImageData& imageData, LvnImageData* pMipLevels, uint32_t mipLevelCount, LvnImageMipFilter filter, LvnTextureFormat format); // generates the mip levels below the image into pMipLevels, each level half the size of the previous, srgb images are filtered in linear space (alpha is always linear)
+    LVN_API LvnImageData                imageCompress(const LvnImageData& imageData, LvnTextureCompression compression);  // encodes the image into bc1, bc3, bc5 or bc7 blocks for LvnTextureCreateInfo::compression, bc5 takes the first two channels (gray and alpha for 2 channel images), returns empty image data on failure
+    LVN_API uint64_t                    imageGetLevelSize(uint32_t width, uint32_t height, uint32_t channels, LvnTextureCompression compression); // size in bytes of one level of an image, compressed levels are rounded up to whole 4x4 blocks
 
     LVN_API LvnImageData                imageGenWhiteNoise(uint32_t width, uint32_t height, uint32_t channels);
     LVN_API LvnImageData                imageGenWhiteNoise(uint32_t width, uint32_t height, uint32_t channels, uint32_t seed);
@@ -1563,6 +1894,34 @@ namespace lvn
     LVN_API LvnModel                    loadModel(const char* filepath);
     LVN_API void                        unloadModel(LvnModel* model);
 
+    // asset manager, files are read on the I/O threads and decoded on the job system while their graphics objects are created on the
+    // render thread within a per frame budget; all asset functions must be called from the thread that owns the graphics context
+    LVN_API LvnResult                   assetManagerInit(const LvnAssetManagerCreateInfo* createInfo);                                                    // start the asset manager, call after the graphics context and physical device are set up
+    LVN_API void                        assetManagerTerminate();                                                                                          // wait for assets still loading then destroy every asset, called by lvn::terminateContext if not called before
+    LVN_API bool                        assetManagerIsInitialized();
+    LVN_API uint32_t                    assetManagerUpdate();                                                                                             // create the graphics objects of decoded assets until the frame budget is used, call once per frame; returns the number of assets that became ready
+    LVN_API LvnAssetManagerStats        assetManagerGetStats();
+
+    LVN_API LvnAssetHandle              assetLoad(const LvnAssetLoadInfo* loadInfo);                                                                      // start loading an asset and return its handle straight away, loading the same type and path again adds a reference to the existing asset
+    LVN_API void                        assetAcquire(LvnAssetHandle asset);                                                                               // add a reference to the asset
+    LVN_API void                        assetRelease(LvnAssetHandle asset);                                                                               // remove a reference, the asset is destroyed when the last reference is released
+    LVN_API LvnAssetStatus              assetGetStatus(LvnAssetHandle asset);
+    LVN_API LvnTexture*                 assetGetTexture(LvnAssetHandle asset);                                                                            // get the texture of a texture asset or the atlas of a font asset, returns the placeholder texture until the asset is ready
+    LVN_API LvnModel*                   assetGetModel(LvnAssetHandle asset);                                                                              // get the model of a model asset, returns nullptr until the asset is ready
+    LVN_API const LvnFont*              assetGetFont(LvnAssetHandle asset);                                                                               // get the font of a font asset, returns nullptr until the asset is ready
+
+    // scene packs hold models, images and fonts baked offline (eg. by the levikno-bake tool) into a single file, the pack is mapped at
+    // load and its vertex, index and image data are given to the graphics api straight from the mapped pages without parsing or decoding
+    LVN_API LvnResult                   bakePack(const LvnPackBakeInfo* bakeInfo, const char* filepath);                                                  // loads every file of the bake info, builds the mip levels and compression of the images and writes the pack, does not need a graphics context
+    LVN_API LvnPack*                    loadPack(const char* filepath);                                                                                   // maps the pack file, returns nullptr if the file is not a pack or is from a different pack version
+    LVN_API void                        unloadPack(LvnPack* pack);                                                                                        // models, images and fonts taken from the pack keep the file mapped until they are released
+    LVN_API uint32_t                    packGetModelCount(const LvnPack* pack);
+    LVN_API uint32_t                    packGetImageCount(const LvnPack* pack);
+    LVN_API uint32_t                    packGetFontCount(const LvnPack* pack);
+    LVN_API LvnModel                    packCreateModel(const LvnPack* pack, uint32_t index);                                                             // create the graphics objects of a model, models are in the order of LvnPackBakeInfo::pModelFilepaths, free with lvn::unloadModel
+    LVN_API LvnImageData                packGetImage(const LvnPack* pack, uint32_t index);                                                                // the images of LvnPackBakeInfo::pImages come first in order, followed by the model textures and font atlases, the levels are slices of the mapped file
+    LVN_API LvnFont                     packGetFont(const LvnPack* pack, uint32_t index);                                                                 // fonts are in the order of LvnPackBakeInfo::pFonts, the atlas is a slice of the mapped file
+
 
     // -- [SUBSECT]: Audio Functions
     // ------------------------------------------------------------
@@ -2457,6 +2816,9 @@ struct LvnPair
 {
     union { T p1, x, width, first; };
     union { T p2, y, height, second; };
+
+    bool operator==(const LvnPair& other) const { return first == other.first && second == other.second; }
+    bool operator!=(const LvnPair& other) const { return !(*this == other); }
 };
 
 template<typename T1, typename T2>
@@ -2464,14 +2826,61 @@ struct LvnDoublePair
 {
     union { T1 p1, x, width, first; };
     union { T2 p2, y, height, second; };
+
+    bool operator==(const LvnDoublePair& other) const { return first == other.first && second == other.second; }
+    bool operator!=(const LvnDoublePair& other) const { return !(*this == other); }
 };
 
+// -- LvnHeapAllocator, LvnFrameAllocator
+// ------------------------------------------------------------
+// - allocation policies for data structures, allocate does not construct, deallocate destructs the elements given
+// - LvnHeapAllocator uses lvn::memNew and lvn::memDelete
+// - LvnFrameAllocator uses the per frame arena, deallocate only destructs since arena memory is released when the frame arena is reset
+
+struct LvnHeapAllocator
+{
+    template <typename T>
+    static T* allocate(size_t size) { return lvn::memNew<T>(size, false); }
+
+    template <typename T>
+    static void deallocate(T* ptr, size_t size) { lvn::memDelete<T>(ptr, size); }
+};
+
+struct LvnFrameAllocator
+{
+    template <typename T>
+    static T* allocate(size_t size) { return size ? static_cast<T*>(lvn::frameArenaAlloc(size * sizeof(T), alignof(T))) : nullptr; }
+
+    template <typename T>
+    static void deallocate(T* ptr, size_t size)
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            if (ptr == nullptr) { return; }
+            for (size_t i = 0; i < size; i++)
+                ptr[i].~T();
+        }
+    }
+};
+
+
 // -- LvnVector
 // ------------------------------------------------------------
 // - simple and light weight replacement to std::vector
 // - this vector implmentation is not intended to be used outside of the library, use std::vector instead
+// - use LvnFrameVector for temporary vectors that do not outlive the frame, no memory is freed
+// - capacity grows geometrically (x2) so push_back and emplace_back are amortized constant time
+// - elements are relocated with memcpy when the type is trivially relocatable (see LvnTriviallyRelocatable), otherwise they are move constructed
 
+// types that can be moved to a new address with memcpy without calling the move constructor and destructor,
+// specialize to std::true_type for types that are not trivially copyable but do not hold pointers to themselves
 template <typename T>
+struct LvnTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+template <typename T, typename Alloc>
+struct LvnTriviallyRelocatable<LvnVector<T, Alloc>> : std::true_type {};
+
+template <typename T, typename Alloc>
 class LvnVector
 {
 private:
@@ -2479,15 +2888,52 @@ private:
     size_t m_Size;      /* number of elements that are in this vector; size of vector */
     size_t m_Capacity;  /* max number of elements allocated/reserved for this vector; note that m_Size can be less than or equal to the capacity */
 
+    using MoveRef = std::remove_reference_t<T>&&;
+
     void destruct() { if constexpr (!std::is_trivially_destructible_v<T>) { for (size_t i = 0; i < m_Size; i++) m_Data[i].~T(); } }
     void destruct_at(T* value) { if constexpr (!std::is_trivially_destructible_v<T>) value->~T(); }
 
+    /* moves count elements from src into uninitialized memory at dst, src elements are left destroyed */
+    static void relocate(T* dst, T* src, size_t count)
+    {
+        if (count == 0) return;
+        if constexpr (LvnTriviallyRelocatable<T>::value)
+        {
+            memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                new (dst + i) T(static_cast<MoveRef>(src[i])); /* NOTE: cast to rvalue for move constructor */
+                src[i].~T();
+            }
+        }
+    }
+
+    /* allocates a new array with the given capacity and relocates the current elements into it */
+    void reallocate(size_t capacity)
+    {
+        T* temp = Alloc::template allocate<T>(capacity);
+        relocate(temp, m_Data, m_Size);
+        Alloc::deallocate(m_Data, 0); /* elements were already destroyed by relocate */
+        m_Data = temp;
+        m_Capacity = capacity;
+    }
+
+    /* returns the capacity to grow to so that at least size elements fit */
+    size_t grow_capacity(size_t size) const
+    {
+        size_t capacity = m_Capacity ? m_Capacity * 2 : 4;
+        return capacity > size ? capacity : size;
+    }
+
 public:
     LvnVector()
         : m_Data(nullptr), m_Size(0), m_Capacity(0) {}
     ~LvnVector()
     {
-        lvn::memDelete<T>(m_Data, m_Size);
+        Alloc::deallocate(m_Data, m_Size);
         m_Size = 0;
         m_Capacity = 0;
         m_Data = nullptr;
@@ -2497,13 +2943,15 @@ public:
     {
         m_Size = size;
         m_Capacity = size;
-        m_Data = lvn::memNew<T>(size);
+        m_Data = Alloc::template allocate<T>(size);
+        for (size_t i = 0; i < size; i++)
+            new (&m_Data[i]) T();
     }
     LvnVector(const T* data, size_t size)
     {
         m_Size = size;
         m_Capacity = size;
-        m_Data = lvn::memNew<T>(size, false);
+        m_Data = Alloc::template allocate<T>(size);
         for (size_t i = 0; i < size; i++)
             new (&m_Data[i]) T(data[i]);
     }
@@ -2512,7 +2960,7 @@ public:
         LVN_CORE_ASSERT(end > begin, "end element pointer must be after before element pointer");
         m_Size = end - begin;
         m_Capacity = m_Size;
-        m_Data = lvn::memNew<T>(m_Size, false);
+        m_Data = Alloc::template allocate<T>(m_Size);
         for (size_t i = 0; i < m_Size; i++)
             new (&m_Data[i]) T(begin[i]);
     }
@@ -2520,7 +2968,7 @@ public:
     {
         m_Size = size;
         m_Capacity = size;
-        m_Data = lvn::memNew<T>(size, false);
+        m_Data = Alloc::template allocate<T>(size);
         for (size_t i = 0; i < size; i++)
             new (&m_Data[i]) T(value);
     }
@@ -2528,7 +2976,7 @@ public:
     {
         m_Size = other.m_Size;
         m_Capacity = other.m_Size; /* NOTE: we are only allocating up to the size of the other vector, not the capacity */
-        m_Data = lvn::memNew<T>(other.m_Size, false);
+        m_Data = Alloc::template allocate<T>(other.m_Size);
         for (size_t i = 0; i < other.m_Size; i++)
             new (&m_Data[i]) T(other.m_Data[i]);
     }
@@ -2544,14 +2992,17 @@ public:
     LvnVector& operator=(const LvnVector& other)
     {
         if (this == &other) return *this;
-        resize(other.m_Size);
-        for (size_t i = 0; i < m_Size; i++)
+        clear();
+        reserve(other.m_Size);
+        for (size_t i = 0; i < other.m_Size; i++)
             new (&m_Data[i]) T(other.m_Data[i]);
+        m_Size = other.m_Size;
         return *this;
     }
     LvnVector& operator=(LvnVector&& other)
     {
-        lvn::memDelete<T>(m_Data, m_Size);
+        if (this == &other) return *this;
+        Alloc::deallocate(m_Data, m_Size);
         m_Size = other.m_Size;
         m_Capacity = other.m_Capacity;
         m_Data = other.m_Data;
@@ -2609,18 +3060,46 @@ public:
     {
         if (size == 0) return;
         LVN_CORE_ASSERT(index <= m_Size, "insert index not within vector bounds");
-        reserve(m_Size + size);
+
+        if (m_Size + size > m_Capacity)
+        {
+            /* relocate into the new array around the gap so that data may still point into the old array */
+            size_t capacity = grow_capacity(m_Size + size);
+            T* temp = Alloc::template allocate<T>(capacity);
+            for (size_t i = 0; i < size; ++i)
+                new (temp + index + i) T(data[i]);
+            relocate(temp, m_Data, index);
+            relocate(temp + index + size, m_Data + index, m_Size - index);
+            Alloc::deallocate(m_Data, 0);
+            m_Data = temp;
+            m_Capacity = capacity;
+            m_Size += size;
+            return;
+        }
 
         /* shift elements to the right */
-        for (int64_t i = m_Size - 1; i >= (int64_t)index; --i)
+        if constexpr (LvnTriviallyRelocatable<T>::value)
         {
-            new (m_Data + i + size) T(static_cast<std::remove_reference_t<T>&&>(m_Data[i])); /* NOTE: cast to rvalue for move constructor */
-            destruct_at(m_Data + i);
+            memmove(static_cast<void*>(m_Data + index + size), static_cast<const void*>(m_Data + index), (m_Size - index) * sizeof(T));
+        }
+        else
+        {
+            for (int64_t i = m_Size - 1; i >= (int64_t)index; --i)
+            {
+                new (m_Data + i + size) T(static_cast<MoveRef>(m_Data[i])); /* NOTE: cast to rvalue for move constructor */
+                destruct_at(m_Data + i);
+            }
         }
 
-        /* construct new elements in place at index */
+        /* construct new elements in place at index, data that pointed into the shifted elements has moved right by size */
+        const T* shiftBegin = m_Data + index;
+        const T* shiftEnd = m_Data + m_Size;
         for (size_t i = 0; i < size; ++i)
-            new (m_Data + index + i) T(data[i]);
+        {
+            const T* src = data + i;
+            if (src >= shiftBegin && src < shiftEnd) { src += size; }
+            new (m_Data + index + i) T(*src);
+        }
 
         m_Size += size;
     }
@@ -2636,23 +3115,61 @@ public:
 
     bool        empty() const { return m_Size == 0; }
     void        clear() { destruct(); m_Size = 0; }
-    void        clear_free() { if (m_Data) { lvn::memDelete<T>(m_Data, m_Size); m_Size = m_Capacity = 0; m_Data = nullptr; } }
+    void        clear_free() { if (m_Data) { Alloc::deallocate(m_Data, m_Size); m_Size = m_Capacity = 0; m_Data = nullptr; } }
     void        erase(const T* it) { LVN_CORE_ASSERT(it >= m_Data && it < m_Data + m_Size, "erase element not within vector bounds"); size_t index = it - m_Data; erase_index(index); }
-    void        erase_index(size_t index) { LVN_CORE_ASSERT(index < m_Size, "index out of vector size range"); size_t aftIndex = m_Size - index - 1; if (aftIndex != 0) { for (size_t i = index + 1; i < m_Size; i++) { m_Data[i - 1] = m_Data[i]; } destruct_at(&m_Data[m_Size - 1]); } --m_Size; }
+    void        erase_index(size_t index)
+    {
+        LVN_CORE_ASSERT(index < m_Size, "index out of vector size range");
+        if constexpr (LvnTriviallyRelocatable<T>::value)
+        {
+            destruct_at(&m_Data[index]);
+            memmove(static_cast<void*>(m_Data + index), static_cast<const void*>(m_Data + index + 1), (m_Size - index - 1) * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = index + 1; i < m_Size; i++)
+                m_Data[i - 1] = static_cast<MoveRef>(m_Data[i]);
+            destruct_at(&m_Data[m_Size - 1]);
+        }
+        --m_Size;
+    }
     T*          data() { return m_Data; }
     const T*    data() const { return m_Data; }
     size_t      size() const { return m_Size; }
     size_t      capacity() const { return m_Capacity; }
     size_t      memsize() const { return m_Size * sizeof(T); }
     size_t      memcap() const { return m_Capacity * sizeof(T); }
-    void        resize(size_t size) { if (size > m_Size) { reserve(size); for (size_t i = m_Size; i < size; i++) { new (m_Data + i) T(); } } else { for (size_t i = size; i < m_Size; i++) destruct_at(&m_Data[i]); }  m_Size = size; }
-    void        resize(size_t size, const T& value) { if (size > m_Size) { reserve(size); for (size_t i = m_Size; i < size; i++) { new (m_Data + i) T(value); } } else { for (size_t i = size; i < m_Size; i++) destruct_at(&m_Data[i]); }  m_Size = size; }
-    void        reserve(size_t size) { if (size <= m_Capacity) return; T* temp = lvn::memNew<T>(size, false); for (size_t i = 0; i < m_Size; i++) { new (temp + i) T(m_Data[i]); } lvn::memDelete<T>(m_Data, m_Size); m_Data = temp; m_Capacity = size; }
-    void        shrink_to_fit() { if (m_Size >= m_Capacity) { return; } T* temp = lvn::memNew<T>(m_Size, false); for (size_t i = 0; i < m_Size; i++) { new (temp + i) T(m_Data[i]); } lvn::memDelete<T>(m_Data, m_Size); m_Data = temp; m_Capacity = m_Size; }
+    void        resize(size_t size) { if (size > m_Size) { if (size > m_Capacity) { reallocate(grow_capacity(size)); } for (size_t i = m_Size; i < size; i++) { new (m_Data + i) T(); } } else { for (size_t i = size; i < m_Size; i++) destruct_at(&m_Data[i]); }  m_Size = size; }
+    void        resize(size_t size, const T& value) { if (size > m_Size) { if (size > m_Capacity) { reallocate(grow_capacity(size)); } for (size_t i = m_Size; i < size; i++) { new (m_Data + i) T(value); } } else { for (size_t i = size; i < m_Size; i++) destruct_at(&m_Data[i]); }  m_Size = size; }
+    void        reserve(size_t size) { if (size <= m_Capacity) return; reallocate(size); }
+    void        shrink_to_fit() { if (m_Size >= m_Capacity) { return; } reallocate(m_Size); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_Size == m_Capacity)
+        {
+            /* construct the new element before relocating so that args may still refer to elements of this vector */
+            size_t capacity = grow_capacity(m_Size + 1);
+            T* temp = Alloc::template allocate<T>(capacity);
+            new (temp + m_Size) T(static_cast<Args&&>(args)...);
+            relocate(temp, m_Data, m_Size);
+            Alloc::deallocate(m_Data, 0);
+            m_Data = temp;
+            m_Capacity = capacity;
+        }
+        else
+        {
+            new (m_Data + m_Size) T(static_cast<Args&&>(args)...);
+        }
+
+        return m_Data[m_Size++];
+    }
 
-    void        push_back(const T& value) { resize(m_Size + 1); m_Data[m_Size - 1] = value; }
-    void        push_range(const T* data, size_t size) { resize(m_Size + size); for (size_t i = 0; i < size; i++) { m_Data[i + m_Size - size] = data[i]; } }
-    void        pop_back() { if (m_Size == 0) return; destruct_at(&m_Data[m_Size - 1]); resize(m_Size - 1); }
+    void        push_back(const T& value) { emplace_back(value); }
+    void        push_back(T&& value) { emplace_back(static_cast<MoveRef>(value)); }
+    void        push_range(const T* data, size_t size) { insert_index(m_Size, data, size); }
+    void        pop_back() { if (m_Size == 0) return; destruct_at(&m_Data[m_Size - 1]); --m_Size; }
 
     T*          find(const T& e) { T* begin = m_Data; const T* end = m_Data + m_Size; while (begin < end) { if (*begin == e) break; begin++; } return begin; }
     const T*    find(const T& e) const { T* begin = m_Data; const T* end = m_Data + m_Size; while (begin < end) { if (*begin == e) break; begin++; } return begin; }
@@ -2707,6 +3224,7 @@ private:
 
     void destruct_at(LvnINode<T>& node)
     {
+        node.taken = false;
         if constexpr (!std::is_trivially_destructible_v<T>)
             node.value.~T();
         node.next = 0;
@@ -2958,10 +3476,12 @@ public:
     {
         if (!m_Size)
         {
+            /* reuse a freed node if there is one, otherwise no node is taken and the first node can be used */
             reserve(m_Size + 1);
-            m_Head = m_Tail = 0;
+            m_Head = m_Tail = m_FreeSize != 0 ? m_FreeNodes[--m_FreeSize] : 0;
             m_Nodes[m_Head].value = data;
             m_Nodes[m_Head].taken = true;
+            m_Nodes[m_Head].hasNext = m_Nodes[m_Head].hasPrev = false;
             m_Size++;
             return;
         }
@@ -2979,6 +3499,7 @@ public:
             newNode.value = data;
             newNode.prev = m_Tail;
             newNode.hasPrev = true;
+            newNode.hasNext = false;
             newNode.taken = true;
 
             node.next = nodeIndex;
@@ -2998,6 +3519,7 @@ public:
                 newNode.value = data;
                 newNode.prev = m_Tail;
                 newNode.hasPrev = true;
+                newNode.hasNext = false;
                 newNode.taken = true;
 
                 node.next = i;
@@ -3014,10 +3536,12 @@ public:
     {
         if (!m_Size)
         {
+            /* reuse a freed node if there is one, otherwise no node is taken and the first node can be used */
             reserve(m_Size + 1);
-            m_Head = m_Tail = 0;
+            m_Head = m_Tail = m_FreeSize != 0 ? m_FreeNodes[--m_FreeSize] : 0;
             m_Nodes[m_Head].value = data;
             m_Nodes[m_Head].taken = true;
+            m_Nodes[m_Head].hasNext = m_Nodes[m_Head].hasPrev = false;
             m_Size++;
             return;
         }
@@ -3035,6 +3559,7 @@ public:
             newNode.value = data;
             newNode.next = m_Head;
             newNode.hasNext = true;
+            newNode.hasPrev = false;
             newNode.taken = true;
 
             node.prev = nodeIndex;
@@ -3054,6 +3579,7 @@ public:
                 newNode.value = data;
                 newNode.next = m_Head;
                 newNode.hasNext = true;
+                newNode.hasPrev = false;
                 newNode.taken = true;
 
                 node.prev = i;
@@ -3069,7 +3595,15 @@ public:
     void pop_back()
     {
         if (!m_Size) { return; }
-        if (m_Size == 1) { destruct_at(m_Nodes[m_Head]); m_Tail = m_Head = 0; m_Size--; return; }
+        if (m_Size == 1)
+        {
+            LVN_CORE_ASSERT(m_FreeSize < m_FreeCapacity, "free nodes array is full");
+            m_FreeNodes[m_FreeSize++] = m_Head;
+            destruct_at(m_Nodes[m_Head]);
+            m_Tail = m_Head = 0;
+            m_Size--;
+            return;
+        }
 
         /* push back free node */
         LVN_CORE_ASSERT(m_FreeSize < m_FreeCapacity, "free nodes array is full");
@@ -3089,7 +3623,15 @@ public:
     void pop_front()
     {
         if (!m_Size) { return; }
-        if (m_Size == 1) { destruct_at(m_Nodes[m_Head]); m_Tail = m_Head = 0; m_Size--; return; }
+        if (m_Size == 1)
+        {
+            LVN_CORE_ASSERT(m_FreeSize < m_FreeCapacity, "free nodes array is full");
+            m_FreeNodes[m_FreeSize++] = m_Head;
+            destruct_at(m_Nodes[m_Head]);
+            m_Tail = m_Head = 0;
+            m_Size--;
+            return;
+        }
 
         /* push back free node */
         LVN_CORE_ASSERT(m_FreeSize < m_FreeCapacity, "free nodes array is full");
@@ -3113,6 +3655,8 @@ public:
         LvnINode<T>* temp = lvn::memNew<LvnINode<T>>(size, false);
         for (size_t i = 0; i < m_Capacity; i++)
             new (&temp[i]) LvnINode<T>(m_Nodes[i]);
+        for (size_t i = m_Capacity; i < size; i++)
+            temp[i].hasPrev = temp[i].hasNext = temp[i].taken = false; /* memory is not zeroed, new nodes must not look taken */
         destruct();
         lvn::memDelete<LvnINode<T>>(m_Nodes, 0);
         m_Nodes = temp;
@@ -3170,148 +3714,477 @@ public:
 };
 
 
+// -- LvnSpscQueue, LvnMpmcQueue
+// ------------------------------------------------------------
+// - bounded lock-free ring queues, the capacity is rounded up to a power of two and never grows
+// - push returns false when the queue is full and pop returns false when it is empty, neither call blocks or allocates
+// - head and tail are kept on separate cache lines so that producers and consumers do not invalidate each other
+// - LvnSpscQueue only allows one producer thread and one consumer thread, each side keeps a cached copy of the other side's index
+//   and only reloads it when the queue looks full or empty
+// - LvnMpmcQueue allows any number of producers and consumers, every slot holds a sequence number that tells
+//   whether it is ready to be written or read so producers and consumers only contend on the index they move
+
+template <typename T>
+class LvnSpscQueue
+{
+private:
+    alignas(LVN_CACHE_LINE_SIZE) std::atomic<size_t> m_Head;     /* next slot to pop, only written by the consumer */
+    size_t m_CachedTail;                                         /* consumer's last seen tail */
+    alignas(LVN_CACHE_LINE_SIZE) std::atomic<size_t> m_Tail;     /* next slot to push, only written by the producer */
+    size_t m_CachedHead;                                         /* producer's last seen head */
+    alignas(LVN_CACHE_LINE_SIZE) T* m_Data;
+    size_t m_Mask;
+
+    template <typename U>
+    bool push_impl(U&& value)
+    {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_CachedHead > m_Mask)
+        {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+            if (tail - m_CachedHead > m_Mask) { return false; }
+        }
+
+        new (&m_Data[tail & m_Mask]) T(static_cast<U&&>(value));
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    explicit LvnSpscQueue(size_t capacity)
+        : m_Head(0), m_CachedTail(0), m_Tail(0), m_CachedHead(0)
+    {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        m_Data = lvn::memNew<T>(size, false);
+        m_Mask = size - 1;
+    }
+    ~LvnSpscQueue()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (size_t i = m_Head.load(std::memory_order_relaxed); i != m_Tail.load(std::memory_order_relaxed); i++)
+                m_Data[i & m_Mask].~T();
+        }
+        lvn::memDelete<T>(m_Data, 0);
+    }
+
+    LvnSpscQueue(const LvnSpscQueue&) = delete;
+    LvnSpscQueue& operator=(const LvnSpscQueue&) = delete;
+
+    bool push(const T& value) { return push_impl(value); }
+    bool push(T&& value) { return push_impl(static_cast<T&&>(value)); }
+
+    bool pop(T& value)
+    {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_CachedTail)
+        {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            if (head == m_CachedTail) { return false; }
+        }
+
+        T* slot = &m_Data[head & m_Mask];
+        value = static_cast<T&&>(*slot);
+        slot->~T();
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const { return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire); }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return m_Mask + 1; }
+};
+
+template <typename T>
+class LvnMpmcQueue
+{
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;                            /* equals the index when writable, index + 1 when readable */
+        alignas(T) uint8_t storage[sizeof(T)];
+    };
+
+    alignas(LVN_CACHE_LINE_SIZE) std::atomic<size_t> m_Head;     /* next index to pop */
+    alignas(LVN_CACHE_LINE_SIZE) std::atomic<size_t> m_Tail;     /* next index to push */
+    alignas(LVN_CACHE_LINE_SIZE) Cell* m_Cells;
+    size_t m_Mask;
+
+    template <typename U>
+    bool push_impl(U&& value)
+    {
+        Cell* cell;
+        size_t pos = m_Tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &m_Cells[pos & m_Mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (m_Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0) { return false; } /* slot still holds a value from the previous lap, queue is full */
+            else { pos = m_Tail.load(std::memory_order_relaxed); }
+        }
+
+        new (cell->storage) T(static_cast<U&&>(value));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    explicit LvnMpmcQueue(size_t capacity)
+        : m_Head(0), m_Tail(0)
+    {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        m_Cells = lvn::memNew<Cell>(size, false);
+        m_Mask = size - 1;
+
+        for (size_t i = 0; i < size; i++)
+            new (&m_Cells[i].sequence) std::atomic<size_t>(i);
+    }
+    ~LvnMpmcQueue()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (size_t i = m_Head.load(std::memory_order_relaxed); i != m_Tail.load(std::memory_order_relaxed); i++)
+                reinterpret_cast<T*>(m_Cells[i & m_Mask].storage)->~T();
+        }
+        lvn::memDelete<Cell>(m_Cells, 0);
+    }
+
+    LvnMpmcQueue(const LvnMpmcQueue&) = delete;
+    LvnMpmcQueue& operator=(const LvnMpmcQueue&) = delete;
+
+    bool push(const T& value) { return push_impl(value); }
+    bool push(T&& value) { return push_impl(static_cast<T&&>(value)); }
+
+    bool pop(T& value)
+    {
+        Cell* cell;
+        size_t pos = m_Head.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &m_Cells[pos & m_Mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                if (m_Head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0) { return false; } /* slot has not been written yet, queue is empty */
+            else { pos = m_Head.load(std::memory_order_relaxed); }
+        }
+
+        T* slot = reinterpret_cast<T*>(cell->storage);
+        value = static_cast<T&&>(*slot);
+        slot->~T();
+        cell->sequence.store(pos + m_Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size_approx() const /* only exact when no other thread is pushing or popping */
+    {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+    bool empty_approx() const { return size_approx() == 0; }
+    size_t capacity() const { return m_Mask + 1; }
+};
+
+
 // -- LvnHash, LvnHashEntry, LvnHashMap
 // ------------------------------------------------------------
 // simple and light weight replacement to std::hash, std::unordered_map
-// designed to be more cache effecient, all hash entries stored in a single allocated array
-// note that LvnHashMap only takes in integral types for the key value
+// open addressing hash map with linear probing, keys and values are stored in one array of entries alongside an array of control bytes
+// each control byte is either empty or holds 7 bits of the hash of its entry, lookups compare a group of 16 control bytes at once (SSE2/NEON when available)
+// before comparing any keys, capacity is always a power of two so no modulo is needed
+// erasing shifts the following entries of the probe sequence back into the hole instead of leaving tombstones
+// keys can be any type that LvnHash can hash and that can be compared with ==, LvnHash supports integral types, enums, pointers, LvnString and LvnPair/LvnDoublePair
 
 struct LvnHash
 {
     /* splitmix64 */
-    size_t operator()(size_t k) const
+    static size_t mix(uint64_t k)
     {
         k += 0x9E3779B97F4A7C15;
         k = (k ^ (k >> 30)) * 0xBF58476D1CE4E5B9;
         k = (k ^ (k >> 27)) * 0x94D049BB133111EB;
         k = k ^ (k >> 31);
-        return k;
+        return static_cast<size_t>(k);
     }
+
+    /* FNV-1a followed by splitmix64 to spread the bits */
+    static size_t bytes(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t h = 0xCBF29CE484222325;
+        for (size_t i = 0; i < size; i++)
+            h = (h ^ bytes[i]) * 0x100000001B3;
+        return mix(h);
+    }
+
+    static size_t combine(size_t h1, size_t h2) { return mix(h1 ^ (h2 + 0x9E3779B97F4A7C15 + (h1 << 6) + (h1 >> 2))); }
+
+    template <typename K, typename = std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>>
+    size_t operator()(K k) const { return mix(static_cast<uint64_t>(k)); }
+
+    template <typename P>
+    size_t operator()(P* p) const { return mix(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p))); }
+
+    size_t operator()(const LvnString& str) const;
+    size_t operator()(const LvnStringView& str) const;
+
+    template <typename T>
+    size_t operator()(const LvnPair<T>& pair) const { return combine(operator()(pair.first), operator()(pair.second)); }
+
+    template <typename T1, typename T2>
+    size_t operator()(const LvnDoublePair<T1, T2>& pair) const { return combine(operator()(pair.first), operator()(pair.second)); }
 };
 
 template <typename K, typename T>
 struct LvnHashEntry
 {
-    T data;
     K key;
-    size_t nextIndex;
-    bool taken, hasNext;
+    T data;
 };
 
 template <typename K, typename T, typename Hash = LvnHash>
 class LvnHashMap
 {
-    static_assert(std::is_integral_v<K>, "cannot have non integral type as key");
+    using Entry = LvnHashEntry<K, T>;
     using MoveRef = std::remove_reference_t<T>&&;
+
+    static constexpr uint8_t s_CtrlEmpty = 0x80;  /* full control bytes hold the lower 7 bits of the hash, the high bit is only set when empty */
+    static constexpr size_t s_GroupWidth = 16;
+    static constexpr size_t s_MinCapacity = 16;
+
 private:
-    LvnHashEntry<K, T>* m_HashEntries;
+    uint8_t* m_Ctrl;        /* capacity + s_GroupWidth - 1 control bytes, the first bytes are cloned at the end so a group can be loaded at any index */
+    Entry* m_Entries;
     size_t m_Size;
     size_t m_Capacity;
     Hash m_Hasher;
 
-    void destruct()
+    static uint32_t lowest_bit(uint32_t mask)
     {
-        if constexpr (!std::is_trivially_destructible_v<T>)
+    #if defined(_MSC_VER)
+        unsigned long index; _BitScanForward(&index, mask); return index;
+    #else
+        return __builtin_ctz(mask);
+    #endif
+    }
+
+    /* returns a bitmask with one bit per control byte in the group at ctrl that is equal to value */
+    static uint32_t group_match(const uint8_t* ctrl, uint8_t value)
+    {
+    #if defined(LVN_SIMD_SSE2)
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(value)))));
+    #elif defined(LVN_SIMD_NEON)
+        static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        uint8x16_t match = vandq_u8(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(value)), vld1q_u8(bits));
+        return static_cast<uint32_t>(vaddv_u8(vget_low_u8(match))) | (static_cast<uint32_t>(vaddv_u8(vget_high_u8(match))) << 8);
+    #else
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < s_GroupWidth; i++)
+            mask |= static_cast<uint32_t>(ctrl[i] == value) << i;
+        return mask;
+    #endif
+    }
+
+    void set_ctrl(size_t index, uint8_t value)
+    {
+        m_Ctrl[index] = value;
+        if (index < s_GroupWidth - 1)
+            m_Ctrl[m_Capacity + index] = value;
+    }
+
+    size_t hash_key(const K& key) const { return m_Hasher(key); }
+    static uint8_t hash_ctrl(size_t hash) { return static_cast<uint8_t>(hash & 0x7F); }
+    size_t hash_index(size_t hash) const { return (hash >> 7) & (m_Capacity - 1); }
+
+    /* returns the index of the entry with key, or the index of the empty slot the key would be placed in if not found */
+    size_t probe(const K& key, size_t hash, bool* found) const
+    {
+        const uint8_t ctrl = hash_ctrl(hash);
+        size_t pos = hash_index(hash);
+
+        while (true)
         {
-            for (size_t i = 0; i < m_Capacity; i++)
+            uint32_t empty = group_match(&m_Ctrl[pos], s_CtrlEmpty);
+            uint32_t match = group_match(&m_Ctrl[pos], ctrl);
+
+            /* entries of the probe sequence end at the first empty slot */
+            if (empty) { match &= (empty & (0u - empty)) - 1; }
+
+            while (match)
             {
-                if (m_HashEntries[i].taken)
-                    m_HashEntries[i].data.~T();
+                size_t index = (pos + lowest_bit(match)) & (m_Capacity - 1);
+                if (m_Entries[index].key == key) { *found = true; return index; }
+                match &= match - 1;
             }
+
+            if (empty)
+            {
+                *found = false;
+                return (pos + lowest_bit(empty)) & (m_Capacity - 1);
+            }
+
+            pos = (pos + s_GroupWidth) & (m_Capacity - 1);
         }
     }
-    bool erase_recursive(size_t index)
+
+    void destruct()
     {
-        if (m_HashEntries[index].hasNext)
+        if constexpr (!std::is_trivially_destructible_v<Entry>)
         {
-            size_t nextIndex = m_HashEntries[index].nextIndex;
-            m_HashEntries[index].key = m_HashEntries[nextIndex].key;
-            m_HashEntries[index].nextIndex = m_HashEntries[nextIndex].nextIndex;
-            m_HashEntries[index].taken = m_HashEntries[nextIndex].taken;
-            m_HashEntries[index].hasNext = m_HashEntries[nextIndex].hasNext;
-            m_HashEntries[index].data = static_cast<MoveRef>(m_HashEntries[nextIndex].data);
-            if (erase_recursive(nextIndex))
+            for (size_t i = 0; i < m_Capacity; i++)
             {
-                m_HashEntries[index].nextIndex = 0;
-                m_HashEntries[index].hasNext = false;
+                if (m_Ctrl[i] != s_CtrlEmpty)
+                    m_Entries[i].~Entry();
             }
         }
-        else /* last entry in chain */
+    }
+    void free_memory()
+    {
+        lvn::memDelete<uint8_t>(m_Ctrl, 0);
+        lvn::memDelete<Entry>(m_Entries, 0);
+        m_Ctrl = nullptr;
+        m_Entries = nullptr;
+    }
+    void allocate(size_t capacity)
+    {
+        m_Capacity = capacity;
+        m_Ctrl = lvn::memNew<uint8_t>(capacity + s_GroupWidth - 1, false);
+        m_Entries = lvn::memNew<Entry>(capacity, false);
+        memset(m_Ctrl, s_CtrlEmpty, capacity + s_GroupWidth - 1);
+    }
+    void copy_from(const LvnHashMap& other)
+    {
+        m_Size = other.m_Size;
+        m_Capacity = 0; m_Ctrl = nullptr; m_Entries = nullptr;
+        if (other.m_Capacity == 0) return;
+
+        allocate(other.m_Capacity);
+        memcpy(m_Ctrl, other.m_Ctrl, m_Capacity + s_GroupWidth - 1);
+        for (size_t i = 0; i < m_Capacity; i++)
         {
-            if (m_HashEntries[index].taken && !std::is_trivially_destructible_v<T>)
-                m_HashEntries[index].data.~T();
-            m_HashEntries[index].key = 0;
-            m_HashEntries[index].nextIndex = 0;
-            m_HashEntries[index].taken = false;
-            m_HashEntries[index].hasNext = false;
-            return true;
+            if (m_Ctrl[i] != s_CtrlEmpty)
+                new (&m_Entries[i]) Entry(other.m_Entries[i]);
         }
+    }
 
-        return false;
+    /* grows the table before inserting when the load factor would exceed 7/8 */
+    void grow_for_insert()
+    {
+        if (m_Capacity == 0 || (m_Size + 1) * 8 > m_Capacity * 7)
+            rehash(m_Capacity ? m_Capacity * 2 : s_MinCapacity);
+    }
+    void rehash(size_t capacity)
+    {
+        uint8_t* oldCtrl = m_Ctrl;
+        Entry* oldEntries = m_Entries;
+        size_t oldCapacity = m_Capacity;
+
+        allocate(capacity);
+
+        for (size_t i = 0; i < oldCapacity; i++)
+        {
+            if (oldCtrl[i] == s_CtrlEmpty) continue;
+
+            size_t hash = hash_key(oldEntries[i].key);
+            bool found;
+            size_t index = probe(oldEntries[i].key, hash, &found);
+            set_ctrl(index, hash_ctrl(hash));
+            new (&m_Entries[index]) Entry(static_cast<Entry&&>(oldEntries[i]));
+            oldEntries[i].~Entry();
+        }
+
+        lvn::memDelete<uint8_t>(oldCtrl, 0);
+        lvn::memDelete<Entry>(oldEntries, 0);
+    }
+
+    template <typename V>
+    T& insert_impl(const K& key, V&& value, bool assign)
+    {
+        grow_for_insert();
+
+        size_t hash = hash_key(key);
+        bool found;
+        size_t index = probe(key, hash, &found);
+        if (found)
+        {
+            if (assign) m_Entries[index].data = static_cast<V&&>(value);
+            return m_Entries[index].data;
+        }
+
+        set_ctrl(index, hash_ctrl(hash));
+        new (&m_Entries[index]) Entry{ key, static_cast<V&&>(value) };
+        m_Size++;
+        return m_Entries[index].data;
     }
 
 public:
     LvnHashMap()
-        : m_HashEntries(nullptr), m_Size(0), m_Capacity(0) {}
+        : m_Ctrl(nullptr), m_Entries(nullptr), m_Size(0), m_Capacity(0) {}
     ~LvnHashMap()
     {
-        destruct();
-        lvn::memDelete(m_HashEntries, 0);
+        if (m_Capacity) destruct();
+        free_memory();
         m_Size = m_Capacity = 0;
-        m_HashEntries = nullptr;
     }
 
     LvnHashMap(size_t size)
-        : m_Size(0)
+        : m_Ctrl(nullptr), m_Entries(nullptr), m_Size(0), m_Capacity(0)
     {
         reserve(size);
     }
 
     LvnHashMap(const LvnHashMap& other)
     {
-        m_Size = other.m_Size;
-        m_Capacity = other.m_Capacity;
-        m_HashEntries = lvn::memNew<LvnHashEntry<K, T>>(m_Capacity, false);
-        for (size_t i = 0; i < other.m_Capacity; i++)
-        {
-            if (other.m_HashEntries[i].taken)
-                new (&m_HashEntries[i]) LvnHashEntry<K, T>(other.m_HashEntries[i]);
-        }
+        copy_from(other);
     }
     LvnHashMap(LvnHashMap&& other)
     {
+        m_Ctrl = other.m_Ctrl;
+        m_Entries = other.m_Entries;
         m_Size = other.m_Size;
         m_Capacity = other.m_Capacity;
-        m_HashEntries = other.m_HashEntries;
+        other.m_Ctrl = nullptr;
+        other.m_Entries = nullptr;
         other.m_Size = 0;
         other.m_Capacity = 0;
-        other.m_HashEntries = nullptr;
     }
     LvnHashMap& operator=(const LvnHashMap& other)
     {
         if (this == &other) return *this;
-        destruct();
-        lvn::memDelete<LvnHashEntry<K, T>>(m_HashEntries, 0);
-        m_Size = other.m_Size;
-        m_Capacity = other.m_Capacity;
-        m_HashEntries = lvn::memNew<LvnHashEntry<K, T>>(other.m_Capacity, false);
-        for (size_t i = 0; i < other.m_Capacity; i++)
-        {
-            if (other.m_HashEntries[i].taken)
-                new (&m_HashEntries[i]) LvnHashEntry<K, T>(other.m_HashEntries[i]);
-        }
+        if (m_Capacity) destruct();
+        free_memory();
+        copy_from(other);
         return *this;
     }
     LvnHashMap& operator=(LvnHashMap&& other)
     {
-        destruct();
-        lvn::memDelete<LvnHashEntry<K, T>>(m_HashEntries, 0);
+        if (this == &other) return *this;
+        if (m_Capacity) destruct();
+        free_memory();
+        m_Ctrl = other.m_Ctrl;
+        m_Entries = other.m_Entries;
         m_Size = other.m_Size;
         m_Capacity = other.m_Capacity;
-        m_HashEntries = other.m_HashEntries;
+        other.m_Ctrl = nullptr;
+        other.m_Entries = nullptr;
         other.m_Size = 0;
         other.m_Capacity = 0;
-        other.m_HashEntries = nullptr;
         return *this;
     }
 
@@ -3319,222 +4192,128 @@ public:
     {
         return at(key);
     }
-    const T& operator[](K key) const
+    const T& operator[](const K& key) const
     {
         return at(key);
     }
 
-    /* reserves new memory space and rehashes entries */
+    /* reserves space for at least size entries without exceeding the max load factor and rehashes entries */
     void reserve(size_t size)
     {
-        /* step 1: reserve/allocate memory */
-        if (size <= m_Size) return;
-        LvnHashEntry<K, T>* temp = m_HashEntries;
-        size_t tempSize = m_Capacity;
-        m_HashEntries = lvn::memNew<LvnHashEntry<K, T>>(size);
-        m_Capacity = size;
+        size_t capacity = s_MinCapacity;
+        while (capacity * 7 < size * 8)
+            capacity *= 2;
 
-        /* step 2: rehash and insert entries into new table */
-        m_Size = 0;
-        for (size_t i = 0; i < tempSize; i++)
-        {
-            if (temp[i].taken)
-                insert(temp[i].key, static_cast<MoveRef>(temp[i].data));
-        }
-        destruct();
-        lvn::memDelete<LvnHashEntry<K, T>>(temp, 0);
+        if (capacity > m_Capacity)
+            rehash(capacity);
     }
     void insert(const K& key, const T& value)
     {
-        /* resize/rehash when size exceeds 70% capacity (0.7 load factor) */
-        if (m_Size * 10 >= m_Capacity * 7)
-            reserve(m_Capacity ? m_Capacity * 2 : 8);
-
-        size_t index = m_Hasher.operator()(key) % m_Capacity;
-        if (m_HashEntries[index].taken && m_HashEntries[index].key == key)
-        {
-            m_HashEntries[index].data = value;
-            return;
-        }
-
-        /* iterate through entries if key not found */
-        LvnHashEntry<K, T>* entry = &m_HashEntries[index];
-        while (entry->hasNext)
-        {
-            index = entry->nextIndex;
-            entry = &m_HashEntries[entry->nextIndex];
-
-            if (entry->key == key)
-            {
-                entry->data = value;
-                return;
-            }
-        }
-
-        /* add a new entry if key still not found */
-        LvnHashEntry<K, T>* findEntry = &m_HashEntries[index];
-        while (findEntry->taken)
-        {
-            index = (index + 1) % m_Capacity;
-            findEntry = &m_HashEntries[index];
-        }
-
-        findEntry->key = key;
-        findEntry->data = value;
-        findEntry->taken = true;
-        m_Size++;
-
-        if (entry->key != findEntry->key)
-        {
-            entry->nextIndex = index;
-            entry->hasNext = true;
-        }
+        insert_impl(key, value, true);
     }
     void insert(const K& key, T&& value)
     {
-        /* resize/rehash when size exceeds 70% capacity (0.7 load factor) */
-        if (m_Size * 10 >= m_Capacity * 7)
-            reserve(m_Capacity ? m_Capacity * 2 : 8);
-
-        size_t index = m_Hasher.operator()(key) % m_Capacity;
-        if (m_HashEntries[index].taken && m_HashEntries[index].key == key)
-        {
-            m_HashEntries[index].data = static_cast<MoveRef>(value);
-            return;
-        }
-
-        /* iterate through entries if key not found */
-        LvnHashEntry<K, T>* entry = &m_HashEntries[index];
-        while (entry->hasNext)
-        {
-            index = entry->nextIndex;
-            entry = &m_HashEntries[entry->nextIndex];
-
-            if (entry->key == key)
-            {
-                entry->data = static_cast<MoveRef>(value);
-                return;
-            }
-        }
-
-        /* add a new entry if key still not found */
-        LvnHashEntry<K, T>* findEntry = &m_HashEntries[index];
-        while (findEntry->taken)
-        {
-            index = (index + 1) % m_Capacity;
-            findEntry = &m_HashEntries[index];
-        }
-
-        findEntry->key = key;
-        findEntry->data = static_cast<MoveRef>(value);
-        findEntry->taken = true;
-        m_Size++;
-
-        if (entry->key != findEntry->key)
-        {
-            entry->nextIndex = index;
-            entry->hasNext = true;
-        }
+        insert_impl(key, static_cast<MoveRef>(value), true);
     }
     void erase(const K& key)
     {
         if (m_Size == 0) return;
 
-        size_t index = m_Hasher.operator()(key) % m_Capacity;
-        if (m_HashEntries[index].key == key)
-        {
-            erase_recursive(index);
-            return;
-        }
+        bool found;
+        size_t hole = probe(key, hash_key(key), &found);
+        if (!found) return;
 
-        LvnHashEntry<K, T>* entry = &m_HashEntries[index];
-        while (entry->hasNext)
+        m_Entries[hole].~Entry();
+        m_Size--;
+
+        /* backward shift: move following entries of the probe sequence back into the hole until an empty slot
+           or an entry already in its home slot is reached, so that no tombstones are needed */
+        size_t mask = m_Capacity - 1;
+        size_t index = (hole + 1) & mask;
+        while (m_Ctrl[index] != s_CtrlEmpty)
         {
-            index = entry->nextIndex;
-            entry = &m_HashEntries[entry->nextIndex];
+            size_t home = hash_index(hash_key(m_Entries[index].key));
 
-            if (entry->key == key)
+            /* entry can move into the hole if the hole lies within [home, index) of the cyclic probe sequence */
+            if (((index - home) & mask) >= ((index - hole) & mask))
             {
-                erase_recursive(index);
-                return;
+                set_ctrl(hole, m_Ctrl[index]);
+                new (&m_Entries[hole]) Entry(static_cast<Entry&&>(m_Entries[index]));
+                m_Entries[index].~Entry();
+                hole = index;
             }
+
+            index = (index + 1) & mask;
         }
+
+        set_ctrl(hole, s_CtrlEmpty);
     }
     T& at(const K& key)
     {
-        if (m_Size == 0)
-            insert(key, T{});
-
-        size_t index = m_Hasher.operator()(key) % m_Capacity;
-        if (m_HashEntries[index].taken && m_HashEntries[index].key == key)
-            return m_HashEntries[index].data;
-
-        LvnHashEntry<K, T>* entry = &m_HashEntries[index];
-        while (entry->hasNext)
+        if (m_Size != 0)
         {
-            index = entry->nextIndex;
-            entry = &m_HashEntries[entry->nextIndex];
-
-            if (entry->key == key)
-                return entry->data;
+            bool found;
+            size_t index = probe(key, hash_key(key), &found);
+            if (found) return m_Entries[index].data;
         }
 
         /* if key not found, create new entry */
-        insert(key, T{});
-        return at(key);
+        return insert_impl(key, T{}, false);
     }
     const T& at(const K& key) const
     {
-        if (m_Size == 0)
-            insert(key, T{});
-
-        size_t index = m_Hasher.operator()(key) % m_Capacity;
-        if (m_HashEntries[index].taken && m_HashEntries[index].key == key)
-            return m_HashEntries[index].data;
+        const T* data = find(key);
+        LVN_CORE_ASSERT(data != nullptr, "key not found within hash map");
+        return *data;
+    }
 
-        LvnHashEntry<K, T>* entry = &m_HashEntries[index];
-        while (entry->hasNext)
-        {
-            index = entry->nextIndex;
-            entry = &m_HashEntries[entry->nextIndex];
+    /* returns a pointer to the value of key, or nullptr if the key is not in the map */
+    T* find(const K& key)
+    {
+        if (m_Size == 0) return nullptr;
 
-            if (entry->key == key)
-                return entry->data;
-        }
+        bool found;
+        size_t index = probe(key, hash_key(key), &found);
+        return found ? &m_Entries[index].data : nullptr;
+    }
+    const T* find(const K& key) const
+    {
+        return const_cast<LvnHashMap*>(this)->find(key);
+    }
 
-        /* if key not found, create new entry */
-        insert(key, T{});
-        return at(key);
+    bool contains(const K& key) const
+    {
+        return find(key) != nullptr;
     }
 
-    bool contains(const K& key)
+    class iterator
     {
-        if (m_Size == 0) return false;
+    private:
+        const uint8_t* m_Ctrl;
+        Entry* m_Entry;
+        Entry* m_End;
 
-        size_t index = m_Hasher.operator()(key) % m_Capacity;
-        if (key == m_HashEntries[index].key)
-            return true;
+        void skip_empty() { while (m_Entry != m_End && *m_Ctrl == s_CtrlEmpty) { m_Ctrl++; m_Entry++; } }
 
-        LvnHashEntry<K, T>* entry = &m_HashEntries[index];
-        while (entry->hasNext)
-        {
-            index = entry->nextIndex;
-            entry = &m_HashEntries[entry->nextIndex];
+    public:
+        iterator(const uint8_t* ctrl, Entry* entry, Entry* end) : m_Ctrl(ctrl), m_Entry(entry), m_End(end) { skip_empty(); }
 
-            if (entry->key == key)
-                return true;
-        }
+        Entry&      operator*() const { return *m_Entry; }
+        Entry*      operator->() const { return m_Entry; }
+        iterator&   operator++() { m_Ctrl++; m_Entry++; skip_empty(); return *this; }
+        bool        operator==(const iterator& other) const { return m_Entry == other.m_Entry; }
+        bool        operator!=(const iterator& other) const { return m_Entry != other.m_Entry; }
+    };
 
-        return false;
-    }
+    iterator               begin() { return iterator(m_Ctrl, m_Entries, m_Entries + m_Capacity); }
+    iterator               end() { return iterator(m_Ctrl + m_Capacity, m_Entries + m_Capacity, m_Entries + m_Capacity); }
 
-    bool                   empty() { return m_Size == 0; }
-    void                   clear() { if (m_Size) { destruct(); } m_Size = 0; }
-    void                   clear_free() { lvn::memDelete<LvnHashEntry<K, T>>(m_HashEntries, m_Capacity); m_Size = m_Capacity = 0; m_HashEntries = nullptr; }
-    size_t                 size() { return m_Size; }
-    size_t                 capacity() { return m_Capacity; }
-    size_t                 memcap() { return m_Capacity * sizeof(LvnHashEntry<K, T>); }
-    LvnHashEntry<K, T>*    data() { return m_HashEntries; }
+    bool                   empty() const { return m_Size == 0; }
+    void                   clear() { if (m_Size) { destruct(); memset(m_Ctrl, s_CtrlEmpty, m_Capacity + s_GroupWidth - 1); } m_Size = 0; }
+    void                   clear_free() { if (m_Capacity) { destruct(); } free_memory(); m_Size = m_Capacity = 0; }
+    size_t                 size() const { return m_Size; }
+    size_t                 capacity() const { return m_Capacity; }
+    size_t                 memcap() const { return m_Capacity * (sizeof(Entry) + 1); }
 };
 
 
@@ -3554,56 +4333,178 @@ public:
     LvnUniquePtr() : m_Ptr(nullptr) {}
     ~LvnUniquePtr() { lvn::memDelete<T>(m_Ptr); }
 
-    explicit LvnUniquePtr(T* ptr) : m_Ptr(ptr) {}
+    explicit LvnUniquePtr(T* ptr) : m_Ptr(ptr) {}
+
+    template <typename U, typename = typename std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    LvnUniquePtr(LvnUniquePtr<U>&& other) : m_Ptr(other.release()) {}
+
+    LvnUniquePtr(LvnUniquePtr&& other)
+    {
+        m_Ptr = other.m_Ptr;
+        other.m_Ptr = nullptr;
+    }
+    LvnUniquePtr& operator=(LvnUniquePtr&& other)
+    {
+        lvn::memDelete<T>(m_Ptr);
+        m_Ptr = other.m_Ptr;
+        other.m_Ptr = nullptr;
+        return *this;
+    }
+
+    LvnUniquePtr(const LvnUniquePtr& other) = delete;
+    LvnUniquePtr& operator=(const LvnUniquePtr& other) = delete;
+
+    T*          operator->() { return m_Ptr; }
+    const T*    operator->() const { return m_Ptr; }
+
+    T&          operator*() { return *m_Ptr; }
+    const T&    operator*() const { return *m_Ptr; }
+
+    operator    bool() const { return m_Ptr; }
+
+    T*          get() { return m_Ptr; }
+    const T*    get() const { return m_Ptr; }
+
+    T*          release() { T* temp = m_Ptr; m_Ptr = nullptr; return temp; }
+
+    void        reset(T* ptr = nullptr) { if (m_Ptr) { lvn::memDelete<T>(m_Ptr); } m_Ptr = ptr; }
+};
+
+
+// -- LvnHandle
+// ------------------------------------------------------------
+// - generational handle to an object, the lower 32 bits of the id are the slot index and the upper 32 bits are the generation of the slot
+// - an id of 0 is a null handle
+
+template <typename T>
+struct LvnHandle
+{
+    uint64_t id;
+
+    uint32_t    index() const { return static_cast<uint32_t>(id); }
+    uint32_t    generation() const { return static_cast<uint32_t>(id >> 32); }
+
+    bool        operator==(const LvnHandle& other) const { return id == other.id; }
+    bool        operator!=(const LvnHandle& other) const { return id != other.id; }
+    explicit    operator bool() const { return id != 0; }
+};
+
+
+// -- LvnStringView
+// ------------------------------------------------------------
+// - simple and light weight replacement to std::string_view
+// - non owning view of a character range, the viewed string must outlive the view
+// - the range is not guaranteed to be null terminated, use size() instead of strlen and LvnString to get an owning null terminated copy
+// - substr and find do not allocate
+
+class LvnStringView
+{
+private:
+    const char* m_Data;
+    size_t m_Size;
+
+public:
+    static const size_t npos = -1;
+
+    constexpr LvnStringView()
+        : m_Data(""), m_Size(0) {}
+    LvnStringView(const char* str)
+        : m_Data(str ? str : ""), m_Size(str ? strlen(str) : 0) {}
+    constexpr LvnStringView(const char* data, size_t size)
+        : m_Data(data), m_Size(size) {}
+
+    const char& operator [](size_t index) const { LVN_CORE_ASSERT(index < m_Size, "string view index out of range"); return m_Data[index]; }
+
+    bool operator ==(const LvnStringView& other) const { return m_Size == other.m_Size && memcmp(m_Data, other.m_Data, m_Size) == 0; }
+    bool operator !=(const LvnStringView& other) const { return !(*this == other); }
+
+    bool           empty() const { return m_Size == 0; }
+    size_t         length() const { return m_Size; }
+    size_t         size() const { return m_Size; }
+    const char*    data() const { return m_Data; }
+    const char&    front() const { LVN_CORE_ASSERT(m_Size, "cannot call front on empty string view"); return m_Data[0]; }
+    const char&    back() const { LVN_CORE_ASSERT(m_Size, "cannot call back on empty string view"); return m_Data[m_Size - 1]; }
+    const char*    begin() const { return m_Data; }
+    const char*    end() const { return m_Data + m_Size; }
+
+    void           remove_prefix(size_t count) { LVN_CORE_ASSERT(count <= m_Size, "cannot remove more characters than string view size"); m_Data += count; m_Size -= count; }
+    void           remove_suffix(size_t count) { LVN_CORE_ASSERT(count <= m_Size, "cannot remove more characters than string view size"); m_Size -= count; }
 
-    template <typename U, typename = typename std::enable_if_t<std::is_convertible_v<U*, T*>>>
-    LvnUniquePtr(LvnUniquePtr<U>&& other) : m_Ptr(other.release()) {}
+    LvnStringView substr(size_t index, size_t len = npos) const
+    {
+        LVN_CORE_ASSERT(index <= m_Size, "string view index out of bounds");
+        size_t remaining = m_Size - index;
+        return LvnStringView(m_Data + index, len < remaining ? len : remaining);
+    }
 
-    LvnUniquePtr(LvnUniquePtr&& other)
+    size_t find(char ch, size_t index = 0) const
     {
-        m_Ptr = other.m_Ptr;
-        other.m_Ptr = nullptr;
+        if (index >= m_Size) { return npos; }
+        const char* found = static_cast<const char*>(memchr(m_Data + index, ch, m_Size - index));
+        return found ? static_cast<size_t>(found - m_Data) : npos;
     }
-    LvnUniquePtr& operator=(LvnUniquePtr&& other)
+    size_t find(const LvnStringView& str, size_t index = 0) const
     {
-        lvn::memDelete<T>(m_Ptr);
-        m_Ptr = other.m_Ptr;
-        other.m_Ptr = nullptr;
-        return *this;
+        if (str.m_Size == 0) { return index <= m_Size ? index : npos; }
+        if (str.m_Size > m_Size) { return npos; }
+        for (size_t i = index; i + str.m_Size <= m_Size; i++)
+        {
+            i = find(str.m_Data[0], i);
+            if (i == npos || i + str.m_Size > m_Size) { return npos; }
+            if (memcmp(m_Data + i, str.m_Data, str.m_Size) == 0) { return i; }
+        }
+        return npos;
+    }
+    size_t rfind(char ch, size_t index = npos) const
+    {
+        if (m_Size == 0) { return npos; }
+        for (size_t i = (index < m_Size ? index : m_Size - 1) + 1; i > 0; i--)
+        {
+            if (m_Data[i - 1] == ch) { return i - 1; }
+        }
+        return npos;
+    }
+    size_t rfind(const LvnStringView& str) const
+    {
+        if (str.m_Size > m_Size) { return npos; }
+        for (size_t i = m_Size - str.m_Size + 1; i > 0; i--)
+        {
+            if (memcmp(m_Data + i - 1, str.m_Data, str.m_Size) == 0) { return i - 1; }
+        }
+        return npos;
     }
 
-    LvnUniquePtr(const LvnUniquePtr& other) = delete;
-    LvnUniquePtr& operator=(const LvnUniquePtr& other) = delete;
-
-    T*          operator->() { return m_Ptr; }
-    const T*    operator->() const { return m_Ptr; }
-
-    T&          operator*() { return *m_Ptr; }
-    const T&    operator*() const { return *m_Ptr; }
-
-    operator    bool() const { return m_Ptr; }
-
-    T*          get() { return m_Ptr; }
-    const T*    get() const { return m_Ptr; }
-
-    T*          release() { T* temp = m_Ptr; m_Ptr = nullptr; return temp; }
-
-    void        reset(T* ptr = nullptr) { if (m_Ptr) { lvn::memDelete<T>(m_Ptr); } m_Ptr = ptr; }
+    bool           starts_with(const LvnStringView& str) const { return m_Size >= str.m_Size && memcmp(m_Data, str.m_Data, str.m_Size) == 0; }
+    bool           ends_with(const LvnStringView& str) const { return m_Size >= str.m_Size && memcmp(m_Data + m_Size - str.m_Size, str.m_Data, str.m_Size) == 0; }
+    bool           contains(char ch) const { return find(ch) != npos; }
 };
 
+inline size_t LvnHash::operator()(const LvnStringView& str) const { return LvnHash::bytes(str.data(), str.size()); }
+
 
 // -- LvnString
 // ------------------------------------------------------------
 // - simple and light weight replacement to std::string
 // - used for functions or struct data types that need to use or return stored string types
 // - this is meant to be a temporary object on client side, convert LvnString to std::string when possible
+// - strings shorter than 24 characters (including the null terminator) are stored inline without allocating memory
 
 class LvnString
 {
 private:
-    char* m_Data;
+    static const size_t s_LocalCapacity = 24;
+
+    char* m_Data;                              /* points to m_Local when the string is stored inline */
     size_t m_Size;
-    size_t m_Capacity;
+    union
+    {
+        size_t m_Capacity;                     /* capacity of heap allocated strings, including the null terminator */
+        char m_Local[s_LocalCapacity];
+    };
+
+    bool is_local() const { return m_Data == m_Local; }
+    void init(const char* data, size_t size);
+    void move_from(LvnString& other);
 
 public:
     static const size_t npos = -1;
@@ -3612,16 +4513,21 @@ public:
     ~LvnString();
     LvnString(const char* str);
     LvnString(const char* data, size_t size);
+    explicit LvnString(const LvnStringView& view);
     LvnString(const LvnString& other);
+    LvnString(LvnString&& other);
     LvnString& operator=(const LvnString& other);
+    LvnString& operator=(LvnString&& other);
+
+    operator LvnStringView() const { return LvnStringView(m_Data, m_Size); }
 
     char& operator [](size_t index);
     const char& operator [](size_t index) const;
 
-    bool operator ==(const LvnString& other);
-    bool operator !=(const LvnString& other);
-    bool operator ==(const char* str);
-    bool operator !=(const char* str);
+    bool operator ==(const LvnString& other) const;
+    bool operator !=(const LvnString& other) const;
+    bool operator ==(const char* str) const;
+    bool operator !=(const char* str) const;
 
     LvnString operator+(const LvnString& other);
     LvnString operator+(const char* str);
@@ -3647,8 +4553,11 @@ public:
     size_t         length() const { return m_Size; }
     size_t         size() const { return m_Size; }
     size_t         memsize() const { return m_Size * sizeof(char); }
-    size_t         memcap() const { return m_Capacity * sizeof(char); }
+    size_t         capacity() const { return is_local() ? s_LocalCapacity : m_Capacity; }
+    size_t         memcap() const { return capacity() * sizeof(char); }
     const char*    c_str() const { return m_Data; }
+    LvnStringView  view() const { return LvnStringView(m_Data, m_Size); }
+    LvnStringView  view(size_t index, size_t len = npos) const { return view().substr(index, len); }
     char*          data() { return m_Data; }
     const char*    data() const { return m_Data; }
 
@@ -3702,72 +4611,230 @@ public:
 };
 LvnString operator+(const char* str, const LvnString& other);
 
+inline size_t LvnHash::operator()(const LvnString& str) const { return LvnHash::bytes(str.data(), str.size()); }
+
+
+// -- LvnFrameString
+// ------------------------------------------------------------
+// - append only string allocated from the per frame arena, used for building temporary strings on the render thread (eg. debug text drawn each frame)
+// - the string must not be kept past the frame it was created in, memory is reclaimed when the frame arena is reset
+
+class LvnFrameString
+{
+private:
+    char* m_Data;
+    size_t m_Size;
+    size_t m_Capacity;
+
+public:
+    LvnFrameString()
+        : m_Data(nullptr), m_Size(0), m_Capacity(0) {}
+    LvnFrameString(const char* str)
+        : m_Data(nullptr), m_Size(0), m_Capacity(0) { append(str, strlen(str)); }
+
+    void operator+=(const LvnString& other) { append(other.c_str(), other.size()); }
+    void operator+=(const LvnStringView& view) { append(view.data(), view.size()); }
+    void operator+=(const char* str) { append(str, strlen(str)); }
+    void operator+=(const char& ch) { push_back(ch); }
+
+    void append(const char* str, size_t size)
+    {
+        reserve(m_Size + size);
+        memcpy(m_Data + m_Size, str, size);
+        m_Size += size;
+        m_Data[m_Size] = '\0';
+    }
+    void push_back(const char& ch)
+    {
+        reserve(m_Size + 1);
+        m_Data[m_Size++] = ch;
+        m_Data[m_Size] = '\0';
+    }
+    void reserve(size_t size)
+    {
+        if (size < m_Capacity) { return; }
+        size_t capacity = m_Capacity ? m_Capacity * 2 : 64; /* grow geometrically, old buffers are not freed until the arena resets */
+        while (capacity <= size) { capacity *= 2; }
+        char* data = static_cast<char*>(lvn::frameArenaAlloc(capacity, 1));
+        if (m_Size) { memcpy(data, m_Data, m_Size); }
+        data[m_Size] = '\0';
+        m_Data = data;
+        m_Capacity = capacity;
+    }
+    void clear() { m_Size = 0; if (m_Data) { m_Data[0] = '\0'; } }
+
+    bool           empty() const { return m_Size == 0; }
+    size_t         size() const { return m_Size; }
+    size_t         length() const { return m_Size; }
+    const char*    c_str() const { return m_Data ? m_Data : ""; }
+    char*          data() { return m_Data; }
+    const char*    data() const { return m_Data; }
+};
+
+
+// -- LvnData, LvnUniqueData
+// ------------------------------------------------------------
+// - LvnData holds an array of elements in reference counted storage, copies share the storage so copying and returning by value is O(1)
+// - storage is copy on write, non const access to elements makes a unique copy first if the storage is shared with another LvnData
+// - use slice() to get a sub range of the data that shares the same storage, eg. a buffer view into a loaded file
+// - from_external() wraps memory owned by someone else (eg. a mapped file), the release function is called when the last reference is gone
+//   external memory is treated as read only, non const access always makes a unique copy first
+// - from_owned() takes ownership of elements allocated elsewhere (eg. pixels decoded by stb_image) without copying them, the elements
+//   are writable in place like any other unique storage and the release function frees them when the last reference is gone
+// - LvnUniqueData is the move only version for unique ownership, it can be moved into an LvnData without copying
+//   LvnUniqueData::uninitialized() skips zeroing trivial elements for buffers that are filled right after allocating
+
+template<typename T>
+class LvnUniqueData;
+
 template<typename T>
 class LvnData
 {
 private:
-    T* m_Data;
+    struct Block
+    {
+        std::atomic<uint32_t> refCount;
+        size_t size;                      /* number of elements constructed in the block */
+        void (*releaseFunc)(void*);       /* set if the elements are external and not placed after the header */
+        void* releaseData;
+        bool readOnly;                    /* external elements that must be copied before any write */
+    };
+
+    /* elements are placed directly after the block header in the same allocation */
+    static constexpr size_t s_HeaderSize = (sizeof(Block) + alignof(T) - 1) & ~(alignof(T) - 1);
+
+    Block* m_Block;
+    T* m_Data;          /* pointer to the first element in range, not always the start of the block when sliced */
     size_t m_Size;
 
+    static T* block_data(Block* block) { return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(block) + s_HeaderSize); }
+
+    static LvnData<T> wrap(T* data, size_t size, void (*releaseFunc)(void*), void* releaseData, bool readOnly)
+    {
+        LvnData<T> wrapped;
+        if (size == 0) { if (releaseFunc) { releaseFunc(releaseData); } return wrapped; }
+
+        wrapped.m_Block = reinterpret_cast<Block*>(lvn::memNew<uint8_t>(sizeof(Block), false));
+        new (&wrapped.m_Block->refCount) std::atomic<uint32_t>(1);
+        wrapped.m_Block->size = size;
+        wrapped.m_Block->releaseFunc = releaseFunc;
+        wrapped.m_Block->releaseData = releaseData;
+        wrapped.m_Block->readOnly = readOnly;
+        wrapped.m_Data = data;
+        wrapped.m_Size = size;
+        return wrapped;
+    }
+
+    void allocate(size_t size)
+    {
+        m_Size = size;
+        if (size == 0) { m_Block = nullptr; m_Data = nullptr; return; }
+
+        m_Block = reinterpret_cast<Block*>(lvn::memNew<uint8_t>(s_HeaderSize + size * sizeof(T), false));
+        new (&m_Block->refCount) std::atomic<uint32_t>(1);
+        m_Block->size = size;
+        m_Block->releaseFunc = nullptr;
+        m_Block->releaseData = nullptr;
+        m_Block->readOnly = false;
+        m_Data = block_data(m_Block);
+    }
+    void release()
+    {
+        if (m_Block && m_Block->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            if (m_Block->releaseFunc)
+            {
+                m_Block->releaseFunc(m_Block->releaseData);
+                lvn::memDelete<uint8_t>(reinterpret_cast<uint8_t*>(m_Block), 0);
+                m_Block = nullptr;
+                m_Data = nullptr;
+                m_Size = 0;
+                return;
+            }
+
+            T* data = block_data(m_Block);
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (size_t i = 0; i < m_Block->size; i++)
+                    data[i].~T();
+            }
+            lvn::memDelete<uint8_t>(reinterpret_cast<uint8_t*>(m_Block), 0);
+        }
+        m_Block = nullptr;
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+    void share(const LvnData<T>& other)
+    {
+        m_Block = other.m_Block;
+        m_Data = other.m_Data;
+        m_Size = other.m_Size;
+        if (m_Block) { m_Block->refCount.fetch_add(1, std::memory_order_relaxed); }
+    }
+    void take(LvnData<T>& other)
+    {
+        m_Block = other.m_Block;
+        m_Data = other.m_Data;
+        m_Size = other.m_Size;
+        other.m_Block = nullptr;
+        other.m_Data = nullptr;
+        other.m_Size = 0;
+    }
+
+    friend class LvnUniqueData<T>;
+
 public:
     LvnData()
-        : m_Data(nullptr), m_Size(0) {}
+        : m_Block(nullptr), m_Data(nullptr), m_Size(0) {}
 
     ~LvnData()
     {
-        delete [] m_Data;
+        release();
     }
 
+    explicit LvnData(size_t size)
+    {
+        allocate(size);
+        for (size_t i = 0; i < size; i++)
+            new (&m_Data[i]) T();
+    }
     LvnData(const T* data, size_t size)
     {
-        m_Size = size;
-        m_Data = lvn::memNew<T>(size, false);
-
+        allocate(size);
         for (size_t i = 0; i < size; i++)
             new (&m_Data[i]) T(data[i]);
     }
     LvnData(const LvnData<T>& other)
     {
-        m_Size = other.m_Size;
-        m_Data = lvn::memNew<T>(other.m_Size, false);
-
-        for (size_t i = 0; i < other.m_Size; i++)
-            new (&m_Data[i]) T(other.m_Data[i]);
+        share(other);
     }
     LvnData(LvnData<T>&& other)
     {
-        m_Size = other.m_Size;
-        m_Data = other.m_Data;
-        other.m_Size = 0;
-        other.m_Data = nullptr;
+        take(other);
+    }
+    LvnData(LvnUniqueData<T>&& other)
+    {
+        take(other.m_Data);
     }
     LvnData<T>& operator=(const LvnData<T>& other)
     {
         if (this == &other) return *this;
-        lvn::memDelete<T>(m_Data, m_Size);
-        m_Size = other.m_Size;
-        m_Data = lvn::memNew<T>(other.m_Size, false);
-
-        for (size_t i = 0; i < other.m_Size; i++)
-            new (&m_Data[i]) T(other.m_Data[i]);
-
+        release();
+        share(other);
         return *this;
     }
     LvnData<T>& operator=(LvnData<T>&& other)
     {
         if (this == &other) return *this;
-        lvn::memDelete<T>(m_Data, m_Size);
-        m_Size = other.m_Size;
-        m_Data = other.m_Data;
-        other.m_Size = 0;
-        other.m_Data = nullptr;
+        release();
+        take(other);
         return *this;
     }
 
     T& operator[](size_t i)
     {
         LVN_CORE_ASSERT(i < m_Size, "element index out of range");
-        return m_Data[i];
+        return data()[i];
     }
     const T& operator [](size_t i) const
     {
@@ -3775,18 +4842,109 @@ public:
         return m_Data[i];
     }
 
+    /* wraps external elements without copying, releaseFunc is called with releaseData once no LvnData references the elements */
+    static LvnData<T> from_external(const T* data, size_t size, void (*releaseFunc)(void*), void* releaseData)
+    {
+        return LvnData<T>::wrap(const_cast<T*>(data), size, releaseFunc, releaseData, true);
+    }
+
+    /* takes ownership of elements without copying, releaseFunc is called with releaseData once no LvnData references the elements
+       the elements are destructed by the release function, not by LvnData */
+    static LvnData<T> from_owned(T* data, size_t size, void (*releaseFunc)(void*), void* releaseData)
+    {
+        return LvnData<T>::wrap(data, size, releaseFunc, releaseData, false);
+    }
+
+    /* makes a unique copy of the elements in range if the storage is shared or read only */
+    void detach()
+    {
+        if (m_Block == nullptr || (m_Block->refCount.load(std::memory_order_acquire) == 1 && !m_Block->readOnly)) { return; }
+        LvnData<T> copy(m_Data, m_Size);
+        release();
+        take(copy);
+    }
+
+    /* returns a sub range of the data that shares the same storage */
+    LvnData<T> slice(size_t offset, size_t count) const
+    {
+        LVN_CORE_ASSERT(offset + count <= m_Size, "slice range out of data bounds");
+        LvnData<T> data(*this);
+        data.m_Data += offset;
+        data.m_Size = count;
+        return data;
+    }
+
+    LvnData<T>        clone() const { return LvnData<T>(m_Data, m_Size); }
+    bool              unique() const { return m_Block == nullptr || m_Block->refCount.load(std::memory_order_acquire) == 1; }
+    uint32_t          use_count() const { return m_Block ? m_Block->refCount.load(std::memory_order_acquire) : 0; }
+    bool              external() const { return m_Block != nullptr && m_Block->readOnly; }
+
     size_t            size() const { return m_Size; }
     size_t            memsize() const { return m_Size * sizeof(T); }
+    bool              empty() const { return m_Size == 0; }
 
-    T*                data() { return m_Data; }
-    const T* const    data() const { return m_Data; }
+    T*                data() { detach(); return m_Data; }
+    const T*          data() const { return m_Data; }
 
-    const T* const    begin() const { return &m_Data[0]; }
-    const T* const    end() const { return &m_Data[0] + m_Size; }
+    const T*          begin() const { return m_Data; }
+    const T*          end() const { return m_Data + m_Size; }
     const T&          front() const { return m_Data[0]; }
     const T&          back() const { return m_Data[m_Size - 1]; }
 };
 
+template<typename T>
+class LvnUniqueData
+{
+private:
+    LvnData<T> m_Data;
+
+    friend class LvnData<T>;
+
+public:
+    LvnUniqueData() = default;
+    explicit LvnUniqueData(size_t size)
+        : m_Data(size) {}
+    LvnUniqueData(const T* data, size_t size)
+        : m_Data(data, size) {}
+
+    /* allocates the elements without initializing them, for buffers that are fully overwritten right away (eg. by fread) */
+    static LvnUniqueData<T> uninitialized(size_t size)
+    {
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>, "uninitialized elements must be trivial");
+        LvnUniqueData<T> data;
+        data.m_Data.allocate(size);
+        return data;
+    }
+
+    LvnUniqueData(const LvnUniqueData<T>&) = delete;
+    LvnUniqueData<T>& operator=(const LvnUniqueData<T>&) = delete;
+    LvnUniqueData(LvnUniqueData<T>&& other) = default;
+    LvnUniqueData<T>& operator=(LvnUniqueData<T>&& other) = default;
+
+    T& operator[](size_t i)
+    {
+        LVN_CORE_ASSERT(i < m_Data.m_Size, "element index out of range");
+        return m_Data.m_Data[i];
+    }
+    const T& operator [](size_t i) const
+    {
+        LVN_CORE_ASSERT(i < m_Data.m_Size, "element index out of range");
+        return m_Data.m_Data[i];
+    }
+
+    size_t            size() const { return m_Data.m_Size; }
+    size_t            memsize() const { return m_Data.m_Size * sizeof(T); }
+    bool              empty() const { return m_Data.m_Size == 0; }
+
+    T*                data() { return m_Data.m_Data; }
+    const T*          data() const { return m_Data.m_Data; }
+
+    T*                begin() { return m_Data.m_Data; }
+    const T*          begin() const { return m_Data.m_Data; }
+    T*                end() { return m_Data.m_Data + m_Data.m_Size; }
+    const T*          end() const { return m_Data.m_Data + m_Data.m_Size; }
+};
+
 class LvnTimer
 {
 public:
@@ -3802,6 +4960,21 @@ private:
     int64_t m_Start, m_Current;
 };
 
+class LvnProfileScope
+{
+public:
+    explicit LvnProfileScope(const char* name) : m_Name(name), m_Start(0), m_Active(lvn::profileIsEnabled()) { if (m_Active) { m_Start = lvn::profileBeginZone(); } }
+    ~LvnProfileScope() { if (m_Active) { lvn::profileEndZone(m_Name, m_Start); } }
+
+    LvnProfileScope(const LvnProfileScope&) = delete;
+    LvnProfileScope& operator=(const LvnProfileScope&) = delete;
+
+private:
+    const char* m_Name;
+    uint64_t m_Start;
+    bool m_Active;
+};
+
 class LvnThread
 {
 private:
@@ -6224,18 +7397,95 @@ struct LvnMemoryBindingInfo
     uint64_t count;
 };
 
+struct LvnMemSlabStats
+{
+    uint32_t blockSize;           // size in bytes of each block in the size class
+    uint64_t slabCount;           // number of slabs taken by all threads for the size class
+    uint64_t allocCount;          // total number of blocks allocated
+    uint64_t freeCount;           // total number of blocks freed by the thread that allocated them
+    uint64_t remoteFreeCount;     // total number of blocks freed by a different thread than the one that allocated them
+    uint64_t liveBlockCount;      // number of blocks currently allocated
+};
+
+struct LvnMemTrackStats
+{
+    const char* name;             // type name of lvn::memNew allocations, "memAlloc" for lvn::memAlloc
+    const char* file;             // file of the allocation site, nullptr when the stats are per type
+    int line;
+    uint64_t liveCount;           // number of allocations not yet freed
+    uint64_t liveBytes;
+    uint64_t peakBytes;           // highest number of live bytes
+    uint64_t totalCount;          // number of allocations made since tracking started
+    uint64_t totalBytes;
+};
+
+struct LvnMemObjectStats
+{
+    LvnStructureType sType;
+    uint64_t objectSize;          // size in bytes of each object
+    uint64_t liveCount;           // number of objects not yet destroyed
+    uint64_t peakCount;           // highest number of live objects, the high-water mark of the memory pool binding
+    uint64_t poolBaseCount;       // number of objects in the base memory block of the memory pool, 0 when not using the memory pool
+    uint64_t poolBlockCount;      // number of objects in each further memory block of the memory pool
+    uint64_t poolBlocksAllocated; // number of further memory blocks allocated because the peak went over the base count
+};
+
+struct LvnJob
+{
+    LvnJobFunc func;                // function run by the worker that takes the job
+    void* data;                     // user data passed to the function, must stay valid until the job has finished
+};
+
+struct LvnJobCounter
+{
+    std::atomic<int32_t> value{0};  // number of submitted jobs that have not finished yet
+};
+
+struct LvnIoReadInfo
+{
+    const char* filepath;           // path of the file to read, the path is copied into the request
+    uint64_t offset;                // byte offset in the file to start reading from
+    uint64_t size;                  // number of bytes to read, 0 reads to the end of the file
+    LvnIoPriority priority;
+    LvnIoCallbackFunc callback;     // called once when the request completes, fails or is cancelled, may be nullptr
+    void* userData;                 // passed to the callback
+    bool deferCallback;             // call the callback from lvn::ioDispatchCallbacks instead of on the I/O thread
+};
+
+struct LvnProfileZoneStats
+{
+    const char* name;             // name given to LVN_PROFILE_SCOPE
+    uint32_t callCount;           // number of times the zone was recorded in the frame
+    uint32_t depth;               // lowest nesting depth the zone was recorded at, 0 for a zone with no parent on its thread
+    double totalMs;               // total time of every call of the zone, nested calls of the same zone are counted again
+    double maxMs;                 // time of the longest call
+};
+
+struct LvnProfileFrameStats
+{
+    uint64_t frameIndex;          // number of frames completed before this one
+    double cpuMs;                 // time from lvn::profileBeginFrame to lvn::profileEndFrame
+    double frameMs;               // time from the start of the previous frame to the start of this one, 0 for the first frame
+    uint32_t zoneCount;           // number of distinct zones recorded on any thread during the frame
+};
+
 struct LvnContextCreateInfo
 {
     LvnString                     applicationName;               // name of application or program
     LvnWindowApi                  windowapi;                     // window api to use when creating windows
     LvnGraphicsApi                graphicsapi;                   // graphics api to use when rendering (eg. vulkan, opengl)
     bool                          enableMultithreading;          // enables the use of multithreading within the context
+    uint32_t                      jobWorkerCount;                // number of job system workers including the thread creating the context when multithreading is enabled, 0 uses the hardware thread count
+    uint32_t                      ioThreadCount;                 // number of threads reading files for lvn::asyncRead when multithreading is enabled, 0 uses the default of 2
 
     struct
     {
         bool                      enableLogging;                 // enable or diable logging
         bool                      disableCoreLogging;            // whether to disable core logging in the library
         bool                      enableGraphicsApiDebugLogs;    // enable debug output for graphics api calls (eg. vulkan validation layer, opengl debug callbacks)
+        bool                      enableAsyncLogging;            // format and write messages on a background thread, callers only push a compact record to a queue
+        uint32_t                  asyncQueueCapacity;            // number of records the async log queue can hold, rounded up to a power of two; 0 uses the default capacity
+        LvnLogOverflowPolicy      asyncOverflowPolicy;           // what to do with a message when the async log queue is full
     } logging;
 
     struct
@@ -6248,11 +7498,20 @@ struct LvnContextCreateInfo
     struct
     {
         LvnMemAllocMode           memAllocMode;                  // memory allocation mode, how memory should be allocated when creating new object
+        LvnMemAllocator           allocator;                     // general heap allocator used by lvn::memAlloc and lvn::memNew, the slab allocator stays installed after the context is terminated
+        size_t                    frameArenaSize;                // size in bytes of each per frame arena used by lvn::frameArenaAlloc, the arena grows if more is allocated in a frame; 0 uses the default size
+        bool                      enableMemoryTracking;          // records the live and peak bytes of every lvn::memNew type, allocation site and sType, a report is printed when the context is terminated
         LvnMemoryBindingInfo*     pMemoryBindings;               // array of object alloc info structs to tell how many objects of each type to allocate if using memory pool
         uint32_t                  memoryBindingCount;            // number of object alloc inso structs;
         LvnMemoryBindingInfo*     pBlockMemoryBindings;          // array of objects alloc info structs of each type to allocate for further memory blocks in case if the first block is full
         uint32_t                  blockMemoryBindingCount;       // number of block object alloc info structs
     } memoryInfo;
+
+    struct
+    {
+        bool                      enableProfiling;               // record LVN_PROFILE_SCOPE zones from context creation, profiling can also be toggled later with lvn::profileEnable
+        uint32_t                  threadEventCapacity;           // number of zones kept per thread before the oldest are overwritten, rounded up to a power of two; 0 uses the default capacity
+    } profiling;
 };
 
 /* [Logging] */
@@ -6267,6 +7526,7 @@ struct LvnLoggerCreateInfo
         bool enableLogToFile;
         LvnString filename;
         LvnFileMode filemode;
+        LvnLogFileFormat format;
     } fileConfig;
 };
 
@@ -6287,6 +7547,7 @@ struct LvnLogFile
 {
     LvnString filename;
     LvnFileMode filemode;
+    LvnLogFileFormat format;
     FILE* fileptr;
     bool logToFile;
 };
@@ -6717,6 +7978,30 @@ struct LvnFrameBufferCreateInfo
     LvnTextureMode textureMode;
 };
 
+struct LvnFrameStats
+{
+    uint64_t frameIndex;               // number of frames submitted to the window before this one
+
+    // counters of the last submitted frame
+    uint32_t commandCount;             // number of lvn::renderCmd* commands recorded
+    uint32_t drawCallCount;            // number of draw commands recorded (eg. lvn::renderCmdDrawIndexed)
+    uint32_t pipelineBindCount;        // number of lvn::renderCmdBindPipeline commands recorded
+    uint32_t descriptorSetBindCount;   // number of descriptor sets bound with lvn::renderCmdBindDescriptorSets
+    uint64_t bufferUploadBytes;        // bytes uploaded with lvn::bufferUpdateData during the frame
+    uint32_t texturesCreated;          // number of textures created during the frame
+    uint64_t drawListVertexCount;      // vertices drawn from LvnDrawList by the renderer
+    uint64_t drawListIndexCount;       // indices drawn from LvnDrawList by the renderer
+
+    // frame times in milliseconds
+    double cpuTimeMs;                  // time from lvn::renderBeginNextFrame to the end of lvn::renderDrawSubmit of the last frame
+    double frameTimeMs;                // time between the last two calls to lvn::renderBeginNextFrame
+    double minFrameTimeMs;             // min, avg, max and 99th percentile over the frame time history
+    double avgFrameTimeMs;
+    double maxFrameTimeMs;
+    double p99FrameTimeMs;
+    uint32_t historyCount;             // number of frame times in the history, up to LVN_FRAME_STATS_HISTORY
+};
+
 struct LvnBufferCreateInfo
 {
     LvnBufferTypeFlagBits type;
@@ -6737,6 +8022,9 @@ struct LvnImageData
     LvnData<uint8_t> pixels;
     uint32_t width, height, channels;
     uint64_t size;
+
+    LvnTextureCompression compression = Lvn_TextureCompression_None; // block format of pixels (eg. from lvn::imageCompress or a ktx2/dds file), none for uncompressed pixels
+    LvnVector<LvnImageData> mipLevels;        // levels below this one that were stored in a ktx2/dds file, their pixels point into the same file data
 };
 
 struct LvnImageHdrData
@@ -6746,6 +8034,15 @@ struct LvnImageHdrData
     uint64_t size;
 };
 
+struct LvnImageLoadInfo
+{
+    const char* filepath;           // path of the image file to load, set either filepath or data
+    const uint8_t* data;            // encoded image in memory (eg. a buffer view of a glb file), must stay valid until loadImagesBatch returns
+    uint64_t size;                  // size of the encoded image data in bytes
+    int forceChannels;              // number of channels to decode the pixels into (1...4), 0 keeps the channels of the image
+    bool flipVertically;            // flips the image vertically on load
+};
+
 struct LvnSamplerCreateInfo
 {
     LvnTextureFilter minFilter, magFilter;
@@ -6754,10 +8051,14 @@ struct LvnSamplerCreateInfo
 
 struct LvnTextureCreateInfo
 {
-    LvnImageData imageData;
+    LvnImageData imageData;                   // full size level of the texture, holds the compressed blocks if compression is set
     LvnTextureFormat format;
     LvnTextureFilter minFilter, magFilter;
     LvnTextureMode wrapS, wrapT;
+
+    const LvnImageData* pMipLevels;           // optional levels below imageData (eg. from lvn::imageGenMipLevels), each half the size of the previous, imageData.mipLevels are used if nullptr
+    uint32_t mipLevelCount;                   // number of levels in pMipLevels, 0 creates the texture with a single level unless imageData has mip levels
+    LvnTextureCompression compression;        // block format of imageData and pMipLevels (eg. from lvn::imageCompress), none uses imageData.compression
 };
 
 struct LvnTextureSamplerCreateInfo
@@ -6920,6 +8221,77 @@ struct LvnFont
     LvnData<LvnFontGlyph> glyphs;
 };
 
+struct LvnAssetManagerCreateInfo
+{
+    uint64_t uploadBudgetBytes;               // most bytes of texture, vertex and index data given to the graphics api per lvn::assetManagerUpdate, 0 uses the default of 16 MiB
+    float uploadBudgetMs;                     // most time spent creating graphics objects per lvn::assetManagerUpdate, 0 uses the default of 2 ms
+    LvnTexture* placeholderTexture;           // returned by lvn::assetGetTexture until a texture is ready, nullptr creates a 1x1 white texture
+};
+
+struct LvnAssetLoadInfo
+{
+    LvnAssetType type;
+    const char* filepath;                     // assets are shared by type and path (and font size for fonts), the path is copied
+    LvnIoPriority priority;                   // assets with a higher priority are read and uploaded first
+
+    // textures and font atlases, the parameters of the first load of a shared asset are used
+    LvnTextureFormat format;
+    LvnTextureFilter minFilter, magFilter;
+    LvnTextureMode wrapS, wrapT;
+    bool flipVertically;
+
+    // textures only, mip levels and compression are done on the decoding job so the render thread only uploads the result
+    bool genMipLevels;                        // generates the full mip chain of the texture
+    LvnImageMipFilter mipFilter;
+    LvnTextureCompression compression;        // compresses the texture and its mip levels into bc blocks, none keeps uncompressed pixels
+
+    // fonts
+    uint32_t fontSize;
+};
+
+struct LvnAssetManagerStats
+{
+    uint32_t assetCount;                      // number of assets including assets that are still loading
+    uint32_t loadingCount;
+    uint32_t decodedCount;                    // assets waiting for their graphics objects to be created
+    uint32_t readyCount;
+    uint32_t failedCount;
+
+    uint32_t lastUploadCount;                 // assets made ready by the last lvn::assetManagerUpdate
+    uint64_t lastUploadBytes;
+    float lastUploadMs;
+};
+
+struct LvnPackImageInfo
+{
+    const char* filepath;                     // image file, loaded with 4 channels, ktx2 and dds files are stored as they are
+    LvnTextureFormat format;                  // srgb images are filtered in linear space when the mip levels are generated
+};
+
+struct LvnPackFontInfo
+{
+    const char* filepath;                     // ttf font file, the atlas is rasterised when the pack is baked
+    uint32_t fontSize;
+    const uint32_t* pCodepoints;              // nullptr uses the default codepoints
+    uint32_t codepointCount;
+    LvnLoadFontFlagBits flags;
+};
+
+struct LvnPackBakeInfo
+{
+    const char* const* pModelFilepaths;       // gltf, glb and obj files
+    uint32_t modelCount;
+    const LvnPackImageInfo* pImages;
+    uint32_t imageCount;
+    const LvnPackFontInfo* pFonts;
+    uint32_t fontCount;
+
+    // images and model textures, font atlases are always stored as a single uncompressed level
+    bool genMipLevels;                        // generates the full mip chain of every image that does not have one
+    LvnImageMipFilter mipFilter;
+    LvnTextureCompression compression;        // compresses every image and its mip levels into bc blocks, images that are already compressed are stored as they are
+};
+
 
 // -- [SUBSECT]: Audio Struct Implementation
 // ------------------------------------------------------------
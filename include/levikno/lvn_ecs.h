@@ -87,9 +87,10 @@ public:
 
     void remove_entity(LvnEntity entity)
     {
-        LVN_CORE_ASSERT(m_EntityToIndex.contains(entity), "entity not found within component array");
+        const size_t* pIndex = m_EntityToIndex.find(entity);
+        LVN_CORE_ASSERT(pIndex != nullptr, "entity not found within component array");
 
-        const size_t index = m_EntityToIndex[entity];
+        const size_t index = *pIndex;
         LVN_CORE_ASSERT(index < m_Data.size(), "index out of vector size range");
 
         m_AvailableIndices.push(index);
@@ -98,9 +99,10 @@ public:
 
     T& get_entity_component(LvnEntity entity)
     {
-        LVN_CORE_ASSERT(m_EntityToIndex.contains(entity), "entity not found within component array");
+        const size_t* pIndex = m_EntityToIndex.find(entity);
+        LVN_CORE_ASSERT(pIndex != nullptr, "entity not found within component array");
 
-        const size_t index = m_EntityToIndex[entity];
+        const size_t index = *pIndex;
         LVN_CORE_ASSERT(index < m_Data.size(), "index out of vector size range");
 
         return m_Data[index];
@@ -152,8 +154,9 @@ public:
     template <typename T>
     LvnComponentArray<T>& get_component()
     {
-        LVN_CORE_ASSERT(m_Components.contains(lvn::getTypeId<T>()), "component not found within registry");
-        return *static_cast<LvnComponentArray<T>*>(m_Components[lvn::getTypeId<T>()].get());
+        LvnUniquePtr<LvnIComponentArray>* component = m_Components.find(lvn::getTypeId<T>());
+        LVN_CORE_ASSERT(component != nullptr, "component not found within registry");
+        return *static_cast<LvnComponentArray<T>*>(component->get());
     }
 
     template <typename T>
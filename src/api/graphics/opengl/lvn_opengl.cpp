@@ -7,6 +7,16 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+// the s3tc formats are from EXT_texture_compression_s3tc and EXT_texture_sRGB which are not part of the generated glad loader
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT        0x83F1
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT        0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT  0x8C4D
+    #define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT  0x8C4F
+#endif
+
 
 enum LvnVertexAttribType
 {
@@ -28,6 +38,8 @@ namespace ogls
     static GLenum              getVertexAttributeFormatEnum(LvnAttributeFormat format);
     static LvnVertexAttribType getVertexAttribType(LvnAttributeFormat format);
     static GLenum              getTextureFilterEnum(LvnTextureFilter filter);
+    static GLenum              getTextureMipFilterEnum(LvnTextureFilter filter);
+    static GLenum              getCompressedTextureFormatEnum(LvnTextureCompression compression, LvnTextureFormat format);
     static GLenum              getTextureWrapModeEnum(LvnTextureMode mode);
     static uint32_t            getSampleCountEnum(LvnSampleCount samples);
     static GLenum              getColorFormat(LvnColorImageFormat texFormat);
@@ -254,6 +266,41 @@ namespace ogls
         }
     }
 
+    // min filter of textures with mip levels, linear filtering also blends between levels
+    static GLenum getTextureMipFilterEnum(LvnTextureFilter filter)
+    {
+        switch (filter)
+        {
+            case Lvn_TextureFilter_Nearest: { return GL_NEAREST_MIPMAP_NEAREST; }
+            case Lvn_TextureFilter_Linear: { return GL_LINEAR_MIPMAP_LINEAR; }
+
+            default:
+            {
+                LVN_CORE_WARN("unknown sampler filter enum type (%u), setting filter to \'GL_NEAREST_MIPMAP_NEAREST\' as default", filter);
+                return GL_NEAREST_MIPMAP_NEAREST;
+            }
+        }
+    }
+
+    static GLenum getCompressedTextureFormatEnum(LvnTextureCompression compression, LvnTextureFormat format)
+    {
+        bool srgb = format == Lvn_TextureFormat_Srgb;
+
+        switch (compression)
+        {
+            case Lvn_TextureCompression_Bc1: { return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; }
+            case Lvn_TextureCompression_Bc3: { return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; }
+            case Lvn_TextureCompression_Bc5: { return GL_COMPRESSED_RG_RGTC2; }
+            case Lvn_TextureCompression_Bc7: { return srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM; }
+
+            default:
+            {
+                LVN_CORE_ERROR("unknown texture compression enum type (%u)", compression);
+                return GL_NONE;
+            }
+        }
+    }
+
     static GLenum getTextureWrapModeEnum(LvnTextureMode mode)
     {
         switch (mode)
@@ -1148,6 +1195,15 @@ LvnResult oglsImplCreateTexture(LvnTexture* texture, const LvnTextureCreateInfo*
         case 4: { internalFormat = createInfo->format == Lvn_TextureFormat_Unorm ? GL_RGBA8 : GL_SRGB8_ALPHA8; format = GL_RGBA; break; }
     }
 
+    bool compressed = createInfo->compression != Lvn_TextureCompression_None;
+    if (compressed)
+    {
+        internalFormat = ogls::getCompressedTextureFormatEnum(createInfo->compression, createInfo->format);
+        if (internalFormat == GL_NONE) { return Lvn_Result_Failure; }
+    }
+
+    uint32_t levelCount = 1 + createInfo->mipLevelCount;
+
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
     glCreateTextures(GL_TEXTURE_2D, 1, &texture->id);
@@ -1155,13 +1211,24 @@ LvnResult oglsImplCreateTexture(LvnTexture* texture, const LvnTextureCreateInfo*
     glTextureParameteri(texture->id, GL_TEXTURE_WRAP_S, ogls::getTextureWrapModeEnum(createInfo->wrapS));
     glTextureParameteri(texture->id, GL_TEXTURE_WRAP_T, ogls::getTextureWrapModeEnum(createInfo->wrapT));
     glTextureParameteri(texture->id, GL_TEXTURE_WRAP_R, ogls::getTextureWrapModeEnum(createInfo->wrapT));
-    glTextureParameteri(texture->id, GL_TEXTURE_MIN_FILTER, ogls::getTextureFilterEnum(createInfo->minFilter));
+    glTextureParameteri(texture->id, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? ogls::getTextureMipFilterEnum(createInfo->minFilter) : ogls::getTextureFilterEnum(createInfo->minFilter));
     glTextureParameteri(texture->id, GL_TEXTURE_MAG_FILTER, ogls::getTextureFilterEnum(createInfo->magFilter));
+    glTextureParameteri(texture->id, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
 
-    glTextureStorage2D(texture->id, 1, internalFormat, createInfo->imageData.width, createInfo->imageData.height);
-    glTextureSubImage2D(texture->id, 0, 0, 0, createInfo->imageData.width, createInfo->imageData.height, format, GL_UNSIGNED_BYTE, createInfo->imageData.pixels.data());
+    // prebuilt mip levels and compressed blocks are uploaded as they are, each level from its own image data
+    glTextureStorage2D(texture->id, levelCount, internalFormat, createInfo->imageData.width, createInfo->imageData.height);
+    for (uint32_t level = 0; level < levelCount; level++)
+    {
+        const LvnImageData& levelData = level == 0 ? createInfo->imageData : createInfo->pMipLevels[level - 1];
 
-    glGenerateMipmap(GL_TEXTURE_2D);
+        if (compressed)
+            glCompressedTextureSubImage2D(texture->id, level, 0, 0, levelData.width, levelData.height, internalFormat, levelData.pixels.memsize(), levelData.pixels.data());
+        else
+            glTextureSubImage2D(texture->id, level, 0, 0, levelData.width, levelData.height, format, GL_UNSIGNED_BYTE, levelData.pixels.data());
+    }
+
+    if (levelCount == 1 && !compressed)
+        glGenerateMipmap(GL_TEXTURE_2D);
 
     if (ogls::checkErrorCode() == Lvn_Result_Failure)
     {
@@ -1181,10 +1248,11 @@ LvnResult oglsImplCreateTexture(LvnTexture* texture, const LvnTextureCreateInfo*
 LvnResult oglsImplCreateTextureSampler(LvnTexture* texture, const LvnTextureSamplerCreateInfo* createInfo)
 {
     OglSampler* sampler = static_cast<OglSampler*>(createInfo->sampler->sampler);
+    const LvnImageData& imageData = createInfo->imageData;
 
     GLenum format = createInfo->format == Lvn_TextureFormat_Unorm ? GL_RGB8 : GL_SRGB8;
     GLenum internalFormat = GL_RGB;
-    switch (createInfo->imageData.channels)
+    switch (imageData.channels)
     {
         case 1: { internalFormat = createInfo->format == Lvn_TextureFormat_Unorm ? GL_R8 : GL_R8; format = GL_RED; break; }
         case 2: { internalFormat = createInfo->format == Lvn_TextureFormat_Unorm ? GL_RG8 : GL_RG8; format = GL_RG; break; }
@@ -1192,33 +1260,53 @@ LvnResult oglsImplCreateTextureSampler(LvnTexture* texture, const LvnTextureSamp
         case 4: { internalFormat = createInfo->format == Lvn_TextureFormat_Unorm ? GL_RGBA8 : GL_SRGB8_ALPHA8; format = GL_RGBA; break; }
     }
 
+    bool compressed = imageData.compression != Lvn_TextureCompression_None;
+    if (compressed)
+    {
+        internalFormat = ogls::getCompressedTextureFormatEnum(imageData.compression, createInfo->format);
+        if (internalFormat == GL_NONE) { return Lvn_Result_Failure; }
+    }
+
+    uint32_t levelCount = 1 + imageData.mipLevels.size();
+
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
     uint32_t id;
     glCreateTextures(GL_TEXTURE_2D, 1, &id);
-    glTextureStorage2D(id, 1, internalFormat, createInfo->imageData.width, createInfo->imageData.height);
+    glTextureStorage2D(id, levelCount, internalFormat, imageData.width, imageData.height);
 
     glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, ogls::getTextureWrapModeEnum(sampler->wrapS));
     glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, ogls::getTextureWrapModeEnum(sampler->wrapT));
     glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, ogls::getTextureWrapModeEnum(sampler->wrapT));
     glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, ogls::getTextureFilterEnum(sampler->minFilter));
     glTextureParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, ogls::getTextureFilterEnum(sampler->magFilter));
+    glTextureParameteri(id, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+
+    // the mip levels and blocks of ktx2/dds images are uploaded as they are, the same as oglsImplCreateTexture
+    for (uint32_t level = 0; level < levelCount; level++)
+    {
+        const LvnImageData& levelData = level == 0 ? imageData : imageData.mipLevels[level - 1];
 
-    glTextureSubImage2D(id, 0, 0, 0, createInfo->imageData.width, createInfo->imageData.height, format, GL_UNSIGNED_BYTE, createInfo->imageData.pixels.data());
+        if (compressed)
+            glCompressedTextureSubImage2D(id, level, 0, 0, levelData.width, levelData.height, internalFormat, levelData.pixels.memsize(), levelData.pixels.data());
+        else
+            glTextureSubImage2D(id, level, 0, 0, levelData.width, levelData.height, format, GL_UNSIGNED_BYTE, levelData.pixels.data());
+    }
 
-    glGenerateMipmap(GL_TEXTURE_2D);
+    if (levelCount == 1 && !compressed)
+        glGenerateMipmap(GL_TEXTURE_2D);
 
     if (ogls::checkErrorCode() == Lvn_Result_Failure)
     {
-        LVN_CORE_ERROR("[opengl] last error check occurance when creating texture, id: %u, (w:%u,h%u), image data: %p", id, createInfo->imageData.width, createInfo->imageData.height, createInfo->imageData.pixels.data());
+        LVN_CORE_ERROR("[opengl] last error check occurance when creating texture, id: %u, (w:%u,h%u), image data: %p", id, imageData.width, imageData.height, imageData.pixels.data());
         return Lvn_Result_Failure;
     }
 
     glBindTexture(GL_TEXTURE_2D, 0);
 
     texture->id = id;
-    texture->width = createInfo->imageData.width;
-    texture->height = createInfo->imageData.height;
+    texture->width = imageData.width;
+    texture->height = imageData.height;
     texture->seperateSampler = true;
 
     return Lvn_Result_Success;
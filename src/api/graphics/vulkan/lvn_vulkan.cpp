@@ -85,6 +85,7 @@ namespace vks
     static VkFrontFace                          getVulkanCullFrontFaceEnum(LvnCullFrontFace cullFrontFace);
     static VkFormat                             getVulkanColorFormatEnum(LvnColorImageFormat format);
     static VkFormat                             getVulkanDepthFormatEnum(LvnDepthImageFormat format);
+    static VkFormat                             getCompressedTextureFormatEnum(LvnTextureCompression compression, LvnTextureFormat format);
     static VkColorComponentFlags                getColorComponents(LvnPipelineColorWriteMask colorMask);
     static VkBlendFactor                        getBlendFactorEnum(LvnColorBlendFactor blendFactor);
     static VkBlendOp                            getBlendOperationEnum(LvnColorBlendOperation blendOp);
@@ -105,9 +106,12 @@ namespace vks
     static VkShaderModule                       createShaderModule(VulkanBackends* vkBackends, const uint8_t* code, uint32_t size);
     static LvnResult                            createBuffer(VulkanBackends* vkBackends, VkBuffer* buffer, VmaAllocation* bufferMemory, VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memUsage);
     static void                                 copyBuffer(VulkanBackends* vkBackends, VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset, VkDeviceSize dstOffset);
-    static LvnResult                            createImage(VulkanBackends* vkBackends, VkImage* image, VmaAllocation* imageMemory, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlagBits samples, VmaMemoryUsage memUsage);
-    static void                                 transitionImageLayout(VulkanBackends* vkBackends, VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t layerCount);
+    static LvnResult                            createImage(VulkanBackends* vkBackends, VkImage* image, VmaAllocation* imageMemory, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlagBits samples, VmaMemoryUsage memUsage, uint32_t mipLevels = 1);
+    static void                                 transitionImageLayout(VulkanBackends* vkBackends, VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t layerCount, uint32_t levelCount = 1);
     static void                                 copyBufferToImage(VulkanBackends* vkBackends, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount);
+    static void                                 copyBufferToImageRegions(VulkanBackends* vkBackends, VkBuffer buffer, VkImage image, const VkBufferImageCopy* pRegions, uint32_t regionCount);
+    static VkFormat                             getTextureFormatEnum(VulkanBackends* vkBackends, uint32_t channels, LvnTextureFormat format, LvnTextureCompression compression);
+    static LvnResult                            createTextureImage(VulkanBackends* vkBackends, VkImage* image, VmaAllocation* imageMemory, VkFormat format, const LvnImageData& imageData, const LvnImageData* pMipLevels, uint32_t mipLevelCount);
 #ifdef LVN_INCLUDE_GLSLANG_SRC_COMPILE_SUPPORT
     static LvnResult                            compileShaderToSPIRV(glslang_stage_t stage, const char* shaderSource, LvnVector<uint8_t>& bin);
 #endif
@@ -469,6 +473,8 @@ namespace vks
 
         if (vkBackends->deviceSupportedFeatures.samplerAnisotropy)
             deviceFeatures.samplerAnisotropy = VK_TRUE;
+        if (vkBackends->deviceSupportedFeatures.textureCompressionBC)
+            deviceFeatures.textureCompressionBC = VK_TRUE;
 
         VkDeviceCreateInfo createInfo{};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -1199,6 +1205,25 @@ namespace vks
         }
     }
 
+    static VkFormat getCompressedTextureFormatEnum(LvnTextureCompression compression, LvnTextureFormat format)
+    {
+        bool srgb = format == Lvn_TextureFormat_Srgb;
+
+        switch (compression)
+        {
+            case Lvn_TextureCompression_Bc1: { return srgb ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK; }
+            case Lvn_TextureCompression_Bc3: { return srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK; }
+            case Lvn_TextureCompression_Bc5: { return VK_FORMAT_BC5_UNORM_BLOCK; }
+            case Lvn_TextureCompression_Bc7: { return srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK; }
+
+            default:
+            {
+                LVN_CORE_WARN("unknown texture compression enum (%u)", compression);
+                return VK_FORMAT_UNDEFINED;
+            }
+        }
+    }
+
     static VkColorComponentFlags getColorComponents(LvnPipelineColorWriteMask colorMask)
     {
         VkColorComponentFlags colorComponentsFlag = 0;
@@ -1746,7 +1771,7 @@ namespace vks
         vkFreeCommandBuffers(vkBackends->device, vkBackends->commandPool, 1, &commandBuffer);
     }
 
-    static LvnResult createImage(VulkanBackends* vkBackends, VkImage* image, VmaAllocation* imageMemory, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlagBits samples, VmaMemoryUsage memUsage)
+    static LvnResult createImage(VulkanBackends* vkBackends, VkImage* image, VmaAllocation* imageMemory, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlagBits samples, VmaMemoryUsage memUsage, uint32_t mipLevels)
     {
         VkImageCreateInfo imageInfo{};
         imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -1754,7 +1779,7 @@ namespace vks
         imageInfo.extent.width = width;
         imageInfo.extent.height = height;
         imageInfo.extent.depth = 1;
-        imageInfo.mipLevels = 1;
+        imageInfo.mipLevels = mipLevels;
         imageInfo.arrayLayers = 1;
         imageInfo.format = format;
         imageInfo.tiling = tiling;
@@ -1776,7 +1801,7 @@ namespace vks
     }
 
     static std::mutex s_TransitionImageLayoutMutex;
-    static void transitionImageLayout(VulkanBackends* vkBackends, VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t layerCount)
+    static void transitionImageLayout(VulkanBackends* vkBackends, VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t layerCount, uint32_t levelCount)
     {
         std::lock_guard<std::mutex> lock(s_TransitionImageLayoutMutex);
 
@@ -1804,7 +1829,7 @@ namespace vks
         barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.image = image;
         barrier.subresourceRange.baseMipLevel = 0;
-        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.levelCount = levelCount;
         barrier.subresourceRange.baseArrayLayer = 0;
         barrier.subresourceRange.layerCount = layerCount;
 
@@ -1865,8 +1890,26 @@ namespace vks
         vkFreeCommandBuffers(vkBackends->device, vkBackends->commandPool, 1, &commandBuffer);
     }
 
-    static std::mutex s_CopyBufferToImageMutex;
     static void copyBufferToImage(VulkanBackends* vkBackends, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount)
+    {
+        VkBufferImageCopy region{};
+        region.bufferOffset = 0;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = layerCount;
+
+        region.imageOffset = { 0, 0, 0 };
+        region.imageExtent = { width, height, 1 };
+
+        vks::copyBufferToImageRegions(vkBackends, buffer, image, &region, 1);
+    }
+
+    static std::mutex s_CopyBufferToImageMutex;
+    static void copyBufferToImageRegions(VulkanBackends* vkBackends, VkBuffer buffer, VkImage image, const VkBufferImageCopy* pRegions, uint32_t regionCount)
     {
         std::lock_guard<std::mutex> lock(s_CopyBufferToImageMutex);
 
@@ -1885,21 +1928,7 @@ namespace vks
 
         vkBeginCommandBuffer(commandBuffer, &beginInfo);
 
-
-        VkBufferImageCopy region{};
-        region.bufferOffset = 0;
-        region.bufferRowLength = 0;
-        region.bufferImageHeight = 0;
-
-        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel = 0;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount = layerCount;
-
-        region.imageOffset = { 0, 0, 0 };
-        region.imageExtent = { width, height, 1 };
-
-        vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+        vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, regionCount, pRegions);
 
         vkEndCommandBuffer(commandBuffer);
 
@@ -1913,6 +1942,92 @@ namespace vks
 
         vkFreeCommandBuffers(vkBackends->device, vkBackends->commandPool, 1, &commandBuffer);
     }
+    static VkFormat getTextureFormatEnum(VulkanBackends* vkBackends, uint32_t channels, LvnTextureFormat format, LvnTextureCompression compression)
+    {
+        if (compression != Lvn_TextureCompression_None)
+        {
+            if (!vkBackends->deviceSupportedFeatures.textureCompressionBC)
+            {
+                LVN_CORE_ERROR("[vulkan] physical device does not support bc texture compression, cannot create compressed texture");
+                return VK_FORMAT_UNDEFINED;
+            }
+
+            return vks::getCompressedTextureFormatEnum(compression, format);
+        }
+
+        switch (channels)
+        {
+            case 1: { return format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8_SRGB; }
+            case 2: { return format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8_UNORM : VK_FORMAT_R8G8_SRGB; }
+            default: { return format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_SRGB; }
+        }
+    }
+
+    static LvnResult createTextureImage(VulkanBackends* vkBackends, VkImage* image, VmaAllocation* imageMemory, VkFormat format, const LvnImageData& imageData, const LvnImageData* pMipLevels, uint32_t mipLevelCount)
+    {
+        // every level is copied into one staging buffer, level offsets are kept at a multiple of 16 bytes to suit any texel or block size
+        uint32_t levelCount = 1 + mipLevelCount;
+        LvnVector<VkBufferImageCopy> regions(levelCount);
+        VkDeviceSize imageSize = 0;
+
+        for (uint32_t level = 0; level < levelCount; level++)
+        {
+            const LvnImageData& levelData = level == 0 ? imageData : pMipLevels[level - 1];
+
+            VkBufferImageCopy& region = regions[level];
+            region.bufferOffset = imageSize;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = level;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset = { 0, 0, 0 };
+            region.imageExtent = { levelData.width, levelData.height, 1 };
+
+            imageSize += (levelData.pixels.memsize() + 15) & ~(VkDeviceSize)15;
+        }
+
+        VkBuffer stagingBuffer;
+        VmaAllocation stagingBufferMemory;
+
+        vks::createBuffer(vkBackends, &stagingBuffer, &stagingBufferMemory, imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY);
+
+        void* data;
+        vmaMapMemory(vkBackends->vmaAllocator, stagingBufferMemory, &data);
+        for (uint32_t level = 0; level < levelCount; level++)
+        {
+            const LvnImageData& levelData = level == 0 ? imageData : pMipLevels[level - 1];
+            memcpy(static_cast<uint8_t*>(data) + regions[level].bufferOffset, levelData.pixels.data(), levelData.pixels.memsize());
+        }
+        vmaUnmapMemory(vkBackends->vmaAllocator, stagingBufferMemory);
+
+        if (vks::createImage(vkBackends,
+            image,
+            imageMemory,
+            imageData.width,
+            imageData.height,
+            format,
+            VK_IMAGE_TILING_OPTIMAL,
+            VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+            VK_SAMPLE_COUNT_1_BIT,
+            VMA_MEMORY_USAGE_GPU_ONLY,
+            levelCount) != Lvn_Result_Success)
+        {
+            vkDestroyBuffer(vkBackends->device, stagingBuffer, nullptr);
+            vmaFreeMemory(vkBackends->vmaAllocator, stagingBufferMemory);
+            return Lvn_Result_Failure;
+        }
+
+        // transition buffer to image
+        vks::transitionImageLayout(vkBackends, *image, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, levelCount);
+        vks::copyBufferToImageRegions(vkBackends, stagingBuffer, *image, regions.data(), levelCount);
+        vks::transitionImageLayout(vkBackends, *image, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1, levelCount);
+
+        vkDestroyBuffer(vkBackends->device, stagingBuffer, nullptr);
+        vmaFreeMemory(vkBackends->vmaAllocator, stagingBufferMemory);
+
+        return Lvn_Result_Success;
+    }
+
 #ifdef LVN_INCLUDE_GLSLANG_SRC_COMPILE_SUPPORT
     static LvnResult compileShaderToSPIRV(glslang_stage_t stage, const char* shaderSource, LvnVector<uint8_t>& bin)
     {
@@ -3204,49 +3319,21 @@ LvnResult vksImplCreateTexture(LvnTexture* texture, const LvnTextureCreateInfo*
 {
     VulkanBackends* vkBackends = s_VkBackends;
 
-    VkBuffer stagingBuffer;
-    VmaAllocation stagingBufferMemory;
-    VkDeviceSize imageSize = createInfo->imageData.pixels.memsize();
+    VkFormat format = vks::getTextureFormatEnum(vkBackends, createInfo->imageData.channels, createInfo->format, createInfo->compression);
+    if (format == VK_FORMAT_UNDEFINED) { return Lvn_Result_Failure; }
 
-    vks::createBuffer(vkBackends, &stagingBuffer, &stagingBufferMemory, imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY);
+    // create texture image, prebuilt mip levels and compressed blocks are copied as they are
+    uint32_t levelCount = 1 + createInfo->mipLevelCount;
 
-    void* data;
-    vmaMapMemory(vkBackends->vmaAllocator, stagingBufferMemory, &data);
-    memcpy(data, createInfo->imageData.pixels.data(), imageSize);
-    vmaUnmapMemory(vkBackends->vmaAllocator, stagingBufferMemory);
-
-    VkFormat format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_SRGB;
-    switch (createInfo->imageData.channels)
-    {
-        case 1: { format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8_SRGB; break; }
-        case 2: { format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8_UNORM : VK_FORMAT_R8G8_SRGB; break; }
-        case 4: { format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_SRGB; break; }
-    }
-
-    // create texture image
     VkImage textureImage;
     VmaAllocation textureImageMemory;
 
-    if (vks::createImage(vkBackends,
-        &textureImage,
-        &textureImageMemory,
-        createInfo->imageData.width,
-        createInfo->imageData.height,
-        format,
-        VK_IMAGE_TILING_OPTIMAL,
-        VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-        VK_SAMPLE_COUNT_1_BIT,
-        VMA_MEMORY_USAGE_GPU_ONLY) != Lvn_Result_Success)
+    if (vks::createTextureImage(vkBackends, &textureImage, &textureImageMemory, format, createInfo->imageData, createInfo->pMipLevels, createInfo->mipLevelCount) != Lvn_Result_Success)
     {
         LVN_CORE_ERROR("[vulkan] failed to create texture image <VkImage> for texture (%p)", texture);
         return Lvn_Result_Failure;
     }
 
-    // transition buffer to image
-    vks::transitionImageLayout(vkBackends, textureImage, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1);
-    vks::copyBufferToImage(vkBackends, stagingBuffer, textureImage, createInfo->imageData.width, createInfo->imageData.height, 1);
-    vks::transitionImageLayout(vkBackends, textureImage, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1);
-
 
     // texture image view
     VkImageViewCreateInfo viewInfo{};
@@ -3256,7 +3343,7 @@ LvnResult vksImplCreateTexture(LvnTexture* texture, const LvnTextureCreateInfo*
     viewInfo.format = format;
     viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     viewInfo.subresourceRange.baseMipLevel = 0;
-    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.levelCount = levelCount;
     viewInfo.subresourceRange.baseArrayLayer = 0;
     viewInfo.subresourceRange.layerCount = 1;
 
@@ -3291,10 +3378,10 @@ LvnResult vksImplCreateTexture(LvnTexture* texture, const LvnTextureCreateInfo*
     samplerInfo.unnormalizedCoordinates = VK_FALSE;
     samplerInfo.compareEnable = VK_FALSE;
     samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
-    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    samplerInfo.mipmapMode = createInfo->minFilter == Lvn_TextureFilter_Nearest ? VK_SAMPLER_MIPMAP_MODE_NEAREST : VK_SAMPLER_MIPMAP_MODE_LINEAR;
     samplerInfo.mipLodBias = 0.0f;
     samplerInfo.minLod = 0.0f;
-    samplerInfo.maxLod = 0.0f;
+    samplerInfo.maxLod = static_cast<float>(levelCount - 1);
 
     VkSampler textureSampler;
     if (vkCreateSampler(vkBackends->device, &samplerInfo, nullptr, &textureSampler) != VK_SUCCESS)
@@ -3311,59 +3398,29 @@ LvnResult vksImplCreateTexture(LvnTexture* texture, const LvnTextureCreateInfo*
     texture->height = createInfo->imageData.height;
     texture->seperateSampler = false;
 
-    vkDestroyBuffer(vkBackends->device, stagingBuffer, nullptr);
-    vmaFreeMemory(vkBackends->vmaAllocator, stagingBufferMemory);
-
     return Lvn_Result_Success;
 }
 
 LvnResult vksImplCreateTextureSampler(LvnTexture* texture, const LvnTextureSamplerCreateInfo* createInfo)
 {
     VulkanBackends* vkBackends = s_VkBackends;
+    const LvnImageData& imageData = createInfo->imageData;
 
-    VkBuffer stagingBuffer;
-    VmaAllocation stagingBufferMemory;
-    VkDeviceSize imageSize = createInfo->imageData.pixels.memsize();
-
-    vks::createBuffer(vkBackends, &stagingBuffer, &stagingBufferMemory, imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY);
-
-    void* data;
-    vmaMapMemory(vkBackends->vmaAllocator, stagingBufferMemory, &data);
-    memcpy(data, createInfo->imageData.pixels.data(), imageSize);
-    vmaUnmapMemory(vkBackends->vmaAllocator, stagingBufferMemory);
+    VkFormat format = vks::getTextureFormatEnum(vkBackends, imageData.channels, createInfo->format, imageData.compression);
+    if (format == VK_FORMAT_UNDEFINED) { return Lvn_Result_Failure; }
 
-    VkFormat format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_SRGB;
-    switch (createInfo->imageData.channels)
-    {
-        case 1: { format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8_SRGB; break; }
-        case 2: { format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8_UNORM : VK_FORMAT_R8G8_SRGB; break; }
-        case 4: { format = createInfo->format == Lvn_TextureFormat_Unorm ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_SRGB; break; }
-    }
+    // create texture image, the mip levels and blocks of ktx2/dds images are copied as they are
+    uint32_t levelCount = 1 + imageData.mipLevels.size();
 
-    // create texture image
     VkImage textureImage;
     VmaAllocation textureImageMemory;
 
-    if (vks::createImage(vkBackends,
-        &textureImage,
-        &textureImageMemory,
-        createInfo->imageData.width,
-        createInfo->imageData.height,
-        format,
-        VK_IMAGE_TILING_OPTIMAL,
-        VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-        VK_SAMPLE_COUNT_1_BIT,
-        VMA_MEMORY_USAGE_GPU_ONLY) != Lvn_Result_Success)
+    if (vks::createTextureImage(vkBackends, &textureImage, &textureImageMemory, format, imageData, imageData.mipLevels.data(), imageData.mipLevels.size()) != Lvn_Result_Success)
     {
         LVN_CORE_ERROR("[vulkan] failed to create texture image <VkImage> for texture (%p)", texture);
         return Lvn_Result_Failure;
     }
 
-    // transition buffer to image
-    vks::transitionImageLayout(vkBackends, textureImage, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1);
-    vks::copyBufferToImage(vkBackends, stagingBuffer, textureImage, createInfo->imageData.width, createInfo->imageData.height, 1);
-    vks::transitionImageLayout(vkBackends, textureImage, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1);
-
 
     // texture image view
     VkImageViewCreateInfo viewInfo{};
@@ -3373,7 +3430,7 @@ LvnResult vksImplCreateTextureSampler(LvnTexture* texture, const LvnTextureSampl
     viewInfo.format = format;
     viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     viewInfo.subresourceRange.baseMipLevel = 0;
-    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.levelCount = levelCount;
     viewInfo.subresourceRange.baseArrayLayer = 0;
     viewInfo.subresourceRange.layerCount = 1;
 
@@ -3392,9 +3449,6 @@ LvnResult vksImplCreateTextureSampler(LvnTexture* texture, const LvnTextureSampl
     texture->height = createInfo->imageData.height;
     texture->seperateSampler = true;
 
-    vkDestroyBuffer(vkBackends->device, stagingBuffer, nullptr);
-    vmaFreeMemory(vkBackends->vmaAllocator, stagingBufferMemory);
-
     return Lvn_Result_Success;
 }
 
@@ -1,7 +1,6 @@
 #include "levikno.h"
 #include "lvn_loaders.h"
 
-#include <future>
 #include <string>
 #include <vector>
 
@@ -108,6 +107,17 @@ namespace gltfs
         int32_t  vertexPerFace;
     };
 
+    // vertex and index data of a primitive, built on the job system before the gpu buffers are created
+    struct GLTFPrimitiveData
+    {
+        const nlm::json* node;
+        uint32_t meshIndex;
+        uint32_t primitiveIndex;
+        LvnVector<uint8_t> bufferData;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+    };
+
 
     struct GLTFLoadData
     {
@@ -128,6 +138,8 @@ namespace gltfs
         LvnVector<LvnTexture*> textures;
         LvnVector<LvnBuffer*> meshBuffers;
         LvnVector<LvnMesh> meshes;
+        LvnVector<GLTFPrimitiveData> primitives;
+        LvnVector<LvnAnimation> modelAnimations;
 
         LvnSampler* defaultSampler;
         LvnTexture* defaultBaseColorTexture;
@@ -146,6 +158,7 @@ namespace gltfs
     static LvnVector<LvnImageData>     loadImages(const GLTFLoadData& gltfData);
     static LvnVector<LvnSampler*>      loadSamplers(const nlm::json& JSON, LvnSampler** defaultSampler);
     static LvnVector<LvnAnimation>     bindAnimationsToNodes(const GLTFLoadData& gltfData);
+    static LvnVector<LvnSkin>          loadSkinData(GLTFLoadData& gltfData);
     static LvnVector<LvnSkin>          bindSkinsToNodes(GLTFLoadData& gltfData);
     static size_t                      getCompType(int compType);
     static bool                        isNormalizedType(int compType);
@@ -158,10 +171,14 @@ namespace gltfs
     static LvnVector<LvnVec4>          calculateTangents(GLTFTangentCalcInfo* calcInfo);
     static void                        traverseNode(GLTFLoadData* const gltfData, int32_t nodeIndex);
     static LvnMaterial                 getMaterial(GLTFLoadData* gltfData, int meshMaterialIndex);
+    static int32_t                     getBakeTexture(const GLTFLoadData* gltfData, int texIndex, LvnTextureFormat format, LvnModelBakeData* bakeData);
+    static LvnBakeMaterial             getBakeMaterial(const GLTFLoadData* gltfData, int meshMaterialIndex, LvnModelBakeData* bakeData);
     static void                        loadDefaultTextures(GLTFLoadData* gltfData);
+    static void                        buildPrimitiveData(const GLTFLoadData* gltfData, GLTFPrimitiveData* primitive);
+    static void                        buildPrimitives(GLTFLoadData* gltfData);
     static LvnVector<LvnMesh>          loadMeshes(GLTFLoadData* gltfData);
     static void                        bindMeshToNodes(GLTFLoadData* gltfData);
-    static LvnModel                    loadGltfModelFileType(const char* filepath, LvnFileType filetype);
+    static LvnModelData*               loadGltfModelDataFileType(const char* filepath, LvnFileType filetype);
 
 
     static LvnVector<LvnBin> loadBuffers(const nlm::json& JSON, std::string_view filepath)
@@ -174,7 +191,7 @@ namespace gltfs
             std::string_view fileDirectory = filepath.substr(0, filepath.find_last_of("/\\") + 1);
             std::string pathbin = std::string(fileDirectory) + uri;
 
-            buffers[i] = lvn::loadFileSrcBin(pathbin.c_str());
+            buffers[i] = lvn::mapFile(pathbin.c_str());
         }
 
         return buffers;
@@ -355,8 +372,6 @@ namespace gltfs
     }
     static LvnVector<LvnImageData> loadImages(const GLTFLoadData& gltfData)
     {
-        LvnContext* lvnctx = lvn::getContext();
-
         const nlm::json& JSON = gltfData.JSON;
 
         if (!JSON.contains("images"))
@@ -364,62 +379,43 @@ namespace gltfs
 
         LvnVector<LvnImageData> images(JSON["images"].size());
 
-        if (lvnctx->multithreading) // multithreading enabled
-        {
-            LvnVector<std::future<LvnImageData>> futureImages(images.size());
+        // images are decoded across the job workers by lvn::loadImagesBatch, glb images are decoded straight from the buffer views
+        LvnVector<LvnImageLoadInfo> loadInfos(images.size());
+        LvnVector<LvnString> filepaths;
 
-            if (gltfData.filetype == Lvn_FileType_Gltf)
-            {
-                for (uint32_t i = 0; i < JSON["images"].size(); i++)
-                {
-                    std::string uri = JSON["images"][i]["uri"];
-                    std::string fileDirectory = gltfData.filepath.substr(0, gltfData.filepath.find_last_of("/\\") + 1);
-
-                    futureImages[i] = std::async(std::launch::async, lvn::loadImageDataThread, LvnString((fileDirectory + uri).c_str()), 4, false);
-                }
-            }
-            else if (gltfData.filetype == Lvn_FileType_Glb)
-            {
-                for (uint32_t i = 0; i < JSON["images"].size(); i++)
-                {
-                    uint32_t bufferViewIndex = JSON["images"][i]["bufferView"];
-                    GLTFBufferView bufferView = gltfData.bufferViews[bufferViewIndex];
-                    LvnBin buffer = gltfData.buffers[bufferView.buffer];
-
-                    futureImages[i] = std::async(std::launch::async, lvn::loadImageDataMemoryThread, &buffer[bufferView.byteOffset], bufferView.byteLength, 4, false);
-                }
-            }
+        if (gltfData.filetype == Lvn_FileType_Gltf)
+        {
+            std::string fileDirectory = gltfData.filepath.substr(0, gltfData.filepath.find_last_of("/\\") + 1);
 
-            for (uint32_t i = 0; i < JSON["images"].size(); i++)
+            filepaths.resize(images.size());
+            for (uint32_t i = 0; i < images.size(); i++)
             {
-                images[i] = std::move(futureImages[i].get());
+                std::string uri = JSON["images"][i]["uri"];
+                filepaths[i] = LvnString((fileDirectory + uri).c_str());
+                loadInfos[i].filepath = filepaths[i].c_str();
             }
         }
-        else // no multithreading
+        else if (gltfData.filetype == Lvn_FileType_Glb)
         {
-            if (gltfData.filetype == Lvn_FileType_Gltf)
+            for (uint32_t i = 0; i < images.size(); i++)
             {
-                for (uint32_t i = 0; i < JSON["images"].size(); i++)
-                {
-                    std::string uri = JSON["images"][i]["uri"];
-                    std::string fileDirectory = gltfData.filepath.substr(0, gltfData.filepath.find_last_of("/\\") + 1);
+                uint32_t bufferViewIndex = JSON["images"][i]["bufferView"];
+                GLTFBufferView bufferView = gltfData.bufferViews[bufferViewIndex];
+                const LvnBin& buffer = gltfData.buffers[bufferView.buffer];
 
-                    images[i] = lvn::loadImageData((fileDirectory + uri).c_str(), 4);
-                }
+                loadInfos[i].data = &buffer[bufferView.byteOffset];
+                loadInfos[i].size = bufferView.byteLength;
             }
-            else if (gltfData.filetype == Lvn_FileType_Glb)
-            {
-                for (uint32_t i = 0; i < JSON["images"].size(); i++)
-                {
-                    uint32_t bufferViewIndex = JSON["images"][i]["bufferView"];
-                    GLTFBufferView bufferView = gltfData.bufferViews[bufferViewIndex];
-                    LvnBin buffer = gltfData.buffers[bufferView.buffer];
+        }
 
-                    images[i] = lvn::loadImageDataMemory(&buffer[bufferView.byteOffset], bufferView.byteLength, 4);
-                }
-            }
+        for (uint32_t i = 0; i < loadInfos.size(); i++)
+        {
+            loadInfos[i].forceChannels = 4;
+            loadInfos[i].flipVertically = false;
         }
 
+        lvn::loadImagesBatch(loadInfos.data(), loadInfos.size(), images.data());
+
         return images;
     }
     static LvnVector<LvnSampler*> loadSamplers(const nlm::json& JSON, LvnSampler** defaultSampler)
@@ -479,12 +475,12 @@ namespace gltfs
 
                 GLTFAccessor accessor = gltfData.accessors[sampler.input];
                 GLTFBufferView bufferView = gltfData.bufferViews[accessor.bufferView];
-                LvnBin buffer = gltfData.buffers[bufferView.buffer];
+                const LvnBin& buffer = gltfData.buffers[bufferView.buffer];
 
                 uint32_t beginningOfData = accessor.byteOffset + bufferView.byteOffset;
 
-                animations[i].start = *reinterpret_cast<float*>(&buffer[beginningOfData]);
-                animations[i].end = *reinterpret_cast<float*>(&buffer[beginningOfData] + (accessor.count - 1) * sizeof(float));
+                animations[i].start = *reinterpret_cast<const float*>(&buffer[beginningOfData]);
+                animations[i].end = *reinterpret_cast<const float*>(&buffer[beginningOfData] + (accessor.count - 1) * sizeof(float));
             }
 
             // bind the channels, samplers, input, output
@@ -506,7 +502,7 @@ namespace gltfs
                 // sampler input (keyframes)
                 GLTFAccessor accessor = gltfData.accessors[sampler.input];
                 GLTFBufferView bufferView = gltfData.bufferViews[accessor.bufferView];
-                LvnBin buffer = gltfData.buffers[bufferView.buffer];
+                const LvnBin& buffer = gltfData.buffers[bufferView.buffer];
 
                 uint32_t beginningOfData = accessor.byteOffset + bufferView.byteOffset;
 
@@ -514,7 +510,7 @@ namespace gltfs
                 for (uint32_t k = 0; k < accessor.count; k++)
                 {
                     // adjust animation start and end times
-                    animations[i].channels[j].keyFrames[k] = *reinterpret_cast<float*>(&buffer[beginningOfData] + k * sizeof(float));
+                    animations[i].channels[j].keyFrames[k] = *reinterpret_cast<const float*>(&buffer[beginningOfData] + k * sizeof(float));
                     if (animations[i].channels[j].keyFrames[k] < animations[i].start)
                         animations[i].start = animations[i].channels[j].keyFrames[k];
                     if (animations[i].channels[j].keyFrames[k] > animations[i].end)
@@ -524,25 +520,24 @@ namespace gltfs
                 // sampler outputs (translations/rotations/scale)
                 accessor = gltfData.accessors[sampler.output];
                 bufferView = gltfData.bufferViews[accessor.bufferView];
-                buffer = gltfData.buffers[bufferView.buffer];
+                const LvnBin& outputBuffer = gltfData.buffers[bufferView.buffer];
                 beginningOfData = accessor.byteOffset + bufferView.byteOffset;
 
                 animations[i].channels[j].outputs.resize(accessor.count);
                 if (accessor.type == "VEC3")
                     for (uint32_t k = 0; k < accessor.count; k++)
-                        animations[i].channels[j].outputs[k] = LvnVec4(*reinterpret_cast<LvnVec3*>(&buffer[beginningOfData] + k * 3 * sizeof(float)), 0.0f);
+                        animations[i].channels[j].outputs[k] = LvnVec4(*reinterpret_cast<const LvnVec3*>(&outputBuffer[beginningOfData] + k * 3 * sizeof(float)), 0.0f);
                 else if (accessor.type == "VEC4")
                     for (uint32_t k = 0; k < accessor.count; k++)
-                        animations[i].channels[j].outputs[k] = *reinterpret_cast<LvnVec4*>(&buffer[beginningOfData] + k * 4 * sizeof(float));
+                        animations[i].channels[j].outputs[k] = *reinterpret_cast<const LvnVec4*>(&outputBuffer[beginningOfData] + k * 4 * sizeof(float));
             }
         }
 
         return animations;
     }
-    static LvnVector<LvnSkin> bindSkinsToNodes(GLTFLoadData& gltfData)
+    // joints and inverse bind matrices of the skins, the joint nodes are set to their skin
+    static LvnVector<LvnSkin> loadSkinData(GLTFLoadData& gltfData)
     {
-        const nlm::json& JSON = gltfData.JSON;
-
         LvnVector<LvnSkin> skins(gltfData.skins.size());
 
         for (uint32_t i = 0; i < gltfData.skins.size(); i++)
@@ -566,7 +561,16 @@ namespace gltfs
                 skins[i].inverseBindMatrices.resize(accessor.count);
                 memcpy(skins[i].inverseBindMatrices.data(), &buffer[accessor.byteOffset + bufferView.byteOffset], accessor.count * 16 * sizeof(float));
             }
+        }
 
+        return skins;
+    }
+    static LvnVector<LvnSkin> bindSkinsToNodes(GLTFLoadData& gltfData)
+    {
+        LvnVector<LvnSkin> skins = gltfs::loadSkinData(gltfData);
+
+        for (uint32_t i = 0; i < skins.size(); i++)
+        {
             LvnBufferCreateInfo ssboCreateInfo{};
             ssboCreateInfo.type = Lvn_BufferType_Storage;
             ssboCreateInfo.usage = Lvn_BufferUsage_Dynamic;
@@ -610,7 +614,7 @@ namespace gltfs
     static LvnVector<float> getAttributeData(const GLTFLoadData* gltfData, const GLTFAccessor& accessor)
     {
         GLTFBufferView bufferView = gltfData->bufferViews[accessor.bufferView];
-        LvnBin buffer = gltfData->buffers[bufferView.buffer];
+        const LvnBin& buffer = gltfData->buffers[bufferView.buffer];
 
         uint32_t beginningOfData = accessor.byteOffset + bufferView.byteOffset;
 
@@ -632,7 +636,7 @@ namespace gltfs
             {
                 for (uint32_t j = 0; j < type; j++)
                 {
-                    att[i * type + j] = *reinterpret_cast<float*>(&buffer[beginningOfData] + i * type * sizeof(float) + j * sizeof(float));
+                    att[i * type + j] = *reinterpret_cast<const float*>(&buffer[beginningOfData] + i * type * sizeof(float) + j * sizeof(float));
                 }
             }
         }
@@ -642,7 +646,7 @@ namespace gltfs
             {
                 for (uint32_t j = 0; j < type; j++)
                 {
-                    uint32_t at = *reinterpret_cast<uint32_t*>(&buffer[beginningOfData] + i * type * sizeof(uint32_t) + j * sizeof(uint32_t));
+                    uint32_t at = *reinterpret_cast<const uint32_t*>(&buffer[beginningOfData] + i * type * sizeof(uint32_t) + j * sizeof(uint32_t));
                     att[i * type + j] = static_cast<float>(at);
                 }
             }
@@ -653,7 +657,7 @@ namespace gltfs
             {
                 for (uint32_t j = 0; j < type; j++)
                 {
-                    int8_t at = *reinterpret_cast<int8_t*>(&buffer[beginningOfData] + i * type * sizeof(int8_t) + j * sizeof(int8_t));
+                    int8_t at = *reinterpret_cast<const int8_t*>(&buffer[beginningOfData] + i * type * sizeof(int8_t) + j * sizeof(int8_t));
                     att[i * type + j] = accessor.normalized ? static_cast<float>(at) / INT8_MAX : static_cast<float>(at);
                 }
             }
@@ -664,7 +668,7 @@ namespace gltfs
             {
                 for (uint32_t j = 0; j < type; j++)
                 {
-                    uint8_t at = *reinterpret_cast<uint8_t*>(&buffer[beginningOfData] + i * type * sizeof(uint8_t) + j * sizeof(uint8_t));
+                    uint8_t at = *reinterpret_cast<const uint8_t*>(&buffer[beginningOfData] + i * type * sizeof(uint8_t) + j * sizeof(uint8_t));
                     att[i * type + j] = accessor.normalized ? static_cast<float>(at) / UINT8_MAX : static_cast<float>(at);
                 }
             }
@@ -675,7 +679,7 @@ namespace gltfs
             {
                 for (uint32_t j = 0; j < type; j++)
                 {
-                    int16_t at = *reinterpret_cast<int16_t*>(&buffer[beginningOfData] + i * type * sizeof(int16_t) + j * sizeof(int16_t));
+                    int16_t at = *reinterpret_cast<const int16_t*>(&buffer[beginningOfData] + i * type * sizeof(int16_t) + j * sizeof(int16_t));
                     att[i * type + j] = accessor.normalized ? static_cast<float>(at) / INT16_MAX : static_cast<float>(at);
                 }
             }
@@ -686,7 +690,7 @@ namespace gltfs
             {
                 for (uint32_t j = 0; j < type; j++)
                 {
-                    uint16_t at = *reinterpret_cast<uint16_t*>(&buffer[beginningOfData] + i * type * sizeof(uint16_t) + j * sizeof(uint16_t));
+                    uint16_t at = *reinterpret_cast<const uint16_t*>(&buffer[beginningOfData] + i * type * sizeof(uint16_t) + j * sizeof(uint16_t));
                     att[i * type + j] = accessor.normalized ? static_cast<float>(at) / UINT16_MAX : static_cast<float>(at);
                 }
             }
@@ -1193,272 +1197,351 @@ namespace gltfs
             gltfData->textures.push_back(gltfData->defaultEmissiveTexture);
         }
     }
-    static LvnVector<LvnMesh> loadMeshes(GLTFLoadData* gltfData)
+    // same texture setup as getMaterial, the texture takes the format of the first material slot that uses it
+    static int32_t getBakeTexture(const GLTFLoadData* gltfData, int texIndex, LvnTextureFormat format, LvnModelBakeData* bakeData)
     {
-        const nlm::json JSON = gltfData->JSON;
+        if (texIndex < 0)
+            return -1;
 
-        if (!JSON.contains("meshes"))
-            return {};
+        LvnBakeTexture& texture = bakeData->textures[texIndex];
+        if (texture.image >= 0)
+            return texIndex;
+
+        const nlm::json& JSON = gltfData->JSON;
+        const nlm::json& textureNode = JSON["textures"][texIndex];
+
+        texture.image = textureNode["source"];
+        texture.format = format;
+        texture.minFilter = Lvn_TextureFilter_Nearest;
+        texture.magFilter = Lvn_TextureFilter_Nearest;
+        texture.wrapS = Lvn_TextureMode_Repeat;
+        texture.wrapT = Lvn_TextureMode_Repeat;
+
+        if (textureNode.find("sampler") != textureNode.end())
+        {
+            const nlm::json& samplerNode = JSON["samplers"][(int)textureNode["sampler"]];
+            texture.magFilter = gltfs::getSamplerFilterEnum(samplerNode["magFilter"]);
+            texture.minFilter = gltfs::getSamplerFilterEnum(samplerNode["minFilter"]);
+            texture.wrapS = gltfs::getSamplerWrapModeEnum(samplerNode["wrapS"]);
+            texture.wrapT = gltfs::getSamplerWrapModeEnum(samplerNode["wrapT"]);
+        }
+
+        return texIndex;
+    }
+    static LvnBakeMaterial getBakeMaterial(const GLTFLoadData* gltfData, int meshMaterialIndex, LvnModelBakeData* bakeData)
+    {
+        LvnBakeMaterial material{};
+
+        if (meshMaterialIndex < 0)
+        {
+            material.baseColorFactor = LvnVec4(1, 1, 1, 1);
+            material.metallicFactor = 1.0f;
+            material.roughnessFactor = 1.0f;
+            material.emissiveFactor = LvnVec3(0, 0, 0);
+            material.doubleSided = false;
+            material.albedo = material.metallicRoughnessOcclusion = material.normal = material.emissive = -1;
+            return material;
+        }
+
+        const GLTFMatrial& gltfMaterial = gltfData->materials[meshMaterialIndex];
+
+        material.albedo = gltfs::getBakeTexture(gltfData, gltfMaterial.pbrMetallicRoughness.baseColorTexture.index, Lvn_TextureFormat_Srgb, bakeData);
+        material.metallicRoughnessOcclusion = gltfs::getBakeTexture(gltfData, gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index, Lvn_TextureFormat_Srgb, bakeData);
+        material.normal = gltfs::getBakeTexture(gltfData, gltfMaterial.normalTexture.index, Lvn_TextureFormat_Unorm, bakeData);
+        material.emissive = gltfs::getBakeTexture(gltfData, gltfMaterial.emissiveTexture.index, Lvn_TextureFormat_Unorm, bakeData);
+
+        // factors
+        material.baseColorFactor = gltfMaterial.pbrMetallicRoughness.baseColorFactor;
+        material.metallicFactor = gltfMaterial.pbrMetallicRoughness.metallicFactor;
+        material.roughnessFactor = gltfMaterial.pbrMetallicRoughness.roughnessFactor;
+        material.emissiveFactor = gltfMaterial.emissiveFactor;
+        material.doubleSided = gltfMaterial.doubleSided;
 
-        LvnVector<LvnMesh> meshes((JSON["meshes"].size()));
+        return material;
+    }
+    static void buildPrimitiveData(const GLTFLoadData* gltfData, GLTFPrimitiveData* primitive)
+    {
+        const nlm::json& primitiveNode = *primitive->node;
+
+        int posIndex      = primitiveNode["attributes"]["POSITION"];
+        int colorIndex    = primitiveNode["attributes"].value("COLOR_0", -1);
+        int texIndex      = primitiveNode["attributes"].value("TEXCOORD_0", -1);
+        int normalIndex   = primitiveNode["attributes"].value("NORMAL", -1);
+        int tangentIndex  = primitiveNode["attributes"].value("TANGENT", -1);
+        int jointsIndex   = primitiveNode["attributes"].value("JOINTS_0", -1);
+        int weightsIndex  = primitiveNode["attributes"].value("WEIGHTS_0", -1);
+        int indicesIndex  = primitiveNode.value("indices", -1);
+        int materialIndex = primitiveNode.value("material", -1);
+
+        // position
+        GLTFAccessor accessor = gltfData->accessors[posIndex];
+        GLTFBufferView bufferView = gltfData->bufferViews[accessor.bufferView];
+        const LvnBin& buffer = gltfData->buffers[bufferView.buffer];
+
+        uint32_t beginningOfData = accessor.byteOffset + bufferView.byteOffset;
+
+        LvnVector<LvnVec3> positions(accessor.count);
+        for (uint32_t j = 0; j < accessor.count; j++)
+            positions[j] = *reinterpret_cast<const LvnVec3*>(&buffer[beginningOfData] + j * 3 * sizeof(float));
 
-        for (uint32_t meshIndex = 0; meshIndex < JSON["meshes"].size(); meshIndex++)
+        // indices
+        LvnVector<uint32_t> indices;
+        if (indicesIndex >= 0)
         {
-            LvnVector<LvnPrimitive> meshPrimitives(JSON["meshes"][meshIndex]["primitives"].size());
-            for (uint32_t i = 0; i < JSON["meshes"][meshIndex]["primitives"].size(); i++)
+            accessor = gltfData->accessors[indicesIndex];
+            bufferView = gltfData->bufferViews[accessor.bufferView];
+            const LvnBin& indexBuffer = gltfData->buffers[bufferView.buffer];
+
+            beginningOfData = accessor.byteOffset + bufferView.byteOffset;
+            size_t compType = gltfs::getCompType(accessor.componentType);
+
+            indices.resize(accessor.count);
+            for (uint32_t j = 0; j < accessor.count; j++)
             {
-                nlm::json primitiveNode = JSON["meshes"][meshIndex]["primitives"][i];
-
-                int posIndex      = primitiveNode["attributes"]["POSITION"];
-                int colorIndex    = primitiveNode["attributes"].value("COLOR_0", -1);
-                int texIndex      = primitiveNode["attributes"].value("TEXCOORD_0", -1);
-                int normalIndex   = primitiveNode["attributes"].value("NORMAL", -1);
-                int tangentIndex  = primitiveNode["attributes"].value("TANGENT", -1);
-                int jointsIndex   = primitiveNode["attributes"].value("JOINTS_0", -1);
-                int weightsIndex  = primitiveNode["attributes"].value("WEIGHTS_0", -1);
-                int indicesIndex  = primitiveNode.value("indices", -1);
-                int materialIndex = primitiveNode.value("material", -1);
-
-                // position
-                GLTFAccessor accessor = gltfData->accessors[posIndex];
-                GLTFBufferView bufferView = gltfData->bufferViews[accessor.bufferView];
-                LvnBin buffer = gltfData->buffers[bufferView.buffer];
+                memcpy(&indices[j], &indexBuffer[beginningOfData] + j * compType, compType);
+            }
+        }
 
-                uint32_t beginningOfData = accessor.byteOffset + bufferView.byteOffset;
+        // color
+        LvnVector<LvnVec4> colors;
+        if (colorIndex >= 0)
+        {
+            accessor = gltfData->accessors[colorIndex];
+            colors.resize(accessor.count);
+            LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
+            memcpy(colors.data(), data.data(), data.size() * sizeof(float));
+        }
+        else if (materialIndex >= 0) // check material for base color if no color attribute exists
+        {
+            colors.resize(positions.size());
+            for (uint32_t j = 0; j < positions.size(); j++)
+                colors[j] = gltfData->materials[materialIndex].pbrMetallicRoughness.baseColorFactor;
+        }
+        else // default vertex color if no material exists
+        {
+            colors.resize(positions.size());
+            for (uint32_t j = 0; j < positions.size(); j++)
+                colors[j] = LvnVec4(1, 1, 1, 1);
+        }
 
-                LvnVector<LvnVec3> positions(accessor.count);
-                for (uint32_t j = 0; j < accessor.count; j++)
-                    positions[j] = *reinterpret_cast<LvnVec3*>(&buffer[beginningOfData] + j * 3 * sizeof(float));
+        // texcoords
+        LvnVector<LvnVec2> texcoords;
+        if (texIndex >= 0)
+        {
+            accessor = gltfData->accessors[texIndex];
+            texcoords.resize(accessor.count);
+            LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
+            memcpy(texcoords.data(), data.data(), data.size() * sizeof(float));
+        }
+        else
+        {
+            texcoords.resize(positions.size(), 0);
+        }
 
-                // indices
-                LvnVector<uint32_t> indices;
-                if (indicesIndex >= 0)
-                {
-                    accessor = gltfData->accessors[indicesIndex];
-                    bufferView = gltfData->bufferViews[accessor.bufferView];
-                    buffer = gltfData->buffers[bufferView.buffer];
-
-                    beginningOfData = accessor.byteOffset + bufferView.byteOffset;
-                    size_t compType = gltfs::getCompType(accessor.componentType);
-
-                    indices.resize(accessor.count);
-                    for (uint32_t j = 0; j < accessor.count; j++)
-                    {
-                        memcpy(&indices[j], &buffer[beginningOfData] + j * compType, compType);
-                    }
-                }
+        // normals
+        LvnVector<LvnVec3> normals;
+        if (normalIndex >= 0)
+        {
+            accessor = gltfData->accessors[normalIndex];
+            bufferView = gltfData->bufferViews[accessor.bufferView];
+            const LvnBin& normalBuffer = gltfData->buffers[bufferView.buffer];
 
-                // color
-                LvnVector<LvnVec4> colors;
-                if (colorIndex >= 0)
-                {
-                    accessor = gltfData->accessors[colorIndex];
-                    colors.resize(accessor.count);
-                    LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
-                    memcpy(colors.data(), data.data(), data.size() * sizeof(float));
-                }
-                else if (materialIndex >= 0) // check material for base color if no color attribute exists
-                {
-                    colors.resize(positions.size());
-                    for (uint32_t j = 0; j < positions.size(); j++)
-                        colors[j] = gltfData->materials[materialIndex].pbrMetallicRoughness.baseColorFactor;
-                }
-                else // default vertex color if no material exists
-                {
-                    colors.resize(positions.size());
-                    for (uint32_t j = 0; j < positions.size(); j++)
-                        colors[j] = LvnVec4(1, 1, 1, 1);
-                }
+            beginningOfData = accessor.byteOffset + bufferView.byteOffset;
 
-                // texcoords
-                LvnVector<LvnVec2> texcoords;
-                if (texIndex >= 0)
-                {
-                    accessor = gltfData->accessors[texIndex];
-                    texcoords.resize(accessor.count);
-                    LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
-                    memcpy(texcoords.data(), data.data(), data.size() * sizeof(float));
-                }
-                else
-                {
-                    texcoords.resize(positions.size(), 0);
-                }
+            normals.resize(accessor.count);
+            for (uint32_t j = 0; j < accessor.count; j++)
+                normals[j] = *reinterpret_cast<const LvnVec3*>(&normalBuffer[beginningOfData] + j * 3 * sizeof(float));
+        }
+        else
+        {
+            normals.resize(positions.size(), 0);
+        }
 
-                // normals
-                LvnVector<LvnVec3> normals;
-                if (normalIndex >= 0)
-                {
-                    accessor = gltfData->accessors[normalIndex];
-                    bufferView = gltfData->bufferViews[accessor.bufferView];
-                    buffer = gltfData->buffers[bufferView.buffer];
+        // tangents
+        LvnVector<LvnVec4> tangents;
+        if (tangentIndex >= 0)
+        {
+            accessor = gltfData->accessors[tangentIndex];
+            bufferView = gltfData->bufferViews[accessor.bufferView];
+            const LvnBin& tangentBuffer = gltfData->buffers[bufferView.buffer];
 
-                    beginningOfData = accessor.byteOffset + bufferView.byteOffset;
+            beginningOfData = accessor.byteOffset + bufferView.byteOffset;
 
-                    normals.resize(accessor.count);
-                    for (uint32_t j = 0; j < accessor.count; j++)
-                        normals[j] = *reinterpret_cast<LvnVec3*>(&buffer[beginningOfData] + j * 3 * sizeof(float));
-                }
-                else
-                {
-                    normals.resize(positions.size(), 0);
-                }
+            tangents.resize(accessor.count);
+            for (uint32_t j = 0; j < accessor.count; j++)
+                tangents[j] = *reinterpret_cast<const LvnVec4*>(&tangentBuffer[beginningOfData] + j * 4 * sizeof(float));
+        }
+        else if (primitiveNode.value("mode", 4) >= 4 && posIndex >= 0 && normalIndex >= 0 && texIndex >= 0) // calculate tangents
+        {
+            GLTFTangentCalcInfo calcInfo{};
+            calcInfo.positions = positions;
+            calcInfo.normals = normals;
+            calcInfo.texUVs = texcoords;
+            calcInfo.indices = indices;
+            calcInfo.vertexPerFace = 3;
+            calcInfo.numFaces = indices.size() / 3;
+
+            tangents = gltfs::calculateTangents(&calcInfo);
+        }
+        else // mesh has no tangents
+        {
+            tangents.resize(positions.size(), 0);
+        }
 
-                // tangents
-                LvnVector<LvnVec4> tangents;
-                if (tangentIndex >= 0)
-                {
-                    accessor = gltfData->accessors[tangentIndex];
-                    bufferView = gltfData->bufferViews[accessor.bufferView];
-                    buffer = gltfData->buffers[bufferView.buffer];
+        // bitangents
+        LvnVector<LvnVec3> bitangents;
+        if (normalIndex >= 0 && tangentIndex >= 0)
+        {
+            bitangents = gltfs::calculateBitangents(normals, tangents);
+        }
+        else
+        {
+            bitangents.resize(positions.size(), 0);
+        }
 
-                    beginningOfData = accessor.byteOffset + bufferView.byteOffset;
+        // joints
+        LvnVector<LvnVec4> joints;
+        if (jointsIndex >= 0)
+        {
+            accessor = gltfData->accessors[jointsIndex];
+            joints.resize(accessor.count);
+            LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
+            memcpy(joints.data(), data.data(), data.size() * sizeof(float));
+        }
+        else
+        {
+            joints.resize(positions.size(), 0);
+        }
 
-                    tangents.resize(accessor.count);
-                    for (uint32_t j = 0; j < accessor.count; j++)
-                        tangents[j] = *reinterpret_cast<LvnVec4*>(&buffer[beginningOfData] + j * 4 * sizeof(float));
-                }
-                else if (primitiveNode.value("mode", 4) >= 4 && posIndex >= 0 && normalIndex >= 0 && texIndex >= 0) // calculate tangents
-                {
-                    GLTFTangentCalcInfo calcInfo{};
-                    calcInfo.positions = positions;
-                    calcInfo.normals = normals;
-                    calcInfo.texUVs = texcoords;
-                    calcInfo.indices = indices;
-                    calcInfo.vertexPerFace = 3;
-                    calcInfo.numFaces = indices.size() / 3;
-
-                    tangents = gltfs::calculateTangents(&calcInfo);
-                }
-                else // mesh has no tangents
-                {
-                    tangents.resize(positions.size(), 0);
-                }
+        // weights
+        LvnVector<LvnVec4> weights;
+        if (weightsIndex >= 0)
+        {
+            accessor = gltfData->accessors[weightsIndex];
+            weights.resize(accessor.count);
+            LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
+            memcpy(weights.data(), data.data(), data.size() * sizeof(float));
+        }
+        else
+        {
+            weights.resize(positions.size(), 0);
+        }
 
-                // bitangents
-                LvnVector<LvnVec3> bitangents;
-                if (normalIndex >= 0 && tangentIndex >= 0)
-                {
-                    bitangents = gltfs::calculateBitangents(normals, tangents);
-                }
-                else
-                {
-                    bitangents.resize(positions.size(), 0);
-                }
+        // combine vertex data
+        LvnVector<LvnVertex> vertices;
+        vertices.resize(positions.size());
 
-                // joints
-                LvnVector<LvnVec4> joints;
-                if (jointsIndex >= 0)
-                {
-                    accessor = gltfData->accessors[jointsIndex];
-                    joints.resize(accessor.count);
-                    LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
-                    memcpy(joints.data(), data.data(), data.size() * sizeof(float));
-                }
-                else
-                {
-                    joints.resize(positions.size(), 0);
-                }
+        for (uint32_t j = 0; j < positions.size(); j++)
+        {
+            vertices[j] = LvnVertex {
+                positions[j],
+                colors[j],
+                texcoords[j],
+                normals[j],
+                LvnVec3(tangents[j]),
+                bitangents[j],
+                joints[j],
+                weights[j],
+            };
+        }
 
-                // weights
-                LvnVector<LvnVec4> weights;
-                if (weightsIndex >= 0)
-                {
-                    accessor = gltfData->accessors[weightsIndex];
-                    weights.resize(accessor.count);
-                    LvnVector<float> data = gltfs::getAttributeData(gltfData, accessor);
-                    memcpy(weights.data(), data.data(), data.size() * sizeof(float));
-                }
-                else
-                {
-                    weights.resize(positions.size(), 0);
-                }
+        // vertices followed by indices in one buffer
+        primitive->bufferData.resize(vertices.size() * sizeof(LvnVertex) + indices.size() * sizeof(uint32_t));
+        memcpy(primitive->bufferData.data(), vertices.data(), vertices.size() * sizeof(LvnVertex));
+        memcpy(primitive->bufferData.data() + vertices.size() * sizeof(LvnVertex), indices.data(), indices.size() * sizeof(uint32_t));
 
-                // combine vertex data
-                LvnVector<LvnVertex> vertices;
-                vertices.resize(positions.size());
+        primitive->vertexCount = vertices.size();
+        primitive->indexCount = indices.size();
+    }
+    static void buildPrimitives(GLTFLoadData* gltfData)
+    {
+        const nlm::json& JSON = gltfData->JSON;
 
-                for (uint32_t j = 0; j < positions.size(); j++)
-                {
-                    vertices[j] = LvnVertex {
-                        positions[j],
-                        colors[j],
-                        texcoords[j],
-                        normals[j],
-                        LvnVec3(tangents[j]),
-                        bitangents[j],
-                        joints[j],
-                        weights[j],
-                    };
-                }
+        if (!JSON.contains("meshes"))
+            return;
 
-                // create buffer
-                LvnVertexAttribute meshVertexAttributes[] =
-                {
-                    { 0, 0, Lvn_AttributeFormat_Vec3_f32, 0 },                   // pos
-                    { 0, 1, Lvn_AttributeFormat_Vec4_f32, 3 * sizeof(float) },   // color
-                    { 0, 2, Lvn_AttributeFormat_Vec2_f32, 7 * sizeof(float) },   // texUV
-                    { 0, 3, Lvn_AttributeFormat_Vec3_f32, 9 * sizeof(float) },   // normal
-                    { 0, 4, Lvn_AttributeFormat_Vec3_f32, 12 * sizeof(float) },  // tangent
-                    { 0, 5, Lvn_AttributeFormat_Vec3_f32, 15 * sizeof(float) },  // bitangent
-                    { 0, 6, Lvn_AttributeFormat_Vec4_f32, 18 * sizeof(float) },  // joints
-                    { 0, 7, Lvn_AttributeFormat_Vec4_f32, 22 * sizeof(float) },  // weights
-                };
-
-                LvnVertexBindingDescription meshVertexBindingDescription;
-                meshVertexBindingDescription.binding = 0;
-                meshVertexBindingDescription.stride = sizeof(LvnVertex);
-
-                LvnVector<uint8_t> bufferData(vertices.size() * sizeof(LvnVertex) + indices.size() * sizeof(uint32_t));
-                memcpy(bufferData.data(), vertices.data(), vertices.size() * sizeof(LvnVertex));
-                memcpy(bufferData.data() + vertices.size() * sizeof(LvnVertex), indices.data(), indices.size() * sizeof(uint32_t));
-
-                LvnBufferCreateInfo bufferCreateInfo{};
-                bufferCreateInfo.type = Lvn_BufferType_Vertex;
-                if (!indices.empty()) bufferCreateInfo.type |= Lvn_BufferType_Index;
-                bufferCreateInfo.usage = Lvn_BufferUsage_Static;
-                bufferCreateInfo.size = vertices.size() * sizeof(LvnVertex) + indices.size() * sizeof(uint32_t);
-                bufferCreateInfo.data = bufferData.data();
-
-                LvnBuffer* meshBuffer;
-                lvn::createBuffer(&meshBuffer, &bufferCreateInfo);
-                meshPrimitives[i].buffer = meshBuffer;
-                gltfData->meshBuffers.push_back(meshBuffer);
-
-                meshPrimitives[i].vertexCount = vertices.size();
-                meshPrimitives[i].indexCount = indices.size();
-                meshPrimitives[i].indexOffset = vertices.size() * sizeof(LvnVertex);
-
-                // material textures
-                if (materialIndex >= 0)
-                {
-                    meshPrimitives[i].material = gltfs::getMaterial(gltfData, materialIndex);
-                }
-                else
-                {
-                    meshPrimitives[i].material.albedo = gltfData->defaultBaseColorTexture;
-                    meshPrimitives[i].material.metallicRoughnessOcclusion = gltfData->defaultMetalicRoughnessTexture;
-                    meshPrimitives[i].material.normal = gltfData->defaultNormalTexture;
-                    meshPrimitives[i].material.emissive = gltfData->defaultEmissiveTexture;
-                    meshPrimitives[i].material.baseColorFactor = LvnVec4(1, 1, 1, 1);
-                    meshPrimitives[i].material.metallicFactor = 1.0f;
-                    meshPrimitives[i].material.roughnessFactor = 1.0f;
-                    meshPrimitives[i].material.emissiveFactor = LvnVec3(0, 0, 0);
-                    meshPrimitives[i].material.doubleSided = false;
-
-                    // load all default textures if no material found
-                    gltfs::loadDefaultTextures(gltfData);
-                    meshPrimitives[i].material.albedo = gltfData->defaultBaseColorTexture;
-                    meshPrimitives[i].material.metallicRoughnessOcclusion = gltfData->defaultMetalicRoughnessTexture;
-                    meshPrimitives[i].material.normal = gltfData->defaultNormalTexture;
-                    meshPrimitives[i].material.emissive = gltfData->defaultEmissiveTexture;
-                }
+        // flatten the primitives of every mesh so each primitive is one unit of work
+        const nlm::json& meshNodes = JSON["meshes"];
+        LvnVector<GLTFPrimitiveData>& primitives = gltfData->primitives;
+        for (uint32_t meshIndex = 0; meshIndex < meshNodes.size(); meshIndex++)
+        {
+            const nlm::json& primitiveNodes = meshNodes[meshIndex]["primitives"];
 
-                meshPrimitives[i].topology = gltfs::getTopologyEnum(primitiveNode.value("mode", 4));
+            for (uint32_t i = 0; i < primitiveNodes.size(); i++)
+            {
+                GLTFPrimitiveData primitive{};
+                primitive.node = &primitiveNodes[i];
+                primitive.meshIndex = meshIndex;
+                primitive.primitiveIndex = i;
+                primitives.push_back(lvn::move(primitive));
             }
+        }
 
-            LvnMesh mesh{};
-            mesh.primitives = lvn::move(meshPrimitives);
-            meshes[meshIndex] = lvn::move(mesh);
+        // vertex assembly and tangent generation only read from gltfData and are run on the job system
+        lvn::jobParallelFor(primitives.size(), 1, [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; i++)
+                gltfs::buildPrimitiveData(gltfData, &primitives[i]);
+        });
+    }
+    static LvnVector<LvnMesh> loadMeshes(GLTFLoadData* gltfData)
+    {
+        const nlm::json& JSON = gltfData->JSON;
+
+        if (!JSON.contains("meshes"))
+            return {};
+
+        const nlm::json& meshNodes = JSON["meshes"];
+        LvnVector<LvnMesh> meshes(meshNodes.size());
+        for (uint32_t meshIndex = 0; meshIndex < meshNodes.size(); meshIndex++)
+            meshes[meshIndex].primitives.resize(meshNodes[meshIndex]["primitives"].size());
+
+        // buffers and material textures are created from the primitives built by buildPrimitives on the calling thread
+        const LvnVector<GLTFPrimitiveData>& primitives = gltfData->primitives;
+        for (uint32_t i = 0; i < primitives.size(); i++)
+        {
+            const GLTFPrimitiveData& primitive = primitives[i];
+            LvnPrimitive& meshPrimitive = meshes[primitive.meshIndex].primitives[primitive.primitiveIndex];
+
+            LvnBufferCreateInfo bufferCreateInfo{};
+            bufferCreateInfo.type = Lvn_BufferType_Vertex;
+            if (primitive.indexCount > 0) bufferCreateInfo.type |= Lvn_BufferType_Index;
+            bufferCreateInfo.usage = Lvn_BufferUsage_Static;
+            bufferCreateInfo.size = primitive.bufferData.size();
+            bufferCreateInfo.data = primitive.bufferData.data();
+
+            LvnBuffer* meshBuffer;
+            lvn::createBuffer(&meshBuffer, &bufferCreateInfo);
+            meshPrimitive.buffer = meshBuffer;
+            gltfData->meshBuffers.push_back(meshBuffer);
+
+            meshPrimitive.vertexCount = primitive.vertexCount;
+            meshPrimitive.indexCount = primitive.indexCount;
+            meshPrimitive.indexOffset = primitive.vertexCount * sizeof(LvnVertex);
+
+            // material textures
+            int materialIndex = primitive.node->value("material", -1);
+            if (materialIndex >= 0)
+            {
+                meshPrimitive.material = gltfs::getMaterial(gltfData, materialIndex);
+            }
+            else
+            {
+                meshPrimitive.material.baseColorFactor = LvnVec4(1, 1, 1, 1);
+                meshPrimitive.material.metallicFactor = 1.0f;
+                meshPrimitive.material.roughnessFactor = 1.0f;
+                meshPrimitive.material.emissiveFactor = LvnVec3(0, 0, 0);
+                meshPrimitive.material.doubleSided = false;
+
+                // load all default textures if no material found
+                gltfs::loadDefaultTextures(gltfData);
+                meshPrimitive.material.albedo = gltfData->defaultBaseColorTexture;
+                meshPrimitive.material.metallicRoughnessOcclusion = gltfData->defaultMetalicRoughnessTexture;
+                meshPrimitive.material.normal = gltfData->defaultNormalTexture;
+                meshPrimitive.material.emissive = gltfData->defaultEmissiveTexture;
+            }
+
+            meshPrimitive.topology = gltfs::getTopologyEnum(primitive.node->value("mode", 4));
         }
 
         return meshes;
@@ -1473,66 +1556,82 @@ namespace gltfs
                 int32_t meshIndex = JSON["nodes"][i]["mesh"];
         }
     }
-    static LvnModel loadGltfModelFileType(const char* filepath, LvnFileType filetype)
+    // reads and decodes everything in the file without creating any graphics objects so that it can be called from any thread
+    static LvnModelData* loadGltfModelDataFileType(const char* filepath, LvnFileType filetype)
     {
-        LvnContext* lvnctx = lvn::getContext();
-
-        gltfs::GLTFLoadData gltfData{};
+        gltfs::GLTFLoadData* gltfDataPtr = LVN_MEM_NEW(gltfs::GLTFLoadData, 1);
+        gltfs::GLTFLoadData& gltfData = *gltfDataPtr;
         gltfData.filepath = filepath;
         gltfData.filetype = filetype;
 
         if (filetype == Lvn_FileType_Gltf) // gltf text file
         {
-            std::string jsonText = lvn::loadFileSrc(filepath).c_str();
-            gltfData.JSON = nlm::json::parse(jsonText);
+            const LvnBin jsonData = lvn::mapFile(filepath);
+            gltfData.JSON = nlm::json::parse(jsonData.begin(), jsonData.end());
             gltfData.buffers = std::move(gltfs::loadBuffers(gltfData.JSON, filepath)); // load buffers from external file
         }
         else if (filetype == Lvn_FileType_Glb) // glb binary file
         {
-            LvnBin binData = lvn::loadFileSrcBin(filepath);
+            // the file is mapped and never copied, the json is parsed in place and the buffers are views into the mapping
+            const LvnBin binData = lvn::mapFile(filepath);
+            if (binData.size() < 20)
+            {
+                LVN_CORE_ERROR("[gltf]: could not load glb file, file is empty or too small for a glb header; Filepath: %s", filepath);
+                lvn::memDelete(gltfDataPtr);
+                return nullptr;
+            }
 
             // chunk 0 (JSON)
             uint32_t chunkLengthJson = 0;
             memcpy(&chunkLengthJson, &binData[12], sizeof(uint32_t));
-            LvnVector<uint8_t> chunkDataJson(&binData[20], &binData[20] + chunkLengthJson);
 
-            std::string jsonText = std::string(chunkDataJson.begin(), chunkDataJson.end());
-            gltfData.JSON = nlm::json::parse(jsonText);
-            nlm::json JSON = gltfData.JSON;
+            if (20 + static_cast<uint64_t>(chunkLengthJson) > binData.size())
+            {
+                LVN_CORE_ERROR("[gltf]: could not load glb file, json chunk (length:%u) goes past the end of the file (size:%llu); Filepath: %s", chunkLengthJson, (unsigned long long)binData.size(), filepath);
+                lvn::memDelete(gltfDataPtr);
+                return nullptr;
+            }
+
+            const char* jsonText = reinterpret_cast<const char*>(&binData[20]);
+            gltfData.JSON = nlm::json::parse(jsonText, jsonText + chunkLengthJson);
+            const nlm::json& JSON = gltfData.JSON;
 
             // load buffers; buffer are stored in binary file, chunk 1...n after chunk 0
             uint64_t chunkOffset = 0;
-            gltfData.buffers.resize(JSON["buffers"].size());
-            for (int i = 0; i < JSON["buffers"].size(); i++)
+            uint32_t bufferCount = JSON.contains("buffers") ? JSON["buffers"].size() : 0;
+            gltfData.buffers.resize(bufferCount);
+            for (uint32_t i = 0; i < bufferCount; i++)
             {
                 // chunk 1... (Buffer)
+                uint64_t chunkStart = 20 + static_cast<uint64_t>(chunkLengthJson) + chunkOffset;
                 uint32_t chunkLengthBuffer = 0;
-                memcpy(&chunkLengthBuffer, &binData[20 + chunkLengthJson + chunkOffset], sizeof(uint32_t));
-                LvnVector<uint8_t> chunkDataBuffer(&binData[28 + chunkLengthJson + chunkOffset], &binData[28 + chunkLengthJson + chunkOffset] + chunkLengthBuffer);
+                if (chunkStart + 8 <= binData.size())
+                    memcpy(&chunkLengthBuffer, &binData[chunkStart], sizeof(uint32_t));
+
+                if (chunkStart + 8 + chunkLengthBuffer > binData.size())
+                {
+                    LVN_CORE_ERROR("[gltf]: could not load glb file, buffer chunk (%u) goes past the end of the file (size:%llu); Filepath: %s", i, (unsigned long long)binData.size(), filepath);
+                    lvn::memDelete(gltfDataPtr);
+                    return nullptr;
+                }
 
-                gltfData.buffers[i] = LvnBin(chunkDataBuffer.data(), chunkDataBuffer.size());
+                // buffers share the file data instead of copying each chunk
+                gltfData.buffers[i] = binData.slice(chunkStart + 8, chunkLengthBuffer);
                 chunkOffset += chunkLengthBuffer + 8;
             }
         }
 
-        nlm::json JSON = gltfData.JSON;
+        const nlm::json& JSON = gltfData.JSON;
 
         if (JSON["scenes"].size() > 1)
             LVN_CORE_WARN("gltf model has more than one scene, loading mesh data from the first scene; Filepath: %s", filepath);
 
-        if (JSON.contains("textures"))
-        {
-            gltfData.textures.reserve(JSON["textures"].size() + 4); // reserve extra spaces for default textures
-            gltfData.textures.resize(JSON["textures"].size());
-        }
-
         gltfData.accessors = std::move(gltfs::loadAccessors(gltfData.JSON));
         gltfData.bufferViews = std::move(gltfs::loadBufferViews(gltfData.JSON));
         gltfData.materials = std::move(gltfs::loadMaterials(gltfData.JSON));
         gltfData.animations = std::move(gltfs::loadAnimations(gltfData.JSON));
         gltfData.skins = std::move(gltfs::loadSkins(gltfData.JSON));
         gltfData.images = std::move(gltfs::loadImages(gltfData));
-        gltfData.samplers = std::move(gltfs::loadSamplers(gltfData.JSON, &gltfData.defaultSampler));
 
         LvnNode defaultNode{};
         defaultNode.parent = -1;
@@ -1549,43 +1648,124 @@ namespace gltfs
             gltfs::traverseNode(&gltfData, nodeIndex);
         }
 
-        LvnVector<LvnAnimation> modelAnimations;
-        std::future<LvnVector<LvnAnimation>> animationFuture;
+        // animations only read the animation data and buffers which are not changed while building the primitives
+        struct AnimationJobData
+        {
+            const GLTFLoadData* gltfData;
+            LvnVector<LvnAnimation> animations;
+        } animationJobData = { &gltfData, {} };
 
-        if (lvnctx->multithreading)
-            animationFuture = std::async(std::launch::async, gltfs::bindAnimationsToNodes, gltfData);
-        else
-            modelAnimations = std::move(gltfs::bindAnimationsToNodes(gltfData));
-
-        gltfData.meshes = std::move(gltfs::loadMeshes(&gltfData));
-        gltfs::bindMeshToNodes(&gltfData);
-
-        if (lvnctx->multithreading)
-            modelAnimations = std::move(animationFuture.get());
-
-        LvnModel model{};
-        model.skins = std::move(gltfs::bindSkinsToNodes(gltfData));
-        model.rootNodes = std::move(gltfData.rootNodes);
-        model.nodes = std::move(gltfData.nodes);
-        model.meshes = std::move(gltfData.meshes);
-        model.animations = std::move(modelAnimations);
-        model.buffers = std::move(gltfData.meshBuffers);
-        model.textures = std::move(gltfData.textures);
-        model.samplers = std::move(gltfData.samplers);
-        model.matrix = LvnMat4(1.0f);
-
-        return model;
+        LvnJob animationJob{};
+        animationJob.data = &animationJobData;
+        animationJob.func = [](void* data)
+        {
+            AnimationJobData* jobData = static_cast<AnimationJobData*>(data);
+            jobData->animations = gltfs::bindAnimationsToNodes(*jobData->gltfData);
+        };
+
+        LvnJobCounter animationCounter{};
+        lvn::jobSubmit(&animationJob, 1, &animationCounter);
+
+        gltfs::buildPrimitives(&gltfData);
+
+        lvn::jobWait(&animationCounter);
+        gltfData.modelAnimations = std::move(animationJobData.animations);
+
+        LvnModelData* modelData = LVN_MEM_NEW(LvnModelData, 1);
+        modelData->type = Lvn_ModelDataType_Gltf;
+        modelData->data = gltfDataPtr;
+        modelData->uploadSize = 0;
+        for (uint32_t i = 0; i < gltfData.primitives.size(); i++)
+            modelData->uploadSize += gltfData.primitives[i].bufferData.size();
+        for (uint32_t i = 0; i < gltfData.images.size(); i++)
+            modelData->uploadSize += gltfData.images[i].size;
+
+        return modelData;
     }
 
 } /* namespace gltf */
 
-LvnModel loadGltfModel(const char* filepath)
+LvnModelData* loadGltfModelData(const char* filepath)
+{
+    return gltfs::loadGltfModelDataFileType(filepath, Lvn_FileType_Gltf);
+}
+LvnModelData* loadGlbModelData(const char* filepath)
+{
+    return gltfs::loadGltfModelDataFileType(filepath, Lvn_FileType_Glb);
+}
+
+LvnModel createGltfModel(LvnModelData* modelData)
+{
+    gltfs::GLTFLoadData& gltfData = *static_cast<gltfs::GLTFLoadData*>(modelData->data);
+    const nlm::json& JSON = gltfData.JSON;
+
+    if (JSON.contains("textures"))
+    {
+        gltfData.textures.reserve(JSON["textures"].size() + 4); // reserve extra spaces for default textures
+        gltfData.textures.resize(JSON["textures"].size());
+    }
+
+    gltfData.samplers = std::move(gltfs::loadSamplers(gltfData.JSON, &gltfData.defaultSampler));
+    gltfData.meshes = std::move(gltfs::loadMeshes(&gltfData));
+    gltfs::bindMeshToNodes(&gltfData);
+
+    LvnModel model{};
+    model.skins = std::move(gltfs::bindSkinsToNodes(gltfData));
+    model.rootNodes = std::move(gltfData.rootNodes);
+    model.nodes = std::move(gltfData.nodes);
+    model.meshes = std::move(gltfData.meshes);
+    model.animations = std::move(gltfData.modelAnimations);
+    model.buffers = std::move(gltfData.meshBuffers);
+    model.textures = std::move(gltfData.textures);
+    model.samplers = std::move(gltfData.samplers);
+    model.matrix = LvnMat4(1.0f);
+
+    lvn::freeGltfModelData(modelData);
+    return model;
+}
+
+void getGltfModelBakeData(LvnModelData* modelData, LvnModelBakeData* bakeData)
 {
-    return gltfs::loadGltfModelFileType(filepath, Lvn_FileType_Gltf);
+    gltfs::GLTFLoadData& gltfData = *static_cast<gltfs::GLTFLoadData*>(modelData->data);
+    const nlm::json& JSON = gltfData.JSON;
+
+    // skins first so the joint nodes have their skin set before the nodes are copied
+    bakeData->skins = gltfs::loadSkinData(gltfData);
+    bakeData->rootNodes = gltfData.rootNodes;
+    bakeData->nodes = gltfData.nodes;
+    bakeData->animations = gltfData.modelAnimations;
+    bakeData->images = gltfData.images;
+
+    LvnBakeTexture unusedTexture{};
+    unusedTexture.image = -1;
+    bakeData->textures.resize(JSON.contains("textures") ? JSON["textures"].size() : 0, unusedTexture);
+
+    if (JSON.contains("meshes"))
+    {
+        const nlm::json& meshNodes = JSON["meshes"];
+        bakeData->meshes.resize(meshNodes.size());
+        for (uint32_t meshIndex = 0; meshIndex < meshNodes.size(); meshIndex++)
+            bakeData->meshes[meshIndex].primitives.resize(meshNodes[meshIndex]["primitives"].size());
+    }
+
+    for (uint32_t i = 0; i < gltfData.primitives.size(); i++)
+    {
+        const gltfs::GLTFPrimitiveData& primitive = gltfData.primitives[i];
+        LvnBakePrimitive& bakePrimitive = bakeData->meshes[primitive.meshIndex].primitives[primitive.primitiveIndex];
+
+        bakePrimitive.topology = gltfs::getTopologyEnum(primitive.node->value("mode", 4));
+        bakePrimitive.material = gltfs::getBakeMaterial(&gltfData, primitive.node->value("material", -1), bakeData);
+        bakePrimitive.vertexCount = primitive.vertexCount;
+        bakePrimitive.indexCount = primitive.indexCount;
+        bakePrimitive.bufferData = primitive.bufferData.data();
+        bakePrimitive.bufferSize = primitive.bufferData.size();
+    }
 }
-LvnModel loadGlbModel(const char* filepath)
+
+void freeGltfModelData(LvnModelData* modelData)
 {
-    return gltfs::loadGltfModelFileType(filepath, Lvn_FileType_Glb);
+    lvn::memDelete(static_cast<gltfs::GLTFLoadData*>(modelData->data));
+    lvn::memDelete(modelData);
 }
 
 } /* namespace lvn */
@@ -22,7 +22,14 @@ struct OBJMatrial
     std::string specularMap;
 };
 
-LvnModel loadObjModel(const char* filepath)
+struct OBJLoadData
+{
+    std::vector<uint8_t> bufferData;     /* vertices followed by the indices */
+    uint32_t vertexCount;
+    uint32_t indexCount;
+};
+
+LvnModelData* loadObjModelData(const char* filepath)
 {
     std::vector<LvnVec3> positions;
     std::vector<LvnVec2> texCoords;
@@ -32,12 +39,19 @@ LvnModel loadObjModel(const char* filepath)
 
     std::unordered_map<std::string, uint32_t> indicesMap;
 
-    std::string filesrc = lvn::loadFileSrc(filepath).c_str();
-    std::istringstream filess(filesrc);
+    // lines are read straight from the mapped file, only one line is copied at a time
+    const LvnBin filesrc = lvn::mapFile(filepath);
+    const char* src = reinterpret_cast<const char*>(filesrc.data());
+    const char* srcEnd = src + filesrc.size();
 
     std::string line;
-    while (std::getline(filess, line))
+    while (src < srcEnd)
     {
+        const char* lineEnd = static_cast<const char*>(memchr(src, '\n', srcEnd - src));
+        if (lineEnd == nullptr) { lineEnd = srcEnd; }
+        line.assign(src, lineEnd);
+        src = lineEnd < srcEnd ? lineEnd + 1 : srcEnd;
+
         std::istringstream ss(line);
         std::string prefix;
         ss >> prefix;
@@ -107,40 +121,39 @@ LvnModel loadObjModel(const char* filepath)
         }
     }
 
-    LvnVertexAttribute meshVertexAttributes[] =
-    {
-        { 0, 0, Lvn_AttributeFormat_Vec3_f32, 0 },                   // pos
-        { 0, 1, Lvn_AttributeFormat_Vec4_f32, 3 * sizeof(float) },   // color
-        { 0, 2, Lvn_AttributeFormat_Vec2_f32, 7 * sizeof(float) },   // texUV
-        { 0, 3, Lvn_AttributeFormat_Vec3_f32, 9 * sizeof(float) },   // normal
-        { 0, 4, Lvn_AttributeFormat_Vec3_f32, 12 * sizeof(float) },  // tangent
-        { 0, 5, Lvn_AttributeFormat_Vec3_f32, 15 * sizeof(float) },  // bitangent
-        { 0, 6, Lvn_AttributeFormat_Vec4_f32, 18 * sizeof(float) },  // joints
-        { 0, 7, Lvn_AttributeFormat_Vec4_f32, 22 * sizeof(float) },  // weights
-    };
-
-    LvnVertexBindingDescription meshVertexBindingDescription;
-    meshVertexBindingDescription.binding = 0;
-    meshVertexBindingDescription.stride = sizeof(LvnVertex);
-
-    std::vector<uint8_t> bufferData(vertices.size() * sizeof(LvnVertex) + indices.size() * sizeof(uint32_t));
-    memcpy(bufferData.data(), vertices.data(), vertices.size() * sizeof(LvnVertex));
-    memcpy(bufferData.data() + vertices.size() * sizeof(LvnVertex), indices.data(), indices.size() * sizeof(uint32_t));
+    OBJLoadData* objData = LVN_MEM_NEW(OBJLoadData, 1);
+    objData->vertexCount = vertices.size();
+    objData->indexCount = indices.size();
+    objData->bufferData.resize(vertices.size() * sizeof(LvnVertex) + indices.size() * sizeof(uint32_t));
+    memcpy(objData->bufferData.data(), vertices.data(), vertices.size() * sizeof(LvnVertex));
+    memcpy(objData->bufferData.data() + vertices.size() * sizeof(LvnVertex), indices.data(), indices.size() * sizeof(uint32_t));
+
+    LvnModelData* modelData = LVN_MEM_NEW(LvnModelData, 1);
+    modelData->type = Lvn_ModelDataType_Obj;
+    modelData->uploadSize = objData->bufferData.size();
+    modelData->data = objData;
+
+    return modelData;
+}
+
+LvnModel createObjModel(LvnModelData* modelData)
+{
+    const OBJLoadData* objData = static_cast<const OBJLoadData*>(modelData->data);
 
     LvnBufferCreateInfo bufferCreateInfo{};
     bufferCreateInfo.type = Lvn_BufferType_Vertex;
-    if (!indices.empty()) bufferCreateInfo.type |= Lvn_BufferType_Index;
+    if (objData->indexCount > 0) bufferCreateInfo.type |= Lvn_BufferType_Index;
     bufferCreateInfo.usage = Lvn_BufferUsage_Static;
-    bufferCreateInfo.size = vertices.size() * sizeof(LvnVertex) + indices.size() * sizeof(uint32_t);
-    bufferCreateInfo.data = bufferData.data();
+    bufferCreateInfo.size = objData->bufferData.size();
+    bufferCreateInfo.data = objData->bufferData.data();
 
     LvnBuffer* buffer;
     lvn::createBuffer(&buffer, &bufferCreateInfo);
 
     LvnPrimitive primitive;
     primitive.buffer = buffer;
-    primitive.vertexCount = vertices.size();
-    primitive.indexCount = indices.size();
+    primitive.vertexCount = objData->vertexCount;
+    primitive.indexCount = objData->indexCount;
     primitive.topology = Lvn_TopologyType_Triangle;
 
     LvnMesh mesh{};
@@ -161,7 +174,47 @@ LvnModel loadObjModel(const char* filepath)
     model.rootNodes.push_back(0);
     model.meshes.push_back(mesh);
 
+    lvn::freeObjModelData(modelData);
     return model;
 }
 
+void getObjModelBakeData(LvnModelData* modelData, LvnModelBakeData* bakeData)
+{
+    const OBJLoadData* objData = static_cast<const OBJLoadData*>(modelData->data);
+
+    // obj materials are not loaded, the primitive uses the default textures
+    LvnBakePrimitive primitive{};
+    primitive.topology = Lvn_TopologyType_Triangle;
+    primitive.material.baseColorFactor = LvnVec4(1, 1, 1, 1);
+    primitive.material.metallicFactor = 1.0f;
+    primitive.material.roughnessFactor = 1.0f;
+    primitive.material.albedo = primitive.material.metallicRoughnessOcclusion = primitive.material.normal = primitive.material.emissive = -1;
+    primitive.vertexCount = objData->vertexCount;
+    primitive.indexCount = objData->indexCount;
+    primitive.bufferData = objData->bufferData.data();
+    primitive.bufferSize = objData->bufferData.size();
+
+    LvnBakeMesh mesh{};
+    mesh.primitives = LvnVector(&primitive, 1);
+
+    LvnNode node{};
+    node.parent = -1;
+    node.transform.translation = LvnVec3(0, 0, 0);
+    node.transform.rotation = LvnQuat(1, 0, 0, 0);
+    node.transform.scale = LvnVec3(1, 1, 1);
+    node.matrix = LvnMat4(1.0f);
+    node.skin = -1;
+    node.mesh = 0;
+
+    bakeData->nodes.push_back(node);
+    bakeData->rootNodes.push_back(0);
+    bakeData->meshes.push_back(mesh);
+}
+
+void freeObjModelData(LvnModelData* modelData)
+{
+    lvn::memDelete(static_cast<OBJLoadData*>(modelData->data));
+    lvn::memDelete(modelData);
+}
+
 } /* namespace lvn */
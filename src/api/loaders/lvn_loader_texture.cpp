@@ -0,0 +1,361 @@
+#include "levikno.h"
+#include "lvn_loaders.h"
+
+// ktx2 and dds files hold textures in the layout the graphics apis take them in, the files are never decoded, the levels are
+// slices of the file data so the blocks are uploaded straight from the file (or its mapping)
+// - only 2d textures with a single layer and face are loaded, cubemaps, arrays and volume textures are rejected
+// - bc1, bc3, bc5 and bc7 blocks and r8, rg8 and rgba8 pixels are supported, the srgb flag of the file format is not kept, the
+//   texture format is chosen by LvnTextureCreateInfo::format
+// - ktx2 files with supercompression (zstd, basis) are not supported
+
+#define LVN_KTX2_HEADER_SIZE          (80)     /* identifier, header and index, the level index follows */
+#define LVN_KTX2_LEVEL_INDEX_SIZE     (24)     /* byteOffset, byteLength, uncompressedByteLength */
+#define LVN_DDS_HEADER_SIZE           (128)    /* magic and DDS_HEADER */
+#define LVN_DDS_HEADER_DX10_SIZE      (20)
+
+#define LVN_DDS_FLAG_MIPMAPCOUNT      (0x20000)
+#define LVN_DDS_PF_FOURCC             (0x4)
+#define LVN_DDS_PF_RGB                (0x40)
+#define LVN_DDS_PF_LUMINANCE          (0x20000)
+#define LVN_DDS_CAPS2_CUBEMAP         (0x200)
+#define LVN_DDS_CAPS2_VOLUME          (0x200000)
+#define LVN_DDS_DIMENSION_TEXTURE2D   (3)
+#define LVN_DDS_MISC_TEXTURECUBE      (0x4)
+
+#define LVN_FOURCC(a, b, c, d)        ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+
+static const uint8_t s_Ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+namespace lvn
+{
+
+// VkFormat values of the formats that can be loaded from ktx2 files
+enum LvnKtx2Format
+{
+    Lvn_Ktx2Format_R8Unorm       = 9,
+    Lvn_Ktx2Format_R8Srgb        = 15,
+    Lvn_Ktx2Format_R8G8Unorm     = 16,
+    Lvn_Ktx2Format_R8G8Srgb      = 22,
+    Lvn_Ktx2Format_R8G8B8A8Unorm = 37,
+    Lvn_Ktx2Format_R8G8B8A8Srgb  = 43,
+    Lvn_Ktx2Format_Bc1RgbUnorm   = 131,
+    Lvn_Ktx2Format_Bc1RgbSrgb    = 132,
+    Lvn_Ktx2Format_Bc1RgbaUnorm  = 133,
+    Lvn_Ktx2Format_Bc1RgbaSrgb   = 134,
+    Lvn_Ktx2Format_Bc3Unorm      = 137,
+    Lvn_Ktx2Format_Bc3Srgb       = 138,
+    Lvn_Ktx2Format_Bc5Unorm      = 141,
+    Lvn_Ktx2Format_Bc7Unorm      = 145,
+    Lvn_Ktx2Format_Bc7Srgb       = 146,
+};
+
+// DXGI_FORMAT values of the formats that can be loaded from dds files with a DX10 header
+enum LvnDxgiFormat
+{
+    Lvn_DxgiFormat_R8G8B8A8Unorm = 28,
+    Lvn_DxgiFormat_R8G8B8A8Srgb  = 29,
+    Lvn_DxgiFormat_R8G8Unorm     = 49,
+    Lvn_DxgiFormat_R8Unorm       = 61,
+    Lvn_DxgiFormat_Bc1Unorm      = 71,
+    Lvn_DxgiFormat_Bc1Srgb       = 72,
+    Lvn_DxgiFormat_Bc3Unorm      = 77,
+    Lvn_DxgiFormat_Bc3Srgb       = 78,
+    Lvn_DxgiFormat_Bc5Unorm      = 83,
+    Lvn_DxgiFormat_Bc7Unorm      = 98,
+    Lvn_DxgiFormat_Bc7Srgb       = 99,
+};
+
+static uint32_t readU32(const uint8_t* data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(uint32_t));
+    return value;
+}
+
+static uint64_t readU64(const uint8_t* data)
+{
+    uint64_t value;
+    memcpy(&value, data, sizeof(uint64_t));
+    return value;
+}
+
+static bool getKtx2Format(uint32_t vkFormat, LvnTextureCompression* compression, uint32_t* channels)
+{
+    switch (vkFormat)
+    {
+        case Lvn_Ktx2Format_R8Unorm:
+        case Lvn_Ktx2Format_R8Srgb:       { *compression = Lvn_TextureCompression_None; *channels = 1; return true; }
+        case Lvn_Ktx2Format_R8G8Unorm:
+        case Lvn_Ktx2Format_R8G8Srgb:     { *compression = Lvn_TextureCompression_None; *channels = 2; return true; }
+        case Lvn_Ktx2Format_R8G8B8A8Unorm:
+        case Lvn_Ktx2Format_R8G8B8A8Srgb: { *compression = Lvn_TextureCompression_None; *channels = 4; return true; }
+        case Lvn_Ktx2Format_Bc1RgbUnorm:
+        case Lvn_Ktx2Format_Bc1RgbSrgb:
+        case Lvn_Ktx2Format_Bc1RgbaUnorm:
+        case Lvn_Ktx2Format_Bc1RgbaSrgb:  { *compression = Lvn_TextureCompression_Bc1; *channels = 4; return true; }
+        case Lvn_Ktx2Format_Bc3Unorm:
+        case Lvn_Ktx2Format_Bc3Srgb:      { *compression = Lvn_TextureCompression_Bc3; *channels = 4; return true; }
+        case Lvn_Ktx2Format_Bc5Unorm:     { *compression = Lvn_TextureCompression_Bc5; *channels = 2; return true; }
+        case Lvn_Ktx2Format_Bc7Unorm:
+        case Lvn_Ktx2Format_Bc7Srgb:      { *compression = Lvn_TextureCompression_Bc7; *channels = 4; return true; }
+
+        default: { return false; }
+    }
+}
+
+static bool getDxgiFormat(uint32_t dxgiFormat, LvnTextureCompression* compression, uint32_t* channels)
+{
+    switch (dxgiFormat)
+    {
+        case Lvn_DxgiFormat_R8Unorm:       { *compression = Lvn_TextureCompression_None; *channels = 1; return true; }
+        case Lvn_DxgiFormat_R8G8Unorm:     { *compression = Lvn_TextureCompression_None; *channels = 2; return true; }
+        case Lvn_DxgiFormat_R8G8B8A8Unorm:
+        case Lvn_DxgiFormat_R8G8B8A8Srgb:  { *compression = Lvn_TextureCompression_None; *channels = 4; return true; }
+        case Lvn_DxgiFormat_Bc1Unorm:
+        case Lvn_DxgiFormat_Bc1Srgb:       { *compression = Lvn_TextureCompression_Bc1; *channels = 4; return true; }
+        case Lvn_DxgiFormat_Bc3Unorm:
+        case Lvn_DxgiFormat_Bc3Srgb:       { *compression = Lvn_TextureCompression_Bc3; *channels = 4; return true; }
+        case Lvn_DxgiFormat_Bc5Unorm:      { *compression = Lvn_TextureCompression_Bc5; *channels = 2; return true; }
+        case Lvn_DxgiFormat_Bc7Unorm:
+        case Lvn_DxgiFormat_Bc7Srgb:       { *compression = Lvn_TextureCompression_Bc7; *channels = 4; return true; }
+
+        default: { return false; }
+    }
+}
+
+// legacy dds pixel formats are given by a fourCC code or by bit masks
+static bool getDdsPixelFormat(const uint8_t* pixelFormat, LvnTextureCompression* compression, uint32_t* channels)
+{
+    uint32_t flags = lvn::readU32(pixelFormat + 4);
+    uint32_t fourCC = lvn::readU32(pixelFormat + 8);
+    uint32_t bitCount = lvn::readU32(pixelFormat + 12);
+    uint32_t rMask = lvn::readU32(pixelFormat + 16);
+    uint32_t gMask = lvn::readU32(pixelFormat + 20);
+    uint32_t bMask = lvn::readU32(pixelFormat + 24);
+    uint32_t aMask = lvn::readU32(pixelFormat + 28);
+
+    if (flags & LVN_DDS_PF_FOURCC)
+    {
+        switch (fourCC)
+        {
+            case LVN_FOURCC('D', 'X', 'T', '1'): { *compression = Lvn_TextureCompression_Bc1; *channels = 4; return true; }
+            case LVN_FOURCC('D', 'X', 'T', '5'): { *compression = Lvn_TextureCompression_Bc3; *channels = 4; return true; }
+            case LVN_FOURCC('A', 'T', 'I', '2'):
+            case LVN_FOURCC('B', 'C', '5', 'U'): { *compression = Lvn_TextureCompression_Bc5; *channels = 2; return true; }
+
+            default: { return false; }
+        }
+    }
+
+    if ((flags & LVN_DDS_PF_RGB) && bitCount == 32 && rMask == 0x000000ff && gMask == 0x0000ff00 && bMask == 0x00ff0000 && aMask == 0xff000000)
+    {
+        *compression = Lvn_TextureCompression_None;
+        *channels = 4;
+        return true;
+    }
+
+    if ((flags & LVN_DDS_PF_LUMINANCE) && bitCount == 8)
+    {
+        *compression = Lvn_TextureCompression_None;
+        *channels = 1;
+        return true;
+    }
+
+    return false;
+}
+
+// sets the level image data as a slice of the file, returns false if the level does not fit in the file
+static bool setContainerLevel(const LvnBin& file, uint64_t offset, uint64_t byteLength, uint32_t width, uint32_t height, uint32_t channels, LvnTextureCompression compression, LvnImageData* level)
+{
+    uint64_t size = lvn::imageGetLevelSize(width, height, channels, compression);
+    if (byteLength < size || offset > file.size() || size > file.size() - offset)
+        return false;
+
+    level->pixels = file.slice(offset, size);
+    level->width = width;
+    level->height = height;
+    level->channels = channels;
+    level->size = size;
+    level->compression = compression;
+    return true;
+}
+
+static bool loadKtx2(const LvnBin& file, LvnImageData* imageData)
+{
+    const uint8_t* data = file.data();
+
+    if (file.size() < LVN_KTX2_HEADER_SIZE + LVN_KTX2_LEVEL_INDEX_SIZE)
+    {
+        LVN_CORE_ERROR("[ktx2] file is too small to hold the header (%zu bytes)", file.size());
+        return false;
+    }
+
+    uint32_t vkFormat = lvn::readU32(data + 12);
+    uint32_t width = lvn::readU32(data + 20);
+    uint32_t height = lvn::readU32(data + 24);
+    uint32_t depth = lvn::readU32(data + 28);
+    uint32_t layerCount = lvn::readU32(data + 32);
+    uint32_t faceCount = lvn::readU32(data + 36);
+    uint32_t levelCount = lvn::max(lvn::readU32(data + 40), 1u);
+    uint32_t supercompression = lvn::readU32(data + 44);
+
+    if (width == 0 || height == 0 || depth > 1 || layerCount > 1 || faceCount != 1)
+    {
+        LVN_CORE_ERROR("[ktx2] only 2d textures with a single layer and face are supported (w:%u,h:%u,d:%u, layers: %u, faces: %u)", width, height, depth, layerCount, faceCount);
+        return false;
+    }
+
+    if (supercompression != 0)
+    {
+        LVN_CORE_ERROR("[ktx2] supercompression scheme (%u) is not supported, the levels must be stored uncompressed", supercompression);
+        return false;
+    }
+
+    LvnTextureCompression compression;
+    uint32_t channels;
+    if (!lvn::getKtx2Format(vkFormat, &compression, &channels))
+    {
+        LVN_CORE_ERROR("[ktx2] vkFormat (%u) is not supported, only bc1, bc3, bc5, bc7, r8, rg8 and rgba8 textures can be loaded", vkFormat);
+        return false;
+    }
+
+    // levels past 1x1 are ignored
+    levelCount = lvn::min(levelCount, lvn::imageGetMipLevelCount(width, height) + 1);
+    if (file.size() < LVN_KTX2_HEADER_SIZE + (uint64_t)levelCount * LVN_KTX2_LEVEL_INDEX_SIZE)
+    {
+        LVN_CORE_ERROR("[ktx2] file is too small to hold the level index of %u levels", levelCount);
+        return false;
+    }
+
+    *imageData = {};
+    imageData->mipLevels.resize(levelCount - 1);
+
+    for (uint32_t level = 0; level < levelCount; level++)
+    {
+        const uint8_t* levelIndex = data + LVN_KTX2_HEADER_SIZE + level * LVN_KTX2_LEVEL_INDEX_SIZE;
+        uint64_t offset = lvn::readU64(levelIndex);
+        uint64_t byteLength = lvn::readU64(levelIndex + 8);
+
+        uint32_t levelWidth = lvn::max(width >> level, 1u);
+        uint32_t levelHeight = lvn::max(height >> level, 1u);
+        LvnImageData* levelData = level == 0 ? imageData : &imageData->mipLevels[level - 1];
+
+        if (!lvn::setContainerLevel(file, offset, byteLength, levelWidth, levelHeight, channels, compression, levelData))
+        {
+            LVN_CORE_ERROR("[ktx2] level %u (offset: %llu, length: %llu bytes) is out of the file bounds or smaller than a level of (w:%u,h:%u)", level, (unsigned long long)offset, (unsigned long long)byteLength, levelWidth, levelHeight);
+            *imageData = {};
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool loadDds(const LvnBin& file, LvnImageData* imageData)
+{
+    const uint8_t* data = file.data();
+
+    if (file.size() < LVN_DDS_HEADER_SIZE)
+    {
+        LVN_CORE_ERROR("[dds] file is too small to hold the header (%zu bytes)", file.size());
+        return false;
+    }
+
+    uint32_t flags = lvn::readU32(data + 8);
+    uint32_t height = lvn::readU32(data + 12);
+    uint32_t width = lvn::readU32(data + 16);
+    uint32_t levelCount = flags & LVN_DDS_FLAG_MIPMAPCOUNT ? lvn::max(lvn::readU32(data + 28), 1u) : 1;
+    const uint8_t* pixelFormat = data + 76;
+    uint32_t caps2 = lvn::readU32(data + 112);
+
+    if (width == 0 || height == 0 || (caps2 & (LVN_DDS_CAPS2_CUBEMAP | LVN_DDS_CAPS2_VOLUME)))
+    {
+        LVN_CORE_ERROR("[dds] only 2d textures are supported, cubemaps and volume textures cannot be loaded (w:%u,h:%u)", width, height);
+        return false;
+    }
+
+    LvnTextureCompression compression;
+    uint32_t channels;
+    uint64_t offset = LVN_DDS_HEADER_SIZE;
+
+    // the DX10 header follows the dds header and gives the format as a DXGI_FORMAT
+    if ((lvn::readU32(pixelFormat + 4) & LVN_DDS_PF_FOURCC) && lvn::readU32(pixelFormat + 8) == LVN_FOURCC('D', 'X', '1', '0'))
+    {
+        if (file.size() < LVN_DDS_HEADER_SIZE + LVN_DDS_HEADER_DX10_SIZE)
+        {
+            LVN_CORE_ERROR("[dds] file is too small to hold the DX10 header (%zu bytes)", file.size());
+            return false;
+        }
+
+        const uint8_t* dx10 = data + LVN_DDS_HEADER_SIZE;
+        uint32_t dxgiFormat = lvn::readU32(dx10);
+        uint32_t resourceDimension = lvn::readU32(dx10 + 4);
+        uint32_t miscFlag = lvn::readU32(dx10 + 8);
+        uint32_t arraySize = lvn::readU32(dx10 + 12);
+
+        if (resourceDimension != LVN_DDS_DIMENSION_TEXTURE2D || (miscFlag & LVN_DDS_MISC_TEXTURECUBE) || arraySize > 1)
+        {
+            LVN_CORE_ERROR("[dds] only 2d textures are supported, cubemaps, arrays and volume textures cannot be loaded (dimension: %u, array size: %u)", resourceDimension, arraySize);
+            return false;
+        }
+
+        if (!lvn::getDxgiFormat(dxgiFormat, &compression, &channels))
+        {
+            LVN_CORE_ERROR("[dds] DXGI_FORMAT (%u) is not supported, only bc1, bc3, bc5, bc7, r8, rg8 and rgba8 textures can be loaded", dxgiFormat);
+            return false;
+        }
+
+        offset += LVN_DDS_HEADER_DX10_SIZE;
+    }
+    else if (!lvn::getDdsPixelFormat(pixelFormat, &compression, &channels))
+    {
+        LVN_CORE_ERROR("[dds] pixel format is not supported (fourCC: %.4s), only bc1 (DXT1), bc3 (DXT5), bc5 (ATI2), rgba8 and l8 textures can be loaded", reinterpret_cast<const char*>(pixelFormat + 8));
+        return false;
+    }
+
+    levelCount = lvn::min(levelCount, lvn::imageGetMipLevelCount(width, height) + 1);
+
+    *imageData = {};
+    imageData->mipLevels.resize(levelCount - 1);
+
+    // dds levels are stored one after the other starting from the full size level
+    for (uint32_t level = 0; level < levelCount; level++)
+    {
+        uint32_t levelWidth = lvn::max(width >> level, 1u);
+        uint32_t levelHeight = lvn::max(height >> level, 1u);
+        uint64_t levelSize = lvn::imageGetLevelSize(levelWidth, levelHeight, channels, compression);
+        LvnImageData* levelData = level == 0 ? imageData : &imageData->mipLevels[level - 1];
+
+        if (!lvn::setContainerLevel(file, offset, levelSize, levelWidth, levelHeight, channels, compression, levelData))
+        {
+            LVN_CORE_ERROR("[dds] level %u (offset: %llu, %llu bytes) is out of the file bounds (%zu bytes)", level, (unsigned long long)offset, (unsigned long long)levelSize, file.size());
+            *imageData = {};
+            return false;
+        }
+
+        offset += levelSize;
+    }
+
+    return true;
+}
+
+bool isTextureContainer(const uint8_t* data, uint64_t size)
+{
+    if (data == nullptr) { return false; }
+
+    return (size >= sizeof(s_Ktx2Identifier) && memcmp(data, s_Ktx2Identifier, sizeof(s_Ktx2Identifier)) == 0) ||
+        (size >= 4 && lvn::readU32(data) == LVN_FOURCC('D', 'D', 'S', ' '));
+}
+
+bool loadTextureContainer(const LvnBin& file, LvnImageData* imageData)
+{
+    if (file.size() >= sizeof(s_Ktx2Identifier) && memcmp(file.data(), s_Ktx2Identifier, sizeof(s_Ktx2Identifier)) == 0)
+        return lvn::loadKtx2(file, imageData);
+
+    if (file.size() >= 4 && lvn::readU32(file.data()) == LVN_FOURCC('D', 'D', 'S', ' '))
+        return lvn::loadDds(file, imageData);
+
+    return false;
+}
+
+} /* namespace lvn */
@@ -3,14 +3,91 @@
 
 #include "levikno_internal.h"
 
+enum LvnModelDataType
+{
+    Lvn_ModelDataType_Gltf,
+    Lvn_ModelDataType_Obj,
+};
+
+// models are loaded in two steps, the model data is read and decoded from the file without creating any graphics objects so it
+// can be loaded on any thread, the graphics objects are then created from the model data on the thread that owns the graphics context
+struct LvnModelData
+{
+    LvnModelDataType type;
+    uint64_t uploadSize;       /* bytes of vertex, index and image data given to the graphics api when the model is created */
+    void* data;                /* decoded data of the loader of the model type */
+};
+
+// cpu side description of a model for the pack baker (lvn_pack.cpp), built from the model data without creating any graphics
+// objects; textures and images are referred to by index, -1 uses the default texture of the material slot
+struct LvnBakeTexture
+{
+    int32_t image;             /* index into LvnModelBakeData::images, -1 if the texture is not used by any material */
+    LvnTextureFormat format;
+    LvnTextureFilter minFilter, magFilter;
+    LvnTextureMode wrapS, wrapT;
+};
+
+struct LvnBakeMaterial
+{
+    LvnVec4 baseColorFactor;
+    LvnVec3 emissiveFactor;
+    float metallicFactor;
+    float roughnessFactor;
+    int32_t albedo, metallicRoughnessOcclusion, normal, emissive;
+    bool doubleSided;
+};
+
+struct LvnBakePrimitive
+{
+    LvnTopologyType topology;
+    LvnBakeMaterial material;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    const uint8_t* bufferData; /* vertices followed by the indices, points into the model data */
+    uint64_t bufferSize;
+};
+
+struct LvnBakeMesh
+{
+    LvnVector<LvnBakePrimitive> primitives;
+};
+
+struct LvnModelBakeData
+{
+    LvnVector<int32_t> rootNodes;
+    LvnVector<LvnNode> nodes;
+    LvnVector<LvnBakeMesh> meshes;
+    LvnVector<LvnBakeTexture> textures;
+    LvnVector<LvnImageData> images;
+    LvnVector<LvnSkin> skins;  /* ssbo is not created */
+    LvnVector<LvnAnimation> animations;
+};
+
 namespace lvn
 {
     // gltf/glb
-    LvnModel loadGltfModel(const char* filepath);
-    LvnModel loadGlbModel(const char* filepath);
+    LvnModelData* loadGltfModelData(const char* filepath);
+    LvnModelData* loadGlbModelData(const char* filepath);
+    LvnModel createGltfModel(LvnModelData* modelData);
+    void getGltfModelBakeData(LvnModelData* modelData, LvnModelBakeData* bakeData);
+    void freeGltfModelData(LvnModelData* modelData);
 
     // wavefront obj
-    LvnModel loadObjModel(const char* filepath);
+    LvnModelData* loadObjModelData(const char* filepath);
+    LvnModel createObjModel(LvnModelData* modelData);
+    void getObjModelBakeData(LvnModelData* modelData, LvnModelBakeData* bakeData);
+    void freeObjModelData(LvnModelData* modelData);
+
+    // ktx2/dds textures (lvn_loader_texture.cpp)
+    bool isTextureContainer(const uint8_t* data, uint64_t size);             // checks the identifier at the start of the data for a ktx2 or dds file
+    bool loadTextureContainer(const LvnBin& file, LvnImageData* imageData);  // the levels are slices of the file data and are never copied, returns false if the texture cannot be loaded
+
+    // picks the loader from the file extension (levikno.cpp)
+    LvnModelData* loadModelData(const char* filepath);     // returns nullptr if the file could not be loaded
+    LvnModel createModelFromData(LvnModelData* modelData); // creates the graphics objects of the model then frees the model data
+    void freeModelData(LvnModelData* modelData);           // frees model data that was never used to create a model
+    void getModelBakeData(LvnModelData* modelData, LvnModelBakeData* bakeData); // the bake data points into the model data, free the model data after the bake data is no longer used
 }
 
 #endif
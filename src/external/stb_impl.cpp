@@ -1,7 +1,9 @@
 #include "levikno.h"
 
 #define STB_IMAGE_IMPLEMENTATION
-#define STBI_NO_SIMD
+#if defined(LVN_SIMD_NEON)
+    #define STBI_NEON
+#endif
 #define STBI_MALLOC(sz)         LVN_MALLOC(sz)
 #define STBI_REALLOC(p,newsz)   LVN_REALLOC(p,newsz)
 #define STBI_FREE(p)            LVN_FREE(p)
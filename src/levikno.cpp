@@ -2,6 +2,10 @@
 #include "levikno_internal.h"
 
 #include <ctime>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 #include "stb_image.h"
 #include "stb_image_write.h"
@@ -11,6 +15,11 @@
 
 #ifdef LVN_PLATFORM_WINDOWS
     #include <windows.h>
+#else
+    #include <fcntl.h>     /* open */
+    #include <sys/mman.h>  /* mmap, munmap */
+    #include <sys/stat.h>  /* fstat */
+    #include <unistd.h>    /* close */
 #endif
 
 #define LVN_ABORT throw std::bad_alloc{};
@@ -47,6 +56,151 @@ struct LvnSound
 };
 
 
+// ------------------------------------------------------------
+// [SECTION]: Font Internal structs
+// ------------------------------------------------------------
+
+// glyph rasterized by a job before it is packed into the atlas, one byte per pixel without row padding
+struct LvnFontGlyphBitmap
+{
+    LvnVector<uint8_t> pixels;
+    uint32_t width, rows;
+    int32_t bearingX, bearingY;
+    uint32_t advance;
+};
+
+
+// ------------------------------------------------------------
+// [SECTION]: Image Internal structs
+// ------------------------------------------------------------
+
+// images of a loadImagesBatch call are claimed one at a time by a fixed number of decode jobs
+struct LvnImageBatch
+{
+    const LvnImageLoadInfo* pLoadInfos;
+    LvnImageData* pImages;
+    uint32_t count;
+    std::atomic<uint32_t> next;                /* index of the next image to decode */
+    std::atomic<uint32_t> failCount;           /* images that could not be loaded */
+};
+
+// each decode job reads image files into its own scratch buffer, the buffer only grows so it is reused for every file the job decodes
+struct LvnImageBatchWorker
+{
+    LvnImageBatch* batch;
+    LvnVector<uint8_t> scratch;
+};
+
+
+// ------------------------------------------------------------
+// [SECTION]: Logging Internal structs
+// ------------------------------------------------------------
+
+#define LVN_LOG_ASYNC_DEFAULT_CAPACITY      (4096)
+#define LVN_LOG_ASYNC_BATCH_SIZE            (256)                                        /* max records written per console write */
+#define LVN_LOG_RECORD_ARG_SIZE             (200)
+#define LVN_LOG_FORMAT_SPEC_MAX_LENGTH      (31)
+#define LVN_LOG_STACK_BUFFER_SIZE           (512)                                        /* messages longer than this are formatted into a heap buffer */
+
+#define LVN_LOG_BINARY_MAGIC                "LVNLOGB"
+#define LVN_LOG_BINARY_VERSION              (1)
+#define LVN_LOG_BINARY_HEADER_SIZE          (8 + 10)                                     /* magic and version, sizes of the packed argument types */
+#define LVN_LOG_BINARY_MESSAGE_HEADER_SIZE  (1 + 10 + 5 + 5 + 5)                         /* max size, the fields after the type are varints */
+#define LVN_LOG_BINARY_TEXT_FORMAT_ID       (0)                                          /* message record holds the formatted text instead of packed args */
+
+// message pushed to the async log queue
+// - args holds the arguments of the message packed in the order of the specifiers in fmt, %s strings are copied into args
+// - when the arguments do not fit or the format cannot be packed, fmt is nullptr and args holds a heap copy of the formatted message
+struct LvnLogRecord
+{
+    LvnLogger* logger;
+    const char* fmt;
+    long long timeNs;
+    LvnLogLevel level;
+    uint32_t argSize;
+    uint8_t args[LVN_LOG_RECORD_ARG_SIZE];
+};
+
+struct LvnLogAsyncState
+{
+    LvnMpmcQueue<LvnLogRecord>* queue;
+    LvnThread* thread;
+    LvnLogOverflowPolicy overflowPolicy;
+
+    std::mutex sleepLock;
+    std::condition_variable sleepCond;
+    std::atomic<uint64_t> pushed;              /* records pushed to the queue */
+    std::atomic<uint64_t> written;             /* records written and flushed by the log thread */
+    std::atomic<uint64_t> dropped;             /* records discarded with Lvn_LogOverflowPolicy_DropAndCount */
+    std::atomic<bool> sleeping;
+    std::atomic<bool> running;
+};
+
+static LvnLogAsyncState s_LogAsync{};
+
+enum LvnLogBinaryRecordType
+{
+    Lvn_LogBinaryRecord_Logger = 1,            /* u32 logger id, u32 name length, name, u32 pattern length, pattern */
+    Lvn_LogBinaryRecord_Format,                /* u32 format id, u32 length, format string */
+    Lvn_LogBinaryRecord_Message,               /* level in the high 4 bits of the type, time delta in ns, logger id, format id, args size, args */
+};
+
+// ids given to the loggers and format strings written to binary log files
+// the lock also keeps the records of a message together since the sync path writes from the calling threads
+struct LvnLogBinaryState
+{
+    std::mutex lock;
+    uint32_t nextLoggerId;
+    uint32_t nextFormatId;
+};
+
+static LvnLogBinaryState s_LogBinary{};
+
+// output of a formatted log message, kept on the stack and moved to a heap buffer if the output does not fit
+// messages are written from any thread and outside of frames so the output is never allocated from the frame arena
+class LvnLogString
+{
+private:
+    char m_StackBuff[LVN_LOG_STACK_BUFFER_SIZE];
+    char* m_Data;
+    size_t m_Size;
+    size_t m_Capacity;
+
+public:
+    LvnLogString()
+        : m_Data(m_StackBuff), m_Size(0), m_Capacity(LVN_LOG_STACK_BUFFER_SIZE) { m_StackBuff[0] = '\0'; }
+    ~LvnLogString() { if (m_Data != m_StackBuff) { lvn::memDelete<char>(m_Data, 0); } }
+
+    LvnLogString(const LvnLogString&) = delete;
+    LvnLogString& operator=(const LvnLogString&) = delete;
+
+    void operator+=(const LvnString& other) { append(other.c_str(), other.size()); }
+    void operator+=(const char& ch) { append(&ch, 1); }
+
+    void append(const char* str, size_t size)
+    {
+        if (m_Size + size >= m_Capacity)
+        {
+            size_t capacity = m_Capacity * 2;
+            while (capacity <= m_Size + size) { capacity *= 2; }
+            char* data = lvn::memNew<char>(capacity, false, LVN_FILE_NAME, LVN_LINE);
+            memcpy(data, m_Data, m_Size);
+            if (m_Data != m_StackBuff) { lvn::memDelete<char>(m_Data, 0); }
+            m_Data = data;
+            m_Capacity = capacity;
+        }
+
+        memcpy(m_Data + m_Size, str, size);
+        m_Size += size;
+        m_Data[m_Size] = '\0';
+    }
+
+    size_t         size() const { return m_Size; }
+    const char*    c_str() const { return m_Data; }
+    const char*    data() const { return m_Data; }
+};
+
+
 // ------------------------------------------------------------
 // [SECTION]: Network Internal structs
 // ------------------------------------------------------------
@@ -82,7 +236,8 @@ static void*              s_MemAllocUserData = nullptr;
 
 static LvnResult                    initLogging(LvnContextCreateInfo* createInfo);
 static void                         terminateLogging();
-static LvnVector<LvnLogPattern>     logParseFormat(const char* fmt);
+static void                         logAsyncInit(uint32_t capacity, LvnLogOverflowPolicy overflowPolicy);
+static void                         logAsyncTerminate();
 static const char*                  getLogLevelColor(LvnLogLevel level);
 static const char*                  getLogLevelName(LvnLogLevel level);
 static const char*                  getWindowApiNameEnum(LvnWindowApi api);
@@ -100,14 +255,43 @@ static void                         setDefaultStructTypeMemAllocInfos(LvnContext
 static const char*                  getStructTypeEnumStr(LvnStructureType stype);
 static uint64_t                     getStructTypeSize(LvnStructureType sType);
 static LvnData<uint32_t>            initDefaultFontCodepoints();
+static bool                         rasterizeFontGlyphs(const uint8_t* fontData, uint64_t fontDataSize, uint32_t fontSize, const uint32_t* pCodepoints, uint32_t codepointCount, uint32_t loadFlags, bool mono, LvnFontGlyphBitmap* pBitmaps);
 static LvnResult                    createContextMemoryPool(LvnContext* lvnctx, LvnContextCreateInfo* createInfo);
-static void                         createMemoryBlock(LvnContext* lvnctx, LvnStructureType sType);
+static void                         freeStbiImage(void* pixels);
+static bool                         decodeBatchImage(const LvnImageLoadInfo* loadInfo, uint32_t index, LvnVector<uint8_t>& scratch, LvnImageData* imageData);
+static void                         imageBatchDecodeJob(void* data);
+static void                         printMemTrackingReport();
+static LvnResult                    createPipeline(LvnPipeline** pipeline, const LvnPipelineCreateInfo* createInfo, LvnPipeline* storage);
+static LvnResult                    createFrameBuffer(LvnFrameBuffer** frameBuffer, const LvnFrameBufferCreateInfo* createInfo, LvnFrameBuffer* storage);
+static LvnResult                    createBuffer(LvnBuffer** buffer, const LvnBufferCreateInfo* createInfo, LvnBuffer* storage);
+static LvnResult                    createSampler(LvnSampler** sampler, const LvnSamplerCreateInfo* createInfo, LvnSampler* storage);
+static LvnResult                    createTexture(LvnTexture** texture, const LvnTextureCreateInfo* createInfo, LvnTexture* storage);
+static LvnResult                    createTexture(LvnTexture** texture, const LvnTextureSamplerCreateInfo* createInfo, LvnTexture* storage);
+static LvnResult                    createCubemap(LvnCubemap** cubemap, const LvnCubemapCreateInfo* createInfo, LvnCubemap* storage);
+static LvnResult                    createCubemap(LvnCubemap** cubemap, const LvnCubemapHdrCreateInfo* createInfo, LvnCubemap* storage);
+static void                         destroyPipeline(LvnPipeline* pipeline, bool releaseMemory);
+static void                         destroyFrameBuffer(LvnFrameBuffer* frameBuffer, bool releaseMemory);
+static void                         destroyBuffer(LvnBuffer* buffer, bool releaseMemory);
+static void                         destroySampler(LvnSampler* sampler, bool releaseMemory);
+static void                         destroyTexture(LvnTexture* texture, bool releaseMemory);
+static void                         destroyCubemap(LvnCubemap* cubemap, bool releaseMemory);
 
 template <typename T>
-static T* createObject(LvnContext* lvnctx, LvnStructureType sType);
+static T* createObject(LvnContext* lvnctx, LvnStructureType sType, const char* file, int line, T* storage = nullptr);
 
 template <typename T>
-static void destroyObject(LvnContext* lvnctx, T* obj, LvnStructureType sType);
+static void destroyObject(LvnContext* lvnctx, T* obj, LvnStructureType sType, bool releaseMemory = true);
+
+template <typename T, typename CreateInfo>
+static LvnResult createObjectHandle(LvnHandle<T>* handle, LvnHandleObjectTable<T>& table, LvnStructureType sType, LvnResult (*createFunc)(T**, const CreateInfo*, T*), const CreateInfo* createInfo);
+
+template <typename T>
+static void destroyObjectHandle(LvnHandle<T> handle, LvnHandleObjectTable<T>& table, LvnStructureType sType, void (*destroyFunc)(T*, bool));
+
+template <typename T>
+static void destroyHandleTableObjects(LvnHandleObjectTable<T>& table, LvnStructureType sType, void (*destroyFunc)(T*, bool));
+
+static void destroyHandleTableObjects(LvnContext* lvnctx);
 
 
 // Windows platform specific; enables console output colors
@@ -489,40 +673,42 @@ static LvnResult createContextMemoryPool(LvnContext* lvnctx, LvnContextCreateInf
         structTypes[createInfo->memoryInfo.pMemoryBindings[i].sType].count = createInfo->memoryInfo.pMemoryBindings[i].count;
     }
 
-    // get total memory in bytes for memory pool
+    // set struct block memory configs
+    for (uint64_t i = 0; i < createInfo->memoryInfo.blockMemoryBindingCount; i++)
+    {
+        if (createInfo->memoryInfo.pBlockMemoryBindings[i].count == 0)
+        {
+            LVN_CORE_ERROR("[context]: createInfo->memoryInfo.pBlockMemoryBindings[%u].count is 0, cannot have a memory binding with a count of 0", i);
+            return Lvn_Result_Failure;
+        }
+
+        lvnctx->blockMemAllocInfos[createInfo->memoryInfo.pBlockMemoryBindings[i].sType].count = createInfo->memoryInfo.pBlockMemoryBindings[i].count;
+    }
+
+    // get total memory in bytes for memory pool, object sizes are rounded up so that every object in the pool stays aligned
     uint64_t memSize = 0;
     for (uint64_t i = 0; i < structTypes.size(); i++)
-        memSize += structTypes[i].size * structTypes[i].count;
+        memSize += LvnMemoryBinding::aligned_object_size(structTypes[i].size) * structTypes[i].count;
 
-    // create the first memory block
+    // create the base memory block
     LvnMemoryPool* memPool = &lvnctx->memoryPool;
     memPool->baseMemoryBlock = LvnMemoryBlock(memSize);
 
-    memPool->memBlocks.resize(Lvn_Stype_Max_Value); // future memory blocks
-    memPool->memBindings.resize(Lvn_Stype_Max_Value);
-
-    // set memory block bindings (all the first bindings are within the first memory block)
-    // newly created memory bindings will have their own indicidual memory blocks
+    // set memory bindings, the objects of each sType start within the base memory block
+    // further memory blocks are allocated by the memory binding when the base memory of an sType is used up
     uint64_t memIndex = 0;
     for (uint32_t i = 0; i < structTypes.size(); i++)
     {
-        auto& memBinding = memPool->memBindings[structTypes[i].sType];
-
+        uint64_t objSize = LvnMemoryBinding::aligned_object_size(structTypes[i].size);
         uint64_t count = structTypes[i].count;
-        memBinding.push_back(LvnMemoryBinding(memPool->baseMemoryBlock[memIndex], structTypes[i].size, count));
-        memIndex += count * structTypes[i].size;
-    }
+        uint64_t blockCount = lvnctx->blockMemAllocInfos[structTypes[i].sType].count;
 
-    // set struct block memory configs
-    for (uint64_t i = 0; i < createInfo->memoryInfo.blockMemoryBindingCount; i++)
-    {
-        if (createInfo->memoryInfo.pBlockMemoryBindings[i].count == 0)
-        {
-            LVN_CORE_ERROR("[context]: createInfo->memoryInfo.pBlockMemoryBindings[%u].count is 0, cannot have a memory binding with a count of 0", i);
-            return Lvn_Result_Failure;
-        }
+        void* data = count > 0 ? memPool->baseMemoryBlock[memIndex] : nullptr;
+        memPool->memBindings[structTypes[i].sType].init(data, objSize, count, blockCount > 0 ? blockCount : 1, lvnctx->multithreading);
+        memIndex += count * objSize;
 
-        lvnctx->blockMemAllocInfos[createInfo->memoryInfo.pBlockMemoryBindings[i].sType].count = createInfo->memoryInfo.pBlockMemoryBindings[i].count;
+        if (lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed))
+            lvn::memTrackSetPoolBinding(structTypes[i].sType, count, blockCount > 0 ? blockCount : 1);
     }
 
     LVN_CORE_TRACE("memory allocation mode set to memory pool, %u custom base memory bindings created, %u custom memory block bindings created, total base memory pool size: %zu bytes",
@@ -533,74 +719,198 @@ static LvnResult createContextMemoryPool(LvnContext* lvnctx, LvnContextCreateInf
     return Lvn_Result_Success;
 }
 
-static void createMemoryBlock(LvnContext* lvnctx, LvnStructureType sType)
+static void printMemTrackingReport()
 {
-    uint64_t size = lvnctx->blockMemAllocInfos[sType].size;
-    uint64_t count = lvnctx->blockMemAllocInfos[sType].count;
-    uint64_t memsize = size * count;
+    const uint32_t maxReportCount = 16;
 
-    // create the next memory block in the list for sType
-    LvnMemoryPool* memPool = &lvnctx->memoryPool;
-    memPool->memBlocks[sType].push_back(LvnMemoryBlock(memsize));
+    printf("[levikno] memory tracking report\n");
+
+    // the report is still being tracked, memory is taken from the stack or from malloc so that it does not show up as live
 
-    // set memory binding for sType
-    auto& memBinding = memPool->memBindings[sType];
+    // objects per sType, the peak is the count to set in memoryInfo.pMemoryBindings to fit every object in the base memory pool
+    LvnMemObjectStats objects[Lvn_Stype_Max_Value];
+    uint32_t objectCount = Lvn_Stype_Max_Value;
+    lvn::memGetObjectStats(objects, &objectCount);
 
-    LvnMemoryBinding* prevMemBinding = nullptr;
-    if (!memBinding.empty())
-        prevMemBinding = &memBinding.back();
+    printf("  objects (sType: live / peak, object size, pool base count, pool block count, pool blocks allocated)\n");
+    for (uint32_t i = 0; i < objectCount; i++)
+    {
+        const LvnMemObjectStats& stats = objects[i];
+        if (stats.peakCount == 0) { continue; }
+
+        printf("    %-20s %llu / %llu, %llu bytes, %llu, %llu, %llu\n", lvn::getStructTypeEnumStr(stats.sType),
+            (unsigned long long)stats.liveCount, (unsigned long long)stats.peakCount, (unsigned long long)stats.objectSize,
+            (unsigned long long)stats.poolBaseCount, (unsigned long long)stats.poolBlockCount, (unsigned long long)stats.poolBlocksAllocated);
+    }
+
+    // types and sites, memory still live here was not freed by the time the context was deleted
+    LvnMemTrackStats tracked[maxReportCount];
+    uint32_t typeCount = maxReportCount;
+    lvn::memGetTrackedTypes(tracked, &typeCount);
+
+    printf("  types by peak bytes (live bytes / peak bytes, live count, total count)\n");
+    for (uint32_t i = 0; i < typeCount; i++)
+    {
+        printf("    %-40s %llu / %llu, %llu, %llu\n", tracked[i].name,
+            (unsigned long long)tracked[i].liveBytes, (unsigned long long)tracked[i].peakBytes,
+            (unsigned long long)tracked[i].liveCount, (unsigned long long)tracked[i].totalCount);
+    }
+
+    uint32_t siteCount = maxReportCount;
+    lvn::memGetTrackedSites(tracked, &siteCount);
+
+    printf("  sites by peak bytes (live bytes / peak bytes, live count, total count)\n");
+    for (uint32_t i = 0; i < siteCount; i++)
+    {
+        printf("    %s:%d (%s) %llu / %llu, %llu, %llu\n", tracked[i].file, tracked[i].line, tracked[i].name,
+            (unsigned long long)tracked[i].liveBytes, (unsigned long long)tracked[i].peakBytes,
+            (unsigned long long)tracked[i].liveCount, (unsigned long long)tracked[i].totalCount);
+    }
+
+    // every type is checked for leaks, not only the ones with the highest peaks
+    uint32_t allTypeCount = 0;
+    lvn::memGetTrackedTypes(nullptr, &allTypeCount);
+    LvnMemTrackStats* allTypes = static_cast<LvnMemTrackStats*>(malloc(allTypeCount * sizeof(LvnMemTrackStats)));
+    if (allTypes == nullptr) { return; }
+    lvn::memGetTrackedTypes(allTypes, &allTypeCount);
+
+    uint64_t leakCount = 0, leakBytes = 0;
+    for (uint32_t i = 0; i < allTypeCount; i++)
+    {
+        if (allTypes[i].liveCount == 0) { continue; }
+
+        printf("  [leak]: %llu allocations of %s still live, %llu bytes\n", (unsigned long long)allTypes[i].liveCount, allTypes[i].name, (unsigned long long)allTypes[i].liveBytes);
+        leakCount += allTypes[i].liveCount;
+        leakBytes += allTypes[i].liveBytes;
+    }
 
-    // bind the memory binding for sType to the newly created memory block
-    memBinding.push_back(LvnMemoryBinding(memPool->memBlocks[sType].back()[0], size, count));
+    free(allTypes);
 
-    // set the previous memory binding to the newly created memory binding
-    if (prevMemBinding != nullptr)
-        prevMemBinding->set_next_memory_binding(&memBinding.back());
+    printf("  %llu allocations not freed, %llu bytes\n", (unsigned long long)leakCount, (unsigned long long)leakBytes);
 }
 
+// the object is constructed in storage if it is not null (eg. a slot of a handle table), otherwise it is allocated by the memory mode
 template <typename T>
-static T* createObject(LvnContext* lvnctx, LvnStructureType sType)
+static T* createObject(LvnContext* lvnctx, LvnStructureType sType, const char* file, int line, T* storage)
 {
     T* object;
-    if (lvnctx->memoryMode == Lvn_MemAllocMode_Individual)
+    if (storage != nullptr)
     {
-        object = new T();
+        object = new (storage) T();
+    }
+    else if (lvnctx->memoryMode == Lvn_MemAllocMode_Individual)
+    {
+        object = lvn::memNew<T>(1, true, file, line);
     }
     else if (lvnctx->memoryMode == Lvn_MemAllocMode_MemPool)
     {
-        auto& memBinding = lvnctx->memoryPool.memBindings[sType][0];
-        if (memBinding.find_empty_memory_binding() == nullptr)
-            lvn::createMemoryBlock(lvnctx, sType);
-
-        object = new (static_cast<T*>(memBinding.take_next())) T();
+        object = new (lvnctx->memoryPool.memBindings[sType].take_next()) T();
     }
     else
     {
         LVN_CORE_ASSERT(false, "create object failed, no requirment was met before hand"); return nullptr;
     }
 
-    lvnctx->objectMemoryAllocations.sTypes[sType].count++;
+    lvnctx->objectMemoryAllocations.sTypes[sType].count.fetch_add(1, std::memory_order_relaxed);
+    if (lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { lvn::memTrackObject(sType, sizeof(T), true); }
     return object;
 }
 
+// the object is only destructed if releaseMemory is false, its memory is then owned by the caller (eg. a handle table)
 template <typename T>
-static void destroyObject(LvnContext* lvnctx, T* obj, LvnStructureType sType)
+static void destroyObject(LvnContext* lvnctx, T* obj, LvnStructureType sType, bool releaseMemory)
 {
-    if (lvnctx->memoryMode == Lvn_MemAllocMode_Individual)
+    if (!releaseMemory)
+    {
+        obj->~T();
+    }
+    else if (lvnctx->memoryMode == Lvn_MemAllocMode_Individual)
     {
-        delete obj;
+        lvn::memDelete(obj);
         obj = nullptr;
     }
     else if (lvnctx->memoryMode == Lvn_MemAllocMode_MemPool)
     {
-        lvnctx->memoryPool.memBindings[sType][0].push_back(obj);
+        obj->~T();
+        lvnctx->memoryPool.memBindings[sType].push_back(obj);
     }
     else
     {
         LVN_CORE_ASSERT(false, "destroy object failed, no requirment was met before hand");
     }
 
-    lvnctx->objectMemoryAllocations.sTypes[sType].count--;
+    lvnctx->objectMemoryAllocations.sTypes[sType].count.fetch_sub(1, std::memory_order_relaxed);
+    if (lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { lvn::memTrackObject(sType, sizeof(T), false); }
+}
+
+template <typename T, typename CreateInfo>
+static LvnResult createObjectHandle(LvnHandle<T>* handle, LvnHandleObjectTable<T>& table, LvnStructureType sType, LvnResult (*createFunc)(T**, const CreateInfo*, T*), const CreateInfo* createInfo)
+{
+    handle->id = 0;
+
+    // the object is constructed in the table's storage
+    uint64_t id;
+    T* storage = table.take(&id);
+
+    T* object = nullptr;
+    LvnResult result = createFunc(&object, createInfo, storage);
+
+    if (result != Lvn_Result_Success)
+    {
+        if (object != nullptr)
+            lvn::destroyObject(lvn::getContext(), object, sType, false);
+
+        table.remove(id);
+        return result;
+    }
+
+    handle->id = id;
+    return Lvn_Result_Success;
+}
+
+template <typename T>
+static void destroyObjectHandle(LvnHandle<T> handle, LvnHandleObjectTable<T>& table, LvnStructureType sType, void (*destroyFunc)(T*, bool))
+{
+    if (!handle) { return; }
+
+    T* object = table.get(handle.id);
+    if (object == nullptr)
+    {
+        LVN_CORE_WARN("destroy object handle | handle (index:%u,gen:%u) of sType %s is stale, object has already been destroyed", handle.index(), handle.generation(), lvn::getStructTypeEnumStr(sType));
+        return;
+    }
+
+    destroyFunc(object, false);
+    table.remove(handle.id);
+}
+
+template <typename T>
+static void destroyHandleTableObjects(LvnHandleObjectTable<T>& table, LvnStructureType sType, void (*destroyFunc)(T*, bool))
+{
+    if (!table.empty())
+    {
+        LVN_CORE_WARN("sType = %s | %u objects created with handles have not been destroyed, destroying remaining objects", lvn::getStructTypeEnumStr(sType), table.size());
+
+        while (!table.empty())
+        {
+            destroyFunc(table.liveObject(table.size() - 1), false);
+            table.remove(table.liveId(table.size() - 1));
+        }
+    }
+
+    table.release();
+}
+
+static void destroyHandleTableObjects(LvnContext* lvnctx)
+{
+    // destroy in reverse order of dependency, pipelines and framebuffers may reference the other objects
+    LvnHandleTables& tables = lvnctx->handleTables;
+    lvn::destroyHandleTableObjects(tables.pipelines, Lvn_Stype_Pipeline, lvn::destroyPipeline);
+    lvn::destroyHandleTableObjects(tables.frameBuffers, Lvn_Stype_FrameBuffer, lvn::destroyFrameBuffer);
+    lvn::destroyHandleTableObjects(tables.cubemaps, Lvn_Stype_Cubemap, lvn::destroyCubemap);
+    lvn::destroyHandleTableObjects(tables.textures, Lvn_Stype_Texture, lvn::destroyTexture);
+    lvn::destroyHandleTableObjects(tables.samplers, Lvn_Stype_Sampler, lvn::destroySampler);
+    lvn::destroyHandleTableObjects(tables.buffers, Lvn_Stype_Buffer, lvn::destroyBuffer);
 }
 
 // ------------------------------------------------------------
@@ -615,6 +925,10 @@ LvnResult createContext(LvnContextCreateInfo* createInfo)
 
     lvnctx->contexTime.reset();
 
+    // profiler, started first so that the rest of context creation can be profiled
+    lvn::profilerInit(createInfo->profiling.enableProfiling, createInfo->profiling.threadEventCapacity);
+    LVN_PROFILE_SCOPE("createContext");
+
     lvnctx->appName = createInfo->applicationName;
     lvnctx->windowapi = createInfo->windowapi;
     lvnctx->graphicsapi = createInfo->graphicsapi;
@@ -625,14 +939,37 @@ LvnResult createContext(LvnContextCreateInfo* createInfo)
     lvnctx->graphicsContext.frameBufferColorFormat = createInfo->rendering.frameBufferColorFormat;
     lvnctx->graphicsContext.maxFramesInFlight = createInfo->rendering.maxFramesInFlight;
 
+    // memory allocator, installed before anything else allocates through lvn::memAlloc
+    lvnctx->memoryAllocator = createInfo->memoryInfo.allocator;
+    if (lvnctx->memoryAllocator == Lvn_MemAllocator_SlabCache)
+        lvn::memInstallSlabAllocator();
+
+    lvn::frameArenaInit(createInfo->memoryInfo.frameArenaSize);
+
+    if (createInfo->memoryInfo.enableMemoryTracking)
+        lvn::memTrackInit();
+
     // logging
     lvn::initLogging(createInfo);
 
+    if (lvnctx->memoryAllocator == Lvn_MemAllocator_SlabCache)
+        LVN_CORE_TRACE("[context]: slab allocator installed for lvn::memAlloc and lvn::memNew");
+
+    // job system
+    if (lvnctx->multithreading)
+    {
+        lvn::jobSystemInit(createInfo->jobWorkerCount);
+        LVN_CORE_TRACE("[context]: job system started with %u workers", lvn::jobGetWorkerCount());
+
+        lvn::ioInit(createInfo->ioThreadCount);
+        LVN_CORE_TRACE("[context]: file I/O started with %u threads", lvn::ioGetThreadCount());
+    }
+
     // memory
-    lvnctx->objectMemoryAllocations.sTypes.resize(Lvn_Stype_Max_Value);
-    for (uint32_t i = 0; i < lvnctx->objectMemoryAllocations.sTypes.size(); i++)
+    for (uint32_t i = 0; i < Lvn_Stype_Max_Value; i++)
     {
-        lvnctx->objectMemoryAllocations.sTypes[i] = { (LvnStructureType)i, 0 };
+        lvnctx->objectMemoryAllocations.sTypes[i].sType = (LvnStructureType)i;
+        lvnctx->objectMemoryAllocations.sTypes[i].count = 0;
     }
 
     // default font codepoints
@@ -693,29 +1030,48 @@ void terminateContext()
 
     LvnContext* lvnctx = s_LvnContext;
 
+    if (lvn::assetManagerIsInitialized())
+        lvn::assetManagerTerminate();
+
     if (lvn::rendererIsInitialized())
         lvn::renderTerminate();
 
+    lvn::ioTerminate();
+    lvn::jobSystemTerminate();
+    lvn::profilerTerminate();
+    lvn::destroyHandleTableObjects(lvnctx);
     lvn::terminateGraphicsContext(lvnctx);
     lvn::terminateWindowContext(lvnctx);
     lvn::terminateAudioContext(lvnctx);
     lvn::terminateNetworkingContext();
 
-    for (uint32_t i = 0; i < lvnctx->objectMemoryAllocations.sTypes.size(); i++)
+    for (uint32_t i = 0; i < Lvn_Stype_Max_Value; i++)
+        lvnctx->memoryPool.memBindings[i].release();
+
+    for (uint32_t i = 0; i < Lvn_Stype_Max_Value; i++)
     {
-        if (lvnctx->objectMemoryAllocations.sTypes[i].count > 0)
+        size_t count = lvnctx->objectMemoryAllocations.sTypes[i].count.load();
+        if (count > 0)
         {
             const char* stype = lvn::getStructTypeEnumStr(lvnctx->objectMemoryAllocations.sTypes[i].sType);
-            LVN_CORE_ERROR("sType = %s | not all objects of this sType (%s) have been destroyed, number of %s objects remaining: %zu", stype, stype, stype, lvnctx->objectMemoryAllocations.sTypes[i].count);
+            LVN_CORE_ERROR("sType = %s | not all objects of this sType (%s) have been destroyed, number of %s objects remaining: %zu", stype, stype, stype, count);
         }
     }
 
-    if (lvnctx->numMemoryAllocations > 0) { LVN_CORE_WARN("not all memory allocations have been freed, number of allocations remaining: %zu", lvnctx->numMemoryAllocations); }
+    if (lvnctx->numMemoryAllocations > 0) { LVN_CORE_WARN("not all memory allocations have been freed, number of allocations remaining: %zu", lvnctx->numMemoryAllocations.load()); }
 
     lvn::terminateLogging();
+    lvn::frameArenaTerminate();
 
     delete s_LvnContext;
     s_LvnContext = nullptr;
+
+    // the report is printed after the context is deleted so that memory owned by the context is not reported as leaked
+    if (lvn::memIsTrackingEnabled())
+    {
+        lvn::printMemTrackingReport();
+        lvn::memTrackTerminate();
+    }
 }
 
 LvnContext* getContext()
@@ -936,14 +1292,99 @@ LvnData<uint8_t> loadFileSrcBin(const char* filepath)
     long int size = ftell(fileptr);
     fseek(fileptr, 0, SEEK_SET);
 
-    LvnVector<uint8_t> bin(size);
+    LvnUniqueData<uint8_t> bin(size);
     fread(bin.data(), sizeof(uint8_t), size, fileptr);
     fclose(fileptr);
 
-    return LvnData<uint8_t>(bin.data(), bin.size());
+    return LvnData<uint8_t>(std::move(bin));
+}
+
+struct LvnFileMapping
+{
+    void* data;
+    size_t size;
+};
+
+static void unmapFile(void* userData)
+{
+    LvnFileMapping* mapping = static_cast<LvnFileMapping*>(userData);
+
+#ifdef LVN_PLATFORM_WINDOWS
+    UnmapViewOfFile(mapping->data);
+#else
+    munmap(mapping->data, mapping->size);
+#endif
+
+    lvn::memDelete(mapping);
+}
+
+LvnBin mapFile(const char* filepath)
+{
+    void* data = nullptr;
+    size_t size = 0;
+
+#ifdef LVN_PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        LVN_CORE_ERROR("mapFile(const char*) | cannot open file: %s", filepath);
+        return {};
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return {};
+    }
+
+    // the view keeps the mapping alive, both handles can be closed once the view is mapped
+    HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (fileMapping != nullptr)
+    {
+        data = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(fileMapping);
+    }
+    CloseHandle(file);
+
+    size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = open(filepath, O_RDONLY);
+    if (fd < 0)
+    {
+        LVN_CORE_ERROR("mapFile(const char*) | cannot open file: %s", filepath);
+        return {};
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+        return {};
+    }
+
+    // the mapping stays valid after the file descriptor is closed
+    size = static_cast<size_t>(fileStat.st_size);
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) { data = nullptr; }
+#endif
+
+    if (data == nullptr)
+    {
+        LVN_CORE_ERROR("mapFile(const char*) | failed to map file into memory, size: %zu bytes, file: %s", size, filepath);
+        return {};
+    }
+
+    LvnFileMapping* mapping = LVN_MEM_NEW(LvnFileMapping, 1);
+    mapping->data = data;
+    mapping->size = size;
+
+    return LvnBin::from_external(static_cast<const uint8_t*>(data), size, lvn::unmapFile, mapping);
 }
 
-void writeFileSrc(const char* filename, const char* src, LvnFileMode mode)
+void writeFileSrc(const char* filename, LvnStringView src, LvnFileMode mode)
 {
     const char* filemode = "w";
     if (mode == Lvn_FileMode_Write) filemode = "w";
@@ -957,11 +1398,81 @@ void writeFileSrc(const char* filename, const char* src, LvnFileMode mode)
         return;
     }
 
-    fprintf(fileptr, "%s", src);
+    fwrite(src.data(), sizeof(char), src.size(), fileptr);
     fclose(fileptr);
 }
 
+static bool rasterizeFontGlyphs(const uint8_t* fontData, uint64_t fontDataSize, uint32_t fontSize, const uint32_t* pCodepoints, uint32_t codepointCount, uint32_t loadFlags, bool mono, LvnFontGlyphBitmap* pBitmaps)
+{
+    // each call opens its own library and face, freetype faces cannot be shared between threads
+    FT_Library ft;
+    FT_Face face;
+
+    if (FT_Init_FreeType(&ft))
+        return false;
+
+    if (FT_New_Memory_Face(ft, fontData, fontDataSize, 0, &face))
+    {
+        FT_Done_FreeType(ft);
+        return false;
+    }
+
+    FT_Set_Pixel_Sizes(face, 0, (FT_UInt)fontSize);
+
+    for (uint32_t i = 0; i < codepointCount; i++)
+    {
+        FT_Load_Char(face, pCodepoints[i], loadFlags);
+        FT_Bitmap* bmp = &face->glyph->bitmap;
+        LvnFontGlyphBitmap& bitmap = pBitmaps[i];
+
+        bitmap.width = bmp->width;
+        bitmap.rows = bmp->rows;
+        bitmap.bearingX = face->glyph->bitmap_left;
+        bitmap.bearingY = face->glyph->bitmap_top;
+        bitmap.advance = face->glyph->advance.x >> 6;
+        bitmap.pixels.resize(bmp->width * bmp->rows);
+
+        if (bmp->pixel_mode == FT_PIXEL_MODE_MONO && mono)
+        {
+            for (uint32_t row = 0; row < bmp->rows; ++row)
+            {
+                for (uint32_t col = 0; col < bmp->width; ++col)
+                {
+                    int byteIndex = col / 8;
+                    int bitIndex = 7 - (col % 8);
+                    uint8_t byte = bmp->buffer[row * bmp->pitch + byteIndex];
+                    bool bitSet = (byte >> bitIndex) & 1;
+                    bitmap.pixels[row * bmp->width + col] = bitSet ? 255 : 0;
+                }
+            }
+        }
+        else
+        {
+            for (uint32_t row = 0; row < bmp->rows; row++)
+                memcpy(&bitmap.pixels[row * bmp->width], &bmp->buffer[row * abs(bmp->pitch)], bmp->width);
+        }
+    }
+
+    FT_Done_FreeType(ft);
+    return true;
+}
+
 LvnFont loadFontFromFileTTF(const char* filepath, uint32_t fontSize, const uint32_t* pCodepoints, uint32_t codepointCount, LvnLoadFontFlagBits flags)
+{
+    LVN_PROFILE_SCOPE("loadFontFromFileTTF");
+
+    // the file is mapped into memory so that each rasterizing job can open its own face from the same data
+    const LvnBin fontData = lvn::mapFile(filepath);
+    if (fontData.empty())
+    {
+        LVN_CORE_ERROR("[freetype]: failed to load font file: %s", filepath);
+        return LvnFont{};
+    }
+
+    return lvn::loadFontFromFileTTFMemory(fontData.data(), fontData.size(), fontSize, pCodepoints, codepointCount, flags);
+}
+
+LvnFont loadFontFromFileTTFMemory(const uint8_t* fontData, uint64_t fontDataSize, uint32_t fontSize, const uint32_t* pCodepoints, uint32_t codepointCount, LvnLoadFontFlagBits flags)
 {
     LvnFont font{};
 
@@ -982,28 +1493,26 @@ LvnFont loadFontFromFileTTF(const char* filepath, uint32_t fontSize, const uint3
         return font;
     }
 
-    if (FT_New_Face(ft, filepath, 0, &face))
+    if (FT_New_Memory_Face(ft, fontData, fontDataSize, 0, &face))
     {
         LVN_CORE_ERROR("[freetype]: failed to load font face!");
         LVN_CORE_ASSERT(false, "failed to load font face");
+        FT_Done_FreeType(ft);
         return font;
     }
 
     FT_Set_Pixel_Sizes(face, 0, (FT_UInt)fontSize);
 
+    const int padding = 2;
+    const int lineHeight = (face->size->metrics.height >> 6) + padding;
     int maxDim = (1 + (face->size->metrics.height >> 6)) * ceilf(sqrtf(codepointCount));
+
+    FT_Done_FreeType(ft);
+
     int width = 1;
     while (width < maxDim) width <<= 1;
     int height = width;
 
-    // render glyphs to atlas
-    LvnVector<uint8_t> pixels(width * height);
-    int penx = 0, peny = 0;
-    const int padding = 2;
-    const int lineHeight = (face->size->metrics.height >> 6) + padding;
-
-    LvnVector<LvnFontGlyph> glyphs(codepointCount);
-
     uint32_t loadFlags = FT_LOAD_RENDER;
     if (flags & Lvn_LoadFont_NoHinting)
         loadFlags |= FT_LOAD_NO_HINTING;
@@ -1014,197 +1523,77 @@ LvnFont loadFontFromFileTTF(const char* filepath, uint32_t fontSize, const uint3
     if (flags & Lvn_LoadFont_TargetMono)
         loadFlags |= FT_LOAD_TARGET_MONO | FT_LOAD_MONOCHROME;
 
-    for (uint32_t i = 0; i < codepointCount; i++)
+    // rasterize glyphs on the job system, one batch of codepoints per worker
+    LvnVector<LvnFontGlyphBitmap> bitmaps(codepointCount);
+    std::atomic<bool> rasterized{true};
+    uint32_t workerCount = lvn::jobGetWorkerCount();
+
+    lvn::jobParallelFor(codepointCount, (codepointCount + workerCount - 1) / workerCount, [&](uint32_t begin, uint32_t end)
     {
-        FT_Load_Char(face, pCodepoints[i], loadFlags);
-        FT_Bitmap* bmp = &face->glyph->bitmap;
+        bool mono = flags & Lvn_LoadFont_TargetMono;
+        if (!lvn::rasterizeFontGlyphs(fontData, fontDataSize, fontSize, &pCodepoints[begin], end - begin, loadFlags, mono, &bitmaps[begin]))
+            rasterized.store(false, std::memory_order_relaxed);
+    });
 
-        if (penx + bmp->width + padding > width)
-        {
-            penx = padding;
-            peny += lineHeight;
-        }
-
-        if (bmp->pixel_mode == FT_PIXEL_MODE_MONO && flags & Lvn_LoadFont_TargetMono)
-        {
-            for (uint32_t row = 0; row < bmp->rows; ++row)
-            {
-                for (uint32_t col = 0; col < bmp->width; ++col)
-                {
-                    int byteIndex = col / 8;
-                    int bitIndex = 7 - (col % 8);
-                    uint8_t byte = bmp->buffer[row * bmp->pitch + byteIndex];
-                    bool bitSet = (byte >> bitIndex) & 1;
-                    int x = penx + col;
-                    int y = peny + row;
-                    if (x < width && y < height)
-                        pixels[y * width + x] = bitSet ? 255 : 0;
-                }
-            }
-        }
-        else
-        {
-            for (uint32_t row = 0; row < bmp->rows; row++)
-            {
-                for (uint32_t col = 0; col < bmp->width; col++)
-                {
-                    int x = penx + col;
-                    int y = peny + row;
-                    pixels[y * width + x] = bmp->buffer[row * abs(bmp->pitch) + col];
-                }
-            }
-        }
-
-
-        LvnFontGlyph glyph{};
-        glyph.uv.x0 = (float)penx / (float)width;
-        glyph.uv.y0 = (float)peny / (float)height;
-        glyph.uv.x1 = (float)(penx + bmp->width) / (float)width;
-        glyph.uv.y1 = (float)(peny + bmp->rows) / (float)height;
-
-        glyph.size.x = bmp->width;
-        glyph.size.y = bmp->rows;
-        glyph.bearing.x = face->glyph->bitmap_left;
-        glyph.bearing.y = face->glyph->bitmap_top;
-        glyph.advance = face->glyph->advance.x >> 6;
-        glyph.unicode = pCodepoints[i];
-
-        glyphs[i] = glyph;
-
-        penx += bmp->width + padding;
-    }
-
-    FT_Done_FreeType(ft);
-
-    LvnImageData atlas{};
-    atlas.width = width;
-    atlas.height = height;
-    atlas.channels = 1;
-    atlas.size = width * height;
-    atlas.pixels = LvnData<uint8_t>(pixels.data(), pixels.size());
-
-    font.atlas = atlas;
-    font.glyphs = LvnData<LvnFontGlyph>(glyphs.data(), glyphs.size());
-    font.codepoints = LvnData<uint32_t>(pCodepoints, codepointCount);
-    font.fontSize = fontSize;
-
-    return font;
-}
-
-// TODO: refactor font loading and duplicate code
-LvnFont loadFontFromFileTTFMemory(const uint8_t* fontData, uint64_t fontDataSize, uint32_t fontSize, const uint32_t* pCodepoints, uint32_t codepointCount, LvnLoadFontFlagBits flags)
-{
-    LvnFont font{};
-
-    if (pCodepoints == nullptr)
-    {
-        LvnContext* lvnctx = lvn::getContext();
-        pCodepoints = lvnctx->defaultCodePoints.data();
-        codepointCount = lvnctx->defaultCodePoints.size();
-    }
-
-    FT_Library ft;
-    FT_Face face;
-
-    if (FT_Init_FreeType(&ft))
-    {
-        LVN_CORE_ERROR("[freetype]: failed to load freetype library");
-        LVN_CORE_ASSERT(false, "failed to load freetype");
-        return font;
-    }
-
-    if (FT_New_Memory_Face(ft, fontData, fontDataSize, 0, &face))
+    if (!rasterized.load(std::memory_order_relaxed))
     {
         LVN_CORE_ERROR("[freetype]: failed to load font face!");
         LVN_CORE_ASSERT(false, "failed to load font face");
         return font;
     }
 
-    FT_Set_Pixel_Sizes(face, 0, (FT_UInt)fontSize);
-
-    int maxDim = (1 + (face->size->metrics.height >> 6)) * ceilf(sqrtf(codepointCount));
-    int width = 1;
-    while (width < maxDim) width <<= 1;
-    int height = width;
-
-    // render glyphs to atlas
-    LvnVector<uint8_t> pixels(width * height);
-    int penx = 0, peny = 0;
-    const int padding = 2;
-    const int lineHeight = (face->size->metrics.height >> 6) + padding;
-
+    // pack glyphs into the atlas in codepoint order
     LvnVector<LvnFontGlyph> glyphs(codepointCount);
-
-    uint32_t loadFlags = FT_LOAD_RENDER;
-    if (flags & Lvn_LoadFont_NoHinting)
-        loadFlags |= FT_LOAD_NO_HINTING;
-    if (flags & Lvn_LoadFont_AutoHinting)
-        loadFlags |= FT_LOAD_FORCE_AUTOHINT;
-    if (flags & Lvn_LoadFont_TargetLight)
-        loadFlags |= FT_LOAD_TARGET_LIGHT;
-    if (flags & Lvn_LoadFont_TargetMono)
-        loadFlags |= FT_LOAD_TARGET_MONO | FT_LOAD_MONOCHROME;
+    LvnVector<LvnVec2i> glyphPositions(codepointCount);
+    int penx = 0, peny = 0;
 
     for (uint32_t i = 0; i < codepointCount; i++)
     {
-        FT_Load_Char(face, pCodepoints[i], loadFlags);
-        FT_Bitmap* bmp = &face->glyph->bitmap;
+        const LvnFontGlyphBitmap& bitmap = bitmaps[i];
 
-        if (penx + bmp->width + padding > width)
+        if (penx + bitmap.width + padding > width)
         {
             penx = padding;
             peny += lineHeight;
         }
 
-        if (bmp->pixel_mode == FT_PIXEL_MODE_MONO && flags & Lvn_LoadFont_TargetMono)
-        {
-            for (uint32_t row = 0; row < bmp->rows; ++row)
-            {
-                for (uint32_t col = 0; col < bmp->width; ++col)
-                {
-                    int byteIndex = col / 8;
-                    int bitIndex = 7 - (col % 8);
-                    uint8_t byte = bmp->buffer[row * bmp->pitch + byteIndex];
-                    bool bitSet = (byte >> bitIndex) & 1;
-                    int x = penx + col;
-                    int y = peny + row;
-                    if (x < width && y < height)
-                        pixels[y * width + x] = bitSet ? 255 : 0;
-                }
-            }
-        }
-        else
-        {
-            for (uint32_t row = 0; row < bmp->rows; row++)
-            {
-                for (uint32_t col = 0; col < bmp->width; col++)
-                {
-                    int x = penx + col;
-                    int y = peny + row;
-                    pixels[y * width + x] = bmp->buffer[row * abs(bmp->pitch) + col];
-                }
-            }
-        }
-
+        glyphPositions[i] = LvnVec2i(penx, peny);
 
         LvnFontGlyph glyph{};
         glyph.uv.x0 = (float)penx / (float)width;
         glyph.uv.y0 = (float)peny / (float)height;
-        glyph.uv.x1 = (float)(penx + bmp->width) / (float)width;
-        glyph.uv.y1 = (float)(peny + bmp->rows) / (float)height;
-
-        glyph.size.x = bmp->width;
-        glyph.size.y = bmp->rows;
-        glyph.bearing.x = face->glyph->bitmap_left;
-        glyph.bearing.y = face->glyph->bitmap_top;
-        glyph.advance = face->glyph->advance.x >> 6;
+        glyph.uv.x1 = (float)(penx + bitmap.width) / (float)width;
+        glyph.uv.y1 = (float)(peny + bitmap.rows) / (float)height;
+
+        glyph.size.x = bitmap.width;
+        glyph.size.y = bitmap.rows;
+        glyph.bearing.x = bitmap.bearingX;
+        glyph.bearing.y = bitmap.bearingY;
+        glyph.advance = bitmap.advance;
+        glyph.unicode = pCodepoints[i];
 
         glyphs[i] = glyph;
 
-        penx += bmp->width + padding;
+        penx += bitmap.width + padding;
     }
 
-    FT_Done_FreeType(ft);
+    // copy glyph bitmaps into the atlas, glyph regions do not overlap
+    LvnVector<uint8_t> pixels(width * height);
+
+    lvn::jobParallelFor(codepointCount, 0, [&](uint32_t begin, uint32_t end)
+    {
+        for (uint32_t i = begin; i < end; i++)
+        {
+            const LvnFontGlyphBitmap& bitmap = bitmaps[i];
+            int x = glyphPositions[i].x;
+            int y = glyphPositions[i].y;
+            if (x >= width) { continue; }
+
+            uint32_t copyWidth = x + bitmap.width > (uint32_t)width ? width - x : bitmap.width;
+            for (uint32_t row = 0; row < bitmap.rows && y + (int)row < height; row++)
+                memcpy(&pixels[(y + row) * width + x], &bitmap.pixels[row * bitmap.width], copyWidth);
+        }
+    });
 
     LvnImageData atlas{};
     atlas.width = width;
@@ -1279,27 +1668,31 @@ LvnData<uint32_t> getDefaultSupportedCodepoints()
     return lvn::getContext()->defaultCodePoints;
 }
 
-void* memAlloc(size_t size)
+void* memAlloc(size_t size, const char* file, int line)
 {
     if (size == 0) { return nullptr; }
     void* allocmem = (*s_MemAllocFunc)(size, s_MemAllocUserData);
     if (!allocmem) { LVN_CORE_ERROR("malloc failure, could not allocate memory!"); LVN_ABORT; }
     memset(allocmem, 0, size);
-    if (s_LvnContext) { s_LvnContext->numMemoryAllocations++; }
+    if (s_LvnContext) { s_LvnContext->numMemoryAllocations.fetch_add(1, std::memory_order_relaxed); }
+    if (lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { lvn::memTrackAlloc(allocmem, size, nullptr, file, line); }
     return allocmem;
 }
 
 void memFree(void* ptr)
 {
     if (ptr == nullptr) { return; }
+    if (lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { lvn::memTrackFree(ptr); }
     (*s_MemFreeFunc)(ptr, s_MemAllocUserData);
-    if (s_LvnContext) s_LvnContext->numMemoryAllocations--;
+    if (s_LvnContext) s_LvnContext->numMemoryAllocations.fetch_sub(1, std::memory_order_relaxed);
 }
 
 void* memRealloc(void* ptr, size_t size)
 {
     if (!ptr) { return lvn::memAlloc(size); }
-    return (*s_MemReallocFunc)(ptr, size, s_MemAllocUserData);
+    void* allocmem = (*s_MemReallocFunc)(ptr, size, s_MemAllocUserData);
+    if (allocmem && lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { lvn::memTrackRealloc(ptr, allocmem, size); }
+    return allocmem;
 }
 
 void setMemFuncs(LvnMemAllocFunc allocFunc, LvnMemFreeFunc freeFunc, LvnMemReallocFunc reallocFunc, void* userData)
@@ -1331,33 +1724,140 @@ void* getMemUserData()
 }
 
 /* [Logging] */
-const static LvnLogPattern s_LogPatterns[] =
-{
-    { '$', [](LvnLogMessage* msg) -> LvnString { return "\n"; } },
-    { 'n', [](LvnLogMessage* msg) -> LvnString { return msg->loggerName; } },
-    { 'l', [](LvnLogMessage* msg) -> LvnString { return getLogLevelName(msg->level); }},
-    { '#', [](LvnLogMessage* msg) -> LvnString { return getLogLevelColor(msg->level); }},
-    { '^', [](LvnLogMessage* msg) -> LvnString { return LVN_LOG_COLOR_RESET; }},
-    { 'v', [](LvnLogMessage* msg) -> LvnString { return msg->msg; }},
-    { '%', [](LvnLogMessage* msg) -> LvnString { return "%"; } },
-    { 'T', [](LvnLogMessage* msg) -> LvnString { return dateGetTimeHHMMSS(); } },
-    { 't', [](LvnLogMessage* msg) -> LvnString { return dateGetTime12HHMMSS(); } },
-    { 'Y', [](LvnLogMessage* msg) -> LvnString { return dateGetYearStr(); }},
-    { 'y', [](LvnLogMessage* msg) -> LvnString { return dateGetYear02dStr(); } },
-    { 'm', [](LvnLogMessage* msg) -> LvnString { return dateGetMonthNumStr(); } },
-    { 'B', [](LvnLogMessage* msg) -> LvnString { return dateGetMonthName(); } },
-    { 'b', [](LvnLogMessage* msg) -> LvnString { return dateGetMonthNameShort(); } },
-    { 'd', [](LvnLogMessage* msg) -> LvnString { return dateGetDayNumStr(); } },
-    { 'A', [](LvnLogMessage* msg) -> LvnString { return dateGetWeekDayName(); } },
-    { 'a', [](LvnLogMessage* msg) -> LvnString { return dateGetWeekDayNameShort(); } },
-    { 'H', [](LvnLogMessage* msg) -> LvnString { return dateGetHourNumStr(); } },
-    { 'h', [](LvnLogMessage* msg) -> LvnString { return dateGetHour12NumStr(); } },
-    { 'M', [](LvnLogMessage* msg) -> LvnString { return dateGetMinuteNumStr(); } },
-    { 'S', [](LvnLogMessage* msg) -> LvnString { return dateGetSecondNumStr(); } },
-    { 'P', [](LvnLogMessage* msg) -> LvnString { return dateGetTimeMeridiem(); } },
-    { 'p', [](LvnLogMessage* msg) -> LvnString { return dateGetTimeMeridiemLower(); }},
+struct LvnLogPatternSymbol
+{
+    char symbol;
+    LvnLogInstructionType type;
 };
 
+const static LvnLogPatternSymbol s_LogPatterns[] =
+{
+    { '$', Lvn_LogInstruction_NewLine },
+    { 'n', Lvn_LogInstruction_LoggerName },
+    { 'l', Lvn_LogInstruction_LevelName },
+    { '#', Lvn_LogInstruction_LevelColor },
+    { '^', Lvn_LogInstruction_ColorReset },
+    { 'v', Lvn_LogInstruction_Message },
+    { '%', Lvn_LogInstruction_Percent },
+    { 'T', Lvn_LogInstruction_Time },
+    { 't', Lvn_LogInstruction_Time12 },
+    { 'Y', Lvn_LogInstruction_Year },
+    { 'y', Lvn_LogInstruction_Year02d },
+    { 'm', Lvn_LogInstruction_Month },
+    { 'B', Lvn_LogInstruction_MonthName },
+    { 'b', Lvn_LogInstruction_MonthNameShort },
+    { 'd', Lvn_LogInstruction_Day },
+    { 'A', Lvn_LogInstruction_WeekDayName },
+    { 'a', Lvn_LogInstruction_WeekDayNameShort },
+    { 'H', Lvn_LogInstruction_Hour },
+    { 'h', Lvn_LogInstruction_Hour12 },
+    { 'M', Lvn_LogInstruction_Minute },
+    { 'S', Lvn_LogInstruction_Second },
+    { 'P', Lvn_LogInstruction_Meridiem },
+    { 'p', Lvn_LogInstruction_MeridiemLower },
+};
+
+// broken down time of the last second a message was formatted in on this thread
+// date patterns use the time the message was logged, the async log thread may format a message later than it was logged
+struct LvnLogTimeCache
+{
+    long long timeEpoch;
+    struct tm tm;
+    char time[8];      /* HH:MM:SS */
+    char time12[8];    /* HH:MM:SS in 12 hour format */
+    bool valid;
+};
+
+static thread_local LvnLogTimeCache s_LogTimeCache{};
+
+static void logWriteDigits(char* dst, int value, uint32_t digits)
+{
+    for (uint32_t i = digits; i > 0; i--)
+    {
+        dst[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+static const LvnLogTimeCache* logGetTimeCache(long long timeEpoch)
+{
+    LvnLogTimeCache* cache = &s_LogTimeCache;
+    if (cache->valid && cache->timeEpoch == timeEpoch) { return cache; }
+
+    time_t t = static_cast<time_t>(timeEpoch);
+#ifdef LVN_PLATFORM_WINDOWS
+    localtime_s(&cache->tm, &t);
+#else
+    localtime_r(&t, &cache->tm);
+#endif
+
+    int hour12 = ((cache->tm.tm_hour + 11) % 12) + 1;
+    memcpy(cache->time, "00:00:00", 8);
+    lvn::logWriteDigits(cache->time, cache->tm.tm_hour, 2);
+    lvn::logWriteDigits(cache->time + 3, cache->tm.tm_min, 2);
+    lvn::logWriteDigits(cache->time + 6, cache->tm.tm_sec, 2);
+    memcpy(cache->time12, cache->time, 8);
+    lvn::logWriteDigits(cache->time12, hour12, 2);
+
+    cache->timeEpoch = timeEpoch;
+    cache->valid = true;
+    return cache;
+}
+
+// compiles the pattern format into the instruction list of the logger, unknown pattern symbols are ignored
+static void logCompilePatternFormat(LvnLogger* logger, const char* fmt)
+{
+    logger->logInstructions.clear();
+    logger->logLiterals.clear();
+
+    if (!fmt) { return; }
+
+    LvnContext* lvnctx = lvn::getContext();
+    size_t length = strlen(fmt);
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (fmt[i] != '%' || i + 1 == length) // other characters in format, merged into the previous literal if there is one
+        {
+            if (logger->logInstructions.empty() || logger->logInstructions.back().type != Lvn_LogInstruction_Literal)
+            {
+                LvnLogInstruction instruction{};
+                instruction.type = Lvn_LogInstruction_Literal;
+                instruction.offset = static_cast<uint32_t>(logger->logLiterals.size());
+                logger->logInstructions.push_back(instruction);
+            }
+
+            logger->logInstructions.back().length++;
+            logger->logLiterals.push_back(fmt[i]);
+            continue;
+        }
+
+        char symbol = fmt[++i];
+
+        for (uint32_t j = 0; j < sizeof(s_LogPatterns) / sizeof(LvnLogPatternSymbol); j++)
+        {
+            if (symbol != s_LogPatterns[j].symbol)
+                continue;
+
+            LvnLogInstruction instruction{};
+            instruction.type = s_LogPatterns[j].type;
+            logger->logInstructions.push_back(instruction);
+        }
+
+        // find and add user defined patterns
+        for (uint32_t j = 0; j < lvnctx->userLogPatterns.size(); j++)
+        {
+            if (symbol != lvnctx->userLogPatterns[j].symbol)
+                continue;
+
+            LvnLogInstruction instruction{};
+            instruction.type = Lvn_LogInstruction_UserPattern;
+            instruction.func = lvnctx->userLogPatterns[j].func;
+            logger->logInstructions.push_back(instruction);
+        }
+    }
+}
+
 static LvnResult initLogging(LvnContextCreateInfo* createInfo)
 {
     LvnContext* lvnctx = lvn::getContext();
@@ -1376,12 +1876,16 @@ static LvnResult initLogging(LvnContextCreateInfo* createInfo)
 
         lvnctx->coreLogger.logLevel = lvnctx->clientLogger.logLevel = Lvn_LogLevel_None;
         lvnctx->coreLogger.logPatternFormat = lvnctx->clientLogger.logPatternFormat = LVN_DEFAULT_LOG_PATTERN;
-        lvnctx->coreLogger.logPatterns = lvnctx->clientLogger.logPatterns = lvn::logParseFormat(LVN_DEFAULT_LOG_PATTERN);
+        lvn::logCompilePatternFormat(&lvnctx->coreLogger, LVN_DEFAULT_LOG_PATTERN);
+        lvn::logCompilePatternFormat(&lvnctx->clientLogger, LVN_DEFAULT_LOG_PATTERN);
 
         #ifdef LVN_PLATFORM_WINDOWS
         enableLogANSIcodeColors();
         #endif
 
+        if (createInfo->logging.enableAsyncLogging)
+            lvn::logAsyncInit(createInfo->logging.asyncQueueCapacity, createInfo->logging.asyncOverflowPolicy);
+
         return Lvn_Result_Success;
     }
 
@@ -1392,6 +1896,9 @@ static void terminateLogging()
 {
     LvnContext* lvnctx = lvn::getContext();
 
+    // write the remaining messages before the log files are closed
+    lvn::logAsyncTerminate();
+
     if (lvnctx->coreLogger.logfile.logToFile)
     {
         fclose(lvnctx->coreLogger.logfile.fileptr);
@@ -1404,45 +1911,881 @@ static void terminateLogging()
     }
 }
 
-static LvnVector<LvnLogPattern> logParseFormat(const char* fmt)
+// -- Async Logging
+// ------------------------------------------------------------
+// - the caller packs the arguments of a message into a record without formatting it, the log thread formats the records in batches
+// - arguments are packed by walking the printf format specifiers of fmt, the same walk is used to unpack them with one snprintf per specifier
+// - the console and file output of a message are formatted once, the file output is the console output without the ANSI color patterns
+
+enum LvnLogArgType
+{
+    Lvn_LogArgType_None = 0,   /* "%%", no argument */
+    Lvn_LogArgType_Int,
+    Lvn_LogArgType_Long,
+    Lvn_LogArgType_LongLong,
+    Lvn_LogArgType_SizeT,
+    Lvn_LogArgType_IntMax,
+    Lvn_LogArgType_PtrDiff,
+    Lvn_LogArgType_Double,
+    Lvn_LogArgType_LongDouble,
+    Lvn_LogArgType_String,
+    Lvn_LogArgType_Pointer,
+};
+
+struct LvnLogFormatSpec
+{
+    const char* begin;         /* points to the '%' of the specifier */
+    uint32_t length;           /* length of the specifier including the '%' and the conversion character */
+    uint32_t starCount;        /* number of '*' width and precision arguments before the argument */
+    LvnLogArgType type;
+};
+
+// parses the specifier starting at the '%' pointed to by fmt, returns false if the specifier cannot be packed (eg. %n, %ls)
+static bool logParseFormatSpec(const char* fmt, LvnLogFormatSpec* spec)
+{
+    const char* p = fmt + 1;
+    spec->begin = fmt;
+    spec->starCount = 0;
+
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') { p++; }
+
+    if (*p == '*') { spec->starCount++; p++; }
+    else { while (*p >= '0' && *p <= '9') { p++; } }
+
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*') { spec->starCount++; p++; }
+        else { while (*p >= '0' && *p <= '9') { p++; } }
+    }
+
+    LvnLogArgType intType = Lvn_LogArgType_Int;
+    bool lengthModifier = true, longDouble = false;
+    switch (*p)
+    {
+        case 'h': { p++; if (*p == 'h') { p++; } break; } /* char and short are promoted to int */
+        case 'l': { p++; intType = Lvn_LogArgType_Long; if (*p == 'l') { p++; intType = Lvn_LogArgType_LongLong; } break; }
+        case 'j': { p++; intType = Lvn_LogArgType_IntMax; break; }
+        case 'z': { p++; intType = Lvn_LogArgType_SizeT; break; }
+        case 't': { p++; intType = Lvn_LogArgType_PtrDiff; break; }
+        case 'L': { p++; longDouble = true; break; }
+        default: { lengthModifier = false; break; }
+    }
+
+    switch (*p)
+    {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+        {
+            spec->type = intType;
+            break;
+        }
+        case 'c':
+        {
+            if (lengthModifier) { return false; }
+            spec->type = Lvn_LogArgType_Int;
+            break;
+        }
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+        {
+            spec->type = longDouble ? Lvn_LogArgType_LongDouble : Lvn_LogArgType_Double;
+            break;
+        }
+        case 's':
+        {
+            if (lengthModifier) { return false; }
+            spec->type = Lvn_LogArgType_String;
+            break;
+        }
+        case 'p':
+        {
+            spec->type = Lvn_LogArgType_Pointer;
+            break;
+        }
+        case '%':
+        {
+            spec->type = Lvn_LogArgType_None;
+            break;
+        }
+        default: { return false; }
+    }
+
+    spec->length = static_cast<uint32_t>(p + 1 - fmt);
+    return spec->length <= LVN_LOG_FORMAT_SPEC_MAX_LENGTH;
+}
+
+template <typename T>
+static bool logPackValue(uint8_t* dst, uint32_t capacity, uint32_t* offset, const T& value)
+{
+    if (*offset + sizeof(T) > capacity) { return false; }
+    memcpy(dst + *offset, &value, sizeof(T));
+    *offset += sizeof(T);
+    return true;
+}
+
+template <typename T>
+static bool logUnpackValue(const uint8_t* src, uint32_t size, uint32_t* offset, T* value)
+{
+    if (*offset + sizeof(T) > size) { return false; }
+    memcpy(value, src + *offset, sizeof(T));
+    *offset += sizeof(T);
+    return true;
+}
+
+// packs the arguments of fmt into dst, returns false if the arguments do not fit or fmt has a specifier that cannot be packed
+static bool logPackArgs(const char* fmt, va_list args, uint8_t* dst, uint32_t capacity, uint32_t* size)
+{
+    uint32_t offset = 0;
+
+    for (const char* p = fmt; *p;)
+    {
+        if (*p != '%') { p++; continue; }
+
+        LvnLogFormatSpec spec;
+        if (!lvn::logParseFormatSpec(p, &spec)) { return false; }
+        p += spec.length;
+
+        for (uint32_t i = 0; i < spec.starCount; i++)
+        {
+            if (!lvn::logPackValue(dst, capacity, &offset, va_arg(args, int))) { return false; }
+        }
+
+        bool packed = true;
+        switch (spec.type)
+        {
+            case Lvn_LogArgType_None: { break; }
+            case Lvn_LogArgType_Int: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, int)); break; }
+            case Lvn_LogArgType_Long: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, long)); break; }
+            case Lvn_LogArgType_LongLong: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, long long)); break; }
+            case Lvn_LogArgType_SizeT: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, size_t)); break; }
+            case Lvn_LogArgType_IntMax: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, intmax_t)); break; }
+            case Lvn_LogArgType_PtrDiff: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, ptrdiff_t)); break; }
+            case Lvn_LogArgType_Double: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, double)); break; }
+            case Lvn_LogArgType_LongDouble: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, long double)); break; }
+            case Lvn_LogArgType_Pointer: { packed = lvn::logPackValue(dst, capacity, &offset, va_arg(args, void*)); break; }
+            case Lvn_LogArgType_String:
+            {
+                // strings are copied with their null terminator since the caller's string may not outlive the record
+                const char* str = va_arg(args, const char*);
+                if (str == nullptr) { str = "(null)"; }
+                uint32_t len = static_cast<uint32_t>(strlen(str)) + 1;
+                if (!lvn::logPackValue(dst, capacity, &offset, len) || offset + len > capacity) { return false; }
+                memcpy(dst + offset, str, len);
+                offset += len;
+                break;
+            }
+        }
+
+        if (!packed) { return false; }
+    }
+
+    *size = offset;
+    return true;
+}
+
+template <typename T>
+static void logAppendArg(LvnString& str, const char* spec, const int* stars, uint32_t starCount, T value)
+{
+    char buff[128];
+    int len = 0;
+    switch (starCount)
+    {
+        case 0: { len = snprintf(buff, sizeof(buff), spec, value); break; }
+        case 1: { len = snprintf(buff, sizeof(buff), spec, stars[0], value); break; }
+        case 2: { len = snprintf(buff, sizeof(buff), spec, stars[0], stars[1], value); break; }
+    }
+
+    if (len <= 0) { return; }
+    if (len < static_cast<int>(sizeof(buff))) { str.push_range(buff, len); return; }
+
+    // output longer than the stack buffer is formatted again directly into the string
+    size_t offset = str.size();
+    str.resize(offset + len);
+    switch (starCount)
+    {
+        case 0: { snprintf(str.data() + offset, len + 1, spec, value); break; }
+        case 1: { snprintf(str.data() + offset, len + 1, spec, stars[0], value); break; }
+        case 2: { snprintf(str.data() + offset, len + 1, spec, stars[0], stars[1], value); break; }
+    }
+}
+
+template <typename T>
+static bool logUnpackArg(LvnString& str, const char* spec, const int* stars, uint32_t starCount, const uint8_t* src, uint32_t size, uint32_t* offset)
+{
+    T value;
+    if (!lvn::logUnpackValue(src, size, offset, &value)) { return false; }
+    lvn::logAppendArg(str, spec, stars, starCount, value);
+    return true;
+}
+
+// formats the message from fmt and the size bytes of arguments packed by logPackArgs, appends the message to str
+// returns false if fmt has a specifier that cannot be packed or the arguments of fmt do not fit in the packed data
+static bool logUnpackArgs(const char* fmt, const uint8_t* src, uint32_t size, LvnString& str)
+{
+    uint32_t offset = 0;
+    const char* literal = fmt;
+    const char* p = fmt;
+
+    while (*p)
+    {
+        if (*p != '%') { p++; continue; }
+
+        str.push_range(literal, p - literal);
+
+        LvnLogFormatSpec spec;
+        if (!lvn::logParseFormatSpec(p, &spec)) { return false; }
+        p += spec.length;
+        literal = p;
+
+        char specstr[LVN_LOG_FORMAT_SPEC_MAX_LENGTH + 1];
+        memcpy(specstr, spec.begin, spec.length);
+        specstr[spec.length] = '\0';
+
+        int stars[2];
+        for (uint32_t i = 0; i < spec.starCount; i++)
+        {
+            if (!lvn::logUnpackValue(src, size, &offset, &stars[i])) { return false; }
+        }
+
+        bool unpacked = true;
+        switch (spec.type)
+        {
+            case Lvn_LogArgType_None: { str.push_back('%'); break; }
+            case Lvn_LogArgType_Int: { unpacked = lvn::logUnpackArg<int>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_Long: { unpacked = lvn::logUnpackArg<long>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_LongLong: { unpacked = lvn::logUnpackArg<long long>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_SizeT: { unpacked = lvn::logUnpackArg<size_t>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_IntMax: { unpacked = lvn::logUnpackArg<intmax_t>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_PtrDiff: { unpacked = lvn::logUnpackArg<ptrdiff_t>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_Double: { unpacked = lvn::logUnpackArg<double>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_LongDouble: { unpacked = lvn::logUnpackArg<long double>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_Pointer: { unpacked = lvn::logUnpackArg<void*>(str, specstr, stars, spec.starCount, src, size, &offset); break; }
+            case Lvn_LogArgType_String:
+            {
+                // the string and its null terminator must both be inside the packed data
+                uint32_t len;
+                if (!lvn::logUnpackValue(src, size, &offset, &len) || len > size - offset || memchr(src + offset, '\0', len) == nullptr) { return false; }
+                lvn::logAppendArg(str, specstr, stars, spec.starCount, reinterpret_cast<const char*>(src + offset));
+                offset += len;
+                break;
+            }
+        }
+
+        if (!unpacked) { return false; }
+    }
+
+    str.push_range(literal, p - literal);
+    return true;
+}
+
+static void logAppend(LvnString& str, const char* data, size_t size) { str.push_range(data, size); }
+static void logAppend(LvnLogString& str, const char* data, size_t size) { str.append(data, size); }
+
+static void logAppend(LvnString& str, const char* data) { str.push_range(data, strlen(data)); }
+static void logAppend(LvnLogString& str, const char* data) { str.append(data, strlen(data)); }
+
+template <typename String>
+static void logAppendDigits(String& str, int value, uint32_t digits)
+{
+    char buff[8];
+    lvn::logWriteDigits(buff, value, digits);
+    lvn::logAppend(str, buff, digits);
+}
+
+// runs the compiled pattern of the logger once into console, the same output without the ANSI color codes is copied to file if not null
+template <typename String>
+static void logFormatInstructions(LvnLogger* logger, LvnLogMessage* msg, String& console, String* file)
+{
+    const LvnLogTimeCache* time = nullptr; /* broken down time is only looked up by the first date instruction */
+    const LvnLogInstruction* instructions = logger->logInstructions.data();
+    size_t fileBegin = console.size();
+
+    for (uint32_t i = 0; i < logger->logInstructions.size(); i++)
+    {
+        const LvnLogInstruction& instruction = instructions[i];
+
+        if (instruction.type >= Lvn_LogInstruction_Time && instruction.type <= Lvn_LogInstruction_MeridiemLower && time == nullptr)
+            time = lvn::logGetTimeCache(msg->timeEpoch);
+
+        switch (instruction.type)
+        {
+            case Lvn_LogInstruction_Literal: { lvn::logAppend(console, logger->logLiterals.data() + instruction.offset, instruction.length); break; }
+            case Lvn_LogInstruction_NewLine: { console += '\n'; break; }
+            case Lvn_LogInstruction_LoggerName: { lvn::logAppend(console, msg->loggerName); break; }
+            case Lvn_LogInstruction_LevelName: { lvn::logAppend(console, lvn::getLogLevelName(msg->level)); break; }
+            case Lvn_LogInstruction_Message: { lvn::logAppend(console, msg->msg); break; }
+            case Lvn_LogInstruction_Percent: { console += '%'; break; }
+            case Lvn_LogInstruction_LevelColor:
+            case Lvn_LogInstruction_ColorReset:
+            {
+                // color codes are not copied to the file, copy the output since the last color code first
+                if (file != nullptr)
+                    lvn::logAppend(*file, console.data() + fileBegin, console.size() - fileBegin);
+
+                lvn::logAppend(console, instruction.type == Lvn_LogInstruction_LevelColor ? lvn::getLogLevelColor(msg->level) : LVN_LOG_COLOR_RESET);
+                fileBegin = console.size();
+                break;
+            }
+            case Lvn_LogInstruction_Time: { lvn::logAppend(console, time->time, 8); break; }
+            case Lvn_LogInstruction_Time12: { lvn::logAppend(console, time->time12, 8); break; }
+            case Lvn_LogInstruction_Year: { lvn::logAppendDigits(console, time->tm.tm_year + 1900, 4); break; }
+            case Lvn_LogInstruction_Year02d: { lvn::logAppendDigits(console, (time->tm.tm_year + 1900) % 100, 2); break; }
+            case Lvn_LogInstruction_Month: { lvn::logAppendDigits(console, time->tm.tm_mon + 1, 2); break; }
+            case Lvn_LogInstruction_MonthName: { lvn::logAppend(console, s_MonthName[time->tm.tm_mon]); break; }
+            case Lvn_LogInstruction_MonthNameShort: { lvn::logAppend(console, s_MonthNameShort[time->tm.tm_mon]); break; }
+            case Lvn_LogInstruction_Day: { lvn::logAppendDigits(console, time->tm.tm_mday, 2); break; }
+            case Lvn_LogInstruction_WeekDayName: { lvn::logAppend(console, s_WeekDayName[time->tm.tm_wday]); break; }
+            case Lvn_LogInstruction_WeekDayNameShort: { lvn::logAppend(console, s_WeekDayNameShort[time->tm.tm_wday]); break; }
+            case Lvn_LogInstruction_Hour: { lvn::logAppendDigits(console, time->tm.tm_hour, 2); break; }
+            case Lvn_LogInstruction_Hour12: { lvn::logAppendDigits(console, ((time->tm.tm_hour + 11) % 12) + 1, 2); break; }
+            case Lvn_LogInstruction_Minute: { lvn::logAppendDigits(console, time->tm.tm_min, 2); break; }
+            case Lvn_LogInstruction_Second: { lvn::logAppendDigits(console, time->tm.tm_sec, 2); break; }
+            case Lvn_LogInstruction_Meridiem: { lvn::logAppend(console, time->tm.tm_hour < 12 ? "AM" : "PM", 2); break; }
+            case Lvn_LogInstruction_MeridiemLower: { lvn::logAppend(console, time->tm.tm_hour < 12 ? "am" : "pm", 2); break; }
+            case Lvn_LogInstruction_UserPattern: { console += instruction.func(msg); break; }
+        }
+    }
+
+    if (file != nullptr)
+        lvn::logAppend(*file, console.data() + fileBegin, console.size() - fileBegin);
+}
+
+static char* logRecordText(const LvnLogRecord& record)
+{
+    char* text;
+    memcpy(&text, record.args, sizeof(char*));
+    return text;
+}
+
+// formats the message in one pass into stackBuff, a message that does not fit is formatted again into a heap buffer
+// returns stackBuff, the heap buffer which must be freed with lvn::memDelete, or nullptr if fmt is invalid
+static char* logFormatArgs(char* stackBuff, size_t stackSize, const char* fmt, va_list args, int* length)
+{
+    va_list argcopy;
+    va_copy(argcopy, args);
+    int len = vsnprintf(stackBuff, stackSize, fmt, argcopy);
+    va_end(argcopy);
+
+    *length = len;
+    if (len < 0) { return nullptr; }
+    if (static_cast<size_t>(len) < stackSize) { return stackBuff; }
+
+    char* heapBuff = lvn::memNew<char>(len + 1, false, LVN_FILE_NAME, LVN_LINE);
+    va_copy(argcopy, args);
+    vsnprintf(heapBuff, len + 1, fmt, argcopy);
+    va_end(argcopy);
+    return heapBuff;
+}
+
+static long long logGetTimeNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// -- Binary Log Files
+// ------------------------------------------------------------
+// - a binary log file starts with the magic and version followed by the sizes of the packed argument types, the file is only
+//   decoded on a machine with the same header since the arguments are stored as they are packed by logPackArgs
+// - the rest of the file is a stream of records, see LvnLogBinaryRecordType for their layout
+// - logger and format records are written before the first message that uses them, the decoder keeps the latest record of each id
+//   so that appending to a file from a new run or renaming a logger does not need the old ids
+
+static void logBinaryGetHeader(uint8_t* header)
+{
+    memcpy(header, LVN_LOG_BINARY_MAGIC, 7);
+    header[7] = LVN_LOG_BINARY_VERSION;
+
+    uint16_t byteOrder = 1;
+    uint8_t littleEndian;
+    memcpy(&littleEndian, &byteOrder, 1);
+
+    const uint8_t sizes[10] =
+    {
+        sizeof(int), sizeof(long), sizeof(long long), sizeof(size_t), sizeof(intmax_t),
+        sizeof(ptrdiff_t), sizeof(double), sizeof(long double), sizeof(void*), littleEndian,
+    };
+    memcpy(header + 8, sizes, sizeof(sizes));
+}
+
+template <typename T>
+static void logBinaryPut(uint8_t* dst, uint32_t* offset, T value)
+{
+    memcpy(dst + *offset, &value, sizeof(T));
+    *offset += sizeof(T);
+}
+
+static void logBinaryPutVarint(uint8_t* dst, uint32_t* offset, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        dst[(*offset)++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    dst[(*offset)++] = static_cast<uint8_t>(value);
+}
+
+static bool logIsBinaryFile(LvnLogger* logger)
+{
+    return logger->logfile.logToFile && logger->logfile.fileptr != nullptr && logger->logfile.format == Lvn_LogFileFormat_Binary;
+}
+
+// the caller holds s_LogBinary.lock
+static void logBinaryWriteString(FILE* fileptr, const LvnString& str)
+{
+    uint32_t len = static_cast<uint32_t>(str.size());
+    fwrite(&len, sizeof(uint32_t), 1, fileptr);
+    fwrite(str.c_str(), sizeof(char), len, fileptr);
+}
+
+// the caller holds s_LogBinary.lock, the logger record also resets the time base of the logger's messages
+static void logBinaryWriteLoggerLocked(LvnLogger* logger)
+{
+    FILE* fileptr = logger->logfile.fileptr;
+    logger->binaryLastTimeNs = 0;
+    uint8_t type = Lvn_LogBinaryRecord_Logger;
+
+    fwrite(&type, sizeof(uint8_t), 1, fileptr);
+    fwrite(&logger->binaryLoggerId, sizeof(uint32_t), 1, fileptr);
+    lvn::logBinaryWriteString(fileptr, logger->loggerName);
+    lvn::logBinaryWriteString(fileptr, logger->logPatternFormat);
+}
+
+// writes the name and pattern of the logger again after they change
+static void logBinaryWriteLogger(LvnLogger* logger)
+{
+    if (!lvn::logIsBinaryFile(logger)) { return; }
+
+    std::lock_guard<std::mutex> lock(s_LogBinary.lock);
+    lvn::logBinaryWriteLoggerLocked(logger);
+}
+
+// returns the id of fmt in the file of the logger, the format record is written the first time the text of fmt is used
+// format strings are identified by their text, the id of the last text seen at an address is cached so that string literals
+// are only compared and not hashed, the caller holds s_LogBinary.lock
+static uint32_t logBinaryGetFormatIdLocked(LvnLogger* logger, const char* fmt)
+{
+    LvnLogBinaryFormat* cached = logger->binaryFormatAddresses.find(fmt);
+    if (cached != nullptr && strcmp(cached->text.c_str(), fmt) == 0) { return cached->id; }
+
+    LvnString text(fmt);
+    const uint32_t* id = logger->binaryFormatIds.find(text);
+    uint32_t formatId = id != nullptr ? *id : 0;
+
+    if (id == nullptr)
+    {
+        formatId = ++s_LogBinary.nextFormatId;
+        logger->binaryFormatIds.insert(text, formatId);
+
+        FILE* fileptr = logger->logfile.fileptr;
+        uint8_t type = Lvn_LogBinaryRecord_Format;
+        uint32_t len = static_cast<uint32_t>(text.size());
+
+        fwrite(&type, sizeof(uint8_t), 1, fileptr);
+        fwrite(&formatId, sizeof(uint32_t), 1, fileptr);
+        fwrite(&len, sizeof(uint32_t), 1, fileptr);
+        fwrite(fmt, sizeof(char), len, fileptr);
+    }
+
+    if (cached != nullptr)
+    {
+        cached->id = formatId;
+        cached->text = lvn::move(text);
+    }
+    else
+    {
+        logger->binaryFormatAddresses.insert(fmt, { formatId, lvn::move(text) });
+    }
+
+    return formatId;
+}
+
+// writes a message record to the binary file of the logger
+// data is the arguments packed by logPackArgs, or the formatted message text if fmt is nullptr
+static void logBinaryWriteMessage(LvnLogger* logger, LvnLogLevel level, long long timeNs, const char* fmt, const void* data, uint32_t size)
+{
+    std::lock_guard<std::mutex> lock(s_LogBinary.lock);
+
+    uint32_t formatId = fmt != nullptr ? lvn::logBinaryGetFormatIdLocked(logger, fmt) : LVN_LOG_BINARY_TEXT_FORMAT_ID;
+
+    uint8_t record[LVN_LOG_BINARY_MESSAGE_HEADER_SIZE + LVN_LOG_RECORD_ARG_SIZE];
+    uint32_t offset = 0;
+    // the time is the zigzag encoded delta from the previous message of the logger, calling threads may write slightly out of order
+    long long delta = timeNs - logger->binaryLastTimeNs;
+    logger->binaryLastTimeNs = timeNs;
+
+    lvn::logBinaryPut<uint8_t>(record, &offset, static_cast<uint8_t>(Lvn_LogBinaryRecord_Message | (level << 4)));
+    lvn::logBinaryPutVarint(record, &offset, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+    lvn::logBinaryPutVarint(record, &offset, logger->binaryLoggerId);
+    lvn::logBinaryPutVarint(record, &offset, formatId);
+    lvn::logBinaryPutVarint(record, &offset, size);
+
+    // packed args always fit in the record, only long message text takes a second write
+    if (size <= LVN_LOG_RECORD_ARG_SIZE)
+    {
+        memcpy(record + offset, data, size);
+        fwrite(record, sizeof(uint8_t), offset + size, logger->logfile.fileptr);
+        return;
+    }
+
+    fwrite(record, sizeof(uint8_t), offset, logger->logfile.fileptr);
+    fwrite(data, sizeof(uint8_t), size, logger->logfile.fileptr);
+}
+
+// opens the log file of the logger, a binary file gets the file header if it is empty and the logger record
+static void logOpenFile(LvnLogger* logger)
+{
+    bool binary = logger->logfile.format == Lvn_LogFileFormat_Binary;
+
+    const char* filemode = binary ? "wb" : "w";
+    if (logger->logfile.filemode == Lvn_FileMode_Append) filemode = binary ? "ab" : "a";
+
+    logger->logfile.fileptr = fopen(logger->logfile.filename.c_str(), filemode);
+    if (!binary || logger->logfile.fileptr == nullptr) { return; }
+
+    std::lock_guard<std::mutex> lock(s_LogBinary.lock);
+
+    logger->binaryLoggerId = s_LogBinary.nextLoggerId++;
+    logger->binaryFormatIds.clear();
+    logger->binaryFormatAddresses.clear();
+
+    // appending to a file that already has records keeps its header
+    fseek(logger->logfile.fileptr, 0, SEEK_END);
+    if (ftell(logger->logfile.fileptr) == 0)
+    {
+        uint8_t header[LVN_LOG_BINARY_HEADER_SIZE];
+        lvn::logBinaryGetHeader(header);
+        fwrite(header, sizeof(uint8_t), LVN_LOG_BINARY_HEADER_SIZE, logger->logfile.fileptr);
+    }
+
+    lvn::logBinaryWriteLoggerLocked(logger);
+}
+
+static bool logBinaryRead(FILE* fileptr, void* dst, size_t size)
+{
+    return fread(dst, sizeof(uint8_t), size, fileptr) == size;
+}
+
+static bool logBinaryReadVarint(FILE* fileptr, uint64_t* value)
+{
+    *value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        int byte = fgetc(fileptr);
+        if (byte == EOF) { return false; }
+
+        *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) { return true; }
+    }
+
+    return false;
+}
+
+// returns true if size bytes are left in the file after the current position, sizes read from the file are checked before allocating
+static bool logBinaryHasBytes(FILE* fileptr, uint64_t fileSize, uint64_t size)
+{
+    long pos = ftell(fileptr);
+    return pos >= 0 && size <= fileSize - static_cast<uint64_t>(pos);
+}
+
+static bool logBinaryReadString(FILE* fileptr, uint64_t fileSize, LvnString& str)
+{
+    uint32_t len;
+    if (!lvn::logBinaryRead(fileptr, &len, sizeof(uint32_t)) || !lvn::logBinaryHasBytes(fileptr, fileSize, len)) { return false; }
+
+    str.resize(len);
+    return lvn::logBinaryRead(fileptr, str.data(), len);
+}
+
+static void logAsyncWake()
+{
+    // taking the lock orders the notify after the log thread has checked the queue, a wake up cannot be lost between the check and the wait
+    { std::lock_guard<std::mutex> lock(s_LogAsync.sleepLock); }
+    s_LogAsync.sleepCond.notify_one();
+}
+
+static void logAsyncPush(const LvnLogRecord& record)
+{
+    while (!s_LogAsync.queue->push(record))
+    {
+        if (s_LogAsync.overflowPolicy == Lvn_LogOverflowPolicy_Block)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (s_LogAsync.overflowPolicy == Lvn_LogOverflowPolicy_DropAndCount)
+            s_LogAsync.dropped.fetch_add(1, std::memory_order_relaxed);
+
+        if (record.fmt == nullptr)
+            lvn::memDelete<char>(lvn::logRecordText(record), 0);
+
+        return;
+    }
+
+    // seq_cst pairs with the log thread setting sleeping before it checks pushed, either the thread sees the record or this sees it sleeping
+    s_LogAsync.pushed.fetch_add(1, std::memory_order_seq_cst);
+    if (s_LogAsync.sleeping.load(std::memory_order_seq_cst))
+        lvn::logAsyncWake();
+}
+
+// pushes an already formatted message, the message text is copied to the heap since it can be any length
+static void logAsyncPushMessage(LvnLogger* logger, LvnLogLevel level, long long timeNs, const char* msg, size_t len)
+{
+    LvnLogRecord record;
+    record.logger = logger;
+    record.fmt = nullptr;
+    record.timeNs = timeNs;
+    record.level = level;
+    record.argSize = static_cast<uint32_t>(len);
+
+    char* text = lvn::memNew<char>(len + 1, false, LVN_FILE_NAME, LVN_LINE);
+    memcpy(text, msg, len);
+    text[len] = '\0';
+    memcpy(record.args, &text, sizeof(char*));
+
+    lvn::logAsyncPush(record);
+}
+
+static void logAsyncPushArgs(LvnLogger* logger, LvnLogLevel level, const char* fmt, va_list args)
+{
+    LvnLogRecord record;
+    record.logger = logger;
+    record.fmt = fmt;
+    record.timeNs = lvn::logGetTimeNs();
+    record.level = level;
+
+    va_list argcopy;
+    va_copy(argcopy, args);
+    bool packed = lvn::logPackArgs(fmt, argcopy, record.args, LVN_LOG_RECORD_ARG_SIZE, &record.argSize);
+    va_end(argcopy);
+
+    if (packed)
+    {
+        lvn::logAsyncPush(record);
+        return;
+    }
+
+    // arguments did not fit in the record, format the message on the calling thread instead
+    char stackBuff[LVN_LOG_STACK_BUFFER_SIZE];
+    int len;
+    char* msg = lvn::logFormatArgs(stackBuff, LVN_LOG_STACK_BUFFER_SIZE, fmt, args, &len);
+    if (msg == nullptr) { return; }
+
+    lvn::logAsyncPushMessage(logger, level, record.timeNs, msg, len);
+
+    if (msg != stackBuff)
+        lvn::memDelete<char>(msg, 0);
+}
+
+// formats one record into the console batch, the file output is written to the logger's file directly
+// a binary file gets the packed arguments of the record as they are
+static void logAsyncWriteRecord(LvnLogRecord& record, LvnString& text, LvnString& console, LvnString& file, LvnVector<FILE*>& files)
+{
+    LvnLogger* logger = record.logger;
+    bool binaryFile = lvn::logIsBinaryFile(logger);
+    bool textFile = !binaryFile && logger->logfile.logToFile && logger->logfile.fileptr != nullptr;
+
+    text.clear();
+    if (record.fmt != nullptr)
+    {
+        if (binaryFile)
+            lvn::logBinaryWriteMessage(logger, record.level, record.timeNs, record.fmt, record.args, record.argSize);
+
+        lvn::logUnpackArgs(record.fmt, record.args, record.argSize, text);
+    }
+    else
+    {
+        char* msg = lvn::logRecordText(record);
+        if (binaryFile)
+            lvn::logBinaryWriteMessage(logger, record.level, record.timeNs, nullptr, msg, record.argSize);
+
+        text.push_range(msg, record.argSize);
+        lvn::memDelete<char>(msg, 0);
+    }
+
+    LvnLogMessage logMsg{};
+    logMsg.msg = text.c_str();
+    logMsg.loggerName = logger->loggerName.c_str();
+    logMsg.level = record.level;
+    logMsg.timeEpoch = record.timeNs / 1000000000;
+
+    file.clear();
+    lvn::logFormatInstructions(logger, &logMsg, console, textFile ? &file : nullptr);
+
+    if (textFile)
+        fwrite(file.c_str(), sizeof(char), file.size(), logger->logfile.fileptr);
+
+    if (textFile || binaryFile)
+    {
+        bool found = false;
+        for (uint32_t i = 0; i < files.size() && !found; i++)
+            found = files[i] == logger->logfile.fileptr;
+
+        if (!found)
+            files.push_back(logger->logfile.fileptr);
+    }
+}
+
+static void* logAsyncThread(void*)
+{
+    LvnString text, console, file;
+    LvnVector<FILE*> files;
+    LvnLogRecord record;
+    uint64_t reportedDropped = 0;
+
+    for (;;)
+    {
+        uint32_t count = 0;
+        while (count < LVN_LOG_ASYNC_BATCH_SIZE && s_LogAsync.queue->pop(record))
+        {
+            lvn::logAsyncWriteRecord(record, text, console, file, files);
+            count++;
+        }
+
+        uint64_t dropped = s_LogAsync.dropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped)
+        {
+            char buff[128];
+            snprintf(buff, sizeof(buff), "%llu log messages were dropped, the async log queue was full", static_cast<unsigned long long>(dropped - reportedDropped));
+            reportedDropped = dropped;
+
+            LvnLogMessage logMsg{};
+            logMsg.msg = buff;
+            logMsg.loggerName = s_LvnContext->coreLogger.loggerName.c_str();
+            logMsg.level = Lvn_LogLevel_Warn;
+            logMsg.timeEpoch = lvn::dateGetSecondsSinceEpoch();
+            lvn::logFormatInstructions<LvnString>(&s_LvnContext->coreLogger, &logMsg, console, nullptr);
+        }
+
+        if (count > 0 || !console.empty())
+        {
+            // one console write per batch, then flush so that logFlush sees the batch written when the count is updated
+            fwrite(console.c_str(), sizeof(char), console.size(), stdout);
+            fflush(stdout);
+            console.clear();
+
+            for (FILE* fileptr : files)
+                fflush(fileptr);
+            files.clear();
+
+            s_LogAsync.written.fetch_add(count, std::memory_order_release);
+            continue;
+        }
+
+        if (!s_LogAsync.running.load(std::memory_order_acquire)) { break; }
+
+        s_LogAsync.sleeping.store(true, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(s_LogAsync.sleepLock);
+            s_LogAsync.sleepCond.wait(lock, []()
+            {
+                return s_LogAsync.pushed.load(std::memory_order_seq_cst) != s_LogAsync.written.load(std::memory_order_relaxed) || !s_LogAsync.running.load(std::memory_order_relaxed);
+            });
+        }
+        s_LogAsync.sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    return nullptr;
+}
+
+static void logAsyncInit(uint32_t capacity, LvnLogOverflowPolicy overflowPolicy)
+{
+    if (s_LogAsync.running.load(std::memory_order_acquire)) { return; }
+
+    s_LogAsync.queue = new LvnMpmcQueue<LvnLogRecord>(capacity ? capacity : LVN_LOG_ASYNC_DEFAULT_CAPACITY);
+    s_LogAsync.overflowPolicy = overflowPolicy;
+    s_LogAsync.pushed.store(0, std::memory_order_relaxed);
+    s_LogAsync.written.store(0, std::memory_order_relaxed);
+    s_LogAsync.dropped.store(0, std::memory_order_relaxed);
+    s_LogAsync.sleeping.store(false, std::memory_order_relaxed);
+    s_LogAsync.running.store(true, std::memory_order_release);
+    s_LogAsync.thread = new LvnThread(lvn::logAsyncThread, nullptr);
+}
+
+static void logAsyncTerminate()
+{
+    if (!s_LogAsync.running.load(std::memory_order_acquire)) { return; }
+
+    // the log thread drains the queue before it exits, destroying the thread joins it
+    s_LogAsync.running.store(false, std::memory_order_release);
+    lvn::logAsyncWake();
+    delete s_LogAsync.thread;
+    s_LogAsync.thread = nullptr;
+
+    // free the heap copies of any records pushed after the log thread's last pop
+    LvnLogRecord record;
+    while (s_LogAsync.queue->pop(record))
+    {
+        if (record.fmt == nullptr)
+            lvn::memDelete<char>(lvn::logRecordText(record), 0);
+    }
+
+    delete s_LogAsync.queue;
+    s_LogAsync.queue = nullptr;
+}
+
+// formats the message into the console output and the text log file, writeFile is false if the message was already written to the binary file
+static void logWriteMessage(LvnLogger* logger, LvnLogLevel level, long long timeNs, const char* msg, size_t len, bool writeFile)
 {
-    if (!fmt || !*fmt) { return {}; }
+    LvnLogMessage logMsg{};
+    logMsg.msg = msg;
+    logMsg.loggerName = logger->loggerName.c_str();
+    logMsg.level = level;
+    logMsg.timeEpoch = timeNs / 1000000000;
 
-    LvnVector<LvnLogPattern> patterns;
+    bool logToFile = writeFile && logger->logfile.logToFile && logger->logfile.fileptr != nullptr;
+    bool binaryFile = logToFile && logger->logfile.format == Lvn_LogFileFormat_Binary;
+    bool textFile = logToFile && !binaryFile;
 
-    for (uint32_t i = 0; i < strlen(fmt) - 1; i++)
-    {
-        if (fmt[i] != '%') // Other characters in format
-        {
-            LvnLogPattern pattern = { /* .symbol = */ fmt[i], /* .func = */ nullptr };
-            patterns.push_back(pattern);
-            continue;
-        }
+    // format once, the file gets the same output without the ANSI color codes
+    LvnLogString msgstr, filestr;
+    lvn::logFormatInstructions(logger, &logMsg, msgstr, textFile ? &filestr : nullptr);
 
-        // find pattern with matching symbol
-        for (uint32_t j = 0; j < sizeof(s_LogPatterns) / sizeof(LvnLogPattern); j++)
-        {
-            if (fmt[i + 1] != s_LogPatterns[j].symbol)
-                continue;
+    fwrite(msgstr.c_str(), sizeof(char), msgstr.size(), stdout);
 
-            patterns.push_back(s_LogPatterns[j]);
-        }
+    if (textFile)
+        fwrite(filestr.c_str(), sizeof(char), filestr.size(), logger->logfile.fileptr);
+    else if (binaryFile)
+        lvn::logBinaryWriteMessage(logger, level, timeNs, nullptr, msg, static_cast<uint32_t>(len));
+}
 
-        // find and add user defined patterns
-        for (uint32_t j = 0; j < s_LvnContext->userLogPatterns.size(); j++)
-        {
-            if (fmt[i + 1] != s_LvnContext->userLogPatterns[j].symbol)
-                continue;
+static void logMessageArgs(LvnLogger* logger, LvnLogLevel level, const char* fmt, va_list args)
+{
+    if (s_LogAsync.running.load(std::memory_order_acquire))
+    {
+        lvn::logAsyncPushArgs(logger, level, fmt, args);
+        return;
+    }
 
-            patterns.push_back(s_LvnContext->userLogPatterns[j]);
-        }
+    long long timeNs = lvn::logGetTimeNs();
 
-        i++; // incramant past symbol on next character in format
+    // the binary file gets the packed arguments, the message is only formatted for the console
+    bool fileWritten = false;
+    if (lvn::logIsBinaryFile(logger))
+    {
+        uint8_t packedArgs[LVN_LOG_RECORD_ARG_SIZE];
+        uint32_t argSize;
+
+        va_list argcopy;
+        va_copy(argcopy, args);
+        fileWritten = lvn::logPackArgs(fmt, argcopy, packedArgs, LVN_LOG_RECORD_ARG_SIZE, &argSize);
+        va_end(argcopy);
+
+        if (fileWritten)
+            lvn::logBinaryWriteMessage(logger, level, timeNs, fmt, packedArgs, argSize);
     }
 
-    return patterns;
+    char stackBuff[LVN_LOG_STACK_BUFFER_SIZE];
+    int len;
+    char* msg = lvn::logFormatArgs(stackBuff, LVN_LOG_STACK_BUFFER_SIZE, fmt, args, &len);
+    if (msg == nullptr) { return; }
+
+    lvn::logWriteMessage(logger, level, timeNs, msg, len, !fileWritten);
+
+    if (msg != stackBuff)
+        lvn::memDelete<char>(msg, 0);
 }
 
+
 void logEnable(bool enable)
 {
     lvn::getContext()->logging = enable;
@@ -1458,8 +2801,11 @@ void logSetLevel(LvnLogger* logger, LvnLogLevel level)
     logger->logLevel = level;
 }
 
-void logSetFileConfig(LvnLogger* logger, bool enable, const char* filename, LvnFileMode filemode)
+void logSetFileConfig(LvnLogger* logger, bool enable, const char* filename, LvnFileMode filemode, LvnLogFileFormat format)
 {
+    // pending async messages are written with the old config
+    lvn::logFlush();
+
     // if log to file was enabled before, fileptr needs to be closed
     if (logger->logfile.logToFile)
     {
@@ -1470,20 +2816,17 @@ void logSetFileConfig(LvnLogger* logger, bool enable, const char* filename, LvnF
     logger->logfile.logToFile = enable;
     logger->logfile.filename = filename;
     logger->logfile.filemode = filemode;
+    logger->logfile.format = format;
 
     if (enable)
     {
         if (logger->logfile.filename.empty())
         {
             logger->logfile.filename = logger->loggerName + "_logs.txt";
-            LVN_CORE_WARN("logSetFileConfig(LvnLogger*, bool enable, const char* filename, LvnFileMode filemode) | filename not set, setting file name to name of the logger: %s_logs.txt", logger->loggerName.c_str());
+            LVN_CORE_WARN("logSetFileConfig(LvnLogger*, bool enable, const char* filename, LvnFileMode filemode, LvnLogFileFormat format) | filename not set, setting file name to name of the logger: %s_logs.txt", logger->loggerName.c_str());
         }
 
-        const char* filemode = "w";
-        if (logger->logfile.filemode == Lvn_FileMode_Write) filemode = "w";
-        else if (logger->logfile.filemode == Lvn_FileMode_Append) filemode = "a";
-
-        logger->logfile.fileptr = fopen(logger->logfile.filename.c_str(), filemode);
+        lvn::logOpenFile(logger);
     }
 }
 
@@ -1492,30 +2835,21 @@ bool logCheckLevel(LvnLogger* logger, LvnLogLevel level)
     return (level >= logger->logLevel);
 }
 
-void logRenameLogger(LvnLogger* logger, const char* name)
+void logRenameLogger(LvnLogger* logger, LvnStringView name)
 {
-    logger->loggerName = name;
+    lvn::logFlush();
+    logger->loggerName = LvnString(name);
+    lvn::logBinaryWriteLogger(logger);
 }
 
 void logOutputMessage(LvnLogger* logger, LvnLogMessage* msg)
 {
     if (!lvn::getContext()->logging) { return; }
 
-    LvnString msgstr; msgstr.reserve(strlen(msg->msg) + 1);
-
-    for (uint32_t i = 0; i < logger->logPatterns.size(); i++)
-    {
-        if (logger->logPatterns[i].func == nullptr) // no special format character '%' found
-        {
-            msgstr += logger->logPatterns[i].symbol;
-        }
-        else // call func of special format
-        {
-            msgstr += logger->logPatterns[i].func(msg);
-        }
-    }
+    LvnLogString msgstr;
+    lvn::logFormatInstructions<LvnLogString>(logger, msg, msgstr, nullptr);
 
-    printf("%s", msgstr.c_str());
+    fwrite(msgstr.c_str(), sizeof(char), msgstr.size(), stdout);
 }
 
 LvnString logFormatMessage(LvnLogger* logger, LvnLogLevel level, const char* msg, bool removeANSI)
@@ -1526,23 +2860,16 @@ LvnString logFormatMessage(LvnLogger* logger, LvnLogLevel level, const char* msg
     logMsg.level = level;
     logMsg.timeEpoch = lvn::dateGetSecondsSinceEpoch();
 
-    LvnString msgstr; msgstr.reserve(strlen(msg) + 1);
+    LvnString msgstr; msgstr.reserve(strlen(msg) + logger->logLiterals.size() + 64);
 
-    for (uint32_t i = 0; i < logger->logPatterns.size(); i++)
+    if (removeANSI)
     {
-        if (removeANSI && (logger->logPatterns[i].symbol == '#' || logger->logPatterns[i].symbol == '^'))
-            continue;
-
-        if (logger->logPatterns[i].func == nullptr) // no special format character '%' found
-        {
-            msgstr += logger->logPatterns[i].symbol;
-        }
-        else // call func of special format
-        {
-            msgstr += logger->logPatterns[i].func(&logMsg);
-        }
+        LvnString filestr; filestr.reserve(msgstr.capacity());
+        lvn::logFormatInstructions(logger, &logMsg, msgstr, &filestr);
+        return filestr;
     }
 
+    lvn::logFormatInstructions<LvnString>(logger, &logMsg, msgstr, nullptr);
     return msgstr;
 }
 
@@ -1550,160 +2877,89 @@ void logMessage(LvnLogger* logger, LvnLogLevel level, const char* msg)
 {
     if (!lvn::getContext()->logging) { return; }
 
-    LvnLogMessage logMsg{};
-    logMsg.msg = msg;
-    logMsg.loggerName = logger->loggerName.c_str();
-    logMsg.level = level;
-    logMsg.timeEpoch = lvn::dateGetSecondsSinceEpoch();
-
-    lvn::logOutputMessage(logger, &logMsg);
+    long long timeNs = lvn::logGetTimeNs();
 
-    if (logger->logfile.logToFile)
+    if (s_LogAsync.running.load(std::memory_order_acquire))
     {
-        LvnString msgstr; msgstr.reserve(strlen(msg) + 1);
+        lvn::logAsyncPushMessage(logger, level, timeNs, msg, strlen(msg));
+        return;
+    }
 
-        for (uint32_t i = 0; i < logger->logPatterns.size(); i++)
-        {
-            if (logger->logPatterns[i].symbol == '#' || logger->logPatterns[i].symbol == '^')
-                continue;
+    lvn::logWriteMessage(logger, level, timeNs, msg, strlen(msg), true);
+}
 
-            if (logger->logPatterns[i].func == nullptr) // no special format character '%' found
-            {
-                msgstr += logger->logPatterns[i].symbol;
-            }
-            else // call func of special format
-            {
-                msgstr += logger->logPatterns[i].func(&logMsg);
-            }
-        }
+bool logIsEnabled(LvnLogger* logger, LvnLogLevel level)
+{
+    if (!s_LvnContext || !s_LvnContext->logging) { return false; }
+    if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return false; }
+    return level >= logger->logLevel;
+}
 
-        fprintf(logger->logfile.fileptr, "%s", msgstr.c_str());
-    }
+void logMessageFmt(LvnLogger* logger, LvnLogLevel level, const char* fmt, ...)
+{
+    va_list argptr;
+    va_start(argptr, fmt);
+    lvn::logMessageArgs(logger, level, fmt, argptr);
+    va_end(argptr);
 }
 
 void logMessageTrace(LvnLogger* logger, const char* fmt, ...)
 {
-    if (!s_LvnContext || !s_LvnContext->logging) { return; }
-    if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-    if (!lvn::logCheckLevel(logger, Lvn_LogLevel_Trace)) { return; }
+    if (!lvn::logIsEnabled(logger, Lvn_LogLevel_Trace)) { return; }
 
-    LvnVector<char> buff;
-
-    va_list argptr, argcopy;
+    va_list argptr;
     va_start(argptr, fmt);
-    va_copy(argcopy, argptr);
-
-    int len = vsnprintf(nullptr, 0, fmt, argptr);
-    buff.resize(len + 1);
-    vsnprintf(&buff[0], len + 1, fmt, argcopy);
-    lvn::logMessage(logger, Lvn_LogLevel_Trace, buff.data());
-
-    va_end(argcopy);
+    lvn::logMessageArgs(logger, Lvn_LogLevel_Trace, fmt, argptr);
     va_end(argptr);
 }
 
 void logMessageDebug(LvnLogger* logger, const char* fmt, ...)
 {
-    if (!s_LvnContext || !s_LvnContext->logging) { return; }
-    if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-    if (!lvn::logCheckLevel(logger, Lvn_LogLevel_Debug)) { return; }
+    if (!lvn::logIsEnabled(logger, Lvn_LogLevel_Debug)) { return; }
 
-    LvnVector<char> buff;
-
-    va_list argptr, argcopy;
+    va_list argptr;
     va_start(argptr, fmt);
-    va_copy(argcopy, argptr);
-
-    int len = vsnprintf(nullptr, 0, fmt, argptr);
-    buff.resize(len + 1);
-    vsnprintf(&buff[0], len + 1, fmt, argcopy);
-    lvn::logMessage(logger, Lvn_LogLevel_Debug, buff.data());
-
-    va_end(argcopy);
+    lvn::logMessageArgs(logger, Lvn_LogLevel_Debug, fmt, argptr);
     va_end(argptr);
 }
 
 void logMessageInfo(LvnLogger* logger, const char* fmt, ...)
 {
-    if (!s_LvnContext || !s_LvnContext->logging) { return; }
-    if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-    if (!lvn::logCheckLevel(logger, Lvn_LogLevel_Info)) { return; }
+    if (!lvn::logIsEnabled(logger, Lvn_LogLevel_Info)) { return; }
 
-    LvnVector<char> buff;
-
-    va_list argptr, argcopy;
+    va_list argptr;
     va_start(argptr, fmt);
-    va_copy(argcopy, argptr);
-
-    int len = vsnprintf(nullptr, 0, fmt, argptr);
-    buff.resize(len + 1);
-    vsnprintf(&buff[0], len + 1, fmt, argcopy);
-    lvn::logMessage(logger, Lvn_LogLevel_Info, buff.data());
-
-    va_end(argcopy);
+    lvn::logMessageArgs(logger, Lvn_LogLevel_Info, fmt, argptr);
     va_end(argptr);
 }
 
 void logMessageWarn(LvnLogger* logger, const char* fmt, ...)
 {
-    if (!s_LvnContext || !s_LvnContext->logging) { return; }
-    if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-    if (!lvn::logCheckLevel(logger, Lvn_LogLevel_Warn)) { return; }
+    if (!lvn::logIsEnabled(logger, Lvn_LogLevel_Warn)) { return; }
 
-    LvnVector<char> buff;
-
-    va_list argptr, argcopy;
+    va_list argptr;
     va_start(argptr, fmt);
-    va_copy(argcopy, argptr);
-
-    int len = vsnprintf(nullptr, 0, fmt, argptr);
-    buff.resize(len + 1);
-    vsnprintf(&buff[0], len + 1, fmt, argcopy);
-    lvn::logMessage(logger, Lvn_LogLevel_Warn, buff.data());
-
-    va_end(argcopy);
+    lvn::logMessageArgs(logger, Lvn_LogLevel_Warn, fmt, argptr);
     va_end(argptr);
 }
 
 void logMessageError(LvnLogger* logger, const char* fmt, ...)
 {
-    if (!s_LvnContext || !s_LvnContext->logging) { return; }
-    if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-    if (!lvn::logCheckLevel(logger, Lvn_LogLevel_Error)) { return; }
+    if (!lvn::logIsEnabled(logger, Lvn_LogLevel_Error)) { return; }
 
-    LvnVector<char> buff;
-
-    va_list argptr, argcopy;
+    va_list argptr;
     va_start(argptr, fmt);
-    va_copy(argcopy, argptr);
-
-    int len = vsnprintf(nullptr, 0, fmt, argptr);
-    buff.resize(len + 1);
-    vsnprintf(&buff[0], len + 1, fmt, argcopy);
-    lvn::logMessage(logger, Lvn_LogLevel_Error, buff.data());
-
-    va_end(argcopy);
+    lvn::logMessageArgs(logger, Lvn_LogLevel_Error, fmt, argptr);
     va_end(argptr);
 }
 
 void logMessageFatal(LvnLogger* logger, const char* fmt, ...)
 {
-    if (!s_LvnContext || !s_LvnContext->logging) { return; }
-    if (!s_LvnContext->enableCoreLogging && logger == &s_LvnContext->coreLogger) { return; }
-    if (!lvn::logCheckLevel(logger, Lvn_LogLevel_Fatal)) { return; }
+    if (!lvn::logIsEnabled(logger, Lvn_LogLevel_Fatal)) { return; }
 
-    LvnVector<char> buff;
-
-    va_list argptr, argcopy;
+    va_list argptr;
     va_start(argptr, fmt);
-    va_copy(argcopy, argptr);
-
-    int len = vsnprintf(nullptr, 0, fmt, argptr);
-    buff.resize(len + 1);
-    vsnprintf(&buff[0], len + 1, fmt, argcopy);
-    lvn::logMessage(logger, Lvn_LogLevel_Fatal, buff.data());
-
-    va_end(argcopy);
+    lvn::logMessageArgs(logger, Lvn_LogLevel_Fatal, fmt, argptr);
     va_end(argptr);
 }
 
@@ -1738,9 +2994,11 @@ LvnResult logSetPatternFormat(LvnLogger* logger, const char* patternfmt)
     if (!logger) { return Lvn_Result_Failure; }
     if (!patternfmt || patternfmt[0] == '\0') { return Lvn_Result_Failure; }
 
+    lvn::logFlush();
     logger->logPatternFormat = patternfmt;
 
-    logger->logPatterns = lvn::logParseFormat(patternfmt);
+    lvn::logCompilePatternFormat(logger, patternfmt);
+    lvn::logBinaryWriteLogger(logger);
 
     return Lvn_Result_Success;
 }
@@ -1750,7 +3008,7 @@ LvnResult logAddPatterns(LvnLogPattern* pLogPatterns, uint32_t count)
     if (!pLogPatterns) { return Lvn_Result_Failure; }
     if (pLogPatterns->symbol == '\0') { return Lvn_Result_Failure; }
 
-    for (uint32_t i = 0; i < sizeof(s_LogPatterns) / sizeof(LvnLogPattern); i++)
+    for (uint32_t i = 0; i < sizeof(s_LogPatterns) / sizeof(LvnLogPatternSymbol); i++)
     {
         for (uint32_t j = 0; j < count; j++)
         {
@@ -1764,11 +3022,173 @@ LvnResult logAddPatterns(LvnLogPattern* pLogPatterns, uint32_t count)
     return Lvn_Result_Success;
 }
 
+void logFlush()
+{
+    if (!s_LogAsync.running.load(std::memory_order_acquire))
+    {
+        fflush(nullptr);
+        return;
+    }
+
+    uint64_t target = s_LogAsync.pushed.load(std::memory_order_seq_cst);
+    lvn::logAsyncWake();
+
+    while (s_LogAsync.written.load(std::memory_order_acquire) < target)
+        std::this_thread::yield();
+}
+
+uint64_t logGetDroppedMessageCount()
+{
+    return s_LogAsync.dropped.load(std::memory_order_relaxed);
+}
+
+LvnResult logDecodeBinaryFile(const char* filepath, FILE* output, const char* patternfmt)
+{
+    if (!filepath || !output) { return Lvn_Result_Failure; }
+
+    FILE* fileptr = fopen(filepath, "rb");
+    if (!fileptr)
+    {
+        LVN_CORE_ERROR("logDecodeBinaryFile(const char*, FILE*, const char*) | failed to open binary log file: %s", filepath);
+        return Lvn_Result_Failure;
+    }
+
+    uint8_t header[LVN_LOG_BINARY_HEADER_SIZE], expected[LVN_LOG_BINARY_HEADER_SIZE];
+    lvn::logBinaryGetHeader(expected);
+
+    if (!lvn::logBinaryRead(fileptr, header, LVN_LOG_BINARY_HEADER_SIZE) || memcmp(header, expected, LVN_LOG_BINARY_HEADER_SIZE) != 0)
+    {
+        LVN_CORE_ERROR("logDecodeBinaryFile(const char*, FILE*, const char*) | %s is not a binary log file or was written on a machine with a different architecture", filepath);
+        fclose(fileptr);
+        return Lvn_Result_Failure;
+    }
+
+    fseek(fileptr, 0, SEEK_END);
+    uint64_t fileSize = static_cast<uint64_t>(ftell(fileptr));
+    fseek(fileptr, LVN_LOG_BINARY_HEADER_SIZE, SEEK_SET);
+
+    LvnHashMap<uint32_t, LvnLogger> loggers;
+    LvnHashMap<uint32_t, long long> loggerTimes;
+    LvnHashMap<uint32_t, LvnString> formats;
+    LvnVector<uint8_t> data;
+    LvnString name, text, console, file;
+    LvnResult result = Lvn_Result_Success;
+    bool truncated = false;
+
+    uint8_t type;
+    while (result == Lvn_Result_Success && !truncated && lvn::logBinaryRead(fileptr, &type, sizeof(uint8_t)))
+    {
+        switch (type & 0x0f)
+        {
+            case Lvn_LogBinaryRecord_Logger:
+            {
+                uint32_t id;
+                LvnString pattern;
+                if (!lvn::logBinaryRead(fileptr, &id, sizeof(uint32_t)) || !lvn::logBinaryReadString(fileptr, fileSize, name) || !lvn::logBinaryReadString(fileptr, fileSize, pattern))
+                {
+                    truncated = true;
+                    break;
+                }
+
+                loggerTimes[id] = 0;
+                LvnLogger& logger = loggers[id];
+                logger.loggerName = name;
+                logger.logPatternFormat = patternfmt ? LvnString(patternfmt) : pattern;
+                lvn::logCompilePatternFormat(&logger, logger.logPatternFormat.c_str());
+                break;
+            }
+            case Lvn_LogBinaryRecord_Format:
+            {
+                uint32_t id;
+                if (!lvn::logBinaryRead(fileptr, &id, sizeof(uint32_t)) || !lvn::logBinaryReadString(fileptr, fileSize, formats[id]))
+                    truncated = true;
+
+                break;
+            }
+            case Lvn_LogBinaryRecord_Message:
+            {
+                uint64_t delta, loggerId, formatId, size;
+                if (!lvn::logBinaryReadVarint(fileptr, &delta) || !lvn::logBinaryReadVarint(fileptr, &loggerId) ||
+                    !lvn::logBinaryReadVarint(fileptr, &formatId) || !lvn::logBinaryReadVarint(fileptr, &size))
+                {
+                    truncated = true;
+                    break;
+                }
+
+                LvnLogger* logger = loggers.find(static_cast<uint32_t>(loggerId));
+                const LvnString* fmt = formatId != LVN_LOG_BINARY_TEXT_FORMAT_ID ? formats.find(static_cast<uint32_t>(formatId)) : nullptr;
+                if (logger == nullptr || (formatId != LVN_LOG_BINARY_TEXT_FORMAT_ID && fmt == nullptr))
+                {
+                    LVN_CORE_ERROR("logDecodeBinaryFile(const char*, FILE*, const char*) | message in %s uses a logger or format string that was not defined before it, the file is corrupted", filepath);
+                    result = Lvn_Result_Failure;
+                    break;
+                }
+
+                // packed arguments never take more than the record, message text is only bounded by the rest of the file
+                if (fmt != nullptr && size > LVN_LOG_RECORD_ARG_SIZE)
+                {
+                    LVN_CORE_ERROR("logDecodeBinaryFile(const char*, FILE*, const char*) | message in %s has arguments of size (%llu) larger than a record, the file is corrupted", filepath, (unsigned long long)size);
+                    result = Lvn_Result_Failure;
+                    break;
+                }
+
+                if (!lvn::logBinaryHasBytes(fileptr, fileSize, size)) { truncated = true; break; }
+
+                data.resize(size);
+                if (!lvn::logBinaryRead(fileptr, data.data(), size)) { truncated = true; break; }
+
+                text.clear();
+                if (fmt != nullptr)
+                {
+                    if (!lvn::logUnpackArgs(fmt->c_str(), data.data(), static_cast<uint32_t>(size), text))
+                    {
+                        LVN_CORE_ERROR("logDecodeBinaryFile(const char*, FILE*, const char*) | message in %s has arguments that do not match its format string, the file is corrupted", filepath);
+                        result = Lvn_Result_Failure;
+                        break;
+                    }
+                }
+                else
+                {
+                    text.push_range(reinterpret_cast<const char*>(data.data()), size);
+                }
+
+                long long& timeNs = loggerTimes[static_cast<uint32_t>(loggerId)];
+                timeNs += static_cast<long long>(delta >> 1) ^ -static_cast<long long>(delta & 1);
+
+                LvnLogMessage logMsg{};
+                logMsg.msg = text.c_str();
+                logMsg.loggerName = logger->loggerName.c_str();
+                logMsg.level = static_cast<LvnLogLevel>(type >> 4);
+                logMsg.timeEpoch = timeNs / 1000000000;
+
+                console.clear();
+                file.clear();
+                lvn::logFormatInstructions(logger, &logMsg, console, &file);
+                fwrite(file.c_str(), sizeof(char), file.size(), output);
+                break;
+            }
+            default:
+            {
+                LVN_CORE_ERROR("logDecodeBinaryFile(const char*, FILE*, const char*) | unknown record type (%u) in %s, the file is corrupted", type, filepath);
+                result = Lvn_Result_Failure;
+                break;
+            }
+        }
+    }
+
+    // a run that stopped mid write leaves a partial last record, the messages before it are still decoded
+    if (truncated)
+        LVN_CORE_WARN("logDecodeBinaryFile(const char*, FILE*, const char*) | %s ends with a partial record, the file may have been cut off while it was being written", filepath);
+
+    fclose(fileptr);
+    return result;
+}
+
 LvnResult createLogger(LvnLogger** logger, const LvnLoggerCreateInfo* loggerCreateInfo)
 {
     LvnContext* lvnctx = lvn::getContext();
 
-    *logger = lvn::createObject<LvnLogger>(lvnctx, Lvn_Stype_Logger);
+    *logger = lvn::createObject<LvnLogger>(lvnctx, Lvn_Stype_Logger, LVN_FILE_NAME, LVN_LINE);
     LvnLogger* loggerPtr = *logger;
 
     loggerPtr->loggerName = loggerCreateInfo->loggerName;
@@ -1778,6 +3198,7 @@ LvnResult createLogger(LvnLogger** logger, const LvnLoggerCreateInfo* loggerCrea
     loggerPtr->logfile.logToFile = loggerCreateInfo->fileConfig.enableLogToFile;
     loggerPtr->logfile.filename = loggerCreateInfo->fileConfig.filename;
     loggerPtr->logfile.filemode = loggerCreateInfo->fileConfig.filemode;
+    loggerPtr->logfile.format = loggerCreateInfo->fileConfig.format;
 
     if (loggerPtr->logfile.logToFile)
     {
@@ -1787,14 +3208,13 @@ LvnResult createLogger(LvnLogger** logger, const LvnLoggerCreateInfo* loggerCrea
             return Lvn_Result_Failure;
         }
 
-        const char* filemode = "w";
-        if (loggerPtr->logfile.filemode == Lvn_FileMode_Write) filemode = "w";
-        else if (loggerPtr->logfile.filemode == Lvn_FileMode_Append) filemode = "a";
-
-        loggerPtr->logfile.fileptr = fopen(loggerPtr->logfile.filename.c_str(), filemode);
     }
 
-    loggerPtr->logPatterns = lvn::logParseFormat(loggerCreateInfo->format.c_str());
+    lvn::logCompilePatternFormat(loggerPtr, loggerCreateInfo->format.c_str());
+
+    // opened after the name and pattern are set since a binary file writes them first
+    if (loggerPtr->logfile.logToFile)
+        lvn::logOpenFile(loggerPtr);
 
     LVN_CORE_TRACE("created logger: (%p), name: \"%s\"", *logger, loggerCreateInfo->loggerName.c_str());
     return Lvn_Result_Success;
@@ -1804,6 +3224,9 @@ void destroyLogger(LvnLogger* logger)
 {
     if (logger == nullptr) { return; }
 
+    // the log thread may still hold records pointing to this logger
+    lvn::logFlush();
+
     if (logger->logfile.logToFile)
     {
         fclose(logger->logfile.fileptr);
@@ -2080,7 +3503,7 @@ LvnResult createWindow(LvnWindow** window, const LvnWindowCreateInfo* createInfo
         return Lvn_Result_Failure;
     }
 
-    *window = lvn::createObject<LvnWindow>(lvnctx, Lvn_Stype_Window);
+    *window = lvn::createObject<LvnWindow>(lvnctx, Lvn_Stype_Window, LVN_FILE_NAME, LVN_LINE);
 
     LVN_CORE_TRACE("created window: (%p), \"%s\" (w:%d,h:%d)", *window, createInfo->title.c_str(), createInfo->width, createInfo->height);
     return lvnctx->windowContext.createWindow(*window, createInfo);
@@ -2090,6 +3513,7 @@ void destroyWindow(LvnWindow* window)
 {
     if (window == nullptr) { return; }
     LvnContext* lvnctx = lvn::getContext();
+    if (lvnctx->frameArenaWindow == window) { lvnctx->frameArenaWindow = nullptr; }
     lvnctx->windowContext.destroyWindow(window);
     lvn::destroyObject(lvnctx, window, Lvn_Stype_Window);
 }
@@ -2325,12 +3749,48 @@ LvnClipRegion getRenderClipRegionEnum()
     return lvn::getContext()->matrixClipRegion;
 }
 
+static void renderBeginFrameStats(LvnContext* lvnctx, LvnWindow* window)
+{
+    // the time between two frame begins is the frame time, the first frame has nothing to measure against
+    if (window->frameCount > 0)
+    {
+        window->frameStats.frameTimeMs = window->frameTimer.elapsedms();
+        window->frameTimes[window->frameTimeIndex] = (float)window->frameStats.frameTimeMs;
+        window->frameTimeIndex = (window->frameTimeIndex + 1) % LVN_FRAME_STATS_HISTORY;
+        if (window->frameTimeCount < LVN_FRAME_STATS_HISTORY) { window->frameTimeCount++; }
+    }
+    window->frameTimer.begin();
+
+    window->frameCounters = {};
+    window->frameCounters.bufferUploadBytesBegin = lvnctx->statBufferUploadBytes.load(std::memory_order_relaxed);
+    window->frameCounters.texturesCreatedBegin = lvnctx->statTexturesCreated.load(std::memory_order_relaxed);
+}
+
+static void renderEndFrameStats(LvnContext* lvnctx, LvnWindow* window)
+{
+    const LvnFrameCounters& counters = window->frameCounters;
+    LvnFrameStats& stats = window->frameStats;
+
+    stats.frameIndex = window->frameCount++;
+    stats.commandCount = counters.commandCount;
+    stats.drawCallCount = counters.drawCallCount;
+    stats.pipelineBindCount = counters.pipelineBindCount;
+    stats.descriptorSetBindCount = counters.descriptorSetBindCount;
+    stats.bufferUploadBytes = lvnctx->statBufferUploadBytes.load(std::memory_order_relaxed) - counters.bufferUploadBytesBegin;
+    stats.texturesCreated = (uint32_t)(lvnctx->statTexturesCreated.load(std::memory_order_relaxed) - counters.texturesCreatedBegin);
+    stats.drawListVertexCount = counters.drawListVertexCount;
+    stats.drawListIndexCount = counters.drawListIndexCount;
+    stats.cpuTimeMs = window->frameTimer.elapsedms();
+}
+
 void renderCmdDraw(LvnWindow* window, uint32_t vertexCount)
 {
     int width, height;
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
+    window->frameCounters.drawCallCount++;
     lvn::getContext()->graphicsContext.renderCmdDraw(window, vertexCount);
 }
 
@@ -2340,6 +3800,8 @@ void renderCmdDrawIndexed(LvnWindow* window, uint32_t indexCount)
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
+    window->frameCounters.drawCallCount++;
     lvn::getContext()->graphicsContext.renderCmdDrawIndexed(window, indexCount);
 }
 
@@ -2349,6 +3811,8 @@ void renderCmdDrawInstanced(LvnWindow* window, uint32_t vertexCount, uint32_t in
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
+    window->frameCounters.drawCallCount++;
     lvn::getContext()->graphicsContext.renderCmdDrawInstanced(window, vertexCount, instanceCount, firstInstance);
 }
 
@@ -2358,6 +3822,8 @@ void renderCmdDrawIndexedInstanced(LvnWindow* window, uint32_t indexCount, uint3
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
+    window->frameCounters.drawCallCount++;
     lvn::getContext()->graphicsContext.renderCmdDrawIndexedInstanced(window, indexCount, instanceCount, firstInstance);
 }
 
@@ -2373,11 +3839,22 @@ void renderCmdSetStencilMask(uint32_t compareMask, uint32_t writeMask)
 
 void renderBeginNextFrame(LvnWindow* window)
 {
+    // reset the frame arena once per frame, the first window to begin a frame paces the resets
+    LvnContext* lvnctx = lvn::getContext();
+    if (lvnctx->frameArenaWindow == nullptr) { lvnctx->frameArenaWindow = window; }
+    if (lvnctx->frameArenaWindow == window)
+    {
+        lvn::frameArenaReset();
+        lvn::profileBeginFrame();
+    }
+
     int width, height;
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
-    lvn::getContext()->graphicsContext.renderBeginNextFrame(window);
+    lvn::renderBeginFrameStats(lvnctx, window);
+
+    lvnctx->graphicsContext.renderBeginNextFrame(window);
 }
 
 void renderDrawSubmit(LvnWindow* window)
@@ -2386,7 +3863,43 @@ void renderDrawSubmit(LvnWindow* window)
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
-    lvn::getContext()->graphicsContext.renderDrawSubmit(window);
+    LvnContext* lvnctx = lvn::getContext();
+    lvnctx->graphicsContext.renderDrawSubmit(window);
+
+    lvn::renderEndFrameStats(lvnctx, window);
+
+    if (lvnctx->frameArenaWindow == window)
+        lvn::profileEndFrame();
+}
+
+LvnFrameStats renderGetFrameStats(LvnWindow* window)
+{
+    LvnFrameStats stats = window->frameStats;
+    stats.historyCount = window->frameTimeCount;
+    if (window->frameTimeCount == 0) { return stats; }
+
+    // sort a copy of the history, at most LVN_FRAME_STATS_HISTORY values so insertion sort is enough
+    float times[LVN_FRAME_STATS_HISTORY];
+    uint32_t count = window->frameTimeCount;
+    double total = 0.0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float time = window->frameTimes[i];
+        uint32_t j = i;
+        for (; j > 0 && times[j - 1] > time; j--)
+            times[j] = times[j - 1];
+        times[j] = time;
+        total += time;
+    }
+
+    uint32_t p99Index = (count * 99 + 99) / 100 - 1; // nearest rank, ceil(count * 0.99) - 1
+
+    stats.minFrameTimeMs = times[0];
+    stats.avgFrameTimeMs = total / count;
+    stats.maxFrameTimeMs = times[count - 1];
+    stats.p99FrameTimeMs = times[p99Index];
+
+    return stats;
 }
 
 void renderBeginCommandRecording(LvnWindow* window)
@@ -2400,6 +3913,8 @@ void renderBeginCommandRecording(LvnWindow* window)
 
 void renderEndCommandRecording(LvnWindow* window)
 {
+    LVN_PROFILE_SCOPE("renderEndCommandRecording");
+
     int width, height;
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
@@ -2413,6 +3928,7 @@ void renderCmdBeginRenderPass(LvnWindow* window, float r, float g, float b, floa
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
     lvn::getContext()->graphicsContext.renderCmdBeginRenderPass(window, r, g, b, a);
 }
 
@@ -2422,6 +3938,7 @@ void renderCmdEndRenderPass(LvnWindow* window)
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
     lvn::getContext()->graphicsContext.renderCmdEndRenderPass(window);
 }
 
@@ -2431,6 +3948,8 @@ void renderCmdBindPipeline(LvnWindow* window, LvnPipeline* pipeline)
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
+    window->frameCounters.pipelineBindCount++;
     lvn::getContext()->graphicsContext.renderCmdBindPipeline(window, pipeline);
 }
 
@@ -2440,6 +3959,8 @@ void renderCmdBindVertexBuffer(LvnWindow* window, uint32_t firstBinding, uint32_
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
+
     uint64_t offsets[] = {0};
     lvn::getContext()->graphicsContext.renderCmdBindVertexBuffer(window, firstBinding, bindingCount, pBuffers, pOffsets ? pOffsets : offsets);
 }
@@ -2450,6 +3971,7 @@ void renderCmdBindIndexBuffer(LvnWindow* window, LvnBuffer* buffer, uint64_t off
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
     lvn::getContext()->graphicsContext.renderCmdBindIndexBuffer(window, buffer, offset);
 }
 
@@ -2459,6 +3981,8 @@ void renderCmdBindDescriptorSets(LvnWindow* window, LvnPipeline* pipeline, uint3
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
+    window->frameCounters.descriptorSetBindCount += descriptorSetCount;
     lvn::getContext()->graphicsContext.renderCmdBindDescriptorSets(window, pipeline, firstSetIndex, descriptorSetCount, pDescriptorSets);
 }
 
@@ -2468,6 +3992,7 @@ void renderCmdBeginFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer)
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
     lvn::getContext()->graphicsContext.renderCmdBeginFrameBuffer(window, frameBuffer);
 }
 
@@ -2477,6 +4002,7 @@ void renderCmdEndFrameBuffer(LvnWindow* window, LvnFrameBuffer* frameBuffer)
     lvn::windowGetSize(window, &width, &height);
     if (width * height <= 0) { return; }
 
+    window->frameCounters.commandCount++;
     lvn::getContext()->graphicsContext.renderCmdEndFrameBuffer(window, frameBuffer);
 }
 
@@ -2496,7 +4022,7 @@ LvnResult createShaderFromSrc(LvnShader** shader, const LvnShaderCreateInfo* cre
         return Lvn_Result_Failure;
     }
 
-    *shader = lvn::createObject<LvnShader>(lvnctx, Lvn_Stype_Shader);
+    *shader = lvn::createObject<LvnShader>(lvnctx, Lvn_Stype_Shader, LVN_FILE_NAME, LVN_LINE);
 
     LVN_CORE_TRACE("created shader (from source): (%p)", *shader);
     return lvnctx->graphicsContext.createShaderFromSrc(*shader, createInfo);
@@ -2518,7 +4044,7 @@ LvnResult createShaderFromFileSrc(LvnShader** shader, const LvnShaderCreateInfo*
         return Lvn_Result_Failure;
     }
 
-    *shader = lvn::createObject<LvnShader>(lvnctx, Lvn_Stype_Shader);
+    *shader = lvn::createObject<LvnShader>(lvnctx, Lvn_Stype_Shader, LVN_FILE_NAME, LVN_LINE);
 
     LVN_CORE_TRACE("created shader (from source file): (%p), vertex file: %s, fragment file: %s", *shader, createInfo->vertexSrc.c_str(), createInfo->fragmentSrc.c_str());
     return lvnctx->graphicsContext.createShaderFromFileSrc(*shader, createInfo);
@@ -2540,7 +4066,7 @@ LvnResult createShaderFromFileBin(LvnShader** shader, const LvnShaderCreateInfo*
         return Lvn_Result_Failure;
     }
 
-    *shader = lvn::createObject<LvnShader>(lvnctx, Lvn_Stype_Shader);
+    *shader = lvn::createObject<LvnShader>(lvnctx, Lvn_Stype_Shader, LVN_FILE_NAME, LVN_LINE);
 
     LVN_CORE_TRACE("created shader (from binary file): (%p), vertex file: %s, fragment file: %s", *shader, createInfo->vertexSrc.c_str(), createInfo->fragmentSrc.c_str());
     return lvnctx->graphicsContext.createShaderFromFileBin(*shader, createInfo);
@@ -2571,7 +4097,7 @@ LvnResult createDescriptorLayout(LvnDescriptorLayout** descriptorLayout, const L
             LVN_CORE_WARN("createDescriptorLayout(LvnDescriptorLayout**, LvnDescriptorLayoutCreateInfo*) | createInfo->pDescriptorBindings[%u].descriptorCount is 0, no descriptors will be created for this binding which may not be intentional", i);
     }
 
-    *descriptorLayout = lvn::createObject<LvnDescriptorLayout>(lvnctx, Lvn_Stype_DescriptorLayout);
+    *descriptorLayout = lvn::createObject<LvnDescriptorLayout>(lvnctx, Lvn_Stype_DescriptorLayout, LVN_FILE_NAME, LVN_LINE);
 
     LvnDescriptorLayout* descriptorLayoutPtr = *descriptorLayout;
     descriptorLayoutPtr->descriptorSets.resize(createInfo->maxSets);
@@ -2592,6 +4118,11 @@ LvnResult allocateDescriptorSet(LvnDescriptorSet** descriptorSet, LvnDescriptorL
 }
 
 LvnResult createPipeline(LvnPipeline** pipeline, const LvnPipelineCreateInfo* createInfo)
+{
+    return lvn::createPipeline(pipeline, createInfo, nullptr);
+}
+
+static LvnResult createPipeline(LvnPipeline** pipeline, const LvnPipelineCreateInfo* createInfo, LvnPipeline* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
 
@@ -2628,13 +4159,18 @@ LvnResult createPipeline(LvnPipeline** pipeline, const LvnPipelineCreateInfo* cr
         }
     }
 
-    *pipeline = lvn::createObject<LvnPipeline>(lvnctx, Lvn_Stype_Pipeline);
+    *pipeline = lvn::createObject<LvnPipeline>(lvnctx, Lvn_Stype_Pipeline, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created pipeline: (%p)", *pipeline);
     return lvnctx->graphicsContext.createPipeline(*pipeline, createInfo);
 }
 
 LvnResult createFrameBuffer(LvnFrameBuffer** frameBuffer, const LvnFrameBufferCreateInfo* createInfo)
+{
+    return lvn::createFrameBuffer(frameBuffer, createInfo, nullptr);
+}
+
+static LvnResult createFrameBuffer(LvnFrameBuffer** frameBuffer, const LvnFrameBufferCreateInfo* createInfo, LvnFrameBuffer* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
 
@@ -2669,13 +4205,18 @@ LvnResult createFrameBuffer(LvnFrameBuffer** frameBuffer, const LvnFrameBufferCr
         }
     }
 
-    *frameBuffer = lvn::createObject<LvnFrameBuffer>(lvnctx, Lvn_Stype_FrameBuffer);
+    *frameBuffer = lvn::createObject<LvnFrameBuffer>(lvnctx, Lvn_Stype_FrameBuffer, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created framebuffer: (%p)", *frameBuffer);
     return lvnctx->graphicsContext.createFrameBuffer(*frameBuffer, createInfo);
 }
 
 LvnResult createBuffer(LvnBuffer** buffer, const LvnBufferCreateInfo* createInfo)
+{
+    return lvn::createBuffer(buffer, createInfo, nullptr);
+}
+
+static LvnResult createBuffer(LvnBuffer** buffer, const LvnBufferCreateInfo* createInfo, LvnBuffer* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
 
@@ -2686,27 +4227,87 @@ LvnResult createBuffer(LvnBuffer** buffer, const LvnBufferCreateInfo* createInfo
         return Lvn_Result_Failure;
     }
 
-    *buffer = lvn::createObject<LvnBuffer>(lvnctx, Lvn_Stype_Buffer);
+    *buffer = lvn::createObject<LvnBuffer>(lvnctx, Lvn_Stype_Buffer, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created buffer: (%p)", *buffer);
     return lvnctx->graphicsContext.createBuffer(*buffer, createInfo);
 }
 
 LvnResult createSampler(LvnSampler** sampler, const LvnSamplerCreateInfo* createInfo)
+{
+    return lvn::createSampler(sampler, createInfo, nullptr);
+}
+
+static LvnResult createSampler(LvnSampler** sampler, const LvnSamplerCreateInfo* createInfo, LvnSampler* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
 
-    *sampler = lvn::createObject<LvnSampler>(lvnctx, Lvn_Stype_Sampler);
+    *sampler = lvn::createObject<LvnSampler>(lvnctx, Lvn_Stype_Sampler, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created sampler: (%p)");
     return lvnctx->graphicsContext.createSampler(*sampler, createInfo);
 }
 
 LvnResult createTexture(LvnTexture** texture, const LvnTextureCreateInfo* createInfo)
+{
+    return lvn::createTexture(texture, createInfo, nullptr);
+}
+
+static LvnResult createTexture(LvnTexture** texture, const LvnTextureCreateInfo* createInfo, LvnTexture* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
+    const LvnImageData& imageData = createInfo->imageData;
+
+    if (createInfo->compression != Lvn_TextureCompression_None && imageData.compression != Lvn_TextureCompression_None && createInfo->compression != imageData.compression)
+    {
+        LVN_CORE_ERROR("createTexture(LvnTexture**, LvnTextureCreateInfo*) | createInfo->compression (%u) does not match the block format of createInfo->imageData (%u)", createInfo->compression, imageData.compression);
+        return Lvn_Result_Failure;
+    }
+
+    // images from ktx2/dds files carry their own block format and mip levels, they are used unless the create info sets its own
+    LvnTextureCreateInfo imageCreateInfo;
+    bool useImageCompression = createInfo->compression == Lvn_TextureCompression_None && imageData.compression != Lvn_TextureCompression_None;
+    bool useImageMipLevels = createInfo->pMipLevels == nullptr && createInfo->mipLevelCount == 0 && !imageData.mipLevels.empty();
+    if (useImageCompression || useImageMipLevels)
+    {
+        imageCreateInfo = *createInfo;
+        imageCreateInfo.compression = imageData.compression;
+        if (useImageMipLevels)
+        {
+            imageCreateInfo.pMipLevels = imageData.mipLevels.data();
+            imageCreateInfo.mipLevelCount = imageData.mipLevels.size();
+        }
+        createInfo = &imageCreateInfo;
+    }
+
+    if (createInfo->mipLevelCount > 0 && createInfo->pMipLevels == nullptr)
+    {
+        LVN_CORE_ERROR("createTexture(LvnTexture**, LvnTextureCreateInfo*) | createInfo->pMipLevels is nullptr while createInfo->mipLevelCount is %u, cannot create texture without the mip level data", createInfo->mipLevelCount);
+        return Lvn_Result_Failure;
+    }
+
+    if (createInfo->mipLevelCount > lvn::imageGetMipLevelCount(createInfo->imageData.width, createInfo->imageData.height))
+    {
+        LVN_CORE_ERROR("createTexture(LvnTexture**, LvnTextureCreateInfo*) | createInfo->mipLevelCount is %u, a texture of (w:%u,h:%u) has at most %u mip levels below the full size level", createInfo->mipLevelCount, createInfo->imageData.width, createInfo->imageData.height, lvn::imageGetMipLevelCount(createInfo->imageData.width, createInfo->imageData.height));
+        return Lvn_Result_Failure;
+    }
+
+    // compressed levels are uploaded by their block size, the pixels must hold every block of the level
+    if (createInfo->compression != Lvn_TextureCompression_None)
+    {
+        for (uint32_t level = 0; level <= createInfo->mipLevelCount; level++)
+        {
+            const LvnImageData& levelData = level == 0 ? createInfo->imageData : createInfo->pMipLevels[level - 1];
+            uint64_t levelSize = lvn::imageGetLevelSize(levelData.width, levelData.height, levelData.channels, createInfo->compression);
+            if (levelData.pixels.size() < levelSize)
+            {
+                LVN_CORE_ERROR("createTexture(LvnTexture**, LvnTextureCreateInfo*) | level %u holds %zu bytes, a compressed level of (w:%u,h:%u) needs %llu bytes of blocks", level, levelData.pixels.size(), levelData.width, levelData.height, (unsigned long long)levelSize);
+                return Lvn_Result_Failure;
+            }
+        }
+    }
 
-    *texture = lvn::createObject<LvnTexture>(lvnctx, Lvn_Stype_Texture);
+    *texture = lvn::createObject<LvnTexture>(lvnctx, Lvn_Stype_Texture, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created texture: (%p) using image data: (%p), (w:%u,h:%u,ch:%u), total size: %u bytes",
         *texture,
@@ -2716,14 +4317,45 @@ LvnResult createTexture(LvnTexture** texture, const LvnTextureCreateInfo* create
         createInfo->imageData.channels,
         createInfo->imageData.pixels.memsize());
 
-    return lvnctx->graphicsContext.createTexture(*texture, createInfo);
+    LvnResult result = lvnctx->graphicsContext.createTexture(*texture, createInfo);
+    if (result == Lvn_Result_Success)
+        lvnctx->statTexturesCreated.fetch_add(1, std::memory_order_relaxed);
+
+    return result;
 }
 
 LvnResult createTexture(LvnTexture** texture, const LvnTextureSamplerCreateInfo* createInfo)
+{
+    return lvn::createTexture(texture, createInfo, nullptr);
+}
+
+static LvnResult createTexture(LvnTexture** texture, const LvnTextureSamplerCreateInfo* createInfo, LvnTexture* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
+    const LvnImageData& imageData = createInfo->imageData;
+
+    // images from ktx2/dds files are uploaded with their own block format and mip levels, the same as with LvnTextureCreateInfo
+    if (imageData.mipLevels.size() > lvn::imageGetMipLevelCount(imageData.width, imageData.height))
+    {
+        LVN_CORE_ERROR("createTexture(LvnTexture**, LvnTextureSamplerCreateInfo*) | createInfo->imageData has %zu mip levels, a texture of (w:%u,h:%u) has at most %u mip levels below the full size level", imageData.mipLevels.size(), imageData.width, imageData.height, lvn::imageGetMipLevelCount(imageData.width, imageData.height));
+        return Lvn_Result_Failure;
+    }
+
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        for (uint32_t level = 0; level <= imageData.mipLevels.size(); level++)
+        {
+            const LvnImageData& levelData = level == 0 ? imageData : imageData.mipLevels[level - 1];
+            uint64_t levelSize = lvn::imageGetLevelSize(levelData.width, levelData.height, levelData.channels, imageData.compression);
+            if (levelData.pixels.size() < levelSize)
+            {
+                LVN_CORE_ERROR("createTexture(LvnTexture**, LvnTextureSamplerCreateInfo*) | level %u holds %zu bytes, a compressed level of (w:%u,h:%u) needs %llu bytes of blocks", level, levelData.pixels.size(), levelData.width, levelData.height, (unsigned long long)levelSize);
+                return Lvn_Result_Failure;
+            }
+        }
+    }
 
-    *texture = lvn::createObject<LvnTexture>(lvnctx, Lvn_Stype_Texture);
+    *texture = lvn::createObject<LvnTexture>(lvnctx, Lvn_Stype_Texture, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created texture (seperate sampler): (%p) using image data: (%p), (w:%u,h:%u,ch:%u), total size: %u bytes, sampler object used: (%p)",
         *texture,
@@ -2734,10 +4366,19 @@ LvnResult createTexture(LvnTexture** texture, const LvnTextureSamplerCreateInfo*
         createInfo->imageData.pixels.memsize(),
         createInfo->sampler);
 
-    return lvnctx->graphicsContext.createTextureSampler(*texture, createInfo);
+    LvnResult result = lvnctx->graphicsContext.createTextureSampler(*texture, createInfo);
+    if (result == Lvn_Result_Success)
+        lvnctx->statTexturesCreated.fetch_add(1, std::memory_order_relaxed);
+
+    return result;
 }
 
 LvnResult createCubemap(LvnCubemap** cubemap, const LvnCubemapCreateInfo* createInfo)
+{
+    return lvn::createCubemap(cubemap, createInfo, nullptr);
+}
+
+static LvnResult createCubemap(LvnCubemap** cubemap, const LvnCubemapCreateInfo* createInfo, LvnCubemap* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
 
@@ -2783,13 +4424,18 @@ LvnResult createCubemap(LvnCubemap** cubemap, const LvnCubemapCreateInfo* create
     //  return Lvn_Result_Failure;
     // }
 
-    *cubemap = lvn::createObject<LvnCubemap>(lvnctx, Lvn_Stype_Cubemap);
+    *cubemap = lvn::createObject<LvnCubemap>(lvnctx, Lvn_Stype_Cubemap, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created cubemap: (%p)", *cubemap);
     return lvnctx->graphicsContext.createCubemap(*cubemap, createInfo);
 }
 
-LvnResult createCubemap(LvnCubemap** cubemap, const LvnCubemapHdrCreateInfo* createInfo)
+LvnResult createCubemap(LvnCubemap** cubemap, const LvnCubemapHdrCreateInfo* createInfo)
+{
+    return lvn::createCubemap(cubemap, createInfo, nullptr);
+}
+
+static LvnResult createCubemap(LvnCubemap** cubemap, const LvnCubemapHdrCreateInfo* createInfo, LvnCubemap* storage)
 {
     LvnContext* lvnctx = lvn::getContext();
 
@@ -2799,7 +4445,7 @@ LvnResult createCubemap(LvnCubemap** cubemap, const LvnCubemapHdrCreateInfo* cre
         return Lvn_Result_Failure;
     }
 
-    *cubemap = lvn::createObject<LvnCubemap>(lvnctx, Lvn_Stype_Cubemap);
+    *cubemap = lvn::createObject<LvnCubemap>(lvnctx, Lvn_Stype_Cubemap, LVN_FILE_NAME, LVN_LINE, storage);
 
     LVN_CORE_TRACE("created cubemap (%p) from hdr image (%p)", *cubemap, createInfo->hdr.pixels.data());
     return lvnctx->graphicsContext.createCubemapHdr(*cubemap, createInfo);
@@ -2824,57 +4470,187 @@ void destroyDescriptorLayout(LvnDescriptorLayout* descriptorLayout)
 }
 
 void destroyPipeline(LvnPipeline* pipeline)
+{
+    lvn::destroyPipeline(pipeline, true);
+}
+
+static void destroyPipeline(LvnPipeline* pipeline, bool releaseMemory)
 {
     if (pipeline == nullptr) { return; }
     LvnContext* lvnctx = lvn::getContext();
 
     lvnctx->graphicsContext.destroyPipeline(pipeline);
-    lvn::destroyObject(lvnctx, pipeline, Lvn_Stype_Pipeline);
+    lvn::destroyObject(lvnctx, pipeline, Lvn_Stype_Pipeline, releaseMemory);
 }
 
 void destroyFrameBuffer(LvnFrameBuffer* frameBuffer)
+{
+    lvn::destroyFrameBuffer(frameBuffer, true);
+}
+
+static void destroyFrameBuffer(LvnFrameBuffer* frameBuffer, bool releaseMemory)
 {
     if (frameBuffer == nullptr) { return; }
     LvnContext* lvnctx = lvn::getContext();
 
     lvnctx->graphicsContext.destroyFrameBuffer(frameBuffer);
-    lvn::destroyObject(lvnctx, frameBuffer, Lvn_Stype_FrameBuffer);
+    lvn::destroyObject(lvnctx, frameBuffer, Lvn_Stype_FrameBuffer, releaseMemory);
 }
 
 void destroyBuffer(LvnBuffer* buffer)
+{
+    lvn::destroyBuffer(buffer, true);
+}
+
+static void destroyBuffer(LvnBuffer* buffer, bool releaseMemory)
 {
     if (buffer == nullptr) { return; }
     LvnContext* lvnctx = lvn::getContext();
 
     lvnctx->graphicsContext.destroyBuffer(buffer);
-    lvn::destroyObject(lvnctx, buffer, Lvn_Stype_Buffer);
+    lvn::destroyObject(lvnctx, buffer, Lvn_Stype_Buffer, releaseMemory);
 }
 
 void destroySampler(LvnSampler* sampler)
+{
+    lvn::destroySampler(sampler, true);
+}
+
+static void destroySampler(LvnSampler* sampler, bool releaseMemory)
 {
     if (sampler == nullptr) { return; }
     LvnContext* lvnctx = lvn::getContext();
 
     lvnctx->graphicsContext.destroySampler(sampler);
-    lvn::destroyObject(lvnctx, sampler, Lvn_Stype_Sampler);
+    lvn::destroyObject(lvnctx, sampler, Lvn_Stype_Sampler, releaseMemory);
 }
 
 void destroyTexture(LvnTexture* texture)
+{
+    lvn::destroyTexture(texture, true);
+}
+
+static void destroyTexture(LvnTexture* texture, bool releaseMemory)
 {
     if (texture == nullptr) { return; }
     LvnContext* lvnctx = lvn::getContext();
 
     lvnctx->graphicsContext.destroyTexture(texture);
-    lvn::destroyObject(lvnctx, texture, Lvn_Stype_Texture);
+    lvn::destroyObject(lvnctx, texture, Lvn_Stype_Texture, releaseMemory);
 }
 
 void destroyCubemap(LvnCubemap* cubemap)
+{
+    lvn::destroyCubemap(cubemap, true);
+}
+
+static void destroyCubemap(LvnCubemap* cubemap, bool releaseMemory)
 {
     if (cubemap == nullptr) { return; }
     LvnContext* lvnctx = lvn::getContext();
 
     lvnctx->graphicsContext.destroyCubemap(cubemap);
-    lvn::destroyObject(lvnctx, cubemap, Lvn_Stype_Cubemap);
+    lvn::destroyObject(lvnctx, cubemap, Lvn_Stype_Cubemap, releaseMemory);
+}
+
+LvnResult createPipeline(LvnPipelineHandle* pipeline, const LvnPipelineCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(pipeline, lvn::getContext()->handleTables.pipelines, Lvn_Stype_Pipeline, lvn::createPipeline, createInfo);
+}
+
+LvnResult createFrameBuffer(LvnFrameBufferHandle* frameBuffer, const LvnFrameBufferCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(frameBuffer, lvn::getContext()->handleTables.frameBuffers, Lvn_Stype_FrameBuffer, lvn::createFrameBuffer, createInfo);
+}
+
+LvnResult createBuffer(LvnBufferHandle* buffer, const LvnBufferCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(buffer, lvn::getContext()->handleTables.buffers, Lvn_Stype_Buffer, lvn::createBuffer, createInfo);
+}
+
+LvnResult createSampler(LvnSamplerHandle* sampler, const LvnSamplerCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(sampler, lvn::getContext()->handleTables.samplers, Lvn_Stype_Sampler, lvn::createSampler, createInfo);
+}
+
+LvnResult createTexture(LvnTextureHandle* texture, const LvnTextureCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(texture, lvn::getContext()->handleTables.textures, Lvn_Stype_Texture, lvn::createTexture, createInfo);
+}
+
+LvnResult createTexture(LvnTextureHandle* texture, const LvnTextureSamplerCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(texture, lvn::getContext()->handleTables.textures, Lvn_Stype_Texture, lvn::createTexture, createInfo);
+}
+
+LvnResult createCubemap(LvnCubemapHandle* cubemap, const LvnCubemapCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(cubemap, lvn::getContext()->handleTables.cubemaps, Lvn_Stype_Cubemap, lvn::createCubemap, createInfo);
+}
+
+LvnResult createCubemap(LvnCubemapHandle* cubemap, const LvnCubemapHdrCreateInfo* createInfo)
+{
+    return lvn::createObjectHandle(cubemap, lvn::getContext()->handleTables.cubemaps, Lvn_Stype_Cubemap, lvn::createCubemap, createInfo);
+}
+
+void destroyPipeline(LvnPipelineHandle pipeline)
+{
+    lvn::destroyObjectHandle(pipeline, lvn::getContext()->handleTables.pipelines, Lvn_Stype_Pipeline, lvn::destroyPipeline);
+}
+
+void destroyFrameBuffer(LvnFrameBufferHandle frameBuffer)
+{
+    lvn::destroyObjectHandle(frameBuffer, lvn::getContext()->handleTables.frameBuffers, Lvn_Stype_FrameBuffer, lvn::destroyFrameBuffer);
+}
+
+void destroyBuffer(LvnBufferHandle buffer)
+{
+    lvn::destroyObjectHandle(buffer, lvn::getContext()->handleTables.buffers, Lvn_Stype_Buffer, lvn::destroyBuffer);
+}
+
+void destroySampler(LvnSamplerHandle sampler)
+{
+    lvn::destroyObjectHandle(sampler, lvn::getContext()->handleTables.samplers, Lvn_Stype_Sampler, lvn::destroySampler);
+}
+
+void destroyTexture(LvnTextureHandle texture)
+{
+    lvn::destroyObjectHandle(texture, lvn::getContext()->handleTables.textures, Lvn_Stype_Texture, lvn::destroyTexture);
+}
+
+void destroyCubemap(LvnCubemapHandle cubemap)
+{
+    lvn::destroyObjectHandle(cubemap, lvn::getContext()->handleTables.cubemaps, Lvn_Stype_Cubemap, lvn::destroyCubemap);
+}
+
+LvnPipeline* getPipeline(LvnPipelineHandle pipeline)
+{
+    return lvn::getContext()->handleTables.pipelines.get(pipeline.id);
+}
+
+LvnFrameBuffer* getFrameBuffer(LvnFrameBufferHandle frameBuffer)
+{
+    return lvn::getContext()->handleTables.frameBuffers.get(frameBuffer.id);
+}
+
+LvnBuffer* getBuffer(LvnBufferHandle buffer)
+{
+    return lvn::getContext()->handleTables.buffers.get(buffer.id);
+}
+
+LvnSampler* getSampler(LvnSamplerHandle sampler)
+{
+    return lvn::getContext()->handleTables.samplers.get(sampler.id);
+}
+
+LvnTexture* getTexture(LvnTextureHandle texture)
+{
+    return lvn::getContext()->handleTables.textures.get(texture.id);
+}
+
+LvnCubemap* getCubemap(LvnCubemapHandle cubemap)
+{
+    return lvn::getContext()->handleTables.cubemaps.get(cubemap.id);
 }
 
 uint32_t getAttributeFormatSize(LvnAttributeFormat format)
@@ -3011,7 +4787,9 @@ void bufferUpdateData(LvnBuffer* buffer, void* data, uint64_t size, uint64_t off
         return;
     }
 
-    lvn::getContext()->graphicsContext.bufferUpdateData(buffer, data, size, offset);
+    LvnContext* lvnctx = lvn::getContext();
+    lvnctx->statBufferUploadBytes.fetch_add(size, std::memory_order_relaxed);
+    lvnctx->graphicsContext.bufferUpdateData(buffer, data, size, offset);
 }
 
 void bufferResize(LvnBuffer* buffer, uint64_t size)
@@ -3070,6 +4848,155 @@ LvnDepthImageFormat findSupportedDepthImageFormat(LvnDepthImageFormat* pDepthIma
     return lvn::getContext()->graphicsContext.findSupportedDepthImageFormat(pDepthImageFormats, count);
 }
 
+// decoded pixels are allocated by stb_image with LVN_MALLOC and handed to LvnData as they are, the pixels are never copied
+static void freeStbiImage(void* pixels)
+{
+    stbi_image_free(pixels);
+}
+
+// entries are validated here and not before the jobs are submitted, an invalid entry is left empty without stopping the rest of the batch
+static bool decodeBatchImage(const LvnImageLoadInfo* loadInfo, uint32_t index, LvnVector<uint8_t>& scratch, LvnImageData* imageData)
+{
+    if ((loadInfo->filepath == nullptr) == (loadInfo->data == nullptr))
+    {
+        LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | pLoadInfos[%u] must have either a filepath or data, not both", index);
+        return false;
+    }
+
+    if (loadInfo->data && (loadInfo->size == 0 || loadInfo->size > INT32_MAX))
+    {
+        LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | pLoadInfos[%u].size = %llu, size of image data must be within 1 to INT32_MAX bytes", index, (unsigned long long)loadInfo->size);
+        return false;
+    }
+
+    if (loadInfo->forceChannels < 0 || loadInfo->forceChannels > 4)
+    {
+        LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | pLoadInfos[%u].forceChannels = %d, channels must be within 0 to 4 components (rgba)", index, loadInfo->forceChannels);
+        return false;
+    }
+
+    const uint8_t* data = loadInfo->data;
+    uint64_t size = loadInfo->size;
+
+    // files are read whole into the scratch buffer of the job and decoded from memory
+    if (loadInfo->filepath)
+    {
+        FILE* fileptr = fopen(loadInfo->filepath, "rb");
+        if (!fileptr)
+        {
+            LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | cannot open image file: %s", loadInfo->filepath);
+            return false;
+        }
+
+        fseek(fileptr, 0, SEEK_END);
+        long int fileSize = ftell(fileptr);
+        fseek(fileptr, 0, SEEK_SET);
+
+        if (fileSize <= 0 || fileSize > INT32_MAX)
+        {
+            LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | image file is empty or too large to decode (%ld bytes): %s", fileSize, loadInfo->filepath);
+            fclose(fileptr);
+            return false;
+        }
+
+        if (scratch.size() < (size_t)fileSize)
+            scratch.resize(fileSize);
+
+        size = fread(scratch.data(), sizeof(uint8_t), fileSize, fileptr);
+        fclose(fileptr);
+        data = scratch.data();
+    }
+
+    // ktx2 and dds files are not decoded, the file is copied out of the scratch buffer (or the memory of the caller) and the levels point into it
+    if (lvn::isTextureContainer(data, size))
+    {
+        if (!lvn::loadTextureContainer(LvnBin(data, size), imageData))
+        {
+            LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | failed to load texture container %s", loadInfo->filepath ? loadInfo->filepath : "<memory>");
+            return false;
+        }
+        return true;
+    }
+
+    stbi_set_flip_vertically_on_load_thread(loadInfo->flipVertically);
+    int imageWidth, imageHeight, imageChannels;
+    stbi_uc* pixels = stbi_load_from_memory(data, (int)size, &imageWidth, &imageHeight, &imageChannels, loadInfo->forceChannels);
+
+    if (!pixels)
+    {
+        LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | failed to decode image %s (%s)", loadInfo->filepath ? loadInfo->filepath : "<memory>", stbi_failure_reason());
+        return false;
+    }
+
+    imageData->width = imageWidth;
+    imageData->height = imageHeight;
+    imageData->channels = loadInfo->forceChannels ? loadInfo->forceChannels : imageChannels;
+    imageData->size = (uint64_t)imageData->width * imageData->height * imageData->channels;
+    imageData->pixels = LvnData<uint8_t>::from_owned(pixels, imageData->size, lvn::freeStbiImage, pixels);
+
+    return true;
+}
+
+static void imageBatchDecodeJob(void* data)
+{
+    LvnImageBatchWorker* worker = static_cast<LvnImageBatchWorker*>(data);
+    LvnImageBatch* batch = worker->batch;
+
+    // images are claimed until none are left, so at most one image per job is decoded at any time
+    for (uint32_t i = batch->next.fetch_add(1, std::memory_order_relaxed); i < batch->count; i = batch->next.fetch_add(1, std::memory_order_relaxed))
+    {
+        LVN_PROFILE_SCOPE("loadImagesBatch decode");
+
+        if (!lvn::decodeBatchImage(&batch->pLoadInfos[i], i, worker->scratch, &batch->pImages[i]))
+        {
+            batch->pImages[i] = {};
+            batch->failCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+LvnResult loadImagesBatch(const LvnImageLoadInfo* pLoadInfos, uint32_t count, LvnImageData* pImages, uint32_t maxConcurrency)
+{
+    if (pLoadInfos == nullptr || pImages == nullptr)
+    {
+        LVN_CORE_ERROR("loadImagesBatch(const LvnImageLoadInfo*, uint32_t, LvnImageData*, uint32_t) | pLoadInfos and pImages must not be nullptr");
+        return Lvn_Result_Failure;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+        pImages[i] = {};
+
+    if (count == 0) { return Lvn_Result_Success; }
+
+    uint32_t jobCount = maxConcurrency ? maxConcurrency : lvn::jobGetWorkerCount();
+    jobCount = lvn::min(jobCount, count);
+
+    LvnImageBatch batch;
+    batch.pLoadInfos = pLoadInfos;
+    batch.pImages = pImages;
+    batch.count = count;
+    batch.next.store(0, std::memory_order_relaxed);
+    batch.failCount.store(0, std::memory_order_relaxed);
+
+    LvnVector<LvnImageBatchWorker> workers(jobCount);
+    LvnVector<LvnJob> jobs(jobCount);
+    for (uint32_t i = 0; i < jobCount; i++)
+    {
+        workers[i].batch = &batch;
+        jobs[i].func = lvn::imageBatchDecodeJob;
+        jobs[i].data = &workers[i];
+    }
+
+    LvnJobCounter counter;
+    lvn::jobSubmit(jobs.data(), jobCount, &counter);
+    lvn::jobWait(&counter);
+
+    uint32_t failCount = batch.failCount.load(std::memory_order_relaxed);
+    LVN_CORE_TRACE("loaded image batch, %u images decoded by %u jobs, %u failed", count - failCount, jobCount, failCount);
+
+    return failCount == 0 ? Lvn_Result_Success : Lvn_Result_Failure;
+}
+
 LvnImageData loadImageData(const char* filepath, int forceChannels, bool flipVertically)
 {
     if (filepath == nullptr)
@@ -3089,9 +5016,30 @@ LvnImageData loadImageData(const char* filepath, int forceChannels, bool flipVer
         return {};
     }
 
-    stbi_set_flip_vertically_on_load(flipVertically);
+    // the file is mapped once, ktx2 and dds files are returned as slices of the mapping and other files are decoded from it
+    const LvnBin file = lvn::mapFile(filepath);
+    if (lvn::isTextureContainer(file.data(), file.size()))
+    {
+        LvnImageData imageData{};
+        if (!lvn::loadTextureContainer(file, &imageData))
+        {
+            LVN_CORE_ERROR("loadImageData(const char*, int, bool) | failed to load texture container file: %s", filepath);
+            return {};
+        }
+
+        LVN_CORE_TRACE("loaded texture container (w:%u,h:%u,ch:%u), compression: %u, mip levels: %u, filepath: %s", imageData.width, imageData.height, imageData.channels, imageData.compression, (uint32_t)imageData.mipLevels.size(), filepath);
+        return imageData;
+    }
+
+    if (file.empty() || file.size() > INT32_MAX)
+    {
+        LVN_CORE_ERROR("loadImageData(const char*, int, bool) | failed to load image pixel data from file: %s", filepath);
+        return {};
+    }
+
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
     int imageWidth, imageHeight, imageChannels;
-    stbi_uc* pixels = stbi_load(filepath, &imageWidth, &imageHeight, &imageChannels, forceChannels);
+    stbi_uc* pixels = stbi_load_from_memory(file.data(), (int)file.size(), &imageWidth, &imageHeight, &imageChannels, forceChannels);
 
     if (!pixels)
     {
@@ -3104,12 +5052,10 @@ LvnImageData loadImageData(const char* filepath, int forceChannels, bool flipVer
     imageData.height = imageHeight;
     imageData.channels = forceChannels ? forceChannels : imageChannels;
     imageData.size = imageData.width * imageData.height * imageData.channels;
-    imageData.pixels = LvnData<uint8_t>(pixels, imageData.size);
+    imageData.pixels = LvnData<uint8_t>::from_owned(pixels, imageData.size, lvn::freeStbiImage, pixels);
 
     LVN_CORE_TRACE("loaded image data <unsigned char*> (%p), (w:%u,h:%u,ch:%u), total memory size: %u bytes, filepath: %s", pixels, imageData.width, imageData.height, imageData.channels, imageData.size, filepath);
 
-    stbi_image_free(pixels);
-
     return imageData;
 }
 
@@ -3132,7 +5078,19 @@ LvnImageData loadImageDataMemory(const uint8_t* data, int length, int forceChann
         return {};
     }
 
-    stbi_set_flip_vertically_on_load(flipVertically);
+    // ktx2 and dds data is copied once since the memory belongs to the caller, the levels point into the copy
+    if (lvn::isTextureContainer(data, length > 0 ? length : 0))
+    {
+        LvnImageData imageData{};
+        if (!lvn::loadTextureContainer(LvnBin(data, length), &imageData))
+        {
+            LVN_CORE_ERROR("loadImageDataMemory(const unsigned char*, int, int, bool) | failed to load texture container from memory: %p", data);
+            return {};
+        }
+        return imageData;
+    }
+
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
     int imageWidth, imageHeight, imageChannels;
     stbi_uc* pixels = stbi_load_from_memory(data, length, &imageWidth, &imageHeight, &imageChannels, forceChannels);
 
@@ -3147,12 +5105,10 @@ LvnImageData loadImageDataMemory(const uint8_t* data, int length, int forceChann
     imageData.height = imageHeight;
     imageData.channels = forceChannels ? forceChannels : imageChannels;
     imageData.size = imageData.width * imageData.height * imageData.channels;
-    imageData.pixels = LvnData<uint8_t>(pixels, imageData.size);
+    imageData.pixels = LvnData<uint8_t>::from_owned(pixels, imageData.size, lvn::freeStbiImage, pixels);
 
     LVN_CORE_TRACE("loaded image data from memory <unsigned char*> (%p), (w:%u,h:%u,ch:%u), total memory size: %u bytes", pixels, imageData.width, imageData.height, imageData.channels, imageData.size);
 
-    stbi_image_free(pixels);
-
     return imageData;
 }
 
@@ -3175,9 +5131,30 @@ LvnImageData loadImageDataThread(const LvnString filepath, int forceChannels, bo
         return {};
     }
 
+    // the file is mapped once, ktx2 and dds files are returned as slices of the mapping and other files are decoded from it
+    const LvnBin file = lvn::mapFile(filepath.c_str());
+    if (lvn::isTextureContainer(file.data(), file.size()))
+    {
+        LvnImageData imageData{};
+        if (!lvn::loadTextureContainer(file, &imageData))
+        {
+            LVN_CORE_ERROR("loadImageDataThread(const char*, int, bool) | failed to load texture container file: %s", filepath.c_str());
+            return {};
+        }
+
+        LVN_CORE_TRACE("loaded texture container (w:%u,h:%u,ch:%u), compression: %u, mip levels: %u, filepath: %s", imageData.width, imageData.height, imageData.channels, imageData.compression, (uint32_t)imageData.mipLevels.size(), filepath.c_str());
+        return imageData;
+    }
+
+    if (file.empty() || file.size() > INT32_MAX)
+    {
+        LVN_CORE_ERROR("loadImageDataThread(const char*, int, bool) | failed to load image pixel data from file: %s", filepath.c_str());
+        return {};
+    }
+
     stbi_set_flip_vertically_on_load_thread(flipVertically);
     int imageWidth, imageHeight, imageChannels;
-    stbi_uc* pixels = stbi_load(filepath.c_str(), &imageWidth, &imageHeight, &imageChannels, forceChannels);
+    stbi_uc* pixels = stbi_load_from_memory(file.data(), (int)file.size(), &imageWidth, &imageHeight, &imageChannels, forceChannels);
 
     if (!pixels)
     {
@@ -3190,12 +5167,10 @@ LvnImageData loadImageDataThread(const LvnString filepath, int forceChannels, bo
     imageData.height = imageHeight;
     imageData.channels = forceChannels ? forceChannels : imageChannels;
     imageData.size = imageData.width * imageData.height * imageData.channels;
-    imageData.pixels = LvnData<uint8_t>(pixels, imageData.size);
+    imageData.pixels = LvnData<uint8_t>::from_owned(pixels, imageData.size, lvn::freeStbiImage, pixels);
 
     LVN_CORE_TRACE("loaded image data <unsigned char*> (%p), (w:%u,h:%u,ch:%u), total memory size: %u bytes, filepath: %s", pixels, imageData.width, imageData.height, imageData.channels, imageData.size, filepath.c_str());
 
-    stbi_image_free(pixels);
-
     return imageData;
 }
 
@@ -3218,6 +5193,18 @@ LvnImageData loadImageDataMemoryThread(const uint8_t* data, int length, int forc
         return {};
     }
 
+    // ktx2 and dds data is copied once since the memory belongs to the caller, the levels point into the copy
+    if (lvn::isTextureContainer(data, length > 0 ? length : 0))
+    {
+        LvnImageData imageData{};
+        if (!lvn::loadTextureContainer(LvnBin(data, length), &imageData))
+        {
+            LVN_CORE_ERROR("loadImageDataMemoryThread(const unsigned char*, int, int, bool) | failed to load texture container from memory: %p", data);
+            return {};
+        }
+        return imageData;
+    }
+
     stbi_set_flip_vertically_on_load_thread(flipVertically);
     int imageWidth, imageHeight, imageChannels;
     stbi_uc* pixels = stbi_load_from_memory(data, length, &imageWidth, &imageHeight, &imageChannels, forceChannels);
@@ -3233,12 +5220,10 @@ LvnImageData loadImageDataMemoryThread(const uint8_t* data, int length, int forc
     imageData.height = imageHeight;
     imageData.channels = forceChannels ? forceChannels : imageChannels;
     imageData.size = imageData.width * imageData.height * imageData.channels;
-    imageData.pixels = LvnData<uint8_t>(pixels, imageData.size);
+    imageData.pixels = LvnData<uint8_t>::from_owned(pixels, imageData.size, lvn::freeStbiImage, pixels);
 
     LVN_CORE_TRACE("loaded image data from memory <unsigned char*> (%p), (w:%u,h:%u,ch:%u), total memory size: %u bytes", pixels, imageData.width, imageData.height, imageData.channels, imageData.size);
 
-    stbi_image_free(pixels);
-
     return imageData;
 }
 
@@ -3261,7 +5246,7 @@ LvnImageHdrData loadHdrImageData(const char* filepath, int forceChannels, bool f
         return {};
     }
 
-    stbi_set_flip_vertically_on_load(flipVertically);
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
     int imageWidth, imageHeight, imageChannels;
     float* pixels = stbi_loadf(filepath, &imageWidth, &imageHeight, &imageChannels, forceChannels);
 
@@ -3276,12 +5261,10 @@ LvnImageHdrData loadHdrImageData(const char* filepath, int forceChannels, bool f
     imageData.height = imageHeight;
     imageData.channels = forceChannels ? forceChannels : imageChannels;
     imageData.size = imageData.width * imageData.height * imageData.channels;
-    imageData.pixels = LvnData<float>(pixels, imageData.size);
+    imageData.pixels = LvnData<float>::from_owned(pixels, imageData.size, lvn::freeStbiImage, pixels);
 
     LVN_CORE_TRACE("loaded hdr image data <float*> (%p), (w:%u,h:%u,ch:%u), total memory size: %u bytes, filepath: %s", pixels, imageData.width, imageData.height, imageData.channels, imageData.size, filepath);
 
-    stbi_image_free(pixels);
-
     return imageData;
 }
 
@@ -3304,96 +5287,6 @@ LvnResult writeImageBmp(const LvnImageData& imageData, const char* filename)
     return result ? Lvn_Result_Success : Lvn_Result_Failure;
 }
 
-void imageFlipVertically(LvnImageData& imageData)
-{
-    uint8_t* data = imageData.pixels.data();
-    uint32_t rowSize = imageData.width * imageData.channels;
-    LvnVector<uint8_t> tempRow(rowSize);
-
-    for (uint32_t y = 0; y < imageData.height / 2; y++)
-    {
-        uint8_t* rowTop = data + y * rowSize;
-        uint8_t* rowBottom = data + (imageData.height - y - 1) * rowSize;
-
-        memcpy(tempRow.data(), rowTop, rowSize);
-        memcpy(rowTop, rowBottom, rowSize);
-        memcpy(rowBottom, tempRow.data(), rowSize);
-    }
-}
-
-void imageFlipHorizontally(LvnImageData& imageData)
-{
-    uint8_t* data = imageData.pixels.data();
-
-    for (uint32_t y = 0; y < imageData.height; y++)
-    {
-        uint8_t* row = data + y * imageData.width * imageData.channels;
-
-        for (uint32_t x = 0; x < imageData.width / 2; x++)
-        {
-            uint8_t* leftpx = row + x * imageData.channels;
-            uint8_t* rightpx = row + (imageData.width - x - 1) * imageData.channels;
-
-            for (uint32_t c = 0; c < imageData.channels; c++)
-                lvn::swap(leftpx[c], rightpx[c]);
-        }
-    }
-}
-
-void imageRotateCW(LvnImageData& imageData)
-{
-    uint8_t* data = imageData.pixels.data();
-    uint32_t newWidth = imageData.height;
-    uint32_t newHeight = imageData.width;
-
-    LvnVector<uint8_t> rotated(newWidth * newHeight * imageData.channels);
-
-    for (uint32_t y = 0; y < imageData.height; y++)
-    {
-        for (uint32_t x = 0; x < imageData.width; x++)
-        {
-            for (uint32_t c = 0; c < imageData.channels; c++)
-            {
-                uint32_t srcIndex = (y * imageData.width + x) * imageData.channels + c;
-                uint32_t dstx = imageData.height - 1 - y;
-                uint32_t dsty = x;
-                uint32_t dstIndex = (dsty * newWidth + dstx) * imageData.channels + c;
-                rotated[dstIndex] = data[srcIndex];
-            }
-        }
-    }
-
-    imageData.pixels = lvn::move(LvnData<uint8_t>(rotated.data(), rotated.size()));
-    lvn::swap(imageData.width, imageData.height);
-}
-
-void imageRotateCCW(LvnImageData& imageData)
-{
-    uint8_t* data = imageData.pixels.data();
-    uint32_t newWidth = imageData.height;
-    uint32_t newHeight = imageData.width;
-
-    LvnVector<uint8_t> rotated(newWidth * newHeight * imageData.channels);
-
-    for (uint32_t y = 0; y < imageData.height; y++)
-    {
-        for (uint32_t x = 0; x < imageData.width; x++)
-        {
-            for (uint32_t c = 0; c < imageData.channels; c++)
-            {
-                uint32_t srcIndex = (y * imageData.width + x) * imageData.channels + c;
-                uint32_t dstx = y;
-                uint32_t dsty = imageData.width - 1 - x;
-                uint32_t dstIndex = (dsty * newWidth + dstx) * imageData.channels + c;
-                rotated[dstIndex] = data[srcIndex];
-            }
-        }
-    }
-
-    imageData.pixels = lvn::move(LvnData<uint8_t>(rotated.data(), rotated.size()));
-    lvn::swap(imageData.width, imageData.height);
-}
-
 LvnImageData imageGenWhiteNoise(uint32_t width, uint32_t height, uint32_t channels)
 {
     return lvn::imageGenWhiteNoise(width, height, channels, time(0));
@@ -3462,28 +5355,68 @@ LvnImageData imageGenGrayScaleNoise(uint32_t width, uint32_t height, uint32_t ch
     return imageData;
 }
 
-LvnModel loadModel(const char* filepath)
+LvnModelData* loadModelData(const char* filepath)
 {
-    LvnString filepathstr(filepath);
-    LvnString extensionType = filepathstr.substr(filepathstr.find_last_of(".") + 1);
+    LvnStringView filepathView(filepath);
+    LvnStringView extensionType = filepathView.substr(filepathView.rfind('.') + 1);
 
     if (extensionType == "gltf")
     {
-        return lvn::loadGltfModel(filepath);
+        return lvn::loadGltfModelData(filepath);
     }
     else if (extensionType == "glb")
     {
-        return lvn::loadGlbModel(filepath);
+        return lvn::loadGlbModelData(filepath);
     }
     else if (extensionType == "obj")
     {
-        return lvn::loadObjModel(filepath);
+        return lvn::loadObjModelData(filepath);
+    }
+
+    LVN_CORE_WARN("loadModel(const char*) | could not load model, file extension type not recognized (%.*s), Filepath: %s", (int)extensionType.size(), extensionType.data(), filepath);
+    return nullptr;
+}
+
+LvnModel createModelFromData(LvnModelData* modelData)
+{
+    switch (modelData->type)
+    {
+        case Lvn_ModelDataType_Gltf: { return lvn::createGltfModel(modelData); }
+        case Lvn_ModelDataType_Obj: { return lvn::createObjModel(modelData); }
     }
 
-    LVN_CORE_WARN("loadModel(const char*) | could not load model, file extension type not recognized (%s), Filepath: %s", extensionType.c_str(), filepath);
+    LVN_CORE_ASSERT(false, "unknown model data type");
     return {};
 }
 
+void freeModelData(LvnModelData* modelData)
+{
+    switch (modelData->type)
+    {
+        case Lvn_ModelDataType_Gltf: { lvn::freeGltfModelData(modelData); break; }
+        case Lvn_ModelDataType_Obj: { lvn::freeObjModelData(modelData); break; }
+    }
+}
+
+void getModelBakeData(LvnModelData* modelData, LvnModelBakeData* bakeData)
+{
+    switch (modelData->type)
+    {
+        case Lvn_ModelDataType_Gltf: { lvn::getGltfModelBakeData(modelData, bakeData); break; }
+        case Lvn_ModelDataType_Obj: { lvn::getObjModelBakeData(modelData, bakeData); break; }
+    }
+}
+
+LvnModel loadModel(const char* filepath)
+{
+    LVN_PROFILE_SCOPE("loadModel");
+
+    LvnModelData* modelData = lvn::loadModelData(filepath);
+    if (modelData == nullptr) { return {}; }
+
+    return lvn::createModelFromData(modelData);
+}
+
 void unloadModel(LvnModel* model)
 {
     for (uint32_t i = 0; i < model->samplers.size(); i++)
@@ -3630,7 +5563,7 @@ LvnResult createSound(LvnSound** sound, const LvnSoundCreateInfo* createInfo)
         return Lvn_Result_Failure;
     }
 
-    *sound = lvn::createObject<LvnSound>(lvnctx, Lvn_Stype_Sound);
+    *sound = lvn::createObject<LvnSound>(lvnctx, Lvn_Stype_Sound, LVN_FILE_NAME, LVN_LINE);
 
     LvnSound* soundPtr = *sound;
     soundPtr->volume = createInfo->volume;
@@ -3946,7 +5879,7 @@ LvnResult createSocket(LvnSocket** socket, const LvnSocketCreateInfo* createInfo
 {
     LvnContext* lvnctx = lvn::getContext();
 
-    *socket = lvn::createObject<LvnSocket>(lvnctx, Lvn_Stype_Socket);
+    *socket = lvn::createObject<LvnSocket>(lvnctx, Lvn_Stype_Socket, LVN_FILE_NAME, LVN_LINE);
     LvnSocket* socketPtr = *socket;
 
     ENetAddress address;
@@ -3,6 +3,9 @@
 
 #include "levikno.h"
 
+#include <atomic>
+#include <mutex>
+
 
 // ------------------------------------------------------------
 // Layout: levikno_internal.h
@@ -66,7 +69,7 @@ public:
         LvnLNode<T>* node = other.m_Head;
         if (node)
         {
-            m_Head = lvn::memNew<LvnLNode<T>>();
+            m_Head = LVN_MEM_NEW(LvnLNode<T>, 1);
             m_Head->value = node->value;
             m_Head->next = nullptr;
             m_Head->prev = nullptr;
@@ -75,7 +78,7 @@ public:
         node = node->next;
         while (node != nullptr)
         {
-            m_Tail->next = lvn::memNew<LvnLNode<T>>();
+            m_Tail->next = LVN_MEM_NEW(LvnLNode<T>, 1);
             m_Tail->next->value = node->value;
             m_Tail->next->prev = m_Tail;
             m_Tail = m_Tail->next;
@@ -100,7 +103,7 @@ public:
         LvnLNode<T>* node = other.m_Head;
         if (node)
         {
-            m_Head = lvn::memNew<LvnLNode<T>>();
+            m_Head = LVN_MEM_NEW(LvnLNode<T>, 1);
             m_Head->value = node->value;
             m_Head->next = nullptr;
             m_Head->prev = nullptr;
@@ -109,7 +112,7 @@ public:
         node = node->next;
         while (node != nullptr)
         {
-            m_Tail->next = lvn::memNew<LvnLNode<T>*>();
+            m_Tail->next = LVN_MEM_NEW(LvnLNode<T>*, 1);
             m_Tail->next->value = node->value;
             m_Tail->next->prev = m_Tail;
             m_Tail = m_Tail->next;
@@ -174,7 +177,7 @@ public:
         LvnLNode<T>* node = m_Head;
         for (uint32_t i = 0; i < index; i++)
             node = node->next;
-        node->prev->next = lvn::memNew<LvnLNode<T>>();
+        node->prev->next = LVN_MEM_NEW(LvnLNode<T>, 1);
         node->prev->next->value = value;
         node->prev->next->prev = node->prev;
         node->prev->next->next = node;
@@ -185,7 +188,7 @@ public:
     {
         if (!m_Size)
         {
-            m_Head = lvn::memNew<LvnLNode<T>>();
+            m_Head = LVN_MEM_NEW(LvnLNode<T>, 1);
             m_Head->value = data;
             m_Head->next = nullptr;
             m_Head->prev = nullptr;
@@ -195,7 +198,7 @@ public:
         }
 
         LvnLNode<T>* node = m_Tail;
-        node->next = lvn::memNew<LvnLNode<T>>();
+        node->next = LVN_MEM_NEW(LvnLNode<T>, 1);
         m_Tail = node->next;
         m_Tail->value = data;
         m_Tail->prev = node;
@@ -205,14 +208,14 @@ public:
     {
         if (!m_Size)
         {
-            m_Head = lvn::memNew<LvnLNode<T>>();
+            m_Head = LVN_MEM_NEW(LvnLNode<T>, 1);
             m_Head->value = data;
             m_Tail = m_Head;
             m_Size++;
             return;
         }
 
-        LvnLNode<T>* node = lvn::memNew<LvnLNode<T>>();
+        LvnLNode<T>* node = LVN_MEM_NEW(LvnLNode<T>, 1);
         node->value = data;
         node->next = m_Head;
         m_Head->prev = node;
@@ -303,80 +306,404 @@ public:
     uint64_t size() { return m_Size; }
 };
 
+// LvnMemoryBinding
+// - memory pool of objects for one sType, objects are first handed out from the free list then bumped from the newest memory block
+// - freed objects store the next free list pointer within their own memory, allocating and freeing are O(1) and never allocate
+// - a new memory block is allocated once the base memory and every block for the sType is used up
+struct LvnMemoryPoolNode
+{
+    LvnMemoryPoolNode* next;
+};
+
 class LvnMemoryBinding
 {
 private:
-    void* m_Data;
-    uint64_t m_ObjSize, m_Size, m_Capacity;
-    LvnQueue<void*> m_Available;
+    LvnMemoryPoolNode* m_FreeList;     /* objects that were freed and can be reused */
+    uint8_t* m_Next;                   /* next object in the current memory block that has never been handed out */
+    uint8_t* m_End;
+    uint64_t m_ObjSize;                /* size of each object, rounded up to keep objects aligned */
+    uint64_t m_BlockCount;             /* number of objects allocated for each new memory block */
+    LvnVector<void*> m_Blocks;         /* memory blocks allocated after the base memory was used up */
+    LvnMutex m_Mutex;
+    bool m_ThreadSafe;
+
+    void new_block()
+    {
+        uint64_t memsize = m_ObjSize * m_BlockCount;
+        void* block = LVN_MALLOC(memsize);
 
-    LvnMemoryBinding* m_Next;
+        m_Blocks.push_back(block);
+        m_Next = static_cast<uint8_t*>(block);
+        m_End = m_Next + memsize;
+    }
 
 public:
-    LvnMemoryBinding() : m_Data(nullptr), m_ObjSize(0), m_Size(0), m_Capacity(0), m_Next(nullptr) {}
-    LvnMemoryBinding(void* data, uint64_t objSize, uint64_t count) : m_Data(data), m_ObjSize(objSize), m_Size(0), m_Capacity(count), m_Next(nullptr) {}
+    static uint64_t aligned_object_size(uint64_t size)
+    {
+        if (size < sizeof(LvnMemoryPoolNode)) size = sizeof(LvnMemoryPoolNode);
+        return (size + alignof(max_align_t) - 1) & ~(static_cast<uint64_t>(alignof(max_align_t)) - 1);
+    }
 
-    void                 set_next_memory_binding(LvnMemoryBinding* next) { m_Next = next; }
-    LvnMemoryBinding*    get_next_memory_binding() { return m_Next; }
-    bool                 full() { return m_Size == m_Capacity && m_Available.empty(); }
+    LvnMemoryBinding()
+        : m_FreeList(nullptr), m_Next(nullptr), m_End(nullptr), m_ObjSize(0), m_BlockCount(0), m_ThreadSafe(false) {}
+    ~LvnMemoryBinding() { release(); }
 
-    LvnMemoryBinding* find_empty_memory_binding()
+    LvnMemoryBinding(const LvnMemoryBinding&) = delete;
+    LvnMemoryBinding& operator=(const LvnMemoryBinding&) = delete;
+
+    // data points to the objects within the base memory block, objSize must already be aligned with aligned_object_size
+    void init(void* data, uint64_t objSize, uint64_t count, uint64_t blockCount, bool threadSafe)
     {
-        if (!LvnMemoryBinding::full()) { return this; }
+        m_FreeList = nullptr;
+        m_Next = static_cast<uint8_t*>(data);
+        m_End = m_Next + objSize * count;
+        m_ObjSize = objSize;
+        m_BlockCount = blockCount;
+        m_ThreadSafe = threadSafe;
+    }
 
-        if (m_Next != nullptr)
-            return m_Next->find_empty_memory_binding();
+    // frees the memory blocks, called when the context is terminated so the blocks are not counted as remaining allocations
+    void release()
+    {
+        for (uint64_t i = 0; i < m_Blocks.size(); i++)
+            LVN_FREE(m_Blocks[i]);
 
-        return nullptr;
+        m_Blocks.clear_free();
+        m_FreeList = nullptr;
+        m_Next = m_End = nullptr;
     }
 
     void* take_next()
     {
-        if (!m_Available.empty())
+        if (m_ThreadSafe) m_Mutex.lock();
+
+        void* obj;
+        if (m_FreeList != nullptr)
         {
-            void* value = m_Available.front();
-            m_Available.pop();
-            return value;
+            obj = m_FreeList;
+            m_FreeList = m_FreeList->next;
         }
-
-        if (m_Size == m_Capacity) // current memory block is full, get next memory block
+        else
         {
-            LVN_CORE_ASSERT(m_Next != nullptr, "cannot take next memory index, next memory binding not set");
-            return m_Next->take_next();
+            if (m_Next == m_End)
+                new_block();
+
+            obj = m_Next;
+            m_Next += m_ObjSize;
         }
 
-        uint64_t index = m_Size;
-        m_Size++;
-        return &static_cast<uint8_t*>(m_Data)[index * m_ObjSize];
+        if (m_ThreadSafe) m_Mutex.unlock();
+        return obj;
     }
 
-    void push_back(void* value)
+    void push_back(void* obj)
     {
-        LVN_CORE_ASSERT(value != nullptr, "value is nullptr when pushing back into memory binding queue");
+        LVN_CORE_ASSERT(obj != nullptr, "object is nullptr when pushing back into memory binding free list");
+
+        if (m_ThreadSafe) m_Mutex.lock();
 
-        m_Available.push(value);
+        LvnMemoryPoolNode* node = static_cast<LvnMemoryPoolNode*>(obj);
+        node->next = m_FreeList;
+        m_FreeList = node;
+
+        if (m_ThreadSafe) m_Mutex.unlock();
     }
 };
 
 struct LvnMemoryPool
 {
     LvnMemoryBlock baseMemoryBlock;
-    LvnVector<LvnList<LvnMemoryBlock>> memBlocks;
-    LvnVector<LvnList<LvnMemoryBinding>> memBindings;
+    LvnMemoryBinding memBindings[Lvn_Stype_Max_Value];
+};
+
+// LvnHandleTable
+// - maps generational handles to pointers of objects, handle ids hold the slot index in the lower 32 bits and the generation in the upper 32 bits
+// - a slot's generation is incremented when its object is removed so any handles still pointing to the slot become stale
+// - live objects are kept packed in a dense array for iterating, removing swaps the last object into the removed object's place
+class LvnHandleTable
+{
+private:
+    struct Slot
+    {
+        uint32_t generation;
+        uint32_t index;          /* index into the dense arrays when in use, next free slot when not in use */
+    };
+
+    static constexpr uint32_t s_NullIndex = UINT32_MAX;
+
+    LvnVector<Slot> m_Slots;
+    LvnVector<void*> m_Objects;          /* dense array of live objects */
+    LvnVector<uint32_t> m_ObjectSlots;   /* slot index of each object in the dense array */
+    uint32_t m_FreeSlot;                 /* head of the free slot list */
+
+    template <typename T>
+    static void grow(LvnVector<T>& vec) { if (vec.size() == vec.capacity()) vec.reserve(vec.capacity() ? vec.capacity() * 2 : 64); }
+
+public:
+    LvnHandleTable() : m_FreeSlot(s_NullIndex) {}
+
+    uint64_t insert(void* obj)
+    {
+        uint32_t slotIndex;
+        if (m_FreeSlot != s_NullIndex)
+        {
+            slotIndex = m_FreeSlot;
+            m_FreeSlot = m_Slots[slotIndex].index;
+        }
+        else
+        {
+            grow(m_Slots);
+            slotIndex = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.push_back({ 1, s_NullIndex }); /* generations start at 1 so that an id of 0 is never valid */
+        }
+
+        grow(m_Objects);
+        grow(m_ObjectSlots);
+        m_Slots[slotIndex].index = static_cast<uint32_t>(m_Objects.size());
+        m_Objects.push_back(obj);
+        m_ObjectSlots.push_back(slotIndex);
+
+        return (static_cast<uint64_t>(m_Slots[slotIndex].generation) << 32) | slotIndex;
+    }
+
+    void* get(uint64_t id) const
+    {
+        uint32_t slotIndex = static_cast<uint32_t>(id);
+        if (slotIndex >= m_Slots.size() || m_Slots[slotIndex].generation != static_cast<uint32_t>(id >> 32)) { return nullptr; }
+
+        return m_Objects[m_Slots[slotIndex].index];
+    }
+
+    // removes the object from the table and returns it, returns nullptr if the handle is stale
+    void* remove(uint64_t id)
+    {
+        void* obj = get(id);
+        if (obj == nullptr) { return nullptr; }
+
+        uint32_t slotIndex = static_cast<uint32_t>(id);
+        uint32_t index = m_Slots[slotIndex].index;
+        uint32_t last = static_cast<uint32_t>(m_Objects.size() - 1);
+
+        // move the last object into the removed object's place to keep the array packed
+        m_Objects[index] = m_Objects[last];
+        m_ObjectSlots[index] = m_ObjectSlots[last];
+        m_Slots[m_ObjectSlots[index]].index = index;
+        m_Objects.pop_back();
+        m_ObjectSlots.pop_back();
+
+        Slot& slot = m_Slots[slotIndex];
+        if (++slot.generation == 0) { slot.generation = 1; }
+        slot.index = m_FreeSlot;
+        m_FreeSlot = slotIndex;
+
+        return obj;
+    }
+
+    void clear()
+    {
+        for (uint32_t i = 0; i < m_ObjectSlots.size(); i++)
+        {
+            Slot& slot = m_Slots[m_ObjectSlots[i]];
+            if (++slot.generation == 0) { slot.generation = 1; }
+            slot.index = m_FreeSlot;
+            m_FreeSlot = m_ObjectSlots[i];
+        }
+
+        m_Objects.clear();
+        m_ObjectSlots.clear();
+    }
+
+    uint32_t        size() const { return static_cast<uint32_t>(m_Objects.size()); }
+    bool            empty() const { return m_Objects.empty(); }
+    void* const*    objects() const { return m_Objects.data(); }
+};
+
+// LvnHandleObjectTable
+// - the same generational handles as LvnHandleTable but the objects themselves are stored in the table instead of pointers to them
+// - objects are kept in pages of s_PageObjectCount objects, pages never move so pointers to the objects stay valid until they are removed
+// - the slot index of each live object is kept packed for iterating, objects of nearby slots sit next to each other in the same page
+template <typename T>
+class LvnHandleObjectTable
+{
+private:
+    struct Slot
+    {
+        uint32_t generation;
+        uint32_t index;          /* index into the live slot array when in use, next free slot when not in use */
+    };
+
+    static constexpr uint32_t s_NullIndex = UINT32_MAX;
+    static constexpr uint32_t s_PageObjectCount = 64;
+
+    LvnVector<T*> m_Pages;                /* storage of the objects, slot i is object i % s_PageObjectCount of page i / s_PageObjectCount */
+    LvnVector<Slot> m_Slots;
+    LvnVector<uint32_t> m_LiveSlots;      /* slot index of each live object */
+    uint32_t m_FreeSlot;                  /* head of the free slot list */
+
+    template <typename U>
+    static void grow(LvnVector<U>& vec) { if (vec.size() == vec.capacity()) vec.reserve(vec.capacity() ? vec.capacity() * 2 : 64); }
+
+    T* slotObject(uint32_t slotIndex) const { return m_Pages[slotIndex / s_PageObjectCount] + slotIndex % s_PageObjectCount; }
+
+public:
+    LvnHandleObjectTable() : m_FreeSlot(s_NullIndex) {}
+    LvnHandleObjectTable(const LvnHandleObjectTable&) = delete;
+    LvnHandleObjectTable& operator=(const LvnHandleObjectTable&) = delete;
+    ~LvnHandleObjectTable() { release(); }
+
+    // takes a slot and returns the uninitialized storage of its object, the caller constructs the object in place
+    T* take(uint64_t* id)
+    {
+        uint32_t slotIndex;
+        if (m_FreeSlot != s_NullIndex)
+        {
+            slotIndex = m_FreeSlot;
+            m_FreeSlot = m_Slots[slotIndex].index;
+        }
+        else
+        {
+            slotIndex = static_cast<uint32_t>(m_Slots.size());
+            if (slotIndex % s_PageObjectCount == 0)
+            {
+                grow(m_Pages);
+                m_Pages.push_back(static_cast<T*>(LVN_MALLOC(s_PageObjectCount * sizeof(T))));
+            }
+
+            grow(m_Slots);
+            m_Slots.push_back({ 1, s_NullIndex }); /* generations start at 1 so that an id of 0 is never valid */
+        }
+
+        grow(m_LiveSlots);
+        m_Slots[slotIndex].index = static_cast<uint32_t>(m_LiveSlots.size());
+        m_LiveSlots.push_back(slotIndex);
+
+        *id = (static_cast<uint64_t>(m_Slots[slotIndex].generation) << 32) | slotIndex;
+        return slotObject(slotIndex);
+    }
+
+    T* get(uint64_t id) const
+    {
+        uint32_t slotIndex = static_cast<uint32_t>(id);
+        if (slotIndex >= m_Slots.size() || m_Slots[slotIndex].generation != static_cast<uint32_t>(id >> 32)) { return nullptr; }
+
+        return slotObject(slotIndex);
+    }
+
+    // returns the slot to the table, the object must already be destroyed by the caller, returns false if the handle is stale
+    bool remove(uint64_t id)
+    {
+        if (get(id) == nullptr) { return false; }
+
+        uint32_t slotIndex = static_cast<uint32_t>(id);
+        uint32_t index = m_Slots[slotIndex].index;
+
+        // move the last live slot into the removed slot's place to keep the array packed, the objects themselves do not move
+        m_LiveSlots[index] = m_LiveSlots.back();
+        m_Slots[m_LiveSlots[index]].index = index;
+        m_LiveSlots.pop_back();
+
+        Slot& slot = m_Slots[slotIndex];
+        if (++slot.generation == 0) { slot.generation = 1; }
+        slot.index = m_FreeSlot;
+        m_FreeSlot = slotIndex;
+
+        return true;
+    }
+
+    // frees the pages of the table, every object must already be destroyed and its slot removed
+    void release()
+    {
+        for (uint32_t i = 0; i < m_Pages.size(); i++)
+            LVN_FREE(m_Pages[i]);
+
+        m_Pages.clear();
+        m_Slots.clear();
+        m_LiveSlots.clear();
+        m_FreeSlot = s_NullIndex;
+    }
+
+    uint32_t        size() const { return static_cast<uint32_t>(m_LiveSlots.size()); }
+    bool            empty() const { return m_LiveSlots.empty(); }
+    T*              liveObject(uint32_t index) const { return slotObject(m_LiveSlots[index]); }
+    uint64_t        liveId(uint32_t index) const { return (static_cast<uint64_t>(m_Slots[m_LiveSlots[index]].generation) << 32) | m_LiveSlots[index]; }
+};
+
+// one handle table for each type of object that can be created with a handle
+struct LvnHandleTables
+{
+    LvnHandleObjectTable<LvnPipeline>    pipelines;
+    LvnHandleObjectTable<LvnFrameBuffer> frameBuffers;
+    LvnHandleObjectTable<LvnBuffer>      buffers;
+    LvnHandleObjectTable<LvnSampler>     samplers;
+    LvnHandleObjectTable<LvnTexture>     textures;
+    LvnHandleObjectTable<LvnCubemap>     cubemaps;
 };
 
 
 // -- [SUBSECT]: Logging Data Structures
 // ------------------------------------------------------------
 
+// a log pattern format is compiled into a flat list of instructions when it is set on a logger
+// - each instruction writes directly into the output buffer of the message
+// - runs of plain characters in the format are merged into one literal instruction that points into the logger's literal string
+enum LvnLogInstructionType
+{
+    Lvn_LogInstruction_Literal = 0,
+    Lvn_LogInstruction_NewLine,            // '$'
+    Lvn_LogInstruction_LoggerName,         // 'n'
+    Lvn_LogInstruction_LevelName,          // 'l'
+    Lvn_LogInstruction_LevelColor,         // '#'
+    Lvn_LogInstruction_ColorReset,         // '^'
+    Lvn_LogInstruction_Message,            // 'v'
+    Lvn_LogInstruction_Percent,            // '%'
+    Lvn_LogInstruction_Time,               // 'T'
+    Lvn_LogInstruction_Time12,             // 't'
+    Lvn_LogInstruction_Year,               // 'Y'
+    Lvn_LogInstruction_Year02d,            // 'y'
+    Lvn_LogInstruction_Month,              // 'm'
+    Lvn_LogInstruction_MonthName,          // 'B'
+    Lvn_LogInstruction_MonthNameShort,     // 'b'
+    Lvn_LogInstruction_Day,                // 'd'
+    Lvn_LogInstruction_WeekDayName,        // 'A'
+    Lvn_LogInstruction_WeekDayNameShort,   // 'a'
+    Lvn_LogInstruction_Hour,               // 'H'
+    Lvn_LogInstruction_Hour12,             // 'h'
+    Lvn_LogInstruction_Minute,             // 'M'
+    Lvn_LogInstruction_Second,             // 'S'
+    Lvn_LogInstruction_Meridiem,           // 'P'
+    Lvn_LogInstruction_MeridiemLower,      // 'p'
+    Lvn_LogInstruction_UserPattern,        // pattern added with lvn::logAddPatterns
+};
+
+struct LvnLogInstruction
+{
+    LvnLogInstructionType type;
+    uint32_t offset, length;               // range in LvnLogger::logLiterals for literal instructions
+    LvnString (*func)(LvnLogMessage*);     // user pattern function
+};
+
+// format string of a binary log file cached by its address, the text is compared on each use since the address may be reused
+struct LvnLogBinaryFormat
+{
+    uint32_t id;
+    LvnString text;
+};
+
 struct LvnLogger
 {
     LvnString loggerName;
     LvnString logPatternFormat;
     LvnLogLevel logLevel;
-    LvnVector<LvnLogPattern> logPatterns;
+    LvnVector<LvnLogInstruction> logInstructions;
+    LvnString logLiterals;
 
     LvnLogFile logfile;
+
+    // binary log file
+    uint32_t binaryLoggerId;                                 // id of the logger in the binary log file
+    long long binaryLastTimeNs;                              // time of the last message written, message times are stored as deltas
+    LvnHashMap<LvnString, uint32_t> binaryFormatIds;         // format strings already written to the string table of the file
+    LvnHashMap<const char*, LvnLogBinaryFormat> binaryFormatAddresses; // id and text of the last format string used at each address
 };
 
 
@@ -436,6 +763,18 @@ struct LvnRenderPass
     void* nativeRenderPass;
 };
 
+struct LvnFrameCounters
+{
+    uint32_t commandCount;
+    uint32_t drawCallCount;
+    uint32_t pipelineBindCount;
+    uint32_t descriptorSetBindCount;
+    uint64_t drawListVertexCount;
+    uint64_t drawListIndexCount;
+    uint64_t bufferUploadBytesBegin;  // context counters when the frame began, the frame stats hold the difference at submit
+    uint64_t texturesCreatedBegin;
+};
+
 /*
   LvnWindow struct is used to create a window on the system
   - Stores window data (eg. width, height, title)
@@ -455,6 +794,15 @@ struct LvnWindow
     uint32_t indexOffset;            // index offset when binding index buffer (opengl)
     LvnHashMap<uint32_t, uint32_t>* bindingDescriptions;
     LvnVector<uint8_t> cmdBuffer;    // command buffer to store draw commands in byte data
+
+    // frame stats, only written by the thread rendering to the window
+    LvnFrameCounters frameCounters;  // counters of the frame being recorded, reset by lvn::renderBeginNextFrame
+    LvnFrameStats frameStats;        // counters and times of the last submitted frame
+    LvnTimer frameTimer;             // started by every lvn::renderBeginNextFrame
+    float frameTimes[LVN_FRAME_STATS_HISTORY]; // ring buffer of frame times in milliseconds
+    uint32_t frameTimeCount;
+    uint32_t frameTimeIndex;
+    uint64_t frameCount;
 };
 
 
@@ -785,15 +1133,40 @@ struct LvnStructureTypeInfo
     uint64_t count;
 };
 
+#define LVN_FRAME_ARENA_COUNT (2) /* double buffered, memory from the previous frame stays valid for one more frame */
+
+// chunk header is placed at the start of the chunk memory, allocations are bumped from the memory after the header
+struct alignas(alignof(max_align_t)) LvnFrameArenaChunk
+{
+    LvnFrameArenaChunk* next;
+    size_t size;
+    std::atomic<size_t> offset;
+};
+
+struct LvnFrameArena
+{
+    std::atomic<LvnFrameArenaChunk*> current;  /* chunk allocations are bumped from, older chunks are linked through next */
+    size_t totalSize;                          /* combined size of every chunk in the arena */
+};
+
+// frame arenas of the context, lvn::frameArenaReset is called by the render thread from lvn::renderBeginNextFrame
+struct LvnFrameArenaState
+{
+    std::mutex lock;                           /* only taken when a chunk runs out of space */
+    LvnFrameArena arenas[LVN_FRAME_ARENA_COUNT];
+    std::atomic<uint32_t> index;
+    size_t chunkSize;
+};
+
 struct LvnObjectMemAllocCount
 {
     struct LvnStructCounts
     {
         LvnStructureType sType;
-        size_t count;
+        std::atomic<size_t> count;
     };
 
-    LvnVector<LvnStructCounts> sTypes;
+    LvnStructCounts sTypes[Lvn_Stype_Max_Value];
 };
 
 
@@ -822,15 +1195,25 @@ struct LvnContext
 
     // memory pools and bindings
     LvnMemAllocMode                      memoryMode;
+    LvnMemAllocator                      memoryAllocator;
+    LvnFrameArenaState                   frameArena;         // transient memory for render thread per frame data, see lvn::frameArenaAlloc
+    LvnWindow*                           frameArenaWindow;   // window that paces the frame arena resets when rendering to multiple windows
     LvnMemoryPool                        memoryPool;
     LvnVector<LvnStructureTypeInfo>      sTypeMemAllocInfos;
     LvnVector<LvnStructureTypeInfo>      blockMemAllocInfos;
 
+    // object handles
+    LvnHandleTables                      handleTables;
+
     // memory object allocations
-    size_t                               numMemoryAllocations;
+    std::atomic<size_t>                  numMemoryAllocations;
     size_t                               numClassObjectAllocations;
     LvnObjectMemAllocCount               objectMemoryAllocations;
 
+    // render stats, updated from any thread and read per window as the difference between the start and submit of a frame
+    std::atomic<uint64_t>                statBufferUploadBytes;
+    std::atomic<uint64_t>                statTexturesCreated;
+
     // misc
     LvnTimer                             contexTime;       // timer
     LvnData<uint32_t>                    defaultCodePoints;
@@ -862,6 +1245,21 @@ namespace lvn
         arg2 = lvn::move(temp);
     }
 
+    void memInstallSlabAllocator();    // replaces the current mem funcs with the slab allocator (lvn_alloc.cpp), the previous funcs are used for large allocations
+    void frameArenaInit(size_t size);  // sets the chunk size of the frame arenas and releases any memory held by them
+    void frameArenaTerminate();        // releases all memory held by the frame arenas
+    void memTrackInit();               // starts recording lvn::memNew, lvn::memAlloc and object allocations (lvn_alloc.cpp), memory allocated before is not tracked
+    void memTrackTerminate();          // stops tracking and releases the tracking tables, the stats from lvn::memGetTracked* are no longer valid after
+    void memTrackRealloc(void* oldPtr, void* newPtr, size_t size); // moves the recorded allocation to the new pointer, keeps its type and site
+    void memTrackObject(LvnStructureType sType, uint64_t size, bool create); // records the creation or destruction of an object of the sType
+    void memTrackSetPoolBinding(LvnStructureType sType, uint64_t baseCount, uint64_t blockCount); // records the object counts of the memory pool binding of the sType
+    void jobSystemInit(uint32_t workerCount); // starts the job system workers (lvn_jobs.cpp), the calling thread becomes worker 0; 0 uses the hardware thread count
+    void jobSystemTerminate();         // finishes any pending jobs then stops and joins the workers
+    void ioInit(uint32_t threadCount); // starts the I/O threads used by lvn::asyncRead (lvn_io.cpp); 0 uses the default thread count
+    void ioTerminate();                // cancels queued reads, joins the I/O threads and calls any callbacks that were not dispatched
+    void profilerInit(bool enable, uint32_t eventCapacity); // sets the per thread event capacity of the profiler (lvn_profiler.cpp) and names the calling thread "main"
+    void profilerTerminate();          // stops profiling and releases every thread's event buffer, threads must not be inside a zone
+
     template <typename T, size_t N>
     void swap(T (&arg1)[N], T (&arg2)[N])
     {
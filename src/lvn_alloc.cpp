@@ -0,0 +1,1075 @@
+#include "levikno.h"
+#include "levikno_internal.h"
+
+// [FILE]: lvn_alloc.cpp (Memory Allocators)
+// ------------------------------------------------------------
+//
+// [SECTION]: Slab Allocator
+// -- [SUBSECT]: Size Classes
+// -- [SUBSECT]: Segments & Page Map
+// -- [SUBSECT]: Thread Caches
+// -- [SUBSECT]: Slab Alloc Functions
+// -- [SUBSECT]: Slab Allocator Functions
+// [SECTION]: Frame Arena
+// -- [SUBSECT]: Frame Arena Chunks
+// -- [SUBSECT]: Frame Arena Functions
+// [SECTION]: Memory Tracking
+// -- [SUBSECT]: Tracking Tables
+// -- [SUBSECT]: Memory Tracking Functions
+
+#include <atomic>
+#include <mutex>
+
+#ifdef LVN_PLATFORM_WINDOWS
+    #include <malloc.h> /* _aligned_malloc */
+#endif
+
+
+// ------------------------------------------------------------
+// [SECTION]: Slab Allocator
+// ------------------------------------------------------------
+// - small allocations are served from fixed size blocks carved out of 64 KiB slabs, each slab only holds blocks of one size class
+// - slabs are carved out of 4 MiB aligned segments, a pointer is mapped back to its segment and slab through a two level page map
+// - every thread owns a cache of slabs per size class, allocating and freeing on the owning thread never takes a lock
+// - frees from other threads are pushed onto a lock-free list in the owning cache which the owner takes back in one exchange
+// - allocations larger than the biggest size class and pointers not owned by the slab heap are passed to the upstream alloc functions
+
+#define LVN_SLAB_SEGMENT_SHIFT          (22)
+#define LVN_SLAB_SEGMENT_SIZE           (1ULL << LVN_SLAB_SEGMENT_SHIFT)                 /* 4 MiB */
+#define LVN_SLAB_SHIFT                  (16)
+#define LVN_SLAB_SIZE                   (1ULL << LVN_SLAB_SHIFT)                         /* 64 KiB */
+#define LVN_SLAB_SEGMENT_SLAB_COUNT     (LVN_SLAB_SEGMENT_SIZE / LVN_SLAB_SIZE)
+#define LVN_SLAB_MAX_BLOCK_SIZE         (4096)
+
+#define LVN_SLAB_PAGEMAP_BITS           (48 - LVN_SLAB_SEGMENT_SHIFT)                    /* 48 bit virtual address space */
+#define LVN_SLAB_PAGEMAP_ROOT_BITS      (13)
+#define LVN_SLAB_PAGEMAP_LEAF_BITS      (LVN_SLAB_PAGEMAP_BITS - LVN_SLAB_PAGEMAP_ROOT_BITS)
+#define LVN_SLAB_PAGEMAP_LEAF_SIZE      (1ULL << LVN_SLAB_PAGEMAP_LEAF_BITS)
+
+#define LVN_FRAME_ARENA_DEFAULT_SIZE    (1ULL << 20)                                     /* 1 MiB */
+
+#define LVN_MEM_TRACK_MIN_CAPACITY      (1024)
+#define LVN_MEM_TRACK_NULL_GROUP        (UINT32_MAX)
+
+
+// -- [SUBSECT]: Size Classes
+// ------------------------------------------------------------
+
+static constexpr uint32_t s_SlabSizeClasses[] =
+{
+      16,   32,   48,   64,   80,   96,  112,  128,
+     160,  192,  224,  256,  320,  384,  448,  512,
+     640,  768,  896, 1024, 1280, 1536, 1792, 2048,
+    2560, 3072, 3584, 4096,
+};
+
+static constexpr uint32_t s_SlabSizeClassCount = sizeof(s_SlabSizeClasses) / sizeof(s_SlabSizeClasses[0]);
+static_assert(s_SlabSizeClasses[s_SlabSizeClassCount - 1] == LVN_SLAB_MAX_BLOCK_SIZE, "largest slab size class must match the max block size");
+
+// lookup table from (size + 15) / 16 to the smallest size class that fits
+struct LvnSlabSizeClassTable
+{
+    uint8_t index[(LVN_SLAB_MAX_BLOCK_SIZE >> 4) + 1];
+
+    constexpr LvnSlabSizeClassTable()
+        : index()
+    {
+        uint32_t sizeClass = 0;
+        for (uint32_t i = 0; i <= (LVN_SLAB_MAX_BLOCK_SIZE >> 4); i++)
+        {
+            while ((s_SlabSizeClasses[sizeClass] >> 4) < i)
+                sizeClass++;
+            index[i] = static_cast<uint8_t>(sizeClass);
+        }
+    }
+};
+
+static constexpr LvnSlabSizeClassTable s_SlabSizeClassTable{};
+
+
+// -- [SUBSECT]: Segments & Page Map
+// ------------------------------------------------------------
+
+struct LvnSlabThreadCache;
+
+struct LvnSlabBlock
+{
+    LvnSlabBlock* next;
+};
+
+struct LvnSlab
+{
+    LvnSlabThreadCache* owner;    /* cache that allocates from this slab, never changes once the slab is taken */
+    uint32_t sizeClass;
+    uint32_t blockSize;
+    uint8_t* bump;                /* next block in the slab that has never been handed out */
+    uint8_t* end;
+};
+
+// segment header lives in the first slab of the segment, that slab is never handed out for blocks
+struct LvnSlabSegment
+{
+    LvnSlab slabs[LVN_SLAB_SEGMENT_SLAB_COUNT];
+    LvnSlabSegment* next;
+    uint32_t nextSlab;
+};
+static_assert(sizeof(LvnSlabSegment) <= LVN_SLAB_SIZE, "slab segment header must fit within the first slab of the segment");
+
+struct alignas(LVN_CACHE_LINE_SIZE) LvnSlabSizeClassCache
+{
+    LvnSlabBlock* freeList;                                                 /* blocks freed by the owning thread */
+    LvnSlab* activeSlab;                                                    /* slab that new blocks are bumped from */
+    std::atomic<uint64_t> slabCount, allocCount, freeCount;                 /* stats, only written by the owning thread */
+
+    alignas(LVN_CACHE_LINE_SIZE) std::atomic<LvnSlabBlock*> remoteFree;    /* blocks freed by other threads, kept on its own cache line */
+    std::atomic<uint64_t> remoteFreeCount;
+};
+
+struct LvnSlabThreadCache
+{
+    LvnSlabSizeClassCache sizeClasses[s_SlabSizeClassCount];
+    LvnSlabThreadCache* next;            /* list of every cache created, used for stats */
+    LvnSlabThreadCache* nextAbandoned;   /* list of caches left behind by exited threads */
+};
+
+struct LvnSlabHeap
+{
+    std::mutex lock;                          /* guards segment creation and the cache lists, never taken on the alloc/free fast path */
+    LvnSlabSegment* segments;
+    LvnSlabThreadCache* caches;
+    LvnSlabThreadCache* abandonedCaches;
+
+    LvnMemAllocFunc upstreamAlloc;
+    LvnMemFreeFunc upstreamFree;
+    LvnMemReallocFunc upstreamRealloc;
+    void* upstreamUserData;
+};
+
+static LvnSlabHeap s_SlabHeap{};
+static std::atomic<std::atomic<LvnSlabSegment*>*> s_SlabPageMap[1ULL << LVN_SLAB_PAGEMAP_ROOT_BITS];
+
+static void* slabAlignedAlloc(size_t size)
+{
+#ifdef LVN_PLATFORM_WINDOWS
+    return _aligned_malloc(size, size);
+#else
+    return aligned_alloc(size, size);
+#endif
+}
+
+static void slabAlignedFree(void* ptr)
+{
+#ifdef LVN_PLATFORM_WINDOWS
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static LvnSlabSegment* slabFindSegment(const void* ptr)
+{
+    uintptr_t key = reinterpret_cast<uintptr_t>(ptr) >> LVN_SLAB_SEGMENT_SHIFT;
+    if (key >> LVN_SLAB_PAGEMAP_BITS) { return nullptr; }
+
+    std::atomic<LvnSlabSegment*>* leaf = s_SlabPageMap[key >> LVN_SLAB_PAGEMAP_LEAF_BITS].load(std::memory_order_acquire);
+    if (leaf == nullptr) { return nullptr; }
+
+    return leaf[key & (LVN_SLAB_PAGEMAP_LEAF_SIZE - 1)].load(std::memory_order_acquire);
+}
+
+// NOTE: must be called with the heap lock held
+static LvnSlabSegment* slabCreateSegment()
+{
+    void* memory = slabAlignedAlloc(LVN_SLAB_SEGMENT_SIZE);
+    if (memory == nullptr) { return nullptr; }
+
+    uintptr_t key = reinterpret_cast<uintptr_t>(memory) >> LVN_SLAB_SEGMENT_SHIFT;
+    if (key >> LVN_SLAB_PAGEMAP_BITS) // address is outside of what the page map covers
+    {
+        slabAlignedFree(memory);
+        return nullptr;
+    }
+
+    auto& root = s_SlabPageMap[key >> LVN_SLAB_PAGEMAP_LEAF_BITS];
+    std::atomic<LvnSlabSegment*>* leaf = root.load(std::memory_order_relaxed);
+    if (leaf == nullptr)
+    {
+        leaf = new std::atomic<LvnSlabSegment*>[LVN_SLAB_PAGEMAP_LEAF_SIZE]();
+        root.store(leaf, std::memory_order_release);
+    }
+
+    LvnSlabSegment* segment = new (memory) LvnSlabSegment();
+    segment->nextSlab = 1;
+    segment->next = s_SlabHeap.segments;
+    s_SlabHeap.segments = segment;
+
+    leaf[key & (LVN_SLAB_PAGEMAP_LEAF_SIZE - 1)].store(segment, std::memory_order_release);
+    return segment;
+}
+
+static LvnSlab* slabAcquire(LvnSlabThreadCache* cache, uint32_t sizeClass)
+{
+    std::lock_guard<std::mutex> lock(s_SlabHeap.lock);
+
+    LvnSlabSegment* segment = s_SlabHeap.segments;
+    if (segment == nullptr || segment->nextSlab == LVN_SLAB_SEGMENT_SLAB_COUNT)
+    {
+        segment = slabCreateSegment();
+        if (segment == nullptr) { return nullptr; }
+    }
+
+    uint32_t index = segment->nextSlab++;
+    uint32_t blockSize = s_SlabSizeClasses[sizeClass];
+
+    LvnSlab* slab = &segment->slabs[index];
+    slab->owner = cache;
+    slab->sizeClass = sizeClass;
+    slab->blockSize = blockSize;
+    slab->bump = reinterpret_cast<uint8_t*>(segment) + index * LVN_SLAB_SIZE;
+    slab->end = slab->bump + (LVN_SLAB_SIZE / blockSize) * blockSize;
+
+    return slab;
+}
+
+
+// -- [SUBSECT]: Thread Caches
+// ------------------------------------------------------------
+
+static thread_local LvnSlabThreadCache* s_ThreadCache = nullptr;
+static thread_local bool s_ThreadCacheReleased = false;
+
+// hands the cache of an exiting thread back to the heap so the next new thread can adopt it along with its slabs
+struct LvnSlabThreadCacheRelease
+{
+    void touch() {}
+
+    ~LvnSlabThreadCacheRelease()
+    {
+        s_ThreadCacheReleased = true;
+        if (s_ThreadCache == nullptr) { return; }
+
+        std::lock_guard<std::mutex> lock(s_SlabHeap.lock);
+        s_ThreadCache->nextAbandoned = s_SlabHeap.abandonedCaches;
+        s_SlabHeap.abandonedCaches = s_ThreadCache;
+        s_ThreadCache = nullptr;
+    }
+};
+
+static thread_local LvnSlabThreadCacheRelease s_ThreadCacheRelease;
+
+static LvnSlabThreadCache* slabCreateThreadCache()
+{
+    if (s_ThreadCacheReleased) { return nullptr; } // thread is exiting, thread local storage is no longer valid
+
+    s_ThreadCacheRelease.touch(); // construct the release hook for this thread
+
+    std::lock_guard<std::mutex> lock(s_SlabHeap.lock);
+
+    LvnSlabThreadCache* cache = s_SlabHeap.abandonedCaches;
+    if (cache != nullptr)
+    {
+        s_SlabHeap.abandonedCaches = cache->nextAbandoned;
+        cache->nextAbandoned = nullptr;
+    }
+    else
+    {
+        cache = new LvnSlabThreadCache();
+        cache->next = s_SlabHeap.caches;
+        s_SlabHeap.caches = cache;
+    }
+
+    s_ThreadCache = cache;
+    return cache;
+}
+
+static inline void slabStatIncrement(std::atomic<uint64_t>& stat)
+{
+    // single writer, avoid the locked read-modify-write
+    stat.store(stat.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+
+// -- [SUBSECT]: Slab Alloc Functions
+// ------------------------------------------------------------
+
+static void* slabAlloc(size_t size, void* userData)
+{
+    (void)userData;
+
+    if (size > LVN_SLAB_MAX_BLOCK_SIZE)
+        return (*s_SlabHeap.upstreamAlloc)(size, s_SlabHeap.upstreamUserData);
+
+    LvnSlabThreadCache* cache = s_ThreadCache;
+    if (cache == nullptr && (cache = slabCreateThreadCache()) == nullptr)
+        return (*s_SlabHeap.upstreamAlloc)(size, s_SlabHeap.upstreamUserData);
+
+    uint32_t sizeClass = s_SlabSizeClassTable.index[(size + 15) >> 4];
+    LvnSlabSizeClassCache& classCache = cache->sizeClasses[sizeClass];
+
+    LvnSlabBlock* block = classCache.freeList;
+    if (block == nullptr) // take back every block freed by other threads at once
+        block = classCache.remoteFree.exchange(nullptr, std::memory_order_acquire);
+
+    if (block != nullptr)
+    {
+        classCache.freeList = block->next;
+    }
+    else
+    {
+        LvnSlab* slab = classCache.activeSlab;
+        if (slab == nullptr || slab->bump == slab->end)
+        {
+            slab = slabAcquire(cache, sizeClass);
+            if (slab == nullptr) { return nullptr; }
+
+            classCache.activeSlab = slab;
+            slabStatIncrement(classCache.slabCount);
+        }
+
+        block = reinterpret_cast<LvnSlabBlock*>(slab->bump);
+        slab->bump += slab->blockSize;
+    }
+
+    slabStatIncrement(classCache.allocCount);
+    return block;
+}
+
+static void slabFree(void* ptr, void* userData)
+{
+    (void)userData;
+
+    LvnSlabSegment* segment = slabFindSegment(ptr);
+    if (segment == nullptr)
+    {
+        (*s_SlabHeap.upstreamFree)(ptr, s_SlabHeap.upstreamUserData);
+        return;
+    }
+
+    LvnSlab* slab = &segment->slabs[(reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(segment)) >> LVN_SLAB_SHIFT];
+    LvnSlabSizeClassCache& classCache = slab->owner->sizeClasses[slab->sizeClass];
+    LvnSlabBlock* block = static_cast<LvnSlabBlock*>(ptr);
+
+    if (slab->owner == s_ThreadCache)
+    {
+        block->next = classCache.freeList;
+        classCache.freeList = block;
+        slabStatIncrement(classCache.freeCount);
+        return;
+    }
+
+    // block belongs to another thread's cache, push it onto the owner's remote free list
+    LvnSlabBlock* head = classCache.remoteFree.load(std::memory_order_relaxed);
+    do
+    {
+        block->next = head;
+    } while (!classCache.remoteFree.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+
+    classCache.remoteFreeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void* slabRealloc(void* ptr, size_t size, void* userData)
+{
+    if (ptr == nullptr) { return slabAlloc(size, userData); }
+
+    LvnSlabSegment* segment = slabFindSegment(ptr);
+    if (segment == nullptr)
+        return (*s_SlabHeap.upstreamRealloc)(ptr, size, s_SlabHeap.upstreamUserData);
+
+    LvnSlab* slab = &segment->slabs[(reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(segment)) >> LVN_SLAB_SHIFT];
+    if (size <= slab->blockSize) { return ptr; }
+
+    void* newptr = slabAlloc(size, userData);
+    if (newptr == nullptr) { return nullptr; }
+
+    memcpy(newptr, ptr, slab->blockSize);
+    slabFree(ptr, userData);
+    return newptr;
+}
+
+
+// -- [SUBSECT]: Slab Allocator Functions
+// ------------------------------------------------------------
+
+namespace lvn
+{
+
+void memInstallSlabAllocator()
+{
+    if (lvn::getMemAllocFunc() == slabAlloc) { return; }
+
+    // the previous alloc functions are kept as the upstream for large allocations and for memory allocated before the slab heap was installed
+    s_SlabHeap.upstreamAlloc = lvn::getMemAllocFunc();
+    s_SlabHeap.upstreamFree = lvn::getMemFreeFunc();
+    s_SlabHeap.upstreamRealloc = lvn::getMemReallocFunc();
+    s_SlabHeap.upstreamUserData = lvn::getMemUserData();
+
+    lvn::setMemFuncs(slabAlloc, slabFree, slabRealloc, &s_SlabHeap);
+}
+
+void memGetSlabStats(LvnMemSlabStats* pStats, uint32_t* statCount)
+{
+    if (statCount != nullptr)
+        *statCount = s_SlabSizeClassCount;
+
+    if (pStats == nullptr)
+        return;
+
+    for (uint32_t i = 0; i < s_SlabSizeClassCount; i++)
+    {
+        pStats[i] = {};
+        pStats[i].blockSize = s_SlabSizeClasses[i];
+    }
+
+    std::lock_guard<std::mutex> lock(s_SlabHeap.lock);
+
+    for (LvnSlabThreadCache* cache = s_SlabHeap.caches; cache != nullptr; cache = cache->next)
+    {
+        for (uint32_t i = 0; i < s_SlabSizeClassCount; i++)
+        {
+            const LvnSlabSizeClassCache& classCache = cache->sizeClasses[i];
+            pStats[i].slabCount += classCache.slabCount.load(std::memory_order_relaxed);
+            pStats[i].allocCount += classCache.allocCount.load(std::memory_order_relaxed);
+            pStats[i].freeCount += classCache.freeCount.load(std::memory_order_relaxed);
+            pStats[i].remoteFreeCount += classCache.remoteFreeCount.load(std::memory_order_relaxed);
+        }
+    }
+
+    for (uint32_t i = 0; i < s_SlabSizeClassCount; i++)
+    {
+        uint64_t freed = pStats[i].freeCount + pStats[i].remoteFreeCount;
+        pStats[i].liveBlockCount = pStats[i].allocCount > freed ? pStats[i].allocCount - freed : 0;
+    }
+}
+
+
+// ------------------------------------------------------------
+// [SECTION]: Frame Arena
+// ------------------------------------------------------------
+// - linear allocator for transient memory that only lives within a frame, allocating is a single atomic bump and nothing is freed individually
+// - one arena per frame buffer, lvn::frameArenaReset moves to the next arena and rewinds it
+// - the arenas belong to the context (LvnContext::frameArena), memory from them must not be held by other threads across lvn::renderBeginNextFrame
+// - if a frame allocates more than the arena size, more chunks are chained on; the chunks are merged into one larger chunk on the next reset
+
+
+// -- [SUBSECT]: Frame Arena Chunks
+// ------------------------------------------------------------
+
+static LvnFrameArenaChunk* frameArenaCreateChunk(size_t size)
+{
+    // chunks are not counted as context allocations and do not need to be zeroed, call the mem funcs directly
+    void* memory = (*lvn::getMemAllocFunc())(sizeof(LvnFrameArenaChunk) + size, lvn::getMemUserData());
+    if (memory == nullptr) { LVN_CORE_ERROR("frame arena failure, could not allocate frame arena chunk of size %zu", size); throw std::bad_alloc{}; }
+
+    LvnFrameArenaChunk* chunk = new (memory) LvnFrameArenaChunk();
+    chunk->next = nullptr;
+    chunk->size = size;
+    chunk->offset.store(0, std::memory_order_relaxed);
+    return chunk;
+}
+
+static void frameArenaFreeChunks(LvnFrameArena* arena)
+{
+    LvnFrameArenaChunk* chunk = arena->current.load(std::memory_order_relaxed);
+    while (chunk != nullptr)
+    {
+        LvnFrameArenaChunk* next = chunk->next;
+        chunk->~LvnFrameArenaChunk();
+        (*lvn::getMemFreeFunc())(chunk, lvn::getMemUserData());
+        chunk = next;
+    }
+
+    arena->current.store(nullptr, std::memory_order_relaxed);
+    arena->totalSize = 0;
+}
+
+static void* frameArenaChunkAlloc(LvnFrameArenaChunk* chunk, size_t size, size_t alignment)
+{
+    uintptr_t base = reinterpret_cast<uintptr_t>(chunk + 1);
+    size_t offset = chunk->offset.load(std::memory_order_relaxed);
+
+    do
+    {
+        uintptr_t aligned = (base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        size_t end = (aligned - base) + size;
+        if (end > chunk->size) { return nullptr; }
+
+        if (chunk->offset.compare_exchange_weak(offset, end, std::memory_order_relaxed))
+            return reinterpret_cast<void*>(aligned);
+
+    } while (true);
+}
+
+
+// -- [SUBSECT]: Frame Arena Functions
+// ------------------------------------------------------------
+
+void frameArenaInit(size_t size)
+{
+    LvnFrameArenaState& frameArena = lvn::getContext()->frameArena;
+    std::lock_guard<std::mutex> lock(frameArena.lock);
+
+    frameArena.chunkSize = size ? size : LVN_FRAME_ARENA_DEFAULT_SIZE;
+    frameArena.index.store(0, std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < LVN_FRAME_ARENA_COUNT; i++)
+        lvn::frameArenaFreeChunks(&frameArena.arenas[i]);
+}
+
+void frameArenaTerminate()
+{
+    LvnFrameArenaState& frameArena = lvn::getContext()->frameArena;
+    std::lock_guard<std::mutex> lock(frameArena.lock);
+
+    for (uint32_t i = 0; i < LVN_FRAME_ARENA_COUNT; i++)
+        lvn::frameArenaFreeChunks(&frameArena.arenas[i]);
+}
+
+void* frameArenaAlloc(size_t size, size_t alignment)
+{
+    LVN_CORE_ASSERT(alignment && (alignment & (alignment - 1)) == 0, "frame arena alignment must be a power of two");
+
+    LvnFrameArenaState& frameArena = lvn::getContext()->frameArena;
+    LvnFrameArena* arena = &frameArena.arenas[frameArena.index.load(std::memory_order_acquire)];
+    LvnFrameArenaChunk* chunk = arena->current.load(std::memory_order_acquire);
+
+    while (true)
+    {
+        if (chunk != nullptr)
+        {
+            void* ptr = lvn::frameArenaChunkAlloc(chunk, size, alignment);
+            if (ptr != nullptr) { return ptr; }
+        }
+
+        std::lock_guard<std::mutex> lock(frameArena.lock);
+
+        // another thread may have already added a new chunk while waiting for the lock
+        if (arena->current.load(std::memory_order_relaxed) == chunk)
+        {
+            size_t chunkSize = frameArena.chunkSize ? frameArena.chunkSize : LVN_FRAME_ARENA_DEFAULT_SIZE;
+            if (chunkSize < size + alignment)
+                chunkSize = size + alignment;
+
+            LvnFrameArenaChunk* newChunk = lvn::frameArenaCreateChunk(chunkSize);
+            newChunk->next = chunk;
+            arena->totalSize += chunkSize;
+            arena->current.store(newChunk, std::memory_order_release);
+        }
+
+        chunk = arena->current.load(std::memory_order_relaxed);
+    }
+}
+
+void frameArenaReset()
+{
+    LvnFrameArenaState& frameArena = lvn::getContext()->frameArena;
+    uint32_t index = (frameArena.index.load(std::memory_order_relaxed) + 1) % LVN_FRAME_ARENA_COUNT;
+    LvnFrameArena* arena = &frameArena.arenas[index];
+
+    LvnFrameArenaChunk* chunk = arena->current.load(std::memory_order_relaxed);
+    if (chunk != nullptr && chunk->next != nullptr)
+    {
+        // arena overflowed last time it was used, replace the chunks with one chunk large enough for the whole frame
+        std::lock_guard<std::mutex> lock(frameArena.lock);
+        size_t totalSize = arena->totalSize;
+        lvn::frameArenaFreeChunks(arena);
+        arena->current.store(lvn::frameArenaCreateChunk(totalSize), std::memory_order_relaxed);
+        arena->totalSize = totalSize;
+    }
+    else if (chunk != nullptr)
+    {
+        chunk->offset.store(0, std::memory_order_relaxed);
+    }
+
+    frameArena.index.store(index, std::memory_order_release);
+}
+
+size_t frameArenaGetUsedSize()
+{
+    LvnFrameArenaState& frameArena = lvn::getContext()->frameArena;
+    LvnFrameArena* arena = &frameArena.arenas[frameArena.index.load(std::memory_order_acquire)];
+
+    size_t usedSize = 0;
+    for (LvnFrameArenaChunk* chunk = arena->current.load(std::memory_order_acquire); chunk != nullptr; chunk = chunk->next)
+        usedSize += chunk->offset.load(std::memory_order_relaxed);
+
+    return usedSize;
+}
+
+
+
+// ------------------------------------------------------------
+// [SECTION]: Memory Tracking
+// ------------------------------------------------------------
+// - enabled with memoryInfo.enableMemoryTracking, every lvn::memNew and lvn::memAlloc is recorded in a table keyed by pointer so that frees know their size
+// - allocations are grouped by type name and by allocation site (file and line from LVN_MEM_NEW and LVN_MALLOC), each group keeps its live and peak bytes
+// - the tracker's own tables are allocated with malloc so that tracking never recurses into lvn::memNew
+// - one mutex guards every table, tracking is meant for sizing memory pools and finding leaks and not for shipping builds
+
+
+// -- [SUBSECT]: Tracking Tables
+// ------------------------------------------------------------
+
+struct LvnMemTrackAllocation
+{
+    void* ptr;                         /* nullptr marks an empty slot */
+    uint64_t size;
+    uint32_t type;
+    uint32_t site;                     /* LVN_MEM_TRACK_NULL_GROUP if allocated without a site */
+};
+
+// groups are looked up by the pointers passed in, the same type or site may be passed from different translation units
+// with different pointers so several slots can point to the same group
+struct LvnMemTrackSlot
+{
+    const char* key;                   /* nullptr marks an empty slot */
+    const char* file;
+    int line;
+    uint32_t group;
+};
+
+struct LvnMemTrackGroupTable
+{
+    LvnMemTrackStats* groups;
+    uint32_t groupCount, groupCapacity;
+    LvnMemTrackSlot* slots;
+    uint32_t slotCount, slotCapacity;
+};
+
+struct LvnMemTrackObject
+{
+    uint64_t objectSize;
+    uint64_t liveCount, peakCount;
+    uint64_t poolBaseCount, poolBlockCount;
+};
+
+struct LvnMemTracker
+{
+    std::mutex lock;
+    LvnMemTrackAllocation* allocations;
+    uint64_t allocationCount, allocationCapacity;
+    LvnMemTrackGroupTable types;
+    LvnMemTrackGroupTable sites;
+    LvnMemTrackObject objects[Lvn_Stype_Max_Value];
+};
+
+static LvnMemTracker s_MemTracker{};
+static const char* s_MemTrackRawName = "memAlloc";
+
+static inline uint64_t memTrackHash(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    return value;
+}
+
+static void* memTrackCalloc(size_t count, size_t size)
+{
+    void* memory = calloc(count, size);
+    if (memory == nullptr) { throw std::bad_alloc{}; } /* no logging here, the logger allocates through the tracker which holds the lock */
+    return memory;
+}
+
+// lvn::memTypeName returns the whole function signature, only the name of T is kept
+static char* memTrackTypeName(const char* signature)
+{
+    const char* begin = signature;
+    const char* end = signature + strlen(signature);
+
+    if (const char* gccName = strstr(signature, "T = "))
+    {
+        begin = gccName + 4;
+        end = begin;
+        int depth = 0;
+        while (*end && !(depth == 0 && (*end == ';' || *end == ']')))
+        {
+            if (*end == '<') depth++;
+            else if (*end == '>') depth--;
+            end++;
+        }
+    }
+    else if (const char* msvcName = strstr(signature, "memTypeName<"))
+    {
+        begin = msvcName + 12;
+        const char* args = strstr(begin, ">(void)");
+        if (args != nullptr) end = args;
+        if (strncmp(begin, "struct ", 7) == 0) begin += 7;
+        else if (strncmp(begin, "class ", 6) == 0) begin += 6;
+    }
+
+    size_t length = end - begin;
+    char* name = static_cast<char*>(memTrackCalloc(length + 1, 1));
+    memcpy(name, begin, length);
+    return name;
+}
+
+static bool memTrackStrEqual(const char* a, const char* b)
+{
+    if (a == b) { return true; }
+    if (a == nullptr || b == nullptr) { return false; }
+    return strcmp(a, b) == 0;
+}
+
+static void memTrackGrowSlots(LvnMemTrackGroupTable* table)
+{
+    uint32_t oldCapacity = table->slotCapacity;
+    LvnMemTrackSlot* oldSlots = table->slots;
+
+    table->slotCapacity = oldCapacity ? oldCapacity * 2 : 256;
+    table->slots = static_cast<LvnMemTrackSlot*>(memTrackCalloc(table->slotCapacity, sizeof(LvnMemTrackSlot)));
+
+    uint32_t mask = table->slotCapacity - 1;
+    for (uint32_t i = 0; i < oldCapacity; i++)
+    {
+        if (oldSlots[i].key == nullptr) { continue; }
+
+        uint32_t index = memTrackHash(reinterpret_cast<uintptr_t>(oldSlots[i].key) ^ reinterpret_cast<uintptr_t>(oldSlots[i].file) ^ oldSlots[i].line) & mask;
+        while (table->slots[index].key != nullptr)
+            index = (index + 1) & mask;
+        table->slots[index] = oldSlots[i];
+    }
+
+    free(oldSlots);
+}
+
+static uint32_t memTrackFindGroup(LvnMemTrackGroupTable* table, const char* key, const char* file, int line)
+{
+    if ((table->slotCount + 1) * 2 > table->slotCapacity)
+        memTrackGrowSlots(table);
+
+    uint32_t mask = table->slotCapacity - 1;
+    uint32_t index = memTrackHash(reinterpret_cast<uintptr_t>(key) ^ reinterpret_cast<uintptr_t>(file) ^ line) & mask;
+    for (; table->slots[index].key != nullptr; index = (index + 1) & mask)
+    {
+        const LvnMemTrackSlot& slot = table->slots[index];
+        if (slot.key == key && slot.file == file && slot.line == line)
+            return slot.group;
+    }
+
+    // new pointers, only compare the strings of every group once per pointer
+    char* name = key == s_MemTrackRawName ? nullptr : memTrackTypeName(key);
+    const char* groupName = name ? name : s_MemTrackRawName;
+
+    uint32_t group = LVN_MEM_TRACK_NULL_GROUP;
+    for (uint32_t i = 0; i < table->groupCount; i++)
+    {
+        const LvnMemTrackStats& stats = table->groups[i];
+        if (stats.line == line && memTrackStrEqual(stats.name, groupName) && memTrackStrEqual(stats.file, file))
+        {
+            group = i;
+            break;
+        }
+    }
+
+    if (group == LVN_MEM_TRACK_NULL_GROUP)
+    {
+        if (table->groupCount == table->groupCapacity)
+        {
+            uint32_t capacity = table->groupCapacity ? table->groupCapacity * 2 : 64;
+            LvnMemTrackStats* groups = static_cast<LvnMemTrackStats*>(memTrackCalloc(capacity, sizeof(LvnMemTrackStats)));
+            if (table->groupCount > 0) { memcpy(groups, table->groups, table->groupCount * sizeof(LvnMemTrackStats)); }
+            free(table->groups);
+            table->groups = groups;
+            table->groupCapacity = capacity;
+        }
+
+        group = table->groupCount++;
+        LvnMemTrackStats& stats = table->groups[group];
+        stats.name = groupName;
+        stats.file = file;
+        stats.line = line;
+    }
+    else
+    {
+        free(name);
+    }
+
+    table->slots[index] = { key, file, line, group };
+    table->slotCount++;
+    return group;
+}
+
+static void memTrackFreeGroups(LvnMemTrackGroupTable* table)
+{
+    for (uint32_t i = 0; i < table->groupCount; i++)
+    {
+        if (table->groups[i].name != s_MemTrackRawName)
+            free(const_cast<char*>(table->groups[i].name));
+    }
+
+    free(table->groups);
+    free(table->slots);
+    *table = {};
+}
+
+static void memTrackGrowAllocations()
+{
+    uint64_t oldCapacity = s_MemTracker.allocationCapacity;
+    LvnMemTrackAllocation* oldAllocations = s_MemTracker.allocations;
+
+    s_MemTracker.allocationCapacity = oldCapacity ? oldCapacity * 2 : LVN_MEM_TRACK_MIN_CAPACITY;
+    s_MemTracker.allocations = static_cast<LvnMemTrackAllocation*>(memTrackCalloc(s_MemTracker.allocationCapacity, sizeof(LvnMemTrackAllocation)));
+
+    uint64_t mask = s_MemTracker.allocationCapacity - 1;
+    for (uint64_t i = 0; i < oldCapacity; i++)
+    {
+        if (oldAllocations[i].ptr == nullptr) { continue; }
+
+        uint64_t index = memTrackHash(reinterpret_cast<uintptr_t>(oldAllocations[i].ptr)) & mask;
+        while (s_MemTracker.allocations[index].ptr != nullptr)
+            index = (index + 1) & mask;
+        s_MemTracker.allocations[index] = oldAllocations[i];
+    }
+
+    free(oldAllocations);
+}
+
+static void memTrackAddBytes(LvnMemTrackStats* stats, uint64_t size)
+{
+    stats->liveCount++;
+    stats->liveBytes += size;
+    stats->totalCount++;
+    stats->totalBytes += size;
+    if (stats->liveBytes > stats->peakBytes) { stats->peakBytes = stats->liveBytes; }
+}
+
+static void memTrackRemoveBytes(LvnMemTrackStats* stats, uint64_t size)
+{
+    stats->liveCount--;
+    stats->liveBytes -= size;
+}
+
+static void memTrackInsertAllocation(void* ptr, uint64_t size, uint32_t type, uint32_t site)
+{
+    if ((s_MemTracker.allocationCount + 1) * 4 > s_MemTracker.allocationCapacity * 3)
+        memTrackGrowAllocations();
+
+    uint64_t mask = s_MemTracker.allocationCapacity - 1;
+    uint64_t index = memTrackHash(reinterpret_cast<uintptr_t>(ptr)) & mask;
+    while (s_MemTracker.allocations[index].ptr != nullptr && s_MemTracker.allocations[index].ptr != ptr)
+        index = (index + 1) & mask;
+
+    // a pointer that is already recorded was freed without the tracker seeing it (eg. freed with the mem funcs directly)
+    LvnMemTrackAllocation& alloc = s_MemTracker.allocations[index];
+    if (alloc.ptr == ptr)
+    {
+        memTrackRemoveBytes(&s_MemTracker.types.groups[alloc.type], alloc.size);
+        if (alloc.site != LVN_MEM_TRACK_NULL_GROUP) { memTrackRemoveBytes(&s_MemTracker.sites.groups[alloc.site], alloc.size); }
+    }
+    else
+    {
+        s_MemTracker.allocationCount++;
+    }
+
+    alloc = { ptr, size, type, site };
+    memTrackAddBytes(&s_MemTracker.types.groups[type], size);
+    if (site != LVN_MEM_TRACK_NULL_GROUP) { memTrackAddBytes(&s_MemTracker.sites.groups[site], size); }
+}
+
+// removes the allocation and moves the following allocations back so that no tombstones are needed
+static bool memTrackRemoveAllocation(void* ptr, LvnMemTrackAllocation* removed)
+{
+    if (s_MemTracker.allocationCapacity == 0) { return false; }
+
+    uint64_t mask = s_MemTracker.allocationCapacity - 1;
+    uint64_t index = memTrackHash(reinterpret_cast<uintptr_t>(ptr)) & mask;
+    while (s_MemTracker.allocations[index].ptr != ptr)
+    {
+        if (s_MemTracker.allocations[index].ptr == nullptr) { return false; }
+        index = (index + 1) & mask;
+    }
+
+    *removed = s_MemTracker.allocations[index];
+    memTrackRemoveBytes(&s_MemTracker.types.groups[removed->type], removed->size);
+    if (removed->site != LVN_MEM_TRACK_NULL_GROUP) { memTrackRemoveBytes(&s_MemTracker.sites.groups[removed->site], removed->size); }
+
+    uint64_t hole = index;
+    for (uint64_t next = (index + 1) & mask; s_MemTracker.allocations[next].ptr != nullptr; next = (next + 1) & mask)
+    {
+        uint64_t home = memTrackHash(reinterpret_cast<uintptr_t>(s_MemTracker.allocations[next].ptr)) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            s_MemTracker.allocations[hole] = s_MemTracker.allocations[next];
+            hole = next;
+        }
+    }
+
+    s_MemTracker.allocations[hole] = {};
+    s_MemTracker.allocationCount--;
+    return true;
+}
+
+// copies the groups sorted by peak bytes, count is the number of stats pStats can hold and is set to the number written
+static void memTrackGetGroups(const LvnMemTrackGroupTable* table, LvnMemTrackStats* pStats, uint32_t* statCount)
+{
+    if (pStats == nullptr)
+    {
+        *statCount = table->groupCount;
+        return;
+    }
+
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < table->groupCount; i++)
+    {
+        const LvnMemTrackStats& stats = table->groups[i];
+
+        // insertion into the sorted output, groups that would fall off the end are skipped
+        uint32_t j = count < *statCount ? count : *statCount;
+        if (j == *statCount && (j == 0 || pStats[j - 1].peakBytes >= stats.peakBytes)) { continue; }
+        if (j == *statCount) { j--; }
+        for (; j > 0 && pStats[j - 1].peakBytes < stats.peakBytes; j--)
+            pStats[j] = pStats[j - 1];
+        pStats[j] = stats;
+        if (count < *statCount) { count++; }
+    }
+
+    *statCount = count;
+}
+
+
+// -- [SUBSECT]: Memory Tracking Functions
+// ------------------------------------------------------------
+
+void memTrackInit()
+{
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+
+    for (uint32_t i = 0; i < Lvn_Stype_Max_Value; i++)
+        s_MemTracker.objects[i] = {};
+
+    lvn::i_MemTrackingEnabled.store(true, std::memory_order_relaxed);
+}
+
+void memTrackTerminate()
+{
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+
+    lvn::i_MemTrackingEnabled.store(false, std::memory_order_relaxed);
+
+    free(s_MemTracker.allocations);
+    s_MemTracker.allocations = nullptr;
+    s_MemTracker.allocationCount = 0;
+    s_MemTracker.allocationCapacity = 0;
+
+    memTrackFreeGroups(&s_MemTracker.types);
+    memTrackFreeGroups(&s_MemTracker.sites);
+}
+
+void memTrackRealloc(void* oldPtr, void* newPtr, size_t size)
+{
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+    if (!lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { return; }
+
+    // the reallocated memory stays under the type and site it was first allocated from
+    LvnMemTrackAllocation removed;
+    if (oldPtr == nullptr || !memTrackRemoveAllocation(oldPtr, &removed))
+    {
+        removed.type = memTrackFindGroup(&s_MemTracker.types, s_MemTrackRawName, nullptr, 0);
+        removed.site = LVN_MEM_TRACK_NULL_GROUP;
+    }
+
+    memTrackInsertAllocation(newPtr, size, removed.type, removed.site);
+}
+
+void memTrackObject(LvnStructureType sType, uint64_t size, bool create)
+{
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+
+    LvnMemTrackObject& object = s_MemTracker.objects[sType];
+    object.objectSize = size;
+    if (create)
+    {
+        object.liveCount++;
+        if (object.liveCount > object.peakCount) { object.peakCount = object.liveCount; }
+    }
+    else if (object.liveCount > 0)
+    {
+        object.liveCount--;
+    }
+}
+
+void memTrackSetPoolBinding(LvnStructureType sType, uint64_t baseCount, uint64_t blockCount)
+{
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+
+    s_MemTracker.objects[sType].poolBaseCount = baseCount;
+    s_MemTracker.objects[sType].poolBlockCount = blockCount;
+}
+
+bool memIsTrackingEnabled()
+{
+    return lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed);
+}
+
+void memTrackAlloc(void* ptr, size_t size, const char* name, const char* file, int line)
+{
+    if (ptr == nullptr) { return; }
+
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+    if (!lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { return; }
+
+    const char* key = name ? name : s_MemTrackRawName;
+    uint32_t type = memTrackFindGroup(&s_MemTracker.types, key, nullptr, 0);
+    uint32_t site = file ? memTrackFindGroup(&s_MemTracker.sites, key, file, line) : LVN_MEM_TRACK_NULL_GROUP;
+
+    memTrackInsertAllocation(ptr, size, type, site);
+}
+
+void memTrackFree(void* ptr)
+{
+    if (ptr == nullptr) { return; }
+
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+    if (!lvn::i_MemTrackingEnabled.load(std::memory_order_relaxed)) { return; }
+
+    LvnMemTrackAllocation removed;
+    memTrackRemoveAllocation(ptr, &removed);
+}
+
+void memGetTrackedTypes(LvnMemTrackStats* pStats, uint32_t* statCount)
+{
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+    memTrackGetGroups(&s_MemTracker.types, pStats, statCount);
+}
+
+void memGetTrackedSites(LvnMemTrackStats* pStats, uint32_t* statCount)
+{
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+    memTrackGetGroups(&s_MemTracker.sites, pStats, statCount);
+}
+
+void memGetObjectStats(LvnMemObjectStats* pStats, uint32_t* statCount)
+{
+    if (statCount == nullptr) { return; }
+
+    if (pStats == nullptr)
+    {
+        *statCount = Lvn_Stype_Max_Value;
+        return;
+    }
+
+    // statCount holds the capacity of pStats, the number of stats written is returned in it
+    uint32_t count = lvn::min(*statCount, static_cast<uint32_t>(Lvn_Stype_Max_Value));
+
+    std::lock_guard<std::mutex> lock(s_MemTracker.lock);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const LvnMemTrackObject& object = s_MemTracker.objects[i];
+
+        pStats[i] = {};
+        pStats[i].sType = static_cast<LvnStructureType>(i);
+        pStats[i].objectSize = object.objectSize;
+        pStats[i].liveCount = object.liveCount;
+        pStats[i].peakCount = object.peakCount;
+        pStats[i].poolBaseCount = object.poolBaseCount;
+        pStats[i].poolBlockCount = object.poolBlockCount;
+
+        // a binding only allocates a new block once the base memory and every block before it is full
+        if (object.poolBlockCount > 0 && object.peakCount > object.poolBaseCount)
+            pStats[i].poolBlocksAllocated = (object.peakCount - object.poolBaseCount + object.poolBlockCount - 1) / object.poolBlockCount;
+    }
+    *statCount = count;
+}
+
+} /* namespace lvn */
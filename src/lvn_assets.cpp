@@ -0,0 +1,631 @@
+#include "levikno.h"
+#include "levikno_internal.h"
+
+#include "lvn_loaders.h"
+
+// [FILE]: lvn_assets.cpp (Asset Manager)
+// ------------------------------------------------------------
+//
+// [SECTION]: Asset Manager
+// -- [SUBSECT]: Asset Loading
+// -- [SUBSECT]: Asset Uploads
+// -- [SUBSECT]: Asset Manager Functions
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+
+// ------------------------------------------------------------
+// [SECTION]: Asset Manager
+// ------------------------------------------------------------
+// - texture and font files are read with lvn::asyncRead, the read callback submits a job that decodes the file on the job system
+// - model loaders read their own files (gltf buffers and images can be in other files), so models are decoded in a job straight away
+// - texture mip levels and bc compression (LvnAssetLoadInfo::genMipLevels and compression) are done by the same decoding job, the
+//   render thread only uploads the finished levels, ktx2 and dds textures skip decoding and use the levels stored in the file
+// - decoded assets are handed back to the render thread through a locked list, lvn::assetManagerUpdate then creates their graphics
+//   objects in priority order until the byte or time budget of the frame is used, at least one asset is uploaded per update so that
+//   assets larger than the budget still finish
+// - the handle table, path map and reference counts are only used from the render thread, workers only write the decoded data of
+//   the asset they were given before passing it back
+
+#define LVN_ASSET_DEFAULT_UPLOAD_BUDGET_BYTES   (16 * 1024 * 1024)
+#define LVN_ASSET_DEFAULT_UPLOAD_BUDGET_MS      (2.0f)
+
+struct LvnAsset
+{
+    LvnAssetType type;
+    LvnAssetStatus status;
+    LvnString filepath;
+    LvnString key;                 /* key in the path map, the type, font size and path */
+    uint64_t handleId;
+    uint32_t refCount;
+    LvnIoPriority priority;
+
+    LvnAssetLoadInfo loadInfo;     /* filepath points to the filepath string of the asset */
+
+    // decoded data, written by the decoding job before the asset is passed back to the render thread
+    LvnBin fileData;
+    LvnImageData image;
+    LvnVector<LvnImageData> mipLevels;
+    LvnModelData* modelData;
+    LvnFont font;
+    uint64_t uploadSize;
+    bool decodeFailed;
+
+    // graphics objects
+    LvnTexture* texture;
+    LvnModel model;
+};
+
+struct LvnAssetManager
+{
+    LvnHandleTable assets;
+    LvnHashMap<LvnString, uint64_t> paths;                     /* asset key to handle id */
+    LvnQueue<LvnAsset*> uploadQueues[Lvn_IoPriority_Max_Value]; /* decoded assets waiting for an upload */
+
+    std::mutex decodedLock;
+    LvnVector<LvnAsset*> decoded;                               /* assets passed back from the workers since the last update */
+    std::atomic<uint32_t> pendingCount;                         /* assets being read or decoded */
+    LvnJobCounter decodeCounter;
+
+    LvnTexture* placeholderTexture;
+    bool ownsPlaceholder;
+    uint64_t uploadBudgetBytes;
+    float uploadBudgetMs;
+
+    uint32_t lastUploadCount;
+    uint64_t lastUploadBytes;
+    float lastUploadMs;
+};
+
+namespace lvn
+{
+
+static LvnUniquePtr<LvnAssetManager> s_AssetManager;
+
+static void assetPassDecoded(LvnAsset* asset);
+static void assetPrepareTexture(LvnAsset* asset);
+static void assetDecodeJob(void* data);
+static void assetReadCallback(LvnIoRequest* request, void* userData);
+static void assetFreeDecodedData(LvnAsset* asset);
+static void assetDestroy(LvnAssetManager* assetManager, LvnAsset* asset);
+static bool assetUpload(LvnAsset* asset);
+
+
+// -- [SUBSECT]: Asset Loading
+// ------------------------------------------------------------
+
+static void assetPassDecoded(LvnAsset* asset)
+{
+    LvnAssetManager* assetManager = s_AssetManager.get();
+
+    {
+        std::lock_guard<std::mutex> lock(assetManager->decodedLock);
+        assetManager->decoded.push_back(asset);
+    }
+    assetManager->pendingCount.fetch_sub(1, std::memory_order_release);
+}
+
+// generates and compresses the mip levels of a decoded texture if the load info asks for them, textures from ktx2/dds files
+// keep the levels and block format stored in the file
+static void assetPrepareTexture(LvnAsset* asset)
+{
+    const LvnAssetLoadInfo& loadInfo = asset->loadInfo;
+
+    if (!asset->image.mipLevels.empty())
+    {
+        asset->mipLevels = lvn::move(asset->image.mipLevels);
+    }
+    else if (loadInfo.genMipLevels && asset->image.compression == Lvn_TextureCompression_None)
+    {
+        asset->mipLevels.resize(lvn::imageGetMipLevelCount(asset->image.width, asset->image.height));
+        if (lvn::imageGenMipLevels(asset->image, asset->mipLevels.data(), asset->mipLevels.size(), loadInfo.mipFilter, loadInfo.format) != Lvn_Result_Success)
+        {
+            asset->decodeFailed = true;
+            return;
+        }
+    }
+
+    if (loadInfo.compression != Lvn_TextureCompression_None && asset->image.compression == Lvn_TextureCompression_None)
+    {
+        asset->image = lvn::imageCompress(asset->image, loadInfo.compression);
+        asset->decodeFailed = asset->image.pixels.empty();
+
+        for (uint32_t i = 0; i < asset->mipLevels.size(); i++)
+        {
+            asset->mipLevels[i] = lvn::imageCompress(asset->mipLevels[i], loadInfo.compression);
+            asset->decodeFailed |= asset->mipLevels[i].pixels.empty();
+        }
+    }
+}
+
+static void assetDecodeJob(void* data)
+{
+    LvnAsset* asset = static_cast<LvnAsset*>(data);
+    LVN_PROFILE_SCOPE("assetDecode");
+
+    switch (asset->type)
+    {
+        case Lvn_AssetType_Texture:
+        {
+            // ktx2 and dds files are not decoded, the levels point into the file data that was read
+            if (lvn::isTextureContainer(asset->fileData.data(), asset->fileData.size()))
+                lvn::loadTextureContainer(asset->fileData, &asset->image);
+            else
+                asset->image = lvn::loadImageDataMemoryThread(asset->fileData.data(), static_cast<int>(asset->fileData.size()), 4, asset->loadInfo.flipVertically);
+
+            asset->decodeFailed = asset->image.pixels.empty();
+            if (!asset->decodeFailed)
+                lvn::assetPrepareTexture(asset);
+
+            asset->uploadSize = asset->image.size;
+            for (uint32_t i = 0; i < asset->mipLevels.size(); i++)
+                asset->uploadSize += asset->mipLevels[i].size;
+            break;
+        }
+        case Lvn_AssetType_Model:
+        {
+            asset->modelData = lvn::loadModelData(asset->filepath.c_str());
+            asset->decodeFailed = asset->modelData == nullptr;
+            asset->uploadSize = asset->modelData ? asset->modelData->uploadSize : 0;
+            break;
+        }
+        case Lvn_AssetType_Font:
+        {
+            asset->font = lvn::loadFontFromFileTTFMemory(asset->fileData.data(), asset->fileData.size(), asset->loadInfo.fontSize);
+            asset->decodeFailed = asset->font.atlas.pixels.empty();
+            asset->uploadSize = asset->font.atlas.size;
+            break;
+        }
+
+        default: { asset->decodeFailed = true; break; }
+    }
+
+    // the file data is not needed once decoded, font glyphs are rasterized into the atlas while loading
+    asset->fileData = {};
+
+    lvn::assetPassDecoded(asset);
+}
+
+// called on an I/O thread once the file has been read
+static void assetReadCallback(LvnIoRequest* request, void* userData)
+{
+    LvnAsset* asset = static_cast<LvnAsset*>(userData);
+
+    if (lvn::ioGetStatus(request) != Lvn_IoStatus_Complete)
+    {
+        asset->decodeFailed = true;
+        lvn::assetPassDecoded(asset);
+        return;
+    }
+
+    asset->fileData = lvn::ioGetData(request);
+
+    LvnJob job{};
+    job.func = lvn::assetDecodeJob;
+    job.data = asset;
+    lvn::jobSubmit(&job, 1, &s_AssetManager->decodeCounter);
+}
+
+static void assetFreeDecodedData(LvnAsset* asset)
+{
+    asset->fileData = {};
+    asset->image = {};
+    asset->mipLevels = {};
+
+    if (asset->modelData != nullptr)
+    {
+        lvn::freeModelData(asset->modelData);
+        asset->modelData = nullptr;
+    }
+
+    // fonts are kept once ready since their glyphs are needed to draw text
+    if (asset->status != Lvn_AssetStatus_Ready)
+        asset->font = {};
+}
+
+static void assetDestroy(LvnAssetManager* assetManager, LvnAsset* asset)
+{
+    lvn::assetFreeDecodedData(asset);
+
+    if (asset->texture != nullptr)
+        lvn::destroyTexture(asset->texture);
+    if (asset->type == Lvn_AssetType_Model && asset->status == Lvn_AssetStatus_Ready)
+        lvn::unloadModel(&asset->model);
+
+    assetManager->paths.erase(asset->key);
+    assetManager->assets.remove(asset->handleId);
+    lvn::memDelete(asset);
+}
+
+
+// -- [SUBSECT]: Asset Uploads
+// ------------------------------------------------------------
+
+// creates the graphics objects of a decoded asset, returns false if the graphics objects could not be created
+static bool assetUpload(LvnAsset* asset)
+{
+    LVN_PROFILE_SCOPE("assetUpload");
+
+    switch (asset->type)
+    {
+        case Lvn_AssetType_Texture:
+        case Lvn_AssetType_Font:
+        {
+            LvnTextureCreateInfo textureCreateInfo{};
+            textureCreateInfo.imageData = asset->type == Lvn_AssetType_Texture ? asset->image : asset->font.atlas;
+            textureCreateInfo.format = asset->loadInfo.format;
+            textureCreateInfo.minFilter = asset->loadInfo.minFilter;
+            textureCreateInfo.magFilter = asset->loadInfo.magFilter;
+            textureCreateInfo.wrapS = asset->loadInfo.wrapS;
+            textureCreateInfo.wrapT = asset->loadInfo.wrapT;
+
+            if (asset->type == Lvn_AssetType_Texture)
+            {
+                textureCreateInfo.pMipLevels = asset->mipLevels.data();
+                textureCreateInfo.mipLevelCount = asset->mipLevels.size();
+                textureCreateInfo.compression = asset->image.compression;
+            }
+
+            LvnResult result = lvn::createTexture(&asset->texture, &textureCreateInfo);
+            asset->image = {};
+            asset->mipLevels = {};
+            if (result != Lvn_Result_Success)
+            {
+                asset->texture = nullptr;
+                return false;
+            }
+            return true;
+        }
+        case Lvn_AssetType_Model:
+        {
+            asset->model = lvn::createModelFromData(asset->modelData);
+            asset->modelData = nullptr;
+            return true;
+        }
+
+        default: { return false; }
+    }
+}
+
+
+// -- [SUBSECT]: Asset Manager Functions
+// ------------------------------------------------------------
+
+LvnResult assetManagerInit(const LvnAssetManagerCreateInfo* createInfo)
+{
+    if (s_AssetManager) { return Lvn_Result_AlreadyCalled; }
+
+    LVN_CORE_ASSERT(createInfo != nullptr, "createInfo is nullptr, cannot start asset manager");
+
+    s_AssetManager = lvn::makeUniquePtr<LvnAssetManager>();
+    LvnAssetManager* assetManager = s_AssetManager.get();
+
+    assetManager->pendingCount.store(0, std::memory_order_relaxed);
+    assetManager->uploadBudgetBytes = createInfo->uploadBudgetBytes ? createInfo->uploadBudgetBytes : LVN_ASSET_DEFAULT_UPLOAD_BUDGET_BYTES;
+    assetManager->uploadBudgetMs = createInfo->uploadBudgetMs > 0.0f ? createInfo->uploadBudgetMs : LVN_ASSET_DEFAULT_UPLOAD_BUDGET_MS;
+    assetManager->placeholderTexture = createInfo->placeholderTexture;
+    assetManager->ownsPlaceholder = false;
+
+    if (assetManager->placeholderTexture == nullptr)
+    {
+        uint8_t whiteTextureImageData[4] = { 0xff, 0xff, 0xff, 0xff };
+
+        LvnImageData imageData;
+        imageData.pixels = LvnData<uint8_t>(whiteTextureImageData, sizeof(whiteTextureImageData));
+        imageData.width = 1;
+        imageData.height = 1;
+        imageData.channels = 4;
+        imageData.size = 4;
+
+        LvnTextureCreateInfo textureCreateInfo{};
+        textureCreateInfo.imageData = imageData;
+        textureCreateInfo.format = Lvn_TextureFormat_Unorm;
+        textureCreateInfo.wrapS = Lvn_TextureMode_Repeat;
+        textureCreateInfo.wrapT = Lvn_TextureMode_Repeat;
+        textureCreateInfo.minFilter = Lvn_TextureFilter_Nearest;
+        textureCreateInfo.magFilter = Lvn_TextureFilter_Nearest;
+
+        if (lvn::createTexture(&assetManager->placeholderTexture, &textureCreateInfo) != Lvn_Result_Success)
+        {
+            LVN_CORE_ERROR("assetManagerInit(const LvnAssetManagerCreateInfo*) | failed to create placeholder texture");
+            s_AssetManager.reset(nullptr);
+            return Lvn_Result_Failure;
+        }
+
+        assetManager->ownsPlaceholder = true;
+    }
+
+    return Lvn_Result_Success;
+}
+
+void assetManagerTerminate()
+{
+    if (!s_AssetManager) { return; }
+
+    LvnAssetManager* assetManager = s_AssetManager.get();
+
+    // wait for the reads and decodes still in flight, waiting on the counter runs decode jobs on this thread if no worker takes them
+    while (assetManager->pendingCount.load(std::memory_order_acquire) > 0)
+    {
+        lvn::jobWait(&assetManager->decodeCounter);
+        std::this_thread::yield();
+    }
+
+    // a decode job passes its asset back before the job system releases the counter
+    lvn::jobWait(&assetManager->decodeCounter);
+
+    // destroying an asset swaps the last asset into its place, destroy from the back
+    while (!assetManager->assets.empty())
+    {
+        LvnAsset* asset = static_cast<LvnAsset*>(assetManager->assets.objects()[assetManager->assets.size() - 1]);
+        lvn::assetDestroy(assetManager, asset);
+    }
+
+    if (assetManager->ownsPlaceholder)
+        lvn::destroyTexture(assetManager->placeholderTexture);
+
+    s_AssetManager.reset(nullptr);
+}
+
+bool assetManagerIsInitialized()
+{
+    return s_AssetManager;
+}
+
+uint32_t assetManagerUpdate()
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+    LvnAssetManager* assetManager = s_AssetManager.get();
+
+    LVN_PROFILE_SCOPE("assetManagerUpdate");
+
+    LvnVector<LvnAsset*> decoded;
+    {
+        std::lock_guard<std::mutex> lock(assetManager->decodedLock);
+        decoded = std::move(assetManager->decoded);
+    }
+
+    for (uint32_t i = 0; i < decoded.size(); i++)
+    {
+        LvnAsset* asset = decoded[i];
+
+        // every reference was released while the asset was loading
+        if (asset->refCount == 0)
+        {
+            lvn::assetDestroy(assetManager, asset);
+            continue;
+        }
+
+        if (asset->decodeFailed)
+        {
+            LVN_CORE_ERROR("[asset]: failed to load asset: %s", asset->filepath.c_str());
+            asset->status = Lvn_AssetStatus_Failed;
+            lvn::assetFreeDecodedData(asset);
+            continue;
+        }
+
+        asset->status = Lvn_AssetStatus_Decoded;
+        assetManager->uploadQueues[asset->priority].push(asset);
+    }
+
+    LvnTimer timer;
+    timer.begin();
+
+    uint32_t uploadCount = 0;
+    uint64_t uploadBytes = 0;
+
+    for (int i = Lvn_IoPriority_Max_Value - 1; i >= 0; i--)
+    {
+        LvnQueue<LvnAsset*>& queue = assetManager->uploadQueues[i];
+        while (!queue.empty())
+        {
+            LvnAsset* asset = queue.front();
+
+            // always upload at least one asset so that assets larger than the budget are not stuck
+            if (uploadCount > 0 && (uploadBytes + asset->uploadSize > assetManager->uploadBudgetBytes || timer.elapsedms() >= assetManager->uploadBudgetMs))
+                break;
+
+            queue.pop();
+
+            // released after it was decoded
+            if (asset->refCount == 0)
+            {
+                lvn::assetDestroy(assetManager, asset);
+                continue;
+            }
+
+            if (lvn::assetUpload(asset))
+            {
+                asset->status = Lvn_AssetStatus_Ready;
+                uploadCount++;
+                uploadBytes += asset->uploadSize;
+            }
+            else
+            {
+                LVN_CORE_ERROR("[asset]: failed to create graphics objects for asset: %s", asset->filepath.c_str());
+                asset->status = Lvn_AssetStatus_Failed;
+            }
+
+            lvn::assetFreeDecodedData(asset);
+        }
+
+        if (!queue.empty()) { break; }
+    }
+
+    assetManager->lastUploadCount = uploadCount;
+    assetManager->lastUploadBytes = uploadBytes;
+    assetManager->lastUploadMs = static_cast<float>(timer.elapsedms());
+
+    return uploadCount;
+}
+
+LvnAssetManagerStats assetManagerGetStats()
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+    LvnAssetManager* assetManager = s_AssetManager.get();
+
+    LvnAssetManagerStats stats{};
+    stats.assetCount = assetManager->assets.size();
+    stats.lastUploadCount = assetManager->lastUploadCount;
+    stats.lastUploadBytes = assetManager->lastUploadBytes;
+    stats.lastUploadMs = assetManager->lastUploadMs;
+
+    for (uint32_t i = 0; i < assetManager->assets.size(); i++)
+    {
+        const LvnAsset* asset = static_cast<const LvnAsset*>(assetManager->assets.objects()[i]);
+        switch (asset->status)
+        {
+            case Lvn_AssetStatus_Loading: { stats.loadingCount++; break; }
+            case Lvn_AssetStatus_Decoded: { stats.decodedCount++; break; }
+            case Lvn_AssetStatus_Ready: { stats.readyCount++; break; }
+            case Lvn_AssetStatus_Failed: { stats.failedCount++; break; }
+        }
+    }
+
+    return stats;
+}
+
+LvnAssetHandle assetLoad(const LvnAssetLoadInfo* loadInfo)
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+    LVN_CORE_ASSERT(loadInfo != nullptr, "loadInfo is nullptr, cannot load asset");
+    LvnAssetManager* assetManager = s_AssetManager.get();
+
+    if (loadInfo->filepath == nullptr)
+    {
+        LVN_CORE_ERROR("assetLoad(const LvnAssetLoadInfo*) | loadInfo->filepath is nullptr, cannot load asset");
+        return {};
+    }
+
+    if (static_cast<uint32_t>(loadInfo->type) >= Lvn_AssetType_Max_Value || static_cast<uint32_t>(loadInfo->priority) >= Lvn_IoPriority_Max_Value)
+    {
+        LVN_CORE_ERROR("assetLoad(const LvnAssetLoadInfo*) | loadInfo->type or loadInfo->priority is not valid, cannot load asset: %s", loadInfo->filepath);
+        return {};
+    }
+
+    if (loadInfo->type == Lvn_AssetType_Font && loadInfo->fontSize == 0)
+    {
+        LVN_CORE_ERROR("assetLoad(const LvnAssetLoadInfo*) | loadInfo->fontSize is 0, cannot load font asset: %s", loadInfo->filepath);
+        return {};
+    }
+
+    char keyPrefix[32];
+    snprintf(keyPrefix, sizeof(keyPrefix), "%u:%u:", static_cast<uint32_t>(loadInfo->type), loadInfo->type == Lvn_AssetType_Font ? loadInfo->fontSize : 0);
+    LvnString key(keyPrefix);
+    key += loadInfo->filepath;
+
+    // the asset is already loaded or loading, share it
+    if (uint64_t* handleId = assetManager->paths.find(key))
+    {
+        LvnAsset* asset = static_cast<LvnAsset*>(assetManager->assets.get(*handleId));
+        asset->refCount++;
+        return { *handleId };
+    }
+
+    LvnAsset* asset = LVN_MEM_NEW(LvnAsset, 1);
+    asset->type = loadInfo->type;
+    asset->status = Lvn_AssetStatus_Loading;
+    asset->filepath = loadInfo->filepath;
+    asset->key = key;
+    asset->refCount = 1;
+    asset->priority = loadInfo->priority;
+    asset->loadInfo = *loadInfo;
+    asset->loadInfo.filepath = asset->filepath.c_str();
+    asset->handleId = assetManager->assets.insert(asset);
+    assetManager->paths.insert(key, asset->handleId);
+
+    assetManager->pendingCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (asset->type == Lvn_AssetType_Model)
+    {
+        LvnJob job{};
+        job.func = lvn::assetDecodeJob;
+        job.data = asset;
+        lvn::jobSubmit(&job, 1, &assetManager->decodeCounter);
+    }
+    else
+    {
+        LvnIoReadInfo readInfo{};
+        readInfo.filepath = asset->filepath.c_str();
+        readInfo.priority = asset->priority;
+        readInfo.callback = lvn::assetReadCallback;
+        readInfo.userData = asset;
+
+        if (lvn::asyncRead(&readInfo) != Lvn_Result_Success)
+        {
+            asset->decodeFailed = true;
+            lvn::assetPassDecoded(asset);
+        }
+    }
+
+    return { asset->handleId };
+}
+
+void assetAcquire(LvnAssetHandle asset)
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+
+    LvnAsset* assetPtr = static_cast<LvnAsset*>(s_AssetManager->assets.get(asset.id));
+    if (assetPtr == nullptr) { return; }
+
+    assetPtr->refCount++;
+}
+
+void assetRelease(LvnAssetHandle asset)
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+
+    LvnAsset* assetPtr = static_cast<LvnAsset*>(s_AssetManager->assets.get(asset.id));
+    if (assetPtr == nullptr || assetPtr->refCount == 0) { return; }
+
+    if (--assetPtr->refCount > 0) { return; }
+
+    // assets that are loading are owned by a worker or the upload queue, they are destroyed in lvn::assetManagerUpdate
+    if (assetPtr->status == Lvn_AssetStatus_Ready || assetPtr->status == Lvn_AssetStatus_Failed)
+        lvn::assetDestroy(s_AssetManager.get(), assetPtr);
+}
+
+LvnAssetStatus assetGetStatus(LvnAssetHandle asset)
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+
+    const LvnAsset* assetPtr = static_cast<const LvnAsset*>(s_AssetManager->assets.get(asset.id));
+    return assetPtr ? assetPtr->status : Lvn_AssetStatus_Failed;
+}
+
+LvnTexture* assetGetTexture(LvnAssetHandle asset)
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+
+    const LvnAsset* assetPtr = static_cast<const LvnAsset*>(s_AssetManager->assets.get(asset.id));
+    if (assetPtr == nullptr || assetPtr->status != Lvn_AssetStatus_Ready || assetPtr->texture == nullptr)
+        return s_AssetManager->placeholderTexture;
+
+    return assetPtr->texture;
+}
+
+LvnModel* assetGetModel(LvnAssetHandle asset)
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+
+    LvnAsset* assetPtr = static_cast<LvnAsset*>(s_AssetManager->assets.get(asset.id));
+    if (assetPtr == nullptr || assetPtr->type != Lvn_AssetType_Model || assetPtr->status != Lvn_AssetStatus_Ready)
+        return nullptr;
+
+    return &assetPtr->model;
+}
+
+const LvnFont* assetGetFont(LvnAssetHandle asset)
+{
+    LVN_CORE_ASSERT(s_AssetManager, "asset manager has not been started, call lvn::assetManagerInit");
+
+    const LvnAsset* assetPtr = static_cast<const LvnAsset*>(s_AssetManager->assets.get(asset.id));
+    if (assetPtr == nullptr || assetPtr->type != Lvn_AssetType_Font || assetPtr->status != Lvn_AssetStatus_Ready)
+        return nullptr;
+
+    return &assetPtr->font;
+}
+
+} /* namespace lvn */
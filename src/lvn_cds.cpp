@@ -24,18 +24,21 @@
 // -- [SUBSECT]: LvnTimer
 // ------------------------------------------------------------
 
+// steady clock ticks are stored directly, elapsed only scales the difference by the clock period
+static constexpr double s_TimerSecondsPerTick = static_cast<double>(std::chrono::steady_clock::period::num) / std::chrono::steady_clock::period::den;
+
 void LvnTimer::begin()
 {
-    m_Start = m_Current = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    m_Start = m_Current = std::chrono::steady_clock::now().time_since_epoch().count();
 }
 void LvnTimer::reset()
 {
-    m_Start = m_Current = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    m_Start = m_Current = std::chrono::steady_clock::now().time_since_epoch().count();
 }
 double LvnTimer::elapsed()
 {
-    m_Current = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<int64_t, std::ratio<1, 1000000000>>(m_Current - m_Start)).count() * 0.001 * 0.001 * 0.001;
+    m_Current = std::chrono::steady_clock::now().time_since_epoch().count();
+    return static_cast<double>(m_Current - m_Start) * s_TimerSecondsPerTick;
 }
 double LvnTimer::elapsedms()
 {
@@ -142,49 +145,97 @@ void LvnMutex::unlock()
 // -- [SUBSECT]: LvnString
 // ------------------------------------------------------------
 
+void LvnString::init(const char* data, size_t size)
+{
+    m_Size = size;
+    if (size < s_LocalCapacity)
+    {
+        m_Data = m_Local;
+    }
+    else
+    {
+        m_Data = lvn::memNew<char>(size + 1, false, LVN_FILE_NAME, LVN_LINE);
+        m_Capacity = size + 1;
+    }
+    memcpy(m_Data, data, size * sizeof(char));
+    m_Data[m_Size] = '\0';
+}
+void LvnString::move_from(LvnString& other)
+{
+    m_Size = other.m_Size;
+    if (other.is_local())
+    {
+        m_Data = m_Local;
+        memcpy(m_Local, other.m_Local, other.m_Size + 1);
+    }
+    else
+    {
+        /* take ownership of the heap buffer and reset other to an empty inline string */
+        m_Data = other.m_Data;
+        m_Capacity = other.m_Capacity;
+        other.m_Data = other.m_Local;
+    }
+    other.m_Size = 0;
+    other.m_Data[0] = '\0';
+}
+
 LvnString::LvnString()
 {
-    m_Data = lvn::memNew<char>();
+    m_Data = m_Local;
     m_Data[0] = '\0';
     m_Size = 0;
-    m_Capacity = 1;
 }
 LvnString::~LvnString()
 {
-    lvn::memDelete<char>(m_Data);
-    m_Size = m_Capacity = 0;
+    if (!is_local())
+        lvn::memDelete<char>(m_Data);
+    m_Size = 0;
     m_Data = nullptr;
 }
 LvnString::LvnString(const char* str)
 {
-    m_Size = strlen(str);
-    m_Capacity = m_Size + 1;
-    m_Data = lvn::memNew<char>(m_Capacity);
-    memcpy(m_Data, str, m_Capacity);
+    init(str, strlen(str));
 }
 LvnString::LvnString(const char* data, size_t size)
 {
-    m_Size = size;
-    m_Capacity = m_Size + 1;
-    m_Data = lvn::memNew<char>(m_Capacity);
-    memcpy(m_Data, data, m_Capacity);
-    m_Data[m_Size] = '\0';
+    init(data, size);
+}
+LvnString::LvnString(const LvnStringView& view)
+{
+    init(view.data(), view.size());
 }
 LvnString::LvnString(const LvnString& other)
 {
-    m_Size = other.m_Size;
-    m_Capacity = other.m_Capacity;
-    m_Data = lvn::memNew<char>(other.m_Capacity);
-    memcpy(m_Data, other.m_Data, other.m_Capacity);
+    init(other.m_Data, other.m_Size);
+}
+LvnString::LvnString(LvnString&& other)
+{
+    move_from(other);
 }
 LvnString& LvnString::operator=(const LvnString& other)
 {
     if (this == &other) return *this;
-    lvn::memDelete<char>(m_Data);
-    m_Size = other.m_Size;
-    m_Capacity = other.m_Capacity;
-    m_Data = lvn::memNew<char>(other.m_Capacity);
-    memcpy(m_Data, other.m_Data, other.m_Capacity);
+
+    /* reuse the current buffer when the other string fits */
+    if (other.m_Size < capacity())
+    {
+        memcpy(m_Data, other.m_Data, other.m_Size * sizeof(char));
+        m_Size = other.m_Size;
+        m_Data[m_Size] = '\0';
+        return *this;
+    }
+
+    if (!is_local())
+        lvn::memDelete<char>(m_Data);
+    init(other.m_Data, other.m_Size);
+    return *this;
+}
+LvnString& LvnString::operator=(LvnString&& other)
+{
+    if (this == &other) return *this;
+    if (!is_local())
+        lvn::memDelete<char>(m_Data);
+    move_from(other);
     return *this;
 }
 
@@ -199,25 +250,25 @@ const char& LvnString::operator [](size_t index) const
     return m_Data[index];
 }
 
-bool LvnString::operator ==(const LvnString& other)
+bool LvnString::operator ==(const LvnString& other) const
 {
     if (this->length() != other.length())
         return false;
     return memcmp(m_Data, other.m_Data, this->length()) == 0;
 }
-bool LvnString::operator !=(const LvnString& other)
+bool LvnString::operator !=(const LvnString& other) const
 {
     if (this->length() != other.length())
         return true;
     return memcmp(m_Data, other.m_Data, this->length()) != 0;
 }
-bool LvnString::operator ==(const char* str)
+bool LvnString::operator ==(const char* str) const
 {
     if (!str) { return false; }
     if (this->length() != strlen(str)) { return false; }
     return memcmp(m_Data, str, length()) == 0;
 }
-bool LvnString::operator !=(const char* str)
+bool LvnString::operator !=(const char* str) const
 {
     if (!str) { return true; }
     if (this->length() != strlen(str)) { return true; }
@@ -338,16 +389,22 @@ void LvnString::insert_index(size_t index, const char* data, size_t size)
 }
 void LvnString::reserve(size_t size)
 {
-    if (size <= m_Capacity) { return; }
-    char* temp = lvn::memNew<char>(size);
-    memcpy(temp, m_Data, m_Size * sizeof(char));
-    lvn::memDelete<char>(m_Data);
+    if (size <= capacity()) { return; }
+    char* temp = lvn::memNew<char>(size, false, LVN_FILE_NAME, LVN_LINE);
+    memcpy(temp, m_Data, (m_Size + 1) * sizeof(char));
+    if (!is_local())
+        lvn::memDelete<char>(m_Data);
     m_Data = temp;
-    m_Capacity = size;
+    m_Capacity = size; /* NOTE: set after copying since m_Capacity shares memory with the inline buffer */
 }
 void LvnString::resize(size_t size)
 {
-    reserve(size + 1);
+    if (size + 1 > capacity())
+    {
+        /* grow geometrically so that appending characters one at a time is amortized constant time */
+        size_t cap = capacity() * 2;
+        reserve(cap > size + 1 ? cap : size + 1);
+    }
     m_Size = size;
     m_Data[m_Size] = '\0';
 }
@@ -358,9 +415,11 @@ void LvnString::clear()
 }
 void LvnString::clear_free()
 {
-    lvn::memDelete<char>(m_Data);
-    m_Data = nullptr;
-    m_Size = m_Capacity = 0;
+    if (!is_local())
+        lvn::memDelete<char>(m_Data);
+    m_Data = m_Local;
+    m_Data[0] = '\0';
+    m_Size = 0;
 }
 void LvnString::erase(const char* it)
 {
@@ -373,8 +432,9 @@ void LvnString::erase_index(size_t index)
     LVN_CORE_ASSERT(index < m_Size, "index out of vector size range");
     size_t aftIndex = m_Size - index - 1;
     if (aftIndex != 0)
-        memcpy(&m_Data[index], &m_Data[index + 1], aftIndex * sizeof(char));
+        memmove(&m_Data[index], &m_Data[index + 1], aftIndex * sizeof(char));
     --m_Size;
+    m_Data[m_Size] = '\0';
 }
 void LvnString::push_back(const char& ch)
 {
@@ -0,0 +1,1610 @@
+#include "levikno.h"
+#include "levikno_internal.h"
+
+// [FILE]: lvn_image.cpp (Image Transforms, Mip Generation and Block Compression)
+// ------------------------------------------------------------
+//
+// [SECTION]: Image Transform Kernels
+// -- [SUBSECT]: Transpose Kernels
+// -- [SUBSECT]: Flip Kernels
+// -- [SUBSECT]: Channel Kernels
+// [SECTION]: Mip Generation Kernels
+// -- [SUBSECT]: Mip Filters
+// [SECTION]: Block Compression Kernels
+// -- [SUBSECT]: Endpoint Fitting
+// -- [SUBSECT]: BC1 and BC4 Blocks
+// -- [SUBSECT]: BC7 Blocks
+// [SECTION]: Image Transform Functions
+// [SECTION]: Mip Generation and Compression Functions
+
+// the AVX2 kernels are only compiled when the file is built with AVX2 enabled (LVN_ENABLE_AVX2), there is no runtime dispatch
+#if defined(LVN_SIMD_SSE2) && defined(__AVX2__)
+    #define LVN_SIMD_AVX2
+    #include <immintrin.h>
+#endif
+
+
+// ------------------------------------------------------------
+// [SECTION]: Image Transform Kernels
+// ------------------------------------------------------------
+// - kernels are templated on the number of channels so that a pixel is copied as one fixed size value instead of channel by channel
+// - rotations are a transpose with one of the two axes walked backwards, the image is transposed in square tiles so that the
+//   source and destination tiles both stay in cache, within a tile full blocks go through the SSE2 transpose of the pixel size
+//   (an 8x8 AVX2 transpose of 4 channel pixels measured slower than the 4x4 SSE2 one as the tiles are bound by memory, not shuffles)
+// - horizontal flips swap a block from each end of the row and reverse both with shuffles, the middle of the row is swapped per pixel
+// - 1 and 4 channel images have SIMD kernels, 2 and 3 channel images use the scalar kernels
+// - the AVX2 build adds wider flip kernels and byte shuffles (pshufb) for channel conversion and swizzles
+
+#define LVN_IMAGE_TILE_SIZE             (64)       /* pixels per side of the tiles that rotations are done in */
+
+template<uint32_t N>
+struct LvnImagePixel
+{
+    uint8_t c[N];
+};
+
+namespace lvn
+{
+
+
+// -- [SUBSECT]: Transpose Kernels
+// ------------------------------------------------------------
+// strides are in pixels and may be negative, dst[j * dstStride + i] = src[i * srcStride + j]
+
+template<uint32_t N>
+static void transposeRect(const LvnImagePixel<N>* src, ptrdiff_t srcStride, LvnImagePixel<N>* dst, ptrdiff_t dstStride, uint32_t rows, uint32_t cols)
+{
+    for (uint32_t i = 0; i < rows; i++)
+    {
+        const LvnImagePixel<N>* srcRow = src + (ptrdiff_t)i * srcStride;
+        LvnImagePixel<N>* dstCol = dst + i;
+
+        for (uint32_t j = 0; j < cols; j++)
+            dstCol[(ptrdiff_t)j * dstStride] = srcRow[j];
+    }
+}
+
+/* pixels per side of the blocks transposed by transposeBlock, 0 if the pixel size has no SIMD kernel */
+template<uint32_t N>
+static constexpr uint32_t transposeBlockSize()
+{
+#if defined(LVN_SIMD_SSE2)
+    return N == 1 ? 8 : N == 4 ? 4 : 0;
+#else
+    return 0;
+#endif
+}
+
+#if defined(LVN_SIMD_SSE2)
+static void transposeBlock(const LvnImagePixel<1>* src, ptrdiff_t srcStride, LvnImagePixel<1>* dst, ptrdiff_t dstStride)
+{
+    // 8x8 bytes, rows are interleaved byte, word then dword wise until each 64 bit half holds one column
+    __m128i r[8];
+    for (uint32_t i = 0; i < 8; i++)
+        r[i] = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + (ptrdiff_t)i * srcStride));
+
+    __m128i a0 = _mm_unpacklo_epi8(r[0], r[1]);
+    __m128i a1 = _mm_unpacklo_epi8(r[2], r[3]);
+    __m128i a2 = _mm_unpacklo_epi8(r[4], r[5]);
+    __m128i a3 = _mm_unpacklo_epi8(r[6], r[7]);
+
+    __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+
+    __m128i c[4];
+    c[0] = _mm_unpacklo_epi32(b0, b2);
+    c[1] = _mm_unpackhi_epi32(b0, b2);
+    c[2] = _mm_unpacklo_epi32(b1, b3);
+    c[3] = _mm_unpackhi_epi32(b1, b3);
+
+    for (uint32_t j = 0; j < 4; j++)
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + (ptrdiff_t)(j * 2) * dstStride), c[j]);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + (ptrdiff_t)(j * 2 + 1) * dstStride), _mm_unpackhi_epi64(c[j], c[j]));
+    }
+}
+
+static void transposeBlock(const LvnImagePixel<4>* src, ptrdiff_t srcStride, LvnImagePixel<4>* dst, ptrdiff_t dstStride)
+{
+    // 4x4 pixels
+    __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + srcStride));
+    __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + srcStride * 2));
+    __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + srcStride * 3));
+
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + dstStride), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + dstStride * 2), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + dstStride * 3), _mm_unpackhi_epi64(t2, t3));
+}
+#endif
+
+template<uint32_t N>
+static void transposeTile(const LvnImagePixel<N>* src, ptrdiff_t srcStride, LvnImagePixel<N>* dst, ptrdiff_t dstStride, uint32_t rows, uint32_t cols)
+{
+    constexpr uint32_t blockSize = transposeBlockSize<N>();
+    uint32_t blockRows = 0, blockCols = 0;
+
+    if constexpr (blockSize > 0)
+    {
+        blockRows = rows - rows % blockSize;
+        blockCols = cols - cols % blockSize;
+
+        for (uint32_t i = 0; i < blockRows; i += blockSize)
+            for (uint32_t j = 0; j < blockCols; j += blockSize)
+                transposeBlock(src + (ptrdiff_t)i * srcStride + j, srcStride, dst + (ptrdiff_t)j * dstStride + i, dstStride);
+    }
+
+    // columns left over on the right of the blocks, then every row below the blocks
+    if (blockCols < cols)
+        transposeRect<N>(src + blockCols, srcStride, dst + (ptrdiff_t)blockCols * dstStride, dstStride, blockRows, cols - blockCols);
+    if (blockRows < rows)
+        transposeRect<N>(src + (ptrdiff_t)blockRows * srcStride, srcStride, dst + blockRows, dstStride, rows - blockRows, cols);
+}
+
+template<uint32_t N>
+static void rotatePixels(const uint8_t* srcData, uint8_t* dstData, uint32_t width, uint32_t height, bool clockwise)
+{
+    const LvnImagePixel<N>* src = reinterpret_cast<const LvnImagePixel<N>*>(srcData);
+    LvnImagePixel<N>* dst = reinterpret_cast<LvnImagePixel<N>*>(dstData);
+
+    for (uint32_t ty = 0; ty < height; ty += LVN_IMAGE_TILE_SIZE)
+    {
+        uint32_t rows = lvn::min<uint32_t>(LVN_IMAGE_TILE_SIZE, height - ty);
+
+        for (uint32_t tx = 0; tx < width; tx += LVN_IMAGE_TILE_SIZE)
+        {
+            uint32_t cols = lvn::min<uint32_t>(LVN_IMAGE_TILE_SIZE, width - tx);
+
+            // clockwise: dst[x][height - 1 - y] = src[y][x], the source rows of the tile are walked bottom up
+            // counter clockwise: dst[width - 1 - x][y] = src[y][x], the destination rows of the tile are walked bottom up
+            if (clockwise)
+                transposeTile<N>(src + (size_t)(ty + rows - 1) * width + tx, -(ptrdiff_t)width, dst + (size_t)tx * height + (height - ty - rows), (ptrdiff_t)height, rows, cols);
+            else
+                transposeTile<N>(src + (size_t)ty * width + tx, (ptrdiff_t)width, dst + (size_t)(width - 1 - tx) * height + ty, -(ptrdiff_t)height, rows, cols);
+        }
+    }
+}
+
+
+// -- [SUBSECT]: Flip Kernels
+// ------------------------------------------------------------
+
+#if defined(LVN_SIMD_SSE2)
+static __m128i reverseBytes(__m128i v)
+{
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+#endif
+
+template<uint32_t N>
+static void flipRow(LvnImagePixel<N>* row, uint32_t width)
+{
+    uint32_t left = 0, right = width; /* right is one past the last pixel not yet swapped */
+
+#if defined(LVN_SIMD_AVX2)
+    if constexpr (N == 1)
+    {
+        const __m256i reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        for (; right - left >= 64; left += 32, right -= 32)
+        {
+            __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + left));
+            __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + right - 32));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + left), _mm256_permute4x64_epi64(_mm256_shuffle_epi8(r, reverse), _MM_SHUFFLE(1, 0, 3, 2)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + right - 32), _mm256_permute4x64_epi64(_mm256_shuffle_epi8(l, reverse), _MM_SHUFFLE(1, 0, 3, 2)));
+        }
+    }
+    else if constexpr (N == 4)
+    {
+        const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        for (; right - left >= 16; left += 8, right -= 8)
+        {
+            __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + left));
+            __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + right - 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + left), _mm256_permutevar8x32_epi32(r, reverse));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + right - 8), _mm256_permutevar8x32_epi32(l, reverse));
+        }
+    }
+#endif
+
+#if defined(LVN_SIMD_SSE2)
+    if constexpr (N == 1)
+    {
+        for (; right - left >= 32; left += 16, right -= 16)
+        {
+            __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + left));
+            __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + right - 16));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + left), reverseBytes(r));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + right - 16), reverseBytes(l));
+        }
+    }
+    else if constexpr (N == 4)
+    {
+        for (; right - left >= 8; left += 4, right -= 4)
+        {
+            __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + left));
+            __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + right - 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + left), _mm_shuffle_epi32(r, _MM_SHUFFLE(0, 1, 2, 3)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + right - 4), _mm_shuffle_epi32(l, _MM_SHUFFLE(0, 1, 2, 3)));
+        }
+    }
+#endif
+
+    for (; right - left >= 2; left++, right--)
+        lvn::swap(row[left], row[right - 1]);
+}
+
+template<uint32_t N>
+static void flipPixelsHorizontally(uint8_t* data, uint32_t width, uint32_t height)
+{
+    LvnImagePixel<N>* pixels = reinterpret_cast<LvnImagePixel<N>*>(data);
+
+    for (uint32_t y = 0; y < height; y++)
+        flipRow<N>(pixels + (size_t)y * width, width);
+}
+
+
+// -- [SUBSECT]: Channel Kernels
+// ------------------------------------------------------------
+// - channels are read as gray (1), gray alpha (2), rgb (3) or rgba (4)
+// - gray is copied into each of rgb, rgb is reduced to gray with integer Rec. 601 luma weights, a missing alpha is set to 255
+
+/* c * a / 255 rounded to the nearest integer */
+static uint8_t mulDiv255(uint32_t c, uint32_t a)
+{
+    uint32_t t = c * a + 128;
+    return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+}
+
+template<uint32_t S, uint32_t D>
+static void convertPixelsScalar(const uint8_t* src, uint8_t* dst, size_t count)
+{
+    for (size_t i = 0; i < count; i++, src += S, dst += D)
+    {
+        uint8_t r, g, b, a = 255;
+
+        if constexpr (S <= 2)
+        {
+            r = g = b = src[0];
+            if constexpr (S == 2) a = src[1];
+        }
+        else
+        {
+            r = src[0]; g = src[1]; b = src[2];
+            if constexpr (S == 4) a = src[3];
+        }
+
+        if constexpr (D <= 2)
+        {
+            dst[0] = S <= 2 ? r : static_cast<uint8_t>((77 * r + 150 * g + 29 * b + 128) >> 8);
+            if constexpr (D == 2) dst[1] = a;
+        }
+        else
+        {
+            dst[0] = r; dst[1] = g; dst[2] = b;
+            if constexpr (D == 4) dst[3] = a;
+        }
+    }
+}
+
+template<uint32_t S, uint32_t D>
+static void convertPixels(const uint8_t* src, uint8_t* dst, size_t count)
+{
+    convertPixelsScalar<S, D>(src, dst, count);
+}
+
+#if defined(LVN_SIMD_AVX2)
+template<>
+void convertPixels<3, 4>(const uint8_t* src, uint8_t* dst, size_t count)
+{
+    // 4 pixels per step, each load reads 16 bytes for 12 bytes of pixels so the last pixels are left to the scalar kernel
+    const __m128i expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000));
+
+    size_t i = 0;
+    for (; i + 6 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_or_si128(_mm_shuffle_epi8(v, expand), alpha));
+    }
+
+    convertPixelsScalar<3, 4>(src + i * 3, dst + i * 4, count - i);
+}
+
+template<>
+void convertPixels<4, 3>(const uint8_t* src, uint8_t* dst, size_t count)
+{
+    // 4 pixels per step, each store writes 16 bytes for 12 bytes of pixels so the last pixels are left to the scalar kernel
+    const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    size_t i = 0;
+    for (; i + 6 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3), _mm_shuffle_epi8(v, pack));
+    }
+
+    convertPixelsScalar<4, 3>(src + i * 4, dst + i * 3, count - i);
+}
+#endif
+
+typedef void (*LvnConvertPixelsFunc)(const uint8_t*, uint8_t*, size_t);
+
+static const LvnConvertPixelsFunc s_ConvertPixelsFuncs[4][4] =
+{
+    { convertPixels<1, 1>, convertPixels<1, 2>, convertPixels<1, 3>, convertPixels<1, 4> },
+    { convertPixels<2, 1>, convertPixels<2, 2>, convertPixels<2, 3>, convertPixels<2, 4> },
+    { convertPixels<3, 1>, convertPixels<3, 2>, convertPixels<3, 3>, convertPixels<3, 4> },
+    { convertPixels<4, 1>, convertPixels<4, 2>, convertPixels<4, 3>, convertPixels<4, 4> },
+};
+
+template<uint32_t N>
+static void swizzlePixels(uint8_t* data, size_t count, const uint32_t* pSwizzle)
+{
+    size_t i = 0;
+
+    if constexpr (N == 4)
+    {
+#if defined(LVN_SIMD_AVX2)
+        uint8_t order[32];
+        for (uint32_t j = 0; j < 32; j++)
+            order[j] = static_cast<uint8_t>((j & ~3u) + pSwizzle[j & 3]);
+        const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(order));
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i* px = reinterpret_cast<__m256i*>(data + i * 4);
+            _mm256_storeu_si256(px, _mm256_shuffle_epi8(_mm256_loadu_si256(px), shuffle));
+        }
+#elif defined(LVN_SIMD_SSE2)
+        // each destination channel is the source channel shifted down to the bottom byte of the pixel then shifted up into place
+        const __m128i byteMask = _mm_set1_epi32(0xff);
+        __m128i srcShift[4];
+        for (uint32_t c = 0; c < 4; c++)
+            srcShift[c] = _mm_cvtsi32_si128(static_cast<int>(pSwizzle[c] * 8));
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i* px = reinterpret_cast<__m128i*>(data + i * 4);
+            __m128i v = _mm_loadu_si128(px);
+            __m128i result = _mm_and_si128(_mm_srl_epi32(v, srcShift[0]), byteMask);
+            result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(v, srcShift[1]), byteMask), 8));
+            result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(v, srcShift[2]), byteMask), 16));
+            result = _mm_or_si128(result, _mm_slli_epi32(_mm_srl_epi32(v, srcShift[3]), 24));
+            _mm_storeu_si128(px, result);
+        }
+#endif
+    }
+
+    for (uint8_t* px = data + i * N; i < count; i++, px += N)
+    {
+        uint8_t temp[N];
+        for (uint32_t c = 0; c < N; c++)
+            temp[c] = px[c];
+        for (uint32_t c = 0; c < N; c++)
+            px[c] = temp[pSwizzle[c]];
+    }
+}
+
+static void premultiplyPixels(uint8_t* data, size_t count, uint32_t channels)
+{
+    size_t i = 0;
+
+#if defined(LVN_SIMD_SSE2)
+    if (channels == 4)
+    {
+        // 4 pixels per step widened to 16 bits, the alpha lanes are multiplied by 255 so they come out unchanged
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i colorMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+        const __m128i alphaOne = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+        const __m128i round = _mm_set1_epi16(128);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i* px = reinterpret_cast<__m128i*>(data + i * 4);
+            __m128i v = _mm_loadu_si128(px);
+            __m128i halves[2] = { _mm_unpacklo_epi8(v, zero), _mm_unpackhi_epi8(v, zero) };
+
+            for (uint32_t h = 0; h < 2; h++)
+            {
+                __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(halves[h], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                alpha = _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaOne);
+
+                __m128i t = _mm_add_epi16(_mm_mullo_epi16(halves[h], alpha), round);
+                halves[h] = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+            }
+
+            _mm_storeu_si128(px, _mm_packus_epi16(halves[0], halves[1]));
+        }
+    }
+#endif
+
+    uint32_t alphaIndex = channels - 1;
+    for (uint8_t* px = data + i * channels; i < count; i++, px += channels)
+    {
+        for (uint32_t c = 0; c < alphaIndex; c++)
+            px[c] = mulDiv255(px[c], px[alphaIndex]);
+    }
+}
+
+
+// ------------------------------------------------------------
+// [SECTION]: Mip Generation Kernels
+// ------------------------------------------------------------
+// - levels are filtered in linear float, the color channels of srgb images are decoded through a table before filtering and
+//   encoded again after, alpha (the last channel of 2 and 4 channel images) is always linear
+// - each level is filtered from the float pixels of the level above it rather than its rounded bytes, only the float pixels of the
+//   last two levels are kept
+// - the filters are separable, for each destination row the source rows under the filter are summed into a row buffer (SSE2 over
+//   the whole row) which is then filtered across (one SSE2 register per pixel for 4 channel images), rows are split across the
+//   job workers
+// - tap weights are computed once per axis and level, taps past the edge of the image repeat the edge pixel
+
+#define LVN_IMAGE_KAISER_WIDTH          (3.0f)     /* half width of the kaiser filter in destination pixels */
+#define LVN_IMAGE_KAISER_ALPHA          (4.0f)     /* shape of the kaiser window, higher values fall off faster */
+#define LVN_IMAGE_SRGB_ENCODE_SIZE      (4096)     /* entries in the linear to srgb table */
+
+struct LvnMipFilterAxis
+{
+    LvnVector<uint32_t> indices;    /* taps per destination pixel, source pixel of each tap clamped to the image */
+    LvnVector<float> weights;       /* taps per destination pixel, normalized weight of each tap */
+    uint32_t taps;
+};
+
+struct LvnSrgbTables
+{
+    float decode[256];                             /* srgb byte to linear */
+    float unorm[256];                              /* byte to [0, 1] */
+    uint8_t encode[LVN_IMAGE_SRGB_ENCODE_SIZE];    /* linear scaled to the table size to srgb byte */
+};
+
+struct LvnMipLevelJob
+{
+    const uint8_t* srcBytes;        /* pixels of the full size image, only set for the first level */
+    const float* srcFloats;         /* float pixels of the level above */
+    uint32_t srcWidth, srcHeight;
+    uint8_t* dstBytes;
+    float* dstFloats;               /* kept for the next level, nullptr for the last level */
+    uint32_t dstWidth, dstHeight;
+    uint32_t channels;
+    const LvnMipFilterAxis* axisX;
+    const LvnMipFilterAxis* axisY;
+    const float* decodeTables[4];   /* per channel byte to float table */
+    bool srgbChannels[4];           /* channels that are srgb encoded */
+};
+
+static const LvnSrgbTables& getSrgbTables()
+{
+    static const LvnSrgbTables s_Tables = []()
+    {
+        LvnSrgbTables tables;
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            float c = i / 255.0f;
+            tables.decode[i] = c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+            tables.unorm[i] = c;
+        }
+        for (uint32_t i = 0; i < LVN_IMAGE_SRGB_ENCODE_SIZE; i++)
+        {
+            float l = (float)i / (LVN_IMAGE_SRGB_ENCODE_SIZE - 1);
+            float c = l <= 0.0031308f ? l * 12.92f : 1.055f * powf(l, 1.0f / 2.4f) - 0.055f;
+            tables.encode[i] = (uint8_t)(c * 255.0f + 0.5f);
+        }
+        return tables;
+    }();
+
+    return s_Tables;
+}
+
+
+// -- [SUBSECT]: Mip Filters
+// ------------------------------------------------------------
+
+// modified bessel function of the first kind of order 0, used by the kaiser window
+static float besselI0(float x)
+{
+    float sum = 1.0f, term = 1.0f;
+    for (uint32_t k = 1; k < 16; k++)
+    {
+        term *= (x * 0.5f) / k;
+        sum += term * term;
+    }
+    return sum;
+}
+
+// x is the distance from the filter center in destination pixels
+static float kaiserWeight(float x)
+{
+    if (fabsf(x) >= LVN_IMAGE_KAISER_WIDTH) { return 0.0f; }
+
+    float sinc = x == 0.0f ? 1.0f : sinf(LVN_PI * x) / (LVN_PI * x);
+    float t = x / LVN_IMAGE_KAISER_WIDTH;
+    return sinc * besselI0(LVN_IMAGE_KAISER_ALPHA * sqrtf(1.0f - t * t)) / besselI0(LVN_IMAGE_KAISER_ALPHA);
+}
+
+static void buildMipFilterAxis(LvnMipFilterAxis* axis, uint32_t srcSize, uint32_t dstSize, LvnImageMipFilter filter)
+{
+    // an axis that is already 1 pixel wide is copied
+    if (srcSize == dstSize)
+    {
+        axis->taps = 1;
+        axis->indices.resize(dstSize);
+        axis->weights.resize(dstSize);
+        for (uint32_t i = 0; i < dstSize; i++)
+        {
+            axis->indices[i] = i;
+            axis->weights[i] = 1.0f;
+        }
+        return;
+    }
+
+    float scale = (float)srcSize / dstSize;
+    float support = filter == Lvn_ImageMipFilter_Kaiser ? LVN_IMAGE_KAISER_WIDTH * scale : scale * 0.5f;
+    axis->taps = filter == Lvn_ImageMipFilter_Kaiser || srcSize % dstSize != 0 ? (uint32_t)ceilf(support * 2.0f) + 1 : srcSize / dstSize;
+    axis->indices.resize(dstSize * axis->taps);
+    axis->weights.resize(dstSize * axis->taps);
+
+    for (uint32_t i = 0; i < dstSize; i++)
+    {
+        float center = (i + 0.5f) * scale;
+        int32_t first = (int32_t)floorf(center - support);
+        uint32_t* indices = &axis->indices[i * axis->taps];
+        float* weights = &axis->weights[i * axis->taps];
+        float sum = 0.0f;
+
+        for (uint32_t t = 0; t < axis->taps; t++)
+        {
+            int32_t j = first + (int32_t)t;
+
+            // the box weight is how much of the source pixel lies under the destination pixel
+            float weight = filter == Lvn_ImageMipFilter_Kaiser
+                ? kaiserWeight((j + 0.5f - center) / scale)
+                : lvn::max(0.0f, lvn::min((float)j + 1.0f, center + support) - lvn::max((float)j, center - support));
+
+            indices[t] = (uint32_t)lvn::clamp(j, 0, (int32_t)srcSize - 1);
+            weights[t] = weight;
+            sum += weight;
+        }
+
+        for (uint32_t t = 0; t < axis->taps; t++)
+            weights[t] /= sum;
+    }
+}
+
+template<uint32_t N>
+static void decodeMipRow(const uint8_t* src, float* dst, uint32_t width, const float* const* decodeTables)
+{
+    for (uint32_t x = 0; x < width; x++, src += N, dst += N)
+    {
+        for (uint32_t c = 0; c < N; c++)
+            dst[c] = decodeTables[c][src[c]];
+    }
+}
+
+// dst[i] += src[i] * weight
+static void addMipRowWeighted(float* dst, const float* src, float weight, uint32_t count)
+{
+    uint32_t i = 0;
+
+#if defined(LVN_SIMD_SSE2)
+    __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+#endif
+
+    for (; i < count; i++)
+        dst[i] += src[i] * weight;
+}
+
+// filters a row summed from the source rows across into the destination row, results are clamped to [0, 1]
+template<uint32_t N>
+static void filterMipRow(const float* src, float* dst, const LvnMipFilterAxis& axis, uint32_t dstWidth)
+{
+    const uint32_t* indices = axis.indices.data();
+    const float* weights = axis.weights.data();
+
+#if defined(LVN_SIMD_SSE2)
+    if constexpr (N == 4)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        for (uint32_t x = 0; x < dstWidth; x++, indices += axis.taps, weights += axis.taps)
+        {
+            __m128 sum = zero;
+            for (uint32_t t = 0; t < axis.taps; t++)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + indices[t] * 4), _mm_set1_ps(weights[t])));
+
+            _mm_storeu_ps(dst + x * 4, _mm_min_ps(_mm_max_ps(sum, zero), one));
+        }
+        return;
+    }
+#endif
+
+    for (uint32_t x = 0; x < dstWidth; x++, indices += axis.taps, weights += axis.taps)
+    {
+        float sum[N] = {};
+        for (uint32_t t = 0; t < axis.taps; t++)
+        {
+            const float* px = src + indices[t] * N;
+            for (uint32_t c = 0; c < N; c++)
+                sum[c] += px[c] * weights[t];
+        }
+
+        for (uint32_t c = 0; c < N; c++)
+            dst[x * N + c] = lvn::clamp(sum[c], 0.0f, 1.0f);
+    }
+}
+
+template<uint32_t N>
+static void encodeMipRow(const float* src, uint8_t* dst, uint32_t width, const bool* srgbChannels)
+{
+    const uint8_t* encode = lvn::getSrgbTables().encode;
+
+    for (uint32_t x = 0; x < width; x++, src += N, dst += N)
+    {
+        for (uint32_t c = 0; c < N; c++)
+        {
+            dst[c] = srgbChannels[c]
+                ? encode[(uint32_t)(src[c] * (LVN_IMAGE_SRGB_ENCODE_SIZE - 1) + 0.5f)]
+                : (uint8_t)(src[c] * 255.0f + 0.5f);
+        }
+    }
+}
+
+template<uint32_t N>
+static void filterMipRows(const LvnMipLevelJob* job, uint32_t begin, uint32_t end)
+{
+    uint32_t srcRowSize = job->srcWidth * N;
+    uint32_t dstRowSize = job->dstWidth * N;
+    const LvnMipFilterAxis& axisY = *job->axisY;
+
+    LvnVector<float> rowSum(srcRowSize);
+    LvnVector<float> srcRow(job->srcBytes ? srcRowSize : 0);
+    LvnVector<float> dstRow(job->dstFloats ? 0 : dstRowSize);
+
+    for (uint32_t y = begin; y < end; y++)
+    {
+        memset(rowSum.data(), 0, rowSum.memsize());
+
+        for (uint32_t t = 0; t < axisY.taps; t++)
+        {
+            float weight = axisY.weights[y * axisY.taps + t];
+            if (weight == 0.0f) { continue; }
+
+            uint32_t srcY = axisY.indices[y * axisY.taps + t];
+            const float* src = srcRow.data();
+            if (job->srcBytes)
+                lvn::decodeMipRow<N>(job->srcBytes + (size_t)srcY * srcRowSize, srcRow.data(), job->srcWidth, job->decodeTables);
+            else
+                src = job->srcFloats + (size_t)srcY * srcRowSize;
+
+            lvn::addMipRowWeighted(rowSum.data(), src, weight, srcRowSize);
+        }
+
+        float* dst = job->dstFloats ? job->dstFloats + (size_t)y * dstRowSize : dstRow.data();
+        lvn::filterMipRow<N>(rowSum.data(), dst, *job->axisX, job->dstWidth);
+        lvn::encodeMipRow<N>(dst, job->dstBytes + (size_t)y * dstRowSize, job->dstWidth, job->srgbChannels);
+    }
+}
+
+static void filterMipRowsJob(uint32_t begin, uint32_t end, void* data)
+{
+    const LvnMipLevelJob* job = static_cast<const LvnMipLevelJob*>(data);
+
+    switch (job->channels)
+    {
+        case 1: { lvn::filterMipRows<1>(job, begin, end); break; }
+        case 2: { lvn::filterMipRows<2>(job, begin, end); break; }
+        case 3: { lvn::filterMipRows<3>(job, begin, end); break; }
+        case 4: { lvn::filterMipRows<4>(job, begin, end); break; }
+    }
+}
+
+
+// ------------------------------------------------------------
+// [SECTION]: Block Compression Kernels
+// ------------------------------------------------------------
+// - blocks are read as 4x4 rgba pixels, 1 and 2 channel images are expanded the same way as imageConvertChannels and pixels past
+//   the edge of the image repeat the last row and column
+// - color endpoints are fit along the principal axis of the block (power iteration on the covariance), the indices are picked per
+//   pixel and the endpoints are refit once with least squares, the refit is kept if it lowers the error
+// - bc3 alpha and the two bc5 channels are bc4 blocks with the min and max value as endpoints
+// - bc7 blocks are always mode 6 (one subset, rgba 7 bit endpoints with a p bit each, 4 bit indices), the other modes are not
+//   searched, this is the mode that fits most blocks of color textures
+// - block rows are split across the job workers
+
+#define LVN_IMAGE_BLOCK_ALL_PIXELS      (0xffff)   /* pixel mask of a full 4x4 block */
+
+struct LvnBlockCompressJob
+{
+    const uint8_t* pixels;
+    uint32_t width, height, channels;
+    uint8_t* blocks;
+    uint32_t blocksX;
+    uint32_t blockSize;
+    LvnTextureCompression compression;
+};
+
+struct LvnBlockBits
+{
+    uint64_t bits[2];
+    uint32_t pos;
+};
+
+static const uint32_t s_Bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+/* nearest bc7 4 bit index of each weight from 0 to 64 */
+static const uint8_t s_Bc7WeightIndices[65] =
+{
+    0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 7, 7, 7,
+    8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 14, 15, 15,
+};
+
+
+// -- [SUBSECT]: Endpoint Fitting
+// ------------------------------------------------------------
+
+static void fetchBlock(const LvnBlockCompressJob* job, uint32_t bx, uint32_t by, uint8_t block[16][4])
+{
+    for (uint32_t y = 0; y < 4; y++)
+    {
+        uint32_t sy = lvn::min(by * 4 + y, job->height - 1);
+
+        for (uint32_t x = 0; x < 4; x++)
+        {
+            uint32_t sx = lvn::min(bx * 4 + x, job->width - 1);
+            const uint8_t* px = job->pixels + ((size_t)sy * job->width + sx) * job->channels;
+            uint8_t* dst = block[y * 4 + x];
+
+            switch (job->channels)
+            {
+                case 1: { dst[0] = dst[1] = dst[2] = px[0]; dst[3] = 255; break; }
+                case 2: { dst[0] = dst[1] = dst[2] = px[0]; dst[3] = px[1]; break; }
+                case 3: { dst[0] = px[0]; dst[1] = px[1]; dst[2] = px[2]; dst[3] = 255; break; }
+                case 4: { memcpy(dst, px, 4); break; }
+            }
+        }
+    }
+}
+
+// fits a line through the pixels in the mask along their principal axis, endpoints are the ends of the line within the pixels
+static void fitBlockEndpoints(const uint8_t block[16][4], uint32_t mask, uint32_t dims, float endpoints[2][4])
+{
+    float mean[4] = {};
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        if (!(mask & (1u << i))) { continue; }
+        for (uint32_t c = 0; c < dims; c++)
+            mean[c] += block[i][c];
+        count++;
+    }
+    for (uint32_t c = 0; c < dims; c++)
+        mean[c] /= count;
+
+    float cov[4][4] = {};
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        if (!(mask & (1u << i))) { continue; }
+        for (uint32_t a = 0; a < dims; a++)
+            for (uint32_t b = a; b < dims; b++)
+                cov[a][b] += (block[i][a] - mean[a]) * (block[i][b] - mean[b]);
+    }
+    for (uint32_t a = 0; a < dims; a++)
+        for (uint32_t b = 0; b < a; b++)
+            cov[a][b] = cov[b][a];
+
+    // start from the row of the channel with the most spread so the axis is not orthogonal to the principal one
+    uint32_t start = 0;
+    for (uint32_t c = 1; c < dims; c++)
+        if (cov[c][c] > cov[start][start]) start = c;
+
+    float axis[4] = {};
+    for (uint32_t c = 0; c < dims; c++)
+        axis[c] = cov[start][c];
+
+    for (uint32_t iter = 0; iter < 8; iter++)
+    {
+        float next[4] = {};
+        float largest = 0.0f;
+        for (uint32_t a = 0; a < dims; a++)
+        {
+            for (uint32_t b = 0; b < dims; b++)
+                next[a] += cov[a][b] * axis[b];
+            largest = lvn::max(largest, fabsf(next[a]));
+        }
+
+        if (largest == 0.0f) { break; }
+        for (uint32_t c = 0; c < dims; c++)
+            axis[c] = next[c] / largest;
+    }
+
+    float length = 0.0f;
+    for (uint32_t c = 0; c < dims; c++)
+        length += axis[c] * axis[c];
+
+    float tmin = 0.0f, tmax = 0.0f;
+    if (length > 0.0f)
+    {
+        length = sqrtf(length);
+        for (uint32_t c = 0; c < dims; c++)
+            axis[c] /= length;
+
+        tmin = 1e30f; tmax = -1e30f;
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            if (!(mask & (1u << i))) { continue; }
+            float t = 0.0f;
+            for (uint32_t c = 0; c < dims; c++)
+                t += (block[i][c] - mean[c]) * axis[c];
+            tmin = lvn::min(tmin, t);
+            tmax = lvn::max(tmax, t);
+        }
+    }
+
+    for (uint32_t c = 0; c < dims; c++)
+    {
+        endpoints[0][c] = lvn::clamp(mean[c] + axis[c] * tmin, 0.0f, 255.0f);
+        endpoints[1][c] = lvn::clamp(mean[c] + axis[c] * tmax, 0.0f, 255.0f);
+    }
+}
+
+// least squares endpoints for the given weights (how far each pixel is from endpoint 0 to endpoint 1), returns false if the
+// weights do not separate the endpoints
+static bool refitBlockEndpoints(const uint8_t block[16][4], uint32_t mask, const float* weights, uint32_t dims, float endpoints[2][4])
+{
+    float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+    float ax[4] = {}, bx[4] = {};
+
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        if (!(mask & (1u << i))) { continue; }
+        float b = weights[i], a = 1.0f - b;
+        aa += a * a; bb += b * b; ab += a * b;
+        for (uint32_t c = 0; c < dims; c++)
+        {
+            ax[c] += a * block[i][c];
+            bx[c] += b * block[i][c];
+        }
+    }
+
+    float det = aa * bb - ab * ab;
+    if (fabsf(det) < 1e-6f) { return false; }
+
+    for (uint32_t c = 0; c < dims; c++)
+    {
+        endpoints[0][c] = lvn::clamp((ax[c] * bb - bx[c] * ab) / det, 0.0f, 255.0f);
+        endpoints[1][c] = lvn::clamp((bx[c] * aa - ax[c] * ab) / det, 0.0f, 255.0f);
+    }
+    return true;
+}
+
+static void writeBlockBits(LvnBlockBits* bits, uint32_t value, uint32_t count)
+{
+    if (bits->pos < 64)
+    {
+        bits->bits[0] |= (uint64_t)value << bits->pos;
+        if (bits->pos + count > 64)
+            bits->bits[1] |= (uint64_t)value >> (64 - bits->pos);
+    }
+    else
+        bits->bits[1] |= (uint64_t)value << (bits->pos - 64);
+
+    bits->pos += count;
+}
+
+
+// -- [SUBSECT]: BC1 and BC4 Blocks
+// ------------------------------------------------------------
+
+static uint16_t packColor565(const float color[4])
+{
+    uint32_t r = (uint32_t)(color[0] * 31.0f / 255.0f + 0.5f);
+    uint32_t g = (uint32_t)(color[1] * 63.0f / 255.0f + 0.5f);
+    uint32_t b = (uint32_t)(color[2] * 31.0f / 255.0f + 0.5f);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void unpackColor565(uint16_t packed, int32_t color[3])
+{
+    int32_t r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+// picks the palette entry of each pixel for the endpoints, three color blocks (c0 <= c1) give transparent pixels index 3,
+// returns the squared error of the block
+static uint32_t selectBc1Indices(const uint8_t block[16][4], uint16_t c0, uint16_t c1, bool threeColor, uint32_t* pIndices)
+{
+    int32_t palette[4][3];
+    unpackColor565(c0, palette[0]);
+    unpackColor565(c1, palette[1]);
+    for (uint32_t c = 0; c < 3; c++)
+    {
+        palette[2][c] = threeColor ? (palette[0][c] + palette[1][c]) / 2 : (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    uint32_t paletteSize = threeColor ? 3 : 4;
+    uint32_t indices = 0, error = 0;
+
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        if (threeColor && block[i][3] < 128)
+        {
+            indices |= 3u << (i * 2);
+            continue;
+        }
+
+        uint32_t best = 0, bestError = UINT32_MAX;
+        for (uint32_t p = 0; p < paletteSize; p++)
+        {
+            int32_t dr = block[i][0] - palette[p][0], dg = block[i][1] - palette[p][1], db = block[i][2] - palette[p][2];
+            uint32_t e = (uint32_t)(dr * dr + dg * dg + db * db);
+            if (e < bestError) { best = p; bestError = e; }
+        }
+
+        indices |= best << (i * 2);
+        error += bestError;
+    }
+
+    *pIndices = indices;
+    return error;
+}
+
+// orders the endpoints for the block mode, four color blocks need c0 > c1 and three color blocks c0 <= c1
+static void orderBc1Endpoints(uint16_t* c0, uint16_t* c1, bool threeColor)
+{
+    if (threeColor ? *c0 > *c1 : *c0 < *c1)
+        lvn::swap(*c0, *c1);
+}
+
+// color part of bc1, bc2 and bc3 blocks, pixels with alpha below 128 are made transparent if allowAlpha is set (bc1 only)
+static void encodeBc1Block(const uint8_t block[16][4], bool allowAlpha, uint8_t* out)
+{
+    uint32_t opaqueMask = 0;
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        if (!allowAlpha || block[i][3] >= 128)
+            opaqueMask |= 1u << i;
+    }
+
+    bool threeColor = opaqueMask != LVN_IMAGE_BLOCK_ALL_PIXELS;
+    uint16_t c0 = 0, c1 = 0;
+    uint32_t indices = 0xffffffff;
+
+    if (opaqueMask != 0)
+    {
+        float endpoints[2][4];
+        lvn::fitBlockEndpoints(block, opaqueMask, 3, endpoints);
+        c0 = packColor565(endpoints[1]);
+        c1 = packColor565(endpoints[0]);
+        orderBc1Endpoints(&c0, &c1, threeColor);
+        uint32_t error = selectBc1Indices(block, c0, c1, threeColor, &indices);
+
+        // refit with the weight each pixel got towards c1
+        static const float s_FourColorWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+        static const float s_ThreeColorWeights[4] = { 0.0f, 1.0f, 0.5f, 0.0f };
+        const float* paletteWeights = threeColor ? s_ThreeColorWeights : s_FourColorWeights;
+
+        float weights[16];
+        for (uint32_t i = 0; i < 16; i++)
+            weights[i] = paletteWeights[(indices >> (i * 2)) & 3];
+
+        if (error > 0 && lvn::refitBlockEndpoints(block, opaqueMask, weights, 3, endpoints))
+        {
+            uint16_t r0 = packColor565(endpoints[0]);
+            uint16_t r1 = packColor565(endpoints[1]);
+            orderBc1Endpoints(&r0, &r1, threeColor);
+
+            uint32_t refitIndices;
+            if (selectBc1Indices(block, r0, r1, threeColor, &refitIndices) < error)
+            {
+                c0 = r0; c1 = r1;
+                indices = refitIndices;
+            }
+        }
+    }
+
+    memcpy(out, &c0, 2);
+    memcpy(out + 2, &c1, 2);
+    memcpy(out + 4, &indices, 4);
+}
+
+// one channel block (bc4), also the alpha of bc3 and both channels of bc5, uses the eight value mode (a0 > a1)
+static void encodeBc4Block(const uint8_t block[16][4], uint32_t channel, uint8_t* out)
+{
+    uint32_t lo = 255, hi = 0;
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        lo = lvn::min(lo, (uint32_t)block[i][channel]);
+        hi = lvn::max(hi, (uint32_t)block[i][channel]);
+    }
+
+    // the palette is evenly spaced from lo to hi, the nearest step is rounded directly and mapped to its index (0 is hi, 1 is lo,
+    // 2 to 7 step from hi towards lo)
+    uint64_t indices = 0;
+    uint32_t range = hi - lo;
+    if (range > 0)
+    {
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            uint32_t step = ((block[i][channel] - lo) * 14 + range) / (range * 2);
+            uint32_t index = step == 7 ? 0 : step == 0 ? 1 : 8 - step;
+            indices |= (uint64_t)index << (i * 3);
+        }
+    }
+
+    out[0] = (uint8_t)hi;
+    out[1] = (uint8_t)lo;
+    for (uint32_t b = 0; b < 6; b++)
+        out[2 + b] = (uint8_t)(indices >> (b * 8));
+}
+
+
+// -- [SUBSECT]: BC7 Blocks
+// ------------------------------------------------------------
+
+// mode 6 endpoints are 7 bits per channel with a shared lowest bit (p bit), the p bit with the lower error is chosen
+static void quantizeBc7Endpoint(const float endpoint[4], uint32_t quantized[4], uint32_t* pbit)
+{
+    float bestError = 1e30f;
+
+    for (uint32_t p = 0; p < 2; p++)
+    {
+        uint32_t q[4];
+        float error = 0.0f;
+        for (uint32_t c = 0; c < 4; c++)
+        {
+            q[c] = (uint32_t)lvn::clamp((int32_t)((endpoint[c] - p) * 0.5f + 0.5f), 0, 127);
+            float d = endpoint[c] - (float)((q[c] << 1) | p);
+            error += d * d;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            memcpy(quantized, q, sizeof(q));
+            *pbit = p;
+        }
+    }
+}
+
+// the index of each pixel is estimated by projecting it onto the endpoint line, then the estimate and its two neighbours are compared
+static uint32_t selectBc7Indices(const uint8_t block[16][4], const uint32_t quantized[2][4], const uint32_t pbits[2], uint8_t* indices)
+{
+    int32_t palette[16][4];
+    float dir[4], length = 0.0f;
+    for (uint32_t c = 0; c < 4; c++)
+    {
+        int32_t e0 = (int32_t)((quantized[0][c] << 1) | pbits[0]);
+        int32_t e1 = (int32_t)((quantized[1][c] << 1) | pbits[1]);
+        for (uint32_t p = 0; p < 16; p++)
+            palette[p][c] = ((64 - (int32_t)s_Bc7Weights4[p]) * e0 + (int32_t)s_Bc7Weights4[p] * e1 + 32) >> 6;
+
+        dir[c] = (float)(e1 - e0);
+        length += dir[c] * dir[c];
+    }
+
+    float scale = length > 0.0f ? 64.0f / length : 0.0f;
+    uint32_t error = 0;
+
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        float t = 0.0f;
+        for (uint32_t c = 0; c < 4; c++)
+            t += (block[i][c] - palette[0][c]) * dir[c];
+
+        uint32_t guess = s_Bc7WeightIndices[lvn::clamp((int32_t)(t * scale + 0.5f), 0, 64)];
+        uint32_t best = guess, bestError = UINT32_MAX;
+
+        for (uint32_t p = guess > 0 ? guess - 1 : 0; p <= guess + 1 && p < 16; p++)
+        {
+            uint32_t e = 0;
+            for (uint32_t c = 0; c < 4; c++)
+            {
+                int32_t d = block[i][c] - palette[p][c];
+                e += (uint32_t)(d * d);
+            }
+            if (e < bestError) { best = p; bestError = e; }
+        }
+
+        indices[i] = (uint8_t)best;
+        error += bestError;
+    }
+
+    return error;
+}
+
+static void encodeBc7Block(const uint8_t block[16][4], uint8_t* out)
+{
+    float endpoints[2][4];
+    lvn::fitBlockEndpoints(block, LVN_IMAGE_BLOCK_ALL_PIXELS, 4, endpoints);
+
+    uint32_t quantized[2][4], pbits[2];
+    uint8_t indices[16];
+    quantizeBc7Endpoint(endpoints[0], quantized[0], &pbits[0]);
+    quantizeBc7Endpoint(endpoints[1], quantized[1], &pbits[1]);
+    uint32_t error = selectBc7Indices(block, quantized, pbits, indices);
+
+    float weights[16];
+    for (uint32_t i = 0; i < 16; i++)
+        weights[i] = s_Bc7Weights4[indices[i]] / 64.0f;
+
+    if (error > 0 && lvn::refitBlockEndpoints(block, LVN_IMAGE_BLOCK_ALL_PIXELS, weights, 4, endpoints))
+    {
+        uint32_t refitQuantized[2][4], refitPbits[2];
+        uint8_t refitIndices[16];
+        quantizeBc7Endpoint(endpoints[0], refitQuantized[0], &refitPbits[0]);
+        quantizeBc7Endpoint(endpoints[1], refitQuantized[1], &refitPbits[1]);
+
+        if (selectBc7Indices(block, refitQuantized, refitPbits, refitIndices) < error)
+        {
+            memcpy(quantized, refitQuantized, sizeof(quantized));
+            memcpy(pbits, refitPbits, sizeof(pbits));
+            memcpy(indices, refitIndices, sizeof(indices));
+        }
+    }
+
+    // the highest index bit of the first pixel is not stored and must be 0, swap the endpoints to flip the indices if it is not
+    if (indices[0] & 8)
+    {
+        for (uint32_t c = 0; c < 4; c++)
+            lvn::swap(quantized[0][c], quantized[1][c]);
+        lvn::swap(pbits[0], pbits[1]);
+        for (uint32_t i = 0; i < 16; i++)
+            indices[i] = 15 - indices[i];
+    }
+
+    LvnBlockBits bits{};
+    writeBlockBits(&bits, 1u << 6, 7); // mode 6
+    for (uint32_t c = 0; c < 4; c++)
+    {
+        writeBlockBits(&bits, quantized[0][c], 7);
+        writeBlockBits(&bits, quantized[1][c], 7);
+    }
+    writeBlockBits(&bits, pbits[0], 1);
+    writeBlockBits(&bits, pbits[1], 1);
+    writeBlockBits(&bits, indices[0], 3);
+    for (uint32_t i = 1; i < 16; i++)
+        writeBlockBits(&bits, indices[i], 4);
+
+    memcpy(out, bits.bits, 16);
+}
+
+static void compressBlockRowsJob(uint32_t begin, uint32_t end, void* data)
+{
+    const LvnBlockCompressJob* job = static_cast<const LvnBlockCompressJob*>(data);
+
+    // bc5 takes the second channel from alpha for gray alpha images since fetchBlock copies gray into rgb
+    uint32_t secondChannel = job->channels == 2 ? 3 : 1;
+
+    for (uint32_t by = begin; by < end; by++)
+    {
+        for (uint32_t bx = 0; bx < job->blocksX; bx++)
+        {
+            uint8_t block[16][4];
+            lvn::fetchBlock(job, bx, by, block);
+            uint8_t* out = job->blocks + ((size_t)by * job->blocksX + bx) * job->blockSize;
+
+            switch (job->compression)
+            {
+                case Lvn_TextureCompression_Bc1: { lvn::encodeBc1Block(block, true, out); break; }
+                case Lvn_TextureCompression_Bc3: { lvn::encodeBc4Block(block, 3, out); lvn::encodeBc1Block(block, false, out + 8); break; }
+                case Lvn_TextureCompression_Bc5: { lvn::encodeBc4Block(block, 0, out); lvn::encodeBc4Block(block, secondChannel, out + 8); break; }
+                case Lvn_TextureCompression_Bc7: { lvn::encodeBc7Block(block, out); break; }
+                default: { break; }
+            }
+        }
+    }
+}
+
+
+// ------------------------------------------------------------
+// [SECTION]: Image Transform Functions
+// ------------------------------------------------------------
+
+static void imageRotate(LvnImageData& imageData, bool clockwise)
+{
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("%s(LvnImageData&) | image is compressed (%u), only uncompressed pixels can be transformed", clockwise ? "imageRotateCW" : "imageRotateCCW", static_cast<uint32_t>(imageData.compression));
+        return;
+    }
+
+    if (imageData.pixels.empty()) { return; }
+
+    // const access so that pixels shared with another LvnData are read in place instead of being copied first
+    const LvnData<uint8_t>& pixels = imageData.pixels;
+    LvnUniqueData<uint8_t> rotated(pixels.size());
+
+    switch (imageData.channels)
+    {
+        case 1: { rotatePixels<1>(pixels.data(), rotated.data(), imageData.width, imageData.height, clockwise); break; }
+        case 2: { rotatePixels<2>(pixels.data(), rotated.data(), imageData.width, imageData.height, clockwise); break; }
+        case 3: { rotatePixels<3>(pixels.data(), rotated.data(), imageData.width, imageData.height, clockwise); break; }
+        case 4: { rotatePixels<4>(pixels.data(), rotated.data(), imageData.width, imageData.height, clockwise); break; }
+        default:
+        {
+            LVN_CORE_ERROR("%s(LvnImageData&) | image has %u channels, channels must be within 1 to 4", clockwise ? "imageRotateCW" : "imageRotateCCW", imageData.channels);
+            return;
+        }
+    }
+
+    imageData.pixels = LvnData<uint8_t>(lvn::move(rotated));
+    lvn::swap(imageData.width, imageData.height);
+
+    for (uint32_t i = 0; i < imageData.mipLevels.size(); i++)
+        lvn::imageRotate(imageData.mipLevels[i], clockwise);
+}
+
+void imageFlipVertically(LvnImageData& imageData)
+{
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("imageFlipVertically(LvnImageData&) | image is compressed (%u), only uncompressed pixels can be transformed", static_cast<uint32_t>(imageData.compression));
+        return;
+    }
+
+    if (imageData.pixels.empty()) { return; }
+
+    uint8_t* data = imageData.pixels.data();
+    uint32_t rowSize = imageData.width * imageData.channels;
+    LvnVector<uint8_t> tempRow(rowSize);
+
+    for (uint32_t y = 0; y < imageData.height / 2; y++)
+    {
+        uint8_t* rowTop = data + y * rowSize;
+        uint8_t* rowBottom = data + (imageData.height - y - 1) * rowSize;
+
+        memcpy(tempRow.data(), rowTop, rowSize);
+        memcpy(rowTop, rowBottom, rowSize);
+        memcpy(rowBottom, tempRow.data(), rowSize);
+    }
+
+    for (uint32_t i = 0; i < imageData.mipLevels.size(); i++)
+        lvn::imageFlipVertically(imageData.mipLevels[i]);
+}
+
+void imageFlipHorizontally(LvnImageData& imageData)
+{
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("imageFlipHorizontally(LvnImageData&) | image is compressed (%u), only uncompressed pixels can be transformed", static_cast<uint32_t>(imageData.compression));
+        return;
+    }
+
+    if (imageData.pixels.empty()) { return; }
+
+    uint8_t* data = imageData.pixels.data();
+
+    switch (imageData.channels)
+    {
+        case 1: { flipPixelsHorizontally<1>(data, imageData.width, imageData.height); break; }
+        case 2: { flipPixelsHorizontally<2>(data, imageData.width, imageData.height); break; }
+        case 3: { flipPixelsHorizontally<3>(data, imageData.width, imageData.height); break; }
+        case 4: { flipPixelsHorizontally<4>(data, imageData.width, imageData.height); break; }
+        default:
+        {
+            LVN_CORE_ERROR("imageFlipHorizontally(LvnImageData&) | image has %u channels, channels must be within 1 to 4", imageData.channels);
+            return;
+        }
+    }
+
+    for (uint32_t i = 0; i < imageData.mipLevels.size(); i++)
+        lvn::imageFlipHorizontally(imageData.mipLevels[i]);
+}
+
+void imageRotateCW(LvnImageData& imageData)
+{
+    lvn::imageRotate(imageData, true);
+}
+
+void imageRotateCCW(LvnImageData& imageData)
+{
+    lvn::imageRotate(imageData, false);
+}
+
+void imageConvertChannels(LvnImageData& imageData, uint32_t channels)
+{
+    if (channels == 0 || channels > 4)
+    {
+        LVN_CORE_ERROR("imageConvertChannels(LvnImageData&, uint32_t) | channels = %u, channels must be within 1 to 4", channels);
+        return;
+    }
+
+    if (imageData.channels == 0 || imageData.channels > 4)
+    {
+        LVN_CORE_ERROR("imageConvertChannels(LvnImageData&, uint32_t) | image has %u channels, channels must be within 1 to 4", imageData.channels);
+        return;
+    }
+
+    if (imageData.channels == channels) { return; }
+
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("imageConvertChannels(LvnImageData&, uint32_t) | image is compressed (%u), only uncompressed pixels can be transformed", static_cast<uint32_t>(imageData.compression));
+        return;
+    }
+
+    const LvnData<uint8_t>& pixels = imageData.pixels;
+    size_t pixelCount = (size_t)imageData.width * imageData.height;
+    LvnUniqueData<uint8_t> converted(pixelCount * channels);
+
+    s_ConvertPixelsFuncs[imageData.channels - 1][channels - 1](pixels.data(), converted.data(), pixelCount);
+
+    imageData.pixels = LvnData<uint8_t>(lvn::move(converted));
+    imageData.channels = channels;
+    imageData.size = imageData.pixels.size();
+
+    for (uint32_t i = 0; i < imageData.mipLevels.size(); i++)
+        lvn::imageConvertChannels(imageData.mipLevels[i], channels);
+}
+
+void imageSwizzle(LvnImageData& imageData, const uint32_t* pSwizzle)
+{
+    if (pSwizzle == nullptr)
+    {
+        LVN_CORE_ERROR("imageSwizzle(LvnImageData&, const uint32_t*) | pSwizzle is nullptr, cannot swizzle image without channel order");
+        return;
+    }
+
+    for (uint32_t i = 0; i < imageData.channels; i++)
+    {
+        if (pSwizzle[i] >= imageData.channels)
+        {
+            LVN_CORE_ERROR("imageSwizzle(LvnImageData&, const uint32_t*) | pSwizzle[%u] = %u, source channel index must be less than the image channel count (%u)", i, pSwizzle[i], imageData.channels);
+            return;
+        }
+    }
+
+    if (imageData.pixels.empty()) { return; }
+
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("imageSwizzle(LvnImageData&, const uint32_t*) | image is compressed (%u), only uncompressed pixels can be transformed", static_cast<uint32_t>(imageData.compression));
+        return;
+    }
+
+    uint8_t* data = imageData.pixels.data();
+    size_t pixelCount = (size_t)imageData.width * imageData.height;
+
+    switch (imageData.channels)
+    {
+        case 1: { break; }
+        case 2: { swizzlePixels<2>(data, pixelCount, pSwizzle); break; }
+        case 3: { swizzlePixels<3>(data, pixelCount, pSwizzle); break; }
+        case 4: { swizzlePixels<4>(data, pixelCount, pSwizzle); break; }
+        default:
+        {
+            LVN_CORE_ERROR("imageSwizzle(LvnImageData&, const uint32_t*) | image has %u channels, channels must be within 1 to 4", imageData.channels);
+            return;
+        }
+    }
+
+    for (uint32_t i = 0; i < imageData.mipLevels.size(); i++)
+        lvn::imageSwizzle(imageData.mipLevels[i], pSwizzle);
+}
+
+void imagePremultiplyAlpha(LvnImageData& imageData)
+{
+    if (imageData.channels != 2 && imageData.channels != 4)
+    {
+        LVN_CORE_ERROR("imagePremultiplyAlpha(LvnImageData&) | image has %u channels, image must have an alpha channel (2 or 4 channels)", imageData.channels);
+        return;
+    }
+
+    if (imageData.pixels.empty()) { return; }
+
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("imagePremultiplyAlpha(LvnImageData&) | image is compressed (%u), only uncompressed pixels can be transformed", static_cast<uint32_t>(imageData.compression));
+        return;
+    }
+
+    lvn::premultiplyPixels(imageData.pixels.data(), (size_t)imageData.width * imageData.height, imageData.channels);
+
+    for (uint32_t i = 0; i < imageData.mipLevels.size(); i++)
+        lvn::imagePremultiplyAlpha(imageData.mipLevels[i]);
+}
+
+
+// ------------------------------------------------------------
+// [SECTION]: Mip Generation and Compression Functions
+// ------------------------------------------------------------
+
+uint32_t imageGetMipLevelCount(uint32_t width, uint32_t height)
+{
+    uint32_t size = lvn::max(width, height);
+    uint32_t levels = 0;
+
+    while (size > 1)
+    {
+        size >>= 1;
+        levels++;
+    }
+
+    return levels;
+}
+
+LvnResult imageGenMipLevels(const LvnImageData& imageData, LvnImageData* pMipLevels, uint32_t mipLevelCount, LvnImageMipFilter filter, LvnTextureFormat format)
+{
+    if (mipLevelCount == 0) { return Lvn_Result_Success; }
+
+    if (pMipLevels == nullptr)
+    {
+        LVN_CORE_ERROR("imageGenMipLevels(const LvnImageData&, LvnImageData*, uint32_t, LvnImageMipFilter, LvnTextureFormat) | pMipLevels is nullptr, cannot generate mip levels");
+        return Lvn_Result_Failure;
+    }
+
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("imageGenMipLevels(const LvnImageData&, LvnImageData*, uint32_t, LvnImageMipFilter, LvnTextureFormat) | image is compressed (%u), mip levels can only be generated from uncompressed pixels", static_cast<uint32_t>(imageData.compression));
+        return Lvn_Result_Failure;
+    }
+
+    if (imageData.channels == 0 || imageData.channels > 4)
+    {
+        LVN_CORE_ERROR("imageGenMipLevels(const LvnImageData&, LvnImageData*, uint32_t, LvnImageMipFilter, LvnTextureFormat) | image has %u channels, channels must be within 1 to 4", imageData.channels);
+        return Lvn_Result_Failure;
+    }
+
+    if (imageData.pixels.size() < (size_t)imageData.width * imageData.height * imageData.channels)
+    {
+        LVN_CORE_ERROR("imageGenMipLevels(const LvnImageData&, LvnImageData*, uint32_t, LvnImageMipFilter, LvnTextureFormat) | image pixels (%zu bytes) are smaller than the image size (w:%u, h:%u, c:%u)", (size_t)imageData.pixels.size(), imageData.width, imageData.height, imageData.channels);
+        return Lvn_Result_Failure;
+    }
+
+    uint32_t maxLevels = lvn::imageGetMipLevelCount(imageData.width, imageData.height);
+    if (mipLevelCount > maxLevels)
+    {
+        LVN_CORE_ERROR("imageGenMipLevels(const LvnImageData&, LvnImageData*, uint32_t, LvnImageMipFilter, LvnTextureFormat) | mipLevelCount = %u, an image of (w:%u, h:%u) has at most %u mip levels", mipLevelCount, imageData.width, imageData.height, maxLevels);
+        return Lvn_Result_Failure;
+    }
+
+    const LvnSrgbTables& tables = lvn::getSrgbTables();
+    uint32_t channels = imageData.channels;
+    uint32_t colorChannels = channels == 2 || channels == 4 ? channels - 1 : channels;
+
+    LvnMipLevelJob job{};
+    job.srcBytes = static_cast<const LvnData<uint8_t>&>(imageData.pixels).data();
+    job.srcWidth = imageData.width;
+    job.srcHeight = imageData.height;
+    job.channels = channels;
+    for (uint32_t c = 0; c < channels; c++)
+    {
+        job.srgbChannels[c] = format == Lvn_TextureFormat_Srgb && c < colorChannels;
+        job.decodeTables[c] = job.srgbChannels[c] ? tables.decode : tables.unorm;
+    }
+
+    LvnVector<float> floatLevels[2];
+    LvnMipFilterAxis axisX, axisY;
+
+    for (uint32_t level = 0; level < mipLevelCount; level++)
+    {
+        job.dstWidth = lvn::max(job.srcWidth / 2, 1u);
+        job.dstHeight = lvn::max(job.srcHeight / 2, 1u);
+
+        lvn::buildMipFilterAxis(&axisX, job.srcWidth, job.dstWidth, filter);
+        lvn::buildMipFilterAxis(&axisY, job.srcHeight, job.dstHeight, filter);
+        job.axisX = &axisX;
+        job.axisY = &axisY;
+
+        size_t pixelCount = (size_t)job.dstWidth * job.dstHeight * channels;
+        LvnUniqueData<uint8_t> pixels(pixelCount);
+        job.dstBytes = pixels.data();
+
+        // the float pixels of this level are only needed if there is a level below it
+        job.dstFloats = nullptr;
+        if (level + 1 < mipLevelCount)
+        {
+            floatLevels[level % 2].resize(pixelCount);
+            job.dstFloats = floatLevels[level % 2].data();
+        }
+
+        lvn::jobParallelFor(job.dstHeight, 0, lvn::filterMipRowsJob, &job);
+
+        LvnImageData& mipLevel = pMipLevels[level];
+        mipLevel.pixels = LvnData<uint8_t>(lvn::move(pixels));
+        mipLevel.width = job.dstWidth;
+        mipLevel.height = job.dstHeight;
+        mipLevel.channels = channels;
+        mipLevel.size = pixelCount;
+
+        job.srcBytes = nullptr;
+        job.srcFloats = job.dstFloats;
+        job.srcWidth = job.dstWidth;
+        job.srcHeight = job.dstHeight;
+    }
+
+    return Lvn_Result_Success;
+}
+
+LvnImageData imageCompress(const LvnImageData& imageData, LvnTextureCompression compression)
+{
+    uint32_t blockSize;
+    switch (compression)
+    {
+        case Lvn_TextureCompression_Bc1: { blockSize = 8; break; }
+        case Lvn_TextureCompression_Bc3:
+        case Lvn_TextureCompression_Bc5:
+        case Lvn_TextureCompression_Bc7: { blockSize = 16; break; }
+        default:
+        {
+            LVN_CORE_ERROR("imageCompress(const LvnImageData&, LvnTextureCompression) | compression (%u) is not a block format, cannot compress image", static_cast<uint32_t>(compression));
+            return {};
+        }
+    }
+
+    if (imageData.compression != Lvn_TextureCompression_None)
+    {
+        LVN_CORE_ERROR("imageCompress(const LvnImageData&, LvnTextureCompression) | image is already compressed (%u), cannot compress image again", static_cast<uint32_t>(imageData.compression));
+        return {};
+    }
+
+    if (imageData.channels == 0 || imageData.channels > 4)
+    {
+        LVN_CORE_ERROR("imageCompress(const LvnImageData&, LvnTextureCompression) | image has %u channels, channels must be within 1 to 4", imageData.channels);
+        return {};
+    }
+
+    if (imageData.width == 0 || imageData.height == 0 || imageData.pixels.size() < (size_t)imageData.width * imageData.height * imageData.channels)
+    {
+        LVN_CORE_ERROR("imageCompress(const LvnImageData&, LvnTextureCompression) | image pixels (%zu bytes) do not match the image size (w:%u, h:%u, c:%u)", (size_t)imageData.pixels.size(), imageData.width, imageData.height, imageData.channels);
+        return {};
+    }
+
+    uint32_t blocksX = (imageData.width + 3) / 4;
+    uint32_t blocksY = (imageData.height + 3) / 4;
+    LvnUniqueData<uint8_t> blocks((size_t)blocksX * blocksY * blockSize);
+
+    LvnBlockCompressJob job{};
+    job.pixels = static_cast<const LvnData<uint8_t>&>(imageData.pixels).data();
+    job.width = imageData.width;
+    job.height = imageData.height;
+    job.channels = imageData.channels;
+    job.blocks = blocks.data();
+    job.blocksX = blocksX;
+    job.blockSize = blockSize;
+    job.compression = compression;
+
+    lvn::jobParallelFor(blocksY, 0, lvn::compressBlockRowsJob, &job);
+
+    LvnImageData compressed{};
+    compressed.pixels = LvnData<uint8_t>(lvn::move(blocks));
+    compressed.width = imageData.width;
+    compressed.height = imageData.height;
+    compressed.channels = imageData.channels;
+    compressed.size = compressed.pixels.size();
+    compressed.compression = compression;
+    return compressed;
+}
+
+uint64_t imageGetLevelSize(uint32_t width, uint32_t height, uint32_t channels, LvnTextureCompression compression)
+{
+    uint64_t blockCount = (uint64_t)((width + 3) / 4) * ((height + 3) / 4);
+
+    switch (compression)
+    {
+        case Lvn_TextureCompression_Bc1: { return blockCount * 8; }
+        case Lvn_TextureCompression_Bc3:
+        case Lvn_TextureCompression_Bc5:
+        case Lvn_TextureCompression_Bc7: { return blockCount * 16; }
+
+        default: { return (uint64_t)width * height * channels; }
+    }
+}
+
+} /* namespace lvn */
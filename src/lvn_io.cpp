@@ -0,0 +1,402 @@
+#include "levikno.h"
+#include "levikno_internal.h"
+
+// [FILE]: lvn_io.cpp (File I/O)
+// ------------------------------------------------------------
+//
+// [SECTION]: Async File I/O
+// -- [SUBSECT]: I/O Requests
+// -- [SUBSECT]: I/O Threads
+// -- [SUBSECT]: I/O Functions
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+
+// ------------------------------------------------------------
+// [SECTION]: Async File I/O
+// ------------------------------------------------------------
+// - a small pool of I/O threads is created when the context is created with multithreading enabled, separate from the job system
+//   so that blocking reads never hold up job workers
+// - requests are kept in one FIFO queue per priority, an I/O thread always takes the oldest request of the highest priority
+// - files are read in chunks, a cancelled request stops reading at the next chunk
+// - a request is reference counted, the service holds one reference until the callback has been called and the caller holds
+//   another if it asked for the request handle
+// - callbacks are called on the I/O thread, or queued and called later from lvn::ioDispatchCallbacks when deferCallback is set
+
+#define LVN_IO_DEFAULT_THREAD_COUNT     (2)
+#define LVN_IO_MAX_THREAD_COUNT         (16)
+#define LVN_IO_READ_CHUNK_SIZE          (1024 * 1024)                                    /* bytes read between cancellation checks */
+
+#ifdef LVN_PLATFORM_WINDOWS
+    #define LVN_IO_FSEEK _fseeki64
+    #define LVN_IO_FTELL _ftelli64
+#else
+    #define LVN_IO_FSEEK fseeko
+    #define LVN_IO_FTELL ftello
+#endif
+
+struct LvnIoRequest
+{
+    std::atomic<uint32_t> refCount;
+    std::atomic<LvnIoStatus> status;
+    std::atomic<bool> cancelled;
+
+    LvnString filepath;
+    uint64_t offset;
+    uint64_t size;
+    LvnIoPriority priority;
+    LvnIoCallbackFunc callback;
+    void* userData;
+    bool deferCallback;
+
+    LvnBin data;                   /* only written by the thread reading the file before the status is set to complete */
+};
+
+namespace lvn
+{
+
+struct LvnIoService
+{
+    std::mutex lock;
+    std::condition_variable workCond;      /* signaled when a request is queued or the service stops */
+    std::condition_variable doneCond;      /* signaled when any request finishes */
+
+    LvnQueue<LvnIoRequest*> queues[Lvn_IoPriority_Max_Value];
+    LvnVector<LvnIoRequest*> deferred;     /* finished requests waiting for lvn::ioDispatchCallbacks */
+
+    LvnThread* threads;
+    uint32_t threadCount;
+    bool running;
+};
+
+static LvnIoService s_IoService;
+
+static void ioReadRequest(LvnIoRequest* request);
+static void ioFinishRequest(LvnIoRequest* request, LvnIoStatus status);
+static void ioCallRequest(LvnIoRequest* request);
+static void* ioThread(void* arg);
+
+
+// -- [SUBSECT]: I/O Requests
+// ------------------------------------------------------------
+
+static void ioReadRequest(LvnIoRequest* request)
+{
+    FILE* fileptr = fopen(request->filepath.c_str(), "rb");
+    if (!fileptr)
+    {
+        LVN_CORE_ERROR("asyncRead(const LvnIoReadInfo*, LvnIoRequest**) | cannot open file: %s", request->filepath.c_str());
+        lvn::ioFinishRequest(request, Lvn_IoStatus_Failed);
+        return;
+    }
+
+    LVN_IO_FSEEK(fileptr, 0, SEEK_END);
+    int64_t fileSize = static_cast<int64_t>(LVN_IO_FTELL(fileptr));
+
+    if (fileSize < 0 || request->offset > static_cast<uint64_t>(fileSize))
+    {
+        LVN_CORE_ERROR("asyncRead(const LvnIoReadInfo*, LvnIoRequest**) | read offset (%llu) is past the end of file: %s", (unsigned long long)request->offset, request->filepath.c_str());
+        fclose(fileptr);
+        lvn::ioFinishRequest(request, Lvn_IoStatus_Failed);
+        return;
+    }
+
+    uint64_t available = static_cast<uint64_t>(fileSize) - request->offset;
+    uint64_t size = request->size == 0 ? available : request->size;
+    if (size > available)
+    {
+        LVN_CORE_ERROR("asyncRead(const LvnIoReadInfo*, LvnIoRequest**) | read size (%llu) at offset (%llu) is past the end of file: %s", (unsigned long long)size, (unsigned long long)request->offset, request->filepath.c_str());
+        fclose(fileptr);
+        lvn::ioFinishRequest(request, Lvn_IoStatus_Failed);
+        return;
+    }
+
+    LVN_IO_FSEEK(fileptr, static_cast<int64_t>(request->offset), SEEK_SET);
+
+    // every byte is written by fread before the data is handed out, so the buffer is not zeroed first
+    LvnUniqueData<uint8_t> bin = LvnUniqueData<uint8_t>::uninitialized(static_cast<size_t>(size));
+    uint64_t read = 0;
+    while (read < size)
+    {
+        if (request->cancelled.load(std::memory_order_relaxed))
+        {
+            fclose(fileptr);
+            lvn::ioFinishRequest(request, Lvn_IoStatus_Cancelled);
+            return;
+        }
+
+        size_t chunk = size - read < LVN_IO_READ_CHUNK_SIZE ? static_cast<size_t>(size - read) : LVN_IO_READ_CHUNK_SIZE;
+        size_t count = fread(bin.data() + read, sizeof(uint8_t), chunk, fileptr);
+        read += count;
+
+        if (count != chunk)
+        {
+            LVN_CORE_ERROR("asyncRead(const LvnIoReadInfo*, LvnIoRequest**) | failed to read file: %s", request->filepath.c_str());
+            fclose(fileptr);
+            lvn::ioFinishRequest(request, Lvn_IoStatus_Failed);
+            return;
+        }
+    }
+
+    fclose(fileptr);
+
+    request->data = LvnBin(std::move(bin));
+    lvn::ioFinishRequest(request, Lvn_IoStatus_Complete);
+}
+
+// sets the final status then calls or defers the callback, the service's reference is released once the callback has been called
+static void ioFinishRequest(LvnIoRequest* request, LvnIoStatus status)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_IoService.lock);
+        request->status.store(status, std::memory_order_release);
+
+        if (request->deferCallback)
+            s_IoService.deferred.push_back(request);
+    }
+    s_IoService.doneCond.notify_all();
+
+    if (!request->deferCallback)
+        lvn::ioCallRequest(request);
+}
+
+static void ioCallRequest(LvnIoRequest* request)
+{
+    if (request->callback)
+        request->callback(request, request->userData);
+
+    lvn::ioRelease(request);
+}
+
+
+// -- [SUBSECT]: I/O Threads
+// ------------------------------------------------------------
+
+static void* ioThread(void* arg)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "io %u", static_cast<uint32_t>(reinterpret_cast<uintptr_t>(arg)));
+    lvn::profileSetThreadName(name);
+
+    while (true)
+    {
+        LvnIoRequest* request = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(s_IoService.lock);
+            while (request == nullptr)
+            {
+                for (int i = Lvn_IoPriority_Max_Value - 1; i >= 0; i--)
+                {
+                    if (s_IoService.queues[i].empty()) { continue; }
+                    request = s_IoService.queues[i].front();
+                    s_IoService.queues[i].pop();
+                    break;
+                }
+
+                if (request != nullptr) { break; }
+                if (!s_IoService.running) { return nullptr; }
+
+                s_IoService.workCond.wait(lock);
+            }
+        }
+
+        if (request->cancelled.load(std::memory_order_relaxed))
+        {
+            lvn::ioFinishRequest(request, Lvn_IoStatus_Cancelled);
+            continue;
+        }
+
+        request->status.store(Lvn_IoStatus_Reading, std::memory_order_release);
+
+        LVN_PROFILE_SCOPE("asyncRead");
+        lvn::ioReadRequest(request);
+    }
+}
+
+
+// -- [SUBSECT]: I/O Functions
+// ------------------------------------------------------------
+
+void ioInit(uint32_t threadCount)
+{
+    if (s_IoService.threadCount != 0) { return; }
+
+    if (threadCount == 0)
+        threadCount = LVN_IO_DEFAULT_THREAD_COUNT;
+    if (threadCount > LVN_IO_MAX_THREAD_COUNT)
+        threadCount = LVN_IO_MAX_THREAD_COUNT;
+
+    s_IoService.threads = static_cast<LvnThread*>(LVN_MALLOC(sizeof(LvnThread) * threadCount));
+    s_IoService.threadCount = threadCount;
+    s_IoService.running = true;
+
+    for (uint32_t i = 0; i < threadCount; i++)
+        new (&s_IoService.threads[i]) LvnThread(lvn::ioThread, reinterpret_cast<void*>(static_cast<uintptr_t>(i)));
+}
+
+void ioTerminate()
+{
+    if (s_IoService.threadCount == 0) { return; }
+
+    // requests still in the queues are taken out so the threads stop after their current read, they are finished as cancelled once the threads are joined
+    LvnVector<LvnIoRequest*> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(s_IoService.lock);
+        for (uint32_t i = 0; i < Lvn_IoPriority_Max_Value; i++)
+        {
+            while (!s_IoService.queues[i].empty())
+            {
+                cancelled.push_back(s_IoService.queues[i].front());
+                s_IoService.queues[i].pop();
+            }
+            s_IoService.queues[i] = LvnQueue<LvnIoRequest*>();
+        }
+        s_IoService.running = false;
+    }
+    s_IoService.workCond.notify_all();
+
+    // destroying a thread joins it
+    for (uint32_t i = 0; i < s_IoService.threadCount; i++)
+        s_IoService.threads[i].~LvnThread();
+
+    lvn::memFree(s_IoService.threads);
+    s_IoService.threads = nullptr;
+    s_IoService.threadCount = 0;
+
+    for (uint32_t i = 0; i < cancelled.size(); i++)
+    {
+        cancelled[i]->cancelled.store(true, std::memory_order_relaxed);
+        lvn::ioFinishRequest(cancelled[i], Lvn_IoStatus_Cancelled);
+    }
+
+    // deferred callbacks that were never dispatched are called here so that every request is released
+    lvn::ioDispatchCallbacks();
+    s_IoService.deferred = LvnVector<LvnIoRequest*>();
+}
+
+LvnResult asyncRead(const LvnIoReadInfo* readInfo, LvnIoRequest** request)
+{
+    LVN_CORE_ASSERT(readInfo != nullptr, "readInfo is nullptr, cannot read file");
+
+    if (readInfo->filepath == nullptr)
+    {
+        LVN_CORE_ERROR("asyncRead(const LvnIoReadInfo*, LvnIoRequest**) | readInfo->filepath is nullptr, cannot read file");
+        return Lvn_Result_Failure;
+    }
+
+    if (static_cast<uint32_t>(readInfo->priority) >= Lvn_IoPriority_Max_Value)
+    {
+        LVN_CORE_ERROR("asyncRead(const LvnIoReadInfo*, LvnIoRequest**) | readInfo->priority is not a valid priority, cannot read file: %s", readInfo->filepath);
+        return Lvn_Result_Failure;
+    }
+
+    LvnIoRequest* ioRequest = LVN_MEM_NEW(LvnIoRequest, 1);
+    ioRequest->refCount.store(request != nullptr ? 2 : 1, std::memory_order_relaxed);
+    ioRequest->status.store(Lvn_IoStatus_Pending, std::memory_order_relaxed);
+    ioRequest->cancelled.store(false, std::memory_order_relaxed);
+    ioRequest->filepath = readInfo->filepath;
+    ioRequest->offset = readInfo->offset;
+    ioRequest->size = readInfo->size;
+    ioRequest->priority = readInfo->priority;
+    ioRequest->callback = readInfo->callback;
+    ioRequest->userData = readInfo->userData;
+    ioRequest->deferCallback = readInfo->deferCallback;
+
+    if (request != nullptr)
+        *request = ioRequest;
+
+    // no I/O threads, read the file on the calling thread
+    if (s_IoService.threadCount == 0)
+    {
+        ioRequest->status.store(Lvn_IoStatus_Reading, std::memory_order_relaxed);
+        lvn::ioReadRequest(ioRequest);
+        return Lvn_Result_Success;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_IoService.lock);
+        s_IoService.queues[ioRequest->priority].push(ioRequest);
+    }
+    s_IoService.workCond.notify_one();
+
+    return Lvn_Result_Success;
+}
+
+LvnIoStatus ioGetStatus(LvnIoRequest* request)
+{
+    LVN_CORE_ASSERT(request != nullptr, "request is nullptr");
+    return request->status.load(std::memory_order_acquire);
+}
+
+LvnBin ioGetData(LvnIoRequest* request)
+{
+    LVN_CORE_ASSERT(request != nullptr, "request is nullptr");
+
+    if (request->status.load(std::memory_order_acquire) != Lvn_IoStatus_Complete)
+        return {};
+
+    return request->data;
+}
+
+void ioWait(LvnIoRequest* request)
+{
+    LVN_CORE_ASSERT(request != nullptr, "request is nullptr");
+
+    auto finished = [request]()
+    {
+        LvnIoStatus status = request->status.load(std::memory_order_acquire);
+        return status != Lvn_IoStatus_Pending && status != Lvn_IoStatus_Reading;
+    };
+
+    if (finished()) { return; }
+
+    std::unique_lock<std::mutex> lock(s_IoService.lock);
+    s_IoService.doneCond.wait(lock, finished);
+}
+
+bool ioCancel(LvnIoRequest* request)
+{
+    LVN_CORE_ASSERT(request != nullptr, "request is nullptr");
+
+    // the thread that takes the request sees the flag before or while reading and finishes it as cancelled
+    LvnIoStatus status = request->status.load(std::memory_order_acquire);
+    if (status != Lvn_IoStatus_Pending && status != Lvn_IoStatus_Reading)
+        return false;
+
+    request->cancelled.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void ioRelease(LvnIoRequest* request)
+{
+    if (request == nullptr) { return; }
+
+    if (request->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        lvn::memDelete(request);
+}
+
+uint32_t ioDispatchCallbacks()
+{
+    LvnVector<LvnIoRequest*> deferred;
+    {
+        std::lock_guard<std::mutex> lock(s_IoService.lock);
+        if (s_IoService.deferred.empty()) { return 0; }
+        deferred = std::move(s_IoService.deferred);
+    }
+
+    for (uint32_t i = 0; i < deferred.size(); i++)
+        lvn::ioCallRequest(deferred[i]);
+
+    return static_cast<uint32_t>(deferred.size());
+}
+
+uint32_t ioGetThreadCount()
+{
+    return s_IoService.threadCount;
+}
+
+} /* namespace lvn */
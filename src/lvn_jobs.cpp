@@ -0,0 +1,384 @@
+#include "levikno.h"
+#include "levikno_internal.h"
+
+// [FILE]: lvn_jobs.cpp (Job System)
+// ------------------------------------------------------------
+//
+// [SECTION]: Job System
+// -- [SUBSECT]: Job Deques
+// -- [SUBSECT]: Workers
+// -- [SUBSECT]: Job System Functions
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+
+// ------------------------------------------------------------
+// [SECTION]: Job System
+// ------------------------------------------------------------
+// - a fixed number of workers is created when the context is created with multithreading enabled, the thread that creates the context is worker 0
+// - every worker owns a Chase-Lev deque, the owner pushes and pops jobs at the bottom while idle workers steal jobs from the top
+// - jobs submitted from threads that are not workers are pushed to a shared lock-free injection queue
+// - a counter is decremented when each of its jobs finishes, waiting on a counter runs other jobs until it reaches zero
+// - workers sleep on a condition variable when there are no pending jobs left to take
+
+#define LVN_JOB_DEQUE_CAPACITY          (4096)                                           /* must be a power of two */
+#define LVN_JOB_MAX_WORKER_COUNT        (64)
+#define LVN_JOB_INJECTION_CAPACITY      (4096)
+#define LVN_JOB_PARALLEL_FOR_SPLIT      (4)                                              /* number of batches per worker when no batch size is given */
+
+namespace lvn
+{
+
+// -- [SUBSECT]: Job Deques
+// ------------------------------------------------------------
+
+struct LvnJobEntry
+{
+    LvnJobFunc func;
+    void* data;
+    LvnJobCounter* counter;
+};
+
+// slot fields are atomic since a thief may read a slot while the owner is writing to it, the read is discarded when the steal fails
+struct LvnJobSlot
+{
+    std::atomic<LvnJobFunc> func;
+    std::atomic<void*> data;
+    std::atomic<LvnJobCounter*> counter;
+};
+
+struct alignas(LVN_CACHE_LINE_SIZE) LvnJobDeque
+{
+    alignas(LVN_CACHE_LINE_SIZE) std::atomic<int64_t> top;        /* thieves take jobs from the top */
+    alignas(LVN_CACHE_LINE_SIZE) std::atomic<int64_t> bottom;     /* owner pushes and pops jobs at the bottom */
+    LvnJobSlot slots[LVN_JOB_DEQUE_CAPACITY];
+};
+
+static void jobSlotStore(LvnJobSlot* slot, const LvnJobEntry& entry)
+{
+    slot->func.store(entry.func, std::memory_order_relaxed);
+    slot->data.store(entry.data, std::memory_order_relaxed);
+    slot->counter.store(entry.counter, std::memory_order_relaxed);
+}
+
+static LvnJobEntry jobSlotLoad(const LvnJobSlot* slot)
+{
+    LvnJobEntry entry;
+    entry.func = slot->func.load(std::memory_order_relaxed);
+    entry.data = slot->data.load(std::memory_order_relaxed);
+    entry.counter = slot->counter.load(std::memory_order_relaxed);
+    return entry;
+}
+
+// called only by the owner, returns false if the deque is full
+static bool jobDequePush(LvnJobDeque* deque, const LvnJobEntry& entry)
+{
+    int64_t bottom = deque->bottom.load(std::memory_order_relaxed);
+    int64_t top = deque->top.load(std::memory_order_acquire);
+    if (bottom - top >= LVN_JOB_DEQUE_CAPACITY) { return false; }
+
+    lvn::jobSlotStore(&deque->slots[bottom & (LVN_JOB_DEQUE_CAPACITY - 1)], entry);
+    deque->bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+// called only by the owner, takes the most recently pushed job
+static bool jobDequePop(LvnJobDeque* deque, LvnJobEntry* entry)
+{
+    int64_t bottom = deque->bottom.load(std::memory_order_relaxed) - 1;
+    deque->bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = deque->top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        deque->bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    *entry = lvn::jobSlotLoad(&deque->slots[bottom & (LVN_JOB_DEQUE_CAPACITY - 1)]);
+    if (top == bottom)
+    {
+        // last job in the deque, race against thieves for it
+        bool taken = deque->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        deque->bottom.store(bottom + 1, std::memory_order_relaxed);
+        return taken;
+    }
+
+    return true;
+}
+
+// called by any thread, takes the oldest job
+static bool jobDequeSteal(LvnJobDeque* deque, LvnJobEntry* entry)
+{
+    int64_t top = deque->top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = deque->bottom.load(std::memory_order_acquire);
+    if (top >= bottom) { return false; }
+
+    *entry = lvn::jobSlotLoad(&deque->slots[top & (LVN_JOB_DEQUE_CAPACITY - 1)]);
+    return deque->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+
+// -- [SUBSECT]: Workers
+// ------------------------------------------------------------
+
+struct LvnJobSystemState
+{
+    LvnJobDeque* deques;                       /* one deque per worker, index 0 is owned by the thread that initialized the job system */
+    LvnThread* threads;                        /* worker threads 1...n, slot 0 is never constructed */
+    uint32_t workerCount;
+
+    LvnMpmcQueue<LvnJobEntry>* injectionQueue; /* jobs submitted by non worker threads */
+
+    std::mutex sleepLock;
+    std::condition_variable sleepCond;
+    std::atomic<int64_t> pendingJobs;          /* jobs submitted that have not been taken yet */
+    std::atomic<bool> running;
+};
+
+static LvnJobSystemState s_JobSystem{};
+static thread_local int32_t s_WorkerIndex = -1;
+
+static void jobRun(const LvnJobEntry& entry)
+{
+    entry.func(entry.data);
+
+    if (entry.counter != nullptr)
+        entry.counter->value.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+// tries to take one job from the worker's own deque, the injection queue, then the other workers; runs it if found
+static bool jobTryRunOne(int32_t workerIndex)
+{
+    LvnJobEntry entry;
+    bool found = workerIndex >= 0 && lvn::jobDequePop(&s_JobSystem.deques[workerIndex], &entry);
+
+    if (!found)
+        found = s_JobSystem.injectionQueue->pop(entry);
+
+    if (!found)
+    {
+        uint32_t start = workerIndex >= 0 ? workerIndex + 1 : 0;
+        for (uint32_t i = 0; i < s_JobSystem.workerCount && !found; i++)
+        {
+            uint32_t victim = (start + i) % s_JobSystem.workerCount;
+            if (static_cast<int32_t>(victim) == workerIndex) { continue; }
+            found = lvn::jobDequeSteal(&s_JobSystem.deques[victim], &entry);
+        }
+    }
+
+    if (!found) { return false; }
+
+    s_JobSystem.pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+    lvn::jobRun(entry);
+    return true;
+}
+
+static void jobWakeWorkers(uint32_t count)
+{
+    // taking the lock orders the notify after a worker has checked pendingJobs, a wake up cannot be lost between the check and the wait
+    { std::lock_guard<std::mutex> lock(s_JobSystem.sleepLock); }
+
+    if (count == 1)
+        s_JobSystem.sleepCond.notify_one();
+    else
+        s_JobSystem.sleepCond.notify_all();
+}
+
+static void* jobWorkerThread(void* arg)
+{
+    s_WorkerIndex = static_cast<int32_t>(reinterpret_cast<uintptr_t>(arg));
+
+    char name[32];
+    snprintf(name, sizeof(name), "job worker %d", s_WorkerIndex);
+    lvn::profileSetThreadName(name);
+
+    while (s_JobSystem.running.load(std::memory_order_acquire))
+    {
+        if (lvn::jobTryRunOne(s_WorkerIndex))
+            continue;
+
+        std::unique_lock<std::mutex> lock(s_JobSystem.sleepLock);
+        s_JobSystem.sleepCond.wait(lock, []()
+        {
+            return s_JobSystem.pendingJobs.load(std::memory_order_relaxed) > 0 || !s_JobSystem.running.load(std::memory_order_relaxed);
+        });
+    }
+
+    s_WorkerIndex = -1;
+    return nullptr;
+}
+
+
+// -- [SUBSECT]: Job System Functions
+// ------------------------------------------------------------
+
+void jobSystemInit(uint32_t workerCount)
+{
+    if (s_JobSystem.workerCount != 0) { return; }
+
+    if (workerCount == 0)
+        workerCount = std::thread::hardware_concurrency();
+    if (workerCount == 0)
+        workerCount = 1;
+    if (workerCount > LVN_JOB_MAX_WORKER_COUNT)
+        workerCount = LVN_JOB_MAX_WORKER_COUNT;
+
+    s_JobSystem.deques = new LvnJobDeque[workerCount]();
+    s_JobSystem.threads = static_cast<LvnThread*>(LVN_MALLOC(sizeof(LvnThread) * workerCount));
+    s_JobSystem.injectionQueue = new LvnMpmcQueue<LvnJobEntry>(LVN_JOB_INJECTION_CAPACITY);
+    s_JobSystem.workerCount = workerCount;
+    s_JobSystem.pendingJobs.store(0, std::memory_order_relaxed);
+    s_JobSystem.running.store(true, std::memory_order_release);
+
+    s_WorkerIndex = 0;
+    for (uint32_t i = 1; i < workerCount; i++)
+        new (&s_JobSystem.threads[i]) LvnThread(lvn::jobWorkerThread, reinterpret_cast<void*>(static_cast<uintptr_t>(i)));
+}
+
+void jobSystemTerminate()
+{
+    if (s_JobSystem.workerCount == 0) { return; }
+
+    // finish any jobs that were submitted without being waited on
+    while (s_JobSystem.pendingJobs.load(std::memory_order_acquire) > 0)
+    {
+        if (!lvn::jobTryRunOne(s_WorkerIndex))
+            std::this_thread::yield();
+    }
+
+    s_JobSystem.running.store(false, std::memory_order_release);
+    lvn::jobWakeWorkers(s_JobSystem.workerCount);
+
+    // destroying a thread joins it
+    for (uint32_t i = 1; i < s_JobSystem.workerCount; i++)
+        s_JobSystem.threads[i].~LvnThread();
+
+    lvn::memFree(s_JobSystem.threads);
+    delete[] s_JobSystem.deques;
+    s_JobSystem.threads = nullptr;
+    s_JobSystem.deques = nullptr;
+    delete s_JobSystem.injectionQueue;
+    s_JobSystem.injectionQueue = nullptr;
+    s_JobSystem.workerCount = 0;
+
+    s_WorkerIndex = -1;
+}
+
+void jobSubmit(const LvnJob* pJobs, uint32_t jobCount, LvnJobCounter* counter)
+{
+    if (jobCount == 0) { return; }
+    LVN_CORE_ASSERT(pJobs != nullptr, "pJobs is nullptr, cannot submit jobs");
+
+    if (counter != nullptr)
+        counter->value.fetch_add(static_cast<int32_t>(jobCount), std::memory_order_relaxed);
+
+    // job system is not running, run the jobs on the calling thread
+    if (s_JobSystem.workerCount == 0)
+    {
+        for (uint32_t i = 0; i < jobCount; i++)
+            lvn::jobRun({ pJobs[i].func, pJobs[i].data, counter });
+        return;
+    }
+
+    s_JobSystem.pendingJobs.fetch_add(jobCount, std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < jobCount; i++)
+    {
+        LvnJobEntry entry = { pJobs[i].func, pJobs[i].data, counter };
+        bool pushed = s_WorkerIndex >= 0
+            ? lvn::jobDequePush(&s_JobSystem.deques[s_WorkerIndex], entry)
+            : s_JobSystem.injectionQueue->push(entry);
+
+        if (!pushed)
+        {
+            // queue is full, run the job now rather than block
+            s_JobSystem.pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+            lvn::jobRun(entry);
+        }
+    }
+
+    lvn::jobWakeWorkers(jobCount);
+}
+
+void jobWait(LvnJobCounter* counter)
+{
+    if (counter == nullptr) { return; }
+
+    // help with other jobs while waiting instead of blocking the thread
+    while (counter->value.load(std::memory_order_acquire) > 0)
+    {
+        if (!lvn::jobTryRunOne(s_WorkerIndex))
+            std::this_thread::yield();
+    }
+}
+
+struct LvnJobParallelForData
+{
+    void (*func)(uint32_t, uint32_t, void*);
+    void* userData;
+    uint32_t count;
+    uint32_t batchSize;
+    std::atomic<uint32_t> next;
+};
+
+// each job keeps taking batches until the range is done, workers that start late take fewer batches
+static void jobParallelForBatches(void* data)
+{
+    LvnJobParallelForData* forData = static_cast<LvnJobParallelForData*>(data);
+
+    while (true)
+    {
+        uint32_t begin = forData->next.fetch_add(forData->batchSize, std::memory_order_relaxed);
+        if (begin >= forData->count) { break; }
+
+        uint32_t end = forData->count - begin < forData->batchSize ? forData->count : begin + forData->batchSize;
+        forData->func(begin, end, forData->userData);
+    }
+}
+
+void jobParallelFor(uint32_t count, uint32_t batchSize, void (*func)(uint32_t begin, uint32_t end, void* data), void* data)
+{
+    if (count == 0) { return; }
+
+    uint32_t workerCount = lvn::jobGetWorkerCount();
+    if (batchSize == 0)
+        batchSize = (count + workerCount * LVN_JOB_PARALLEL_FOR_SPLIT - 1) / (workerCount * LVN_JOB_PARALLEL_FOR_SPLIT);
+
+    uint32_t batchCount = (count + batchSize - 1) / batchSize;
+    if (workerCount == 1 || batchCount == 1)
+    {
+        func(0, count, data);
+        return;
+    }
+
+    LvnJobParallelForData forData;
+    forData.func = func;
+    forData.userData = data;
+    forData.count = count;
+    forData.batchSize = batchSize;
+    forData.next.store(0, std::memory_order_relaxed);
+
+    // the calling thread takes batches as well, only submit enough jobs to keep the other workers busy
+    uint32_t jobCount = (batchCount < workerCount ? batchCount : workerCount) - 1;
+    LvnJob jobs[LVN_JOB_MAX_WORKER_COUNT];
+    for (uint32_t i = 0; i < jobCount; i++)
+        jobs[i] = { lvn::jobParallelForBatches, &forData };
+
+    LvnJobCounter counter{};
+    lvn::jobSubmit(jobs, jobCount, &counter);
+    lvn::jobParallelForBatches(&forData);
+    lvn::jobWait(&counter);
+}
+
+uint32_t jobGetWorkerCount()
+{
+    return s_JobSystem.workerCount ? s_JobSystem.workerCount : 1;
+}
+
+} /* namespace lvn */
@@ -0,0 +1,1112 @@
+#include "levikno.h"
+#include "levikno_internal.h"
+
+#include "lvn_loaders.h"
+
+// [FILE]: lvn_pack.cpp (Scene Packs)
+// ------------------------------------------------------------
+//
+// [SECTION]: Pack Format
+// [SECTION]: Pack Baking
+// -- [SUBSECT]: Pack Writer
+// -- [SUBSECT]: Bake Functions
+// [SECTION]: Pack Loading
+// -- [SUBSECT]: Pack Reader
+// -- [SUBSECT]: Pack Functions
+
+#include <cstdio>
+
+
+// ------------------------------------------------------------
+// [SECTION]: Pack Format
+// ------------------------------------------------------------
+// - a pack holds the models, images and fonts of a scene in the form they are given to the graphics api, the file is mapped at
+//   load and nothing is parsed or decoded; vertices are already interleaved with their tangents, images already have their mip
+//   levels (and bc blocks) and font atlases are already rasterised
+// - the header is at the start of the file, every other part is found through an offset and count (LvnPackArray) from the start
+//   of the file; tables are written after the data they point to so the baker writes the file in one pass
+// - vertex/index blobs and image levels are aligned to 16 bytes, blobs of a page or more start on a page boundary so the buffers
+//   and textures are created from whole pages of the mapping; tables are aligned to 8 bytes
+// - values are in the byte order of the machine that baked the pack (little endian on every supported platform), packs from a
+//   different version are rejected instead of converted
+
+#define LVN_PACK_MAGIC              (0x504E564C) /* "LVNP" */
+#define LVN_PACK_VERSION            (1)
+#define LVN_PACK_PAGE_SIZE          (4096)
+#define LVN_PACK_BLOB_ALIGNMENT     (16)         /* vertex/index data and image levels, raised to the page size for blobs of a page or more */
+#define LVN_PACK_TABLE_ALIGNMENT    (8)
+
+struct LvnPackArray
+{
+    uint64_t offset;
+    uint64_t count;               /* elements of the table or bytes of the blob */
+};
+
+struct LvnPackHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t fileSize;
+    LvnPackArray models;          /* LvnPackModel */
+    LvnPackArray images;          /* LvnPackImage */
+    LvnPackArray fonts;           /* LvnPackFont */
+};
+
+struct LvnPackImage
+{
+    uint32_t width, height, channels;
+    uint32_t compression;         /* LvnTextureCompression */
+    LvnPackArray levels;          /* LvnPackArray, the blob of each level from the full size level down */
+};
+
+struct LvnPackTexture
+{
+    int32_t image;                /* index into the pack images, -1 if no material uses the texture */
+    uint32_t format;
+    uint32_t minFilter, magFilter;
+    uint32_t wrapS, wrapT;
+};
+
+struct LvnPackMaterial
+{
+    float baseColorFactor[4];
+    float emissiveFactor[3];
+    float metallicFactor;
+    float roughnessFactor;
+    int32_t textures[4];          /* albedo, metallic roughness occlusion, normal, emissive; index into the model textures, -1 uses the default texture */
+    uint32_t doubleSided;
+};
+
+struct LvnPackPrimitive
+{
+    uint32_t topology;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t padding;
+    LvnPackArray buffer;          /* blob of the LvnVertex vertices followed by the uint32_t indices */
+    LvnPackMaterial material;
+};
+
+struct LvnPackMesh
+{
+    LvnPackArray primitives;      /* LvnPackPrimitive */
+};
+
+struct LvnPackNode
+{
+    int32_t parent, mesh, skin;
+    float translation[3];
+    float rotation[4];            /* w, x, y, z */
+    float scale[3];
+    float matrix[16];
+    uint32_t padding;
+    LvnPackArray children;        /* int32_t */
+};
+
+struct LvnPackSkin
+{
+    LvnPackArray name;            /* char */
+    LvnPackArray joints;          /* int32_t */
+    LvnPackArray inverseBindMatrices; /* LvnMat4 */
+};
+
+struct LvnPackAnimationChannel
+{
+    uint32_t path;
+    uint32_t interpolation;
+    int32_t node;
+    uint32_t padding;
+    LvnPackArray keyFrames;       /* float */
+    LvnPackArray outputs;         /* LvnVec4 */
+};
+
+struct LvnPackAnimation
+{
+    float start, end;
+    LvnPackArray channels;        /* LvnPackAnimationChannel */
+};
+
+struct LvnPackModel
+{
+    LvnPackArray rootNodes;       /* int32_t */
+    LvnPackArray nodes;           /* LvnPackNode */
+    LvnPackArray meshes;          /* LvnPackMesh */
+    LvnPackArray textures;        /* LvnPackTexture */
+    LvnPackArray skins;           /* LvnPackSkin */
+    LvnPackArray animations;      /* LvnPackAnimation */
+};
+
+struct LvnPackGlyph
+{
+    float uv[4];                  /* x0, y0, x1, y1 */
+    float size[2];
+    float bearing[2];
+    uint32_t unicode;
+    int32_t advance;
+};
+
+struct LvnPackFont
+{
+    float fontSize;
+    uint32_t atlas;               /* index into the pack images */
+    LvnPackArray codepoints;      /* uint32_t */
+    LvnPackArray glyphs;          /* LvnPackGlyph */
+};
+
+// the records are read straight from the file, their layout must not depend on the compiler
+static_assert(sizeof(LvnPackHeader) == 64, "pack header layout changed");
+static_assert(sizeof(LvnPackImage) == 32, "pack image layout changed");
+static_assert(sizeof(LvnPackPrimitive) == 88, "pack primitive layout changed");
+static_assert(sizeof(LvnPackNode) == 136, "pack node layout changed");
+static_assert(sizeof(LvnPackAnimationChannel) == 48, "pack animation channel layout changed");
+static_assert(sizeof(LvnPackFont) == 40, "pack font layout changed");
+
+struct LvnPack
+{
+    LvnBin file;                  /* mapping of the whole pack */
+    LvnPackHeader header;
+};
+
+namespace lvn
+{
+
+// ------------------------------------------------------------
+// [SECTION]: Pack Baking
+// ------------------------------------------------------------
+
+// -- [SUBSECT]: Pack Writer
+// ------------------------------------------------------------
+
+struct LvnPackWriter
+{
+    FILE* fileptr;
+    uint64_t offset;
+    bool failed;
+};
+
+static uint64_t packWrite(LvnPackWriter* writer, const void* data, uint64_t size, uint64_t alignment)
+{
+    static const uint8_t s_Padding[LVN_PACK_PAGE_SIZE] = {};
+
+    uint64_t padding = (alignment - writer->offset % alignment) % alignment;
+    if (padding > 0 && fwrite(s_Padding, 1, padding, writer->fileptr) != padding)
+        writer->failed = true;
+
+    uint64_t offset = writer->offset + padding;
+    if (size > 0 && fwrite(data, 1, size, writer->fileptr) != size)
+        writer->failed = true;
+
+    writer->offset = offset + size;
+    return offset;
+}
+
+static LvnPackArray packWriteBlob(LvnPackWriter* writer, const void* data, uint64_t size)
+{
+    uint64_t alignment = size >= LVN_PACK_PAGE_SIZE ? LVN_PACK_PAGE_SIZE : LVN_PACK_BLOB_ALIGNMENT;
+    return { lvn::packWrite(writer, data, size, alignment), size };
+}
+
+template <typename T>
+static LvnPackArray packWriteTable(LvnPackWriter* writer, const T* data, uint64_t count)
+{
+    if (count == 0)
+        return { 0, 0 };
+
+    return { lvn::packWrite(writer, data, count * sizeof(T), LVN_PACK_TABLE_ALIGNMENT), count };
+}
+
+
+// -- [SUBSECT]: Bake Functions
+// ------------------------------------------------------------
+
+// writes the levels of an image and adds its record to the image table, a null bake info stores the image as it is
+static bool packBakeImage(LvnPackWriter* writer, const LvnImageData& imageData, LvnTextureFormat format, const LvnPackBakeInfo* bakeInfo, LvnVector<LvnPackImage>* images)
+{
+    LvnImageData baseLevel = imageData;
+    LvnVector<LvnImageData> mipLevels = imageData.mipLevels;
+
+    // images that are already compressed (ktx2, dds) keep the levels stored in their file
+    if (bakeInfo && imageData.compression == Lvn_TextureCompression_None)
+    {
+        if (bakeInfo->genMipLevels)
+        {
+            uint32_t mipLevelCount = lvn::imageGetMipLevelCount(imageData.width, imageData.height);
+            mipLevels = {};
+            mipLevels.resize(mipLevelCount);
+
+            if (lvn::imageGenMipLevels(imageData, mipLevels.data(), mipLevelCount, bakeInfo->mipFilter, format) != Lvn_Result_Success)
+                return false;
+        }
+
+        if (bakeInfo->compression != Lvn_TextureCompression_None)
+        {
+            baseLevel = lvn::imageCompress(imageData, bakeInfo->compression);
+            if (baseLevel.size == 0)
+                return false;
+
+            for (uint32_t i = 0; i < mipLevels.size(); i++)
+            {
+                mipLevels[i] = lvn::imageCompress(mipLevels[i], bakeInfo->compression);
+                if (mipLevels[i].size == 0)
+                    return false;
+            }
+        }
+    }
+
+    LvnVector<LvnPackArray> levels(mipLevels.size() + 1);
+    const LvnData<uint8_t>& basePixels = baseLevel.pixels;
+    levels[0] = lvn::packWriteBlob(writer, basePixels.data(), basePixels.size());
+
+    for (uint32_t i = 0; i < mipLevels.size(); i++)
+    {
+        const LvnData<uint8_t>& levelPixels = mipLevels[i].pixels;
+        levels[i + 1] = lvn::packWriteBlob(writer, levelPixels.data(), levelPixels.size());
+    }
+
+    LvnPackImage image{};
+    image.width = baseLevel.width;
+    image.height = baseLevel.height;
+    image.channels = baseLevel.channels;
+    image.compression = baseLevel.compression;
+    image.levels = lvn::packWriteTable(writer, levels.data(), levels.size());
+
+    images->push_back(image);
+    return true;
+}
+
+static LvnPackMaterial packGetMaterial(const LvnBakeMaterial& material)
+{
+    LvnPackMaterial packMaterial{};
+    packMaterial.baseColorFactor[0] = material.baseColorFactor.x;
+    packMaterial.baseColorFactor[1] = material.baseColorFactor.y;
+    packMaterial.baseColorFactor[2] = material.baseColorFactor.z;
+    packMaterial.baseColorFactor[3] = material.baseColorFactor.w;
+    packMaterial.emissiveFactor[0] = material.emissiveFactor.x;
+    packMaterial.emissiveFactor[1] = material.emissiveFactor.y;
+    packMaterial.emissiveFactor[2] = material.emissiveFactor.z;
+    packMaterial.metallicFactor = material.metallicFactor;
+    packMaterial.roughnessFactor = material.roughnessFactor;
+    packMaterial.textures[0] = material.albedo;
+    packMaterial.textures[1] = material.metallicRoughnessOcclusion;
+    packMaterial.textures[2] = material.normal;
+    packMaterial.textures[3] = material.emissive;
+    packMaterial.doubleSided = material.doubleSided;
+    return packMaterial;
+}
+
+static bool packBakeModelData(LvnPackWriter* writer, const LvnModelBakeData& bakeData, const LvnPackBakeInfo* bakeInfo, LvnVector<LvnPackImage>* images, LvnPackModel* model)
+{
+    // images are written with the format of the first texture that uses them, images that no texture uses are left out
+    LvnVector<int32_t> packImageIndices(bakeData.images.size(), -1);
+    LvnVector<LvnPackTexture> textures(bakeData.textures.size());
+
+    for (uint32_t i = 0; i < bakeData.textures.size(); i++)
+    {
+        const LvnBakeTexture& texture = bakeData.textures[i];
+
+        textures[i].image = -1;
+        textures[i].format = texture.format;
+        textures[i].minFilter = texture.minFilter;
+        textures[i].magFilter = texture.magFilter;
+        textures[i].wrapS = texture.wrapS;
+        textures[i].wrapT = texture.wrapT;
+
+        if (texture.image < 0 || texture.image >= (int32_t)bakeData.images.size())
+            continue;
+
+        if (packImageIndices[texture.image] < 0)
+        {
+            if (!lvn::packBakeImage(writer, bakeData.images[texture.image], texture.format, bakeInfo, images))
+                return false;
+
+            packImageIndices[texture.image] = images->size() - 1;
+        }
+
+        textures[i].image = packImageIndices[texture.image];
+    }
+
+    // meshes, the interleaved vertices and indices built by the loader are written as they are
+    LvnVector<LvnPackMesh> meshes(bakeData.meshes.size());
+    for (uint32_t i = 0; i < bakeData.meshes.size(); i++)
+    {
+        const LvnVector<LvnBakePrimitive>& bakePrimitives = bakeData.meshes[i].primitives;
+        LvnVector<LvnPackPrimitive> primitives(bakePrimitives.size());
+
+        for (uint32_t j = 0; j < bakePrimitives.size(); j++)
+        {
+            primitives[j].topology = bakePrimitives[j].topology;
+            primitives[j].vertexCount = bakePrimitives[j].vertexCount;
+            primitives[j].indexCount = bakePrimitives[j].indexCount;
+            primitives[j].buffer = lvn::packWriteBlob(writer, bakePrimitives[j].bufferData, bakePrimitives[j].bufferSize);
+            primitives[j].material = lvn::packGetMaterial(bakePrimitives[j].material);
+        }
+
+        meshes[i].primitives = lvn::packWriteTable(writer, primitives.data(), primitives.size());
+    }
+
+    // nodes
+    LvnVector<LvnPackNode> nodes(bakeData.nodes.size());
+    for (uint32_t i = 0; i < bakeData.nodes.size(); i++)
+    {
+        const LvnNode& node = bakeData.nodes[i];
+        LvnPackNode& packNode = nodes[i];
+
+        packNode.parent = node.parent;
+        packNode.mesh = node.mesh;
+        packNode.skin = node.skin;
+        packNode.translation[0] = node.transform.translation.x;
+        packNode.translation[1] = node.transform.translation.y;
+        packNode.translation[2] = node.transform.translation.z;
+        packNode.rotation[0] = node.transform.rotation.w;
+        packNode.rotation[1] = node.transform.rotation.x;
+        packNode.rotation[2] = node.transform.rotation.y;
+        packNode.rotation[3] = node.transform.rotation.z;
+        packNode.scale[0] = node.transform.scale.x;
+        packNode.scale[1] = node.transform.scale.y;
+        packNode.scale[2] = node.transform.scale.z;
+        memcpy(packNode.matrix, &node.matrix, sizeof(packNode.matrix));
+        packNode.children = lvn::packWriteTable(writer, node.children.data(), node.children.size());
+    }
+
+    // skins
+    LvnVector<LvnPackSkin> skins(bakeData.skins.size());
+    for (uint32_t i = 0; i < bakeData.skins.size(); i++)
+    {
+        const LvnSkin& skin = bakeData.skins[i];
+        skins[i].name = lvn::packWriteTable(writer, skin.name.c_str(), skin.name.size());
+        skins[i].joints = lvn::packWriteTable(writer, skin.joints.data(), skin.joints.size());
+        skins[i].inverseBindMatrices = lvn::packWriteTable(writer, skin.inverseBindMatrices.data(), skin.inverseBindMatrices.size());
+    }
+
+    // animations
+    LvnVector<LvnPackAnimation> animations(bakeData.animations.size());
+    for (uint32_t i = 0; i < bakeData.animations.size(); i++)
+    {
+        const LvnAnimation& animation = bakeData.animations[i];
+        LvnVector<LvnPackAnimationChannel> channels(animation.channels.size());
+
+        for (uint32_t j = 0; j < animation.channels.size(); j++)
+        {
+            const LvnAnimationChannel& channel = animation.channels[j];
+            channels[j].path = channel.path;
+            channels[j].interpolation = channel.interpolation;
+            channels[j].node = channel.node;
+            channels[j].keyFrames = lvn::packWriteTable(writer, channel.keyFrames.data(), channel.keyFrames.size());
+            channels[j].outputs = lvn::packWriteTable(writer, channel.outputs.data(), channel.outputs.size());
+        }
+
+        animations[i].start = animation.start;
+        animations[i].end = animation.end;
+        animations[i].channels = lvn::packWriteTable(writer, channels.data(), channels.size());
+    }
+
+    model->rootNodes = lvn::packWriteTable(writer, bakeData.rootNodes.data(), bakeData.rootNodes.size());
+    model->nodes = lvn::packWriteTable(writer, nodes.data(), nodes.size());
+    model->meshes = lvn::packWriteTable(writer, meshes.data(), meshes.size());
+    model->textures = lvn::packWriteTable(writer, textures.data(), textures.size());
+    model->skins = lvn::packWriteTable(writer, skins.data(), skins.size());
+    model->animations = lvn::packWriteTable(writer, animations.data(), animations.size());
+
+    return true;
+}
+
+static bool packBakeModel(LvnPackWriter* writer, const char* filepath, const LvnPackBakeInfo* bakeInfo, LvnVector<LvnPackImage>* images, LvnVector<LvnPackModel>* models)
+{
+    LvnModelData* modelData = lvn::loadModelData(filepath);
+    if (modelData == nullptr)
+        return false;
+
+    // the bake data points into the model data, the model data is freed after the model is written
+    LvnModelBakeData bakeData{};
+    lvn::getModelBakeData(modelData, &bakeData);
+
+    LvnPackModel model{};
+    bool baked = lvn::packBakeModelData(writer, bakeData, bakeInfo, images, &model);
+
+    bakeData = {};
+    lvn::freeModelData(modelData);
+
+    if (baked)
+        models->push_back(model);
+
+    return baked;
+}
+
+static bool packBakeFont(LvnPackWriter* writer, const LvnPackFontInfo& fontInfo, LvnVector<LvnPackImage>* images, LvnVector<LvnPackFont>* fonts)
+{
+    LvnFont font = lvn::loadFontFromFileTTF(fontInfo.filepath, fontInfo.fontSize, fontInfo.pCodepoints, fontInfo.codepointCount, fontInfo.flags);
+    if (font.atlas.size == 0)
+        return false;
+
+    // the atlas is sampled as it was rasterised, no mip levels or compression
+    if (!lvn::packBakeImage(writer, font.atlas, Lvn_TextureFormat_Unorm, nullptr, images))
+        return false;
+
+    const LvnData<LvnFontGlyph>& fontGlyphs = font.glyphs;
+    LvnVector<LvnPackGlyph> glyphs(fontGlyphs.size());
+    for (uint32_t i = 0; i < fontGlyphs.size(); i++)
+    {
+        const LvnFontGlyph& glyph = fontGlyphs[i];
+        glyphs[i].uv[0] = glyph.uv.x0;
+        glyphs[i].uv[1] = glyph.uv.y0;
+        glyphs[i].uv[2] = glyph.uv.x1;
+        glyphs[i].uv[3] = glyph.uv.y1;
+        glyphs[i].size[0] = glyph.size.x;
+        glyphs[i].size[1] = glyph.size.y;
+        glyphs[i].bearing[0] = glyph.bearing.x;
+        glyphs[i].bearing[1] = glyph.bearing.y;
+        glyphs[i].unicode = glyph.unicode;
+        glyphs[i].advance = glyph.advance;
+    }
+
+    const LvnData<uint32_t>& codepoints = font.codepoints;
+
+    LvnPackFont packFont{};
+    packFont.fontSize = font.fontSize;
+    packFont.atlas = images->size() - 1;
+    packFont.codepoints = lvn::packWriteTable(writer, codepoints.data(), codepoints.size());
+    packFont.glyphs = lvn::packWriteTable(writer, glyphs.data(), glyphs.size());
+
+    fonts->push_back(packFont);
+    return true;
+}
+
+static bool packBakeFiles(LvnPackWriter* writer, const LvnPackBakeInfo* bakeInfo, LvnPackHeader* header)
+{
+    LvnVector<LvnPackImage> images;
+    LvnVector<LvnPackModel> models;
+    LvnVector<LvnPackFont> fonts;
+
+    // images are decoded across the job workers, the images of the bake info are the first images of the pack
+    if (bakeInfo->imageCount > 0)
+    {
+        LvnVector<LvnImageLoadInfo> loadInfos(bakeInfo->imageCount);
+        for (uint32_t i = 0; i < bakeInfo->imageCount; i++)
+        {
+            loadInfos[i] = {};
+            loadInfos[i].filepath = bakeInfo->pImages[i].filepath;
+            loadInfos[i].forceChannels = 4;
+        }
+
+        LvnVector<LvnImageData> imageData(bakeInfo->imageCount);
+        lvn::loadImagesBatch(loadInfos.data(), loadInfos.size(), imageData.data());
+
+        for (uint32_t i = 0; i < bakeInfo->imageCount; i++)
+        {
+            if (imageData[i].size == 0 || !lvn::packBakeImage(writer, imageData[i], bakeInfo->pImages[i].format, bakeInfo, &images))
+            {
+                LVN_CORE_ERROR("[pack]: cannot bake image: %s", bakeInfo->pImages[i].filepath);
+                return false;
+            }
+
+            imageData[i] = {};
+        }
+    }
+
+    for (uint32_t i = 0; i < bakeInfo->modelCount; i++)
+    {
+        if (!lvn::packBakeModel(writer, bakeInfo->pModelFilepaths[i], bakeInfo, &images, &models))
+        {
+            LVN_CORE_ERROR("[pack]: cannot bake model: %s", bakeInfo->pModelFilepaths[i]);
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < bakeInfo->fontCount; i++)
+    {
+        if (!lvn::packBakeFont(writer, bakeInfo->pFonts[i], &images, &fonts))
+        {
+            LVN_CORE_ERROR("[pack]: cannot bake font: %s", bakeInfo->pFonts[i].filepath);
+            return false;
+        }
+    }
+
+    header->images = lvn::packWriteTable(writer, images.data(), images.size());
+    header->models = lvn::packWriteTable(writer, models.data(), models.size());
+    header->fonts = lvn::packWriteTable(writer, fonts.data(), fonts.size());
+
+    return true;
+}
+
+
+// ------------------------------------------------------------
+// [SECTION]: Pack Loading
+// ------------------------------------------------------------
+
+// -- [SUBSECT]: Pack Reader
+// ------------------------------------------------------------
+
+static bool packArrayInFile(const LvnBin& file, const LvnPackArray& array, uint64_t elementSize)
+{
+    if (array.count == 0)
+        return true;
+
+    if (array.count > file.size() / elementSize)
+        return false;
+
+    return array.offset <= file.size() - array.count * elementSize;
+}
+
+// copies a table out of the mapping, the tables are small compared to the blobs and are copied so that reads never depend on
+// the alignment of the mapping
+template <typename T>
+static bool packReadTable(const LvnBin& file, const LvnPackArray& array, LvnVector<T>* table)
+{
+    if (!lvn::packArrayInFile(file, array, sizeof(T)))
+    {
+        LVN_CORE_ERROR("[pack]: table is out of the range of the file, offset: %llu, count: %llu", (unsigned long long)array.offset, (unsigned long long)array.count);
+        return false;
+    }
+
+    *table = {};
+    table->resize(array.count);
+    if (array.count > 0)
+        memcpy(table->data(), file.data() + array.offset, array.count * sizeof(T));
+
+    return true;
+}
+
+// indices read from the tables are checked against the table they index, a corrupt pack fails to load instead of indexing out of range later
+static bool packIndexInRange(int32_t index, uint64_t count, bool allowNone)
+{
+    return (allowNone && index == -1) || (index >= 0 && static_cast<uint64_t>(index) < count);
+}
+
+static bool packIndicesInRange(const LvnVector<int32_t>& indices, uint64_t count)
+{
+    for (uint32_t i = 0; i < indices.size(); i++)
+    {
+        if (!lvn::packIndexInRange(indices[i], count, false))
+            return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+static bool packReadRecord(const LvnBin& file, const LvnPackArray& array, uint32_t index, T* record)
+{
+    if (index >= array.count || !lvn::packArrayInFile(file, array, sizeof(T)))
+        return false;
+
+    memcpy(record, file.data() + array.offset + index * sizeof(T), sizeof(T));
+    return true;
+}
+
+static LvnTexture* packGetDefaultTexture(uint32_t slot, LvnTexture** defaultTextures, LvnModel* model)
+{
+    // same default textures as the gltf loader: white albedo, (0,1,0) metallic roughness, flat normal and black emissive
+    static const uint8_t s_DefaultTextureData[4][4] =
+    {
+        { 0xff, 0xff, 0xff, 0xff },
+        { 0x00, 0xff, 0x00, 0xff },
+        { 0x80, 0x80, 0xff, 0xff },
+        { 0x00, 0x00, 0x00, 0x00 },
+    };
+
+    if (defaultTextures[slot] == nullptr)
+    {
+        LvnTextureCreateInfo textureCreateInfo{};
+        textureCreateInfo.imageData.width = 1;
+        textureCreateInfo.imageData.height = 1;
+        textureCreateInfo.imageData.channels = 4;
+        textureCreateInfo.imageData.size = 4;
+        textureCreateInfo.imageData.pixels = LvnData<uint8_t>(s_DefaultTextureData[slot], 4);
+        textureCreateInfo.format = slot < 2 ? Lvn_TextureFormat_Srgb : Lvn_TextureFormat_Unorm;
+        textureCreateInfo.minFilter = Lvn_TextureFilter_Nearest;
+        textureCreateInfo.magFilter = Lvn_TextureFilter_Nearest;
+        textureCreateInfo.wrapS = Lvn_TextureMode_Repeat;
+        textureCreateInfo.wrapT = Lvn_TextureMode_Repeat;
+
+        if (lvn::createTexture(&defaultTextures[slot], &textureCreateInfo) != Lvn_Result_Success)
+            return nullptr;
+
+        model->textures.push_back(defaultTextures[slot]);
+    }
+
+    return defaultTextures[slot];
+}
+
+// creates the graphics objects of the model into model, the objects created before a failure are left in model to be destroyed
+static bool packCreateModelObjects(const LvnPack* pack, const LvnPackModel& packModel, LvnModel* model)
+{
+    const LvnBin& file = pack->file;
+
+    // textures, the levels are slices of the mapping and are uploaded without a copy
+    LvnVector<LvnPackTexture> packTextures;
+    if (!lvn::packReadTable(file, packModel.textures, &packTextures))
+        return false;
+
+    LvnVector<LvnTexture*> textures(packTextures.size(), nullptr);
+    for (uint32_t i = 0; i < packTextures.size(); i++)
+    {
+        if (packTextures[i].image < 0)
+            continue;
+
+        const LvnPackTexture& packTexture = packTextures[i];
+        if (packTexture.format > Lvn_TextureFormat_Srgb || packTexture.minFilter > Lvn_TextureFilter_Linear || packTexture.magFilter > Lvn_TextureFilter_Linear ||
+            packTexture.wrapS > Lvn_TextureMode_ClampToBorder || packTexture.wrapT > Lvn_TextureMode_ClampToBorder)
+        {
+            LVN_CORE_ERROR("[pack]: texture %u has an invalid format, filter or wrap mode", i);
+            return false;
+        }
+
+        LvnTextureCreateInfo textureCreateInfo{};
+        textureCreateInfo.imageData = lvn::packGetImage(pack, packTextures[i].image);
+        textureCreateInfo.format = static_cast<LvnTextureFormat>(packTextures[i].format);
+        textureCreateInfo.minFilter = static_cast<LvnTextureFilter>(packTextures[i].minFilter);
+        textureCreateInfo.magFilter = static_cast<LvnTextureFilter>(packTextures[i].magFilter);
+        textureCreateInfo.wrapS = static_cast<LvnTextureMode>(packTextures[i].wrapS);
+        textureCreateInfo.wrapT = static_cast<LvnTextureMode>(packTextures[i].wrapT);
+
+        if (textureCreateInfo.imageData.size == 0 || lvn::createTexture(&textures[i], &textureCreateInfo) != Lvn_Result_Success)
+            return false;
+
+        model->textures.push_back(textures[i]);
+    }
+
+    // meshes, the buffers are created straight from the mapped vertex and index blobs
+    LvnTexture* defaultTextures[4] = {};
+    LvnVector<LvnPackMesh> packMeshes;
+    if (!lvn::packReadTable(file, packModel.meshes, &packMeshes))
+        return false;
+
+    model->meshes.resize(packMeshes.size());
+    for (uint32_t i = 0; i < packMeshes.size(); i++)
+    {
+        LvnVector<LvnPackPrimitive> packPrimitives;
+        if (!lvn::packReadTable(file, packMeshes[i].primitives, &packPrimitives))
+            return false;
+
+        LvnVector<LvnPrimitive>& primitives = model->meshes[i].primitives;
+        primitives.resize(packPrimitives.size());
+
+        for (uint32_t j = 0; j < packPrimitives.size(); j++)
+        {
+            const LvnPackPrimitive& packPrimitive = packPrimitives[j];
+            LvnPrimitive& primitive = primitives[j];
+
+            uint64_t vertexSize = (uint64_t)packPrimitive.vertexCount * sizeof(LvnVertex);
+            uint64_t indexSize = (uint64_t)packPrimitive.indexCount * sizeof(uint32_t);
+            if (packPrimitive.buffer.count != vertexSize + indexSize || !lvn::packArrayInFile(file, packPrimitive.buffer, 1))
+            {
+                LVN_CORE_ERROR("[pack]: primitive buffer does not match its vertex and index count or is out of the range of the file");
+                return false;
+            }
+            if (packPrimitive.topology > Lvn_TopologyType_TriangleStrip)
+            {
+                LVN_CORE_ERROR("[pack]: primitive has an invalid topology (%u)", packPrimitive.topology);
+                return false;
+            }
+
+            LvnBufferCreateInfo bufferCreateInfo{};
+            bufferCreateInfo.type = Lvn_BufferType_Vertex;
+            if (packPrimitive.indexCount > 0) bufferCreateInfo.type |= Lvn_BufferType_Index;
+            bufferCreateInfo.usage = Lvn_BufferUsage_Static;
+            bufferCreateInfo.size = packPrimitive.buffer.count;
+            bufferCreateInfo.data = file.data() + packPrimitive.buffer.offset;
+
+            if (lvn::createBuffer(&primitive.buffer, &bufferCreateInfo) != Lvn_Result_Success)
+                return false;
+
+            model->buffers.push_back(primitive.buffer);
+
+            primitive.topology = static_cast<LvnTopologyType>(packPrimitive.topology);
+            primitive.vertexCount = packPrimitive.vertexCount;
+            primitive.indexCount = packPrimitive.indexCount;
+            primitive.indexOffset = vertexSize;
+            primitive.descriptorSet = nullptr;
+
+            // material, textures that are missing from the pack use the default texture of the slot
+            const LvnPackMaterial& packMaterial = packPrimitive.material;
+            LvnTexture* materialTextures[4];
+            for (uint32_t k = 0; k < 4; k++)
+            {
+                int32_t textureIndex = packMaterial.textures[k];
+                if (textureIndex >= 0 && textureIndex < (int32_t)textures.size() && textures[textureIndex] != nullptr)
+                    materialTextures[k] = textures[textureIndex];
+                else if ((materialTextures[k] = lvn::packGetDefaultTexture(k, defaultTextures, model)) == nullptr)
+                    return false;
+            }
+
+            primitive.material.baseColorFactor = LvnVec3(packMaterial.baseColorFactor[0], packMaterial.baseColorFactor[1], packMaterial.baseColorFactor[2]);
+            primitive.material.emissiveFactor = LvnVec3(packMaterial.emissiveFactor[0], packMaterial.emissiveFactor[1], packMaterial.emissiveFactor[2]);
+            primitive.material.metallicFactor = packMaterial.metallicFactor;
+            primitive.material.roughnessFactor = packMaterial.roughnessFactor;
+            primitive.material.albedo = materialTextures[0];
+            primitive.material.metallicRoughnessOcclusion = materialTextures[1];
+            primitive.material.normal = materialTextures[2];
+            primitive.material.emissive = materialTextures[3];
+            primitive.material.doubleSided = packMaterial.doubleSided != 0;
+        }
+    }
+
+    // nodes
+    LvnVector<LvnPackNode> packNodes;
+    if (!lvn::packReadTable(file, packModel.nodes, &packNodes) || !lvn::packReadTable(file, packModel.rootNodes, &model->rootNodes))
+        return false;
+
+    uint64_t nodeCount = packNodes.size();
+    if (!lvn::packIndicesInRange(model->rootNodes, nodeCount))
+    {
+        LVN_CORE_ERROR("[pack]: root nodes index out of the range of the node table (%llu nodes)", (unsigned long long)nodeCount);
+        return false;
+    }
+
+    model->nodes.resize(packNodes.size());
+    for (uint32_t i = 0; i < packNodes.size(); i++)
+    {
+        const LvnPackNode& packNode = packNodes[i];
+        LvnNode& node = model->nodes[i];
+
+        if (!lvn::packIndexInRange(packNode.parent, nodeCount, true) ||
+            !lvn::packIndexInRange(packNode.mesh, packMeshes.size(), true) ||
+            !lvn::packIndexInRange(packNode.skin, packModel.skins.count, true))
+        {
+            LVN_CORE_ERROR("[pack]: node %u has a parent, mesh or skin index out of the range of its table", i);
+            return false;
+        }
+
+        node.parent = packNode.parent;
+        node.mesh = packNode.mesh;
+        node.skin = packNode.skin;
+        node.transform.translation = LvnVec3(packNode.translation[0], packNode.translation[1], packNode.translation[2]);
+        node.transform.rotation = LvnQuat(packNode.rotation[0], packNode.rotation[1], packNode.rotation[2], packNode.rotation[3]);
+        node.transform.scale = LvnVec3(packNode.scale[0], packNode.scale[1], packNode.scale[2]);
+        memcpy(&node.matrix, packNode.matrix, sizeof(packNode.matrix));
+
+        if (!lvn::packReadTable(file, packNode.children, &node.children))
+            return false;
+
+        if (!lvn::packIndicesInRange(node.children, nodeCount))
+        {
+            LVN_CORE_ERROR("[pack]: node %u has a child index out of the range of the node table", i);
+            return false;
+        }
+    }
+
+    // skins, the joint matrices are uploaded to a storage buffer the same as the gltf loader
+    LvnVector<LvnPackSkin> packSkins;
+    if (!lvn::packReadTable(file, packModel.skins, &packSkins))
+        return false;
+
+    for (uint32_t i = 0; i < packSkins.size(); i++)
+    {
+        LvnSkin skin{};
+        LvnVector<char> name;
+        if (!lvn::packReadTable(file, packSkins[i].name, &name) ||
+            !lvn::packReadTable(file, packSkins[i].joints, &skin.joints) ||
+            !lvn::packReadTable(file, packSkins[i].inverseBindMatrices, &skin.inverseBindMatrices))
+            return false;
+
+        if (!lvn::packIndicesInRange(skin.joints, nodeCount) || (!skin.inverseBindMatrices.empty() && skin.inverseBindMatrices.size() != skin.joints.size()))
+        {
+            LVN_CORE_ERROR("[pack]: skin %u has a joint index out of the range of the node table or does not have a matrix for each joint", i);
+            return false;
+        }
+
+        skin.name = LvnString(name.data(), name.size());
+
+        LvnBufferCreateInfo ssboCreateInfo{};
+        ssboCreateInfo.type = Lvn_BufferType_Storage;
+        ssboCreateInfo.usage = Lvn_BufferUsage_Dynamic;
+        ssboCreateInfo.size = 16 * sizeof(float) * skin.inverseBindMatrices.size();
+        ssboCreateInfo.data = nullptr;
+
+        if (lvn::createBuffer(&skin.ssbo, &ssboCreateInfo) != Lvn_Result_Success)
+            return false;
+
+        lvn::bufferUpdateData(skin.ssbo, skin.inverseBindMatrices.data(), skin.inverseBindMatrices.size() * 16 * sizeof(float), 0);
+        model->skins.push_back(lvn::move(skin));
+    }
+
+    // animations
+    LvnVector<LvnPackAnimation> packAnimations;
+    if (!lvn::packReadTable(file, packModel.animations, &packAnimations))
+        return false;
+
+    model->animations.resize(packAnimations.size());
+    for (uint32_t i = 0; i < packAnimations.size(); i++)
+    {
+        LvnAnimation& animation = model->animations[i];
+        animation.start = packAnimations[i].start;
+        animation.end = packAnimations[i].end;
+        animation.currentTime = 0.0f;
+
+        LvnVector<LvnPackAnimationChannel> packChannels;
+        if (!lvn::packReadTable(file, packAnimations[i].channels, &packChannels))
+            return false;
+
+        animation.channels.resize(packChannels.size());
+        for (uint32_t j = 0; j < packChannels.size(); j++)
+        {
+            LvnAnimationChannel& channel = animation.channels[j];
+
+            if (packChannels[j].path > Lvn_AnimationPath_Scale || packChannels[j].interpolation > Lvn_InterpolationMode_Linear ||
+                !lvn::packIndexInRange(packChannels[j].node, nodeCount, false))
+            {
+                LVN_CORE_ERROR("[pack]: channel %u of animation %u has an invalid path, interpolation or node index", j, i);
+                return false;
+            }
+
+            channel.path = static_cast<LvnAnimationPath>(packChannels[j].path);
+            channel.interpolation = static_cast<LvnInterpolationMode>(packChannels[j].interpolation);
+            channel.node = packChannels[j].node;
+
+            if (!lvn::packReadTable(file, packChannels[j].keyFrames, &channel.keyFrames) ||
+                !lvn::packReadTable(file, packChannels[j].outputs, &channel.outputs))
+                return false;
+
+            if (channel.outputs.size() != channel.keyFrames.size())
+            {
+                LVN_CORE_ERROR("[pack]: channel %u of animation %u does not have an output for each key frame", j, i);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+// -- [SUBSECT]: Pack Functions
+// ------------------------------------------------------------
+
+LvnResult bakePack(const LvnPackBakeInfo* bakeInfo, const char* filepath)
+{
+    LVN_PROFILE_SCOPE("bakePack");
+
+    FILE* fileptr = fopen(filepath, "wb");
+    if (!fileptr)
+    {
+        LVN_CORE_ERROR("bakePack(const LvnPackBakeInfo*, const char*) | cannot open file for writing: %s", filepath);
+        return Lvn_Result_Failure;
+    }
+
+    LvnPackWriter writer{};
+    writer.fileptr = fileptr;
+
+    // the header is written again once the tables are written
+    LvnPackHeader header{};
+    lvn::packWrite(&writer, &header, sizeof(LvnPackHeader), 1);
+
+    bool baked = lvn::packBakeFiles(&writer, bakeInfo, &header);
+
+    if (baked && !writer.failed)
+    {
+        header.magic = LVN_PACK_MAGIC;
+        header.version = LVN_PACK_VERSION;
+        header.fileSize = writer.offset;
+
+        if (fseek(fileptr, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(LvnPackHeader), 1, fileptr) != 1)
+            writer.failed = true;
+    }
+
+    if (fclose(fileptr) != 0)
+        writer.failed = true;
+
+    if (!baked || writer.failed)
+    {
+        if (writer.failed)
+            LVN_CORE_ERROR("bakePack(const LvnPackBakeInfo*, const char*) | failed to write pack file: %s", filepath);
+
+        remove(filepath);
+        return Lvn_Result_Failure;
+    }
+
+    return Lvn_Result_Success;
+}
+
+LvnPack* loadPack(const char* filepath)
+{
+    LVN_PROFILE_SCOPE("loadPack");
+
+    // the mapping is only read through a const reference, a non const access would copy the read only pages
+    LvnPack* pack = LVN_MEM_NEW(LvnPack, 1);
+    pack->file = lvn::mapFile(filepath);
+    const LvnBin& file = pack->file;
+
+    if (file.size() < sizeof(LvnPackHeader))
+    {
+        LVN_CORE_ERROR("loadPack(const char*) | file is empty or too small for a pack header: %s", filepath);
+        lvn::memDelete(pack);
+        return nullptr;
+    }
+
+    LvnPackHeader& header = pack->header;
+    memcpy(&header, file.data(), sizeof(LvnPackHeader));
+
+    if (header.magic != LVN_PACK_MAGIC)
+    {
+        LVN_CORE_ERROR("loadPack(const char*) | file is not a pack: %s", filepath);
+        lvn::memDelete(pack);
+        return nullptr;
+    }
+    if (header.version != LVN_PACK_VERSION)
+    {
+        LVN_CORE_ERROR("loadPack(const char*) | pack version (%u) does not match the version of the library (%u), bake the pack again; file: %s", header.version, LVN_PACK_VERSION, filepath);
+        lvn::memDelete(pack);
+        return nullptr;
+    }
+    if (header.fileSize != file.size() ||
+        !lvn::packArrayInFile(file, header.models, sizeof(LvnPackModel)) ||
+        !lvn::packArrayInFile(file, header.images, sizeof(LvnPackImage)) ||
+        !lvn::packArrayInFile(file, header.fonts, sizeof(LvnPackFont)))
+    {
+        LVN_CORE_ERROR("loadPack(const char*) | pack is truncated or its tables are out of the range of the file: %s", filepath);
+        lvn::memDelete(pack);
+        return nullptr;
+    }
+
+    return pack;
+}
+
+void unloadPack(LvnPack* pack)
+{
+    lvn::memDelete(pack);
+}
+
+uint32_t packGetModelCount(const LvnPack* pack)
+{
+    return static_cast<uint32_t>(pack->header.models.count);
+}
+
+uint32_t packGetImageCount(const LvnPack* pack)
+{
+    return static_cast<uint32_t>(pack->header.images.count);
+}
+
+uint32_t packGetFontCount(const LvnPack* pack)
+{
+    return static_cast<uint32_t>(pack->header.fonts.count);
+}
+
+LvnModel packCreateModel(const LvnPack* pack, uint32_t index)
+{
+    LVN_PROFILE_SCOPE("packCreateModel");
+
+    LvnPackModel packModel;
+    if (!lvn::packReadRecord(pack->file, pack->header.models, index, &packModel))
+    {
+        LVN_CORE_ERROR("packCreateModel(const LvnPack*, uint32_t) | model index (%u) is out of range, the pack has %u models", index, (uint32_t)pack->header.models.count);
+        return {};
+    }
+
+    LvnModel model{};
+    model.matrix = LvnMat4(1.0f);
+
+    if (!lvn::packCreateModelObjects(pack, packModel, &model))
+    {
+        LVN_CORE_ERROR("packCreateModel(const LvnPack*, uint32_t) | failed to create model (%u) from pack", index);
+        lvn::unloadModel(&model);
+        return {};
+    }
+
+    return model;
+}
+
+LvnImageData packGetImage(const LvnPack* pack, uint32_t index)
+{
+    const LvnBin& file = pack->file;
+
+    LvnPackImage packImage;
+    if (!lvn::packReadRecord(file, pack->header.images, index, &packImage))
+    {
+        LVN_CORE_ERROR("packGetImage(const LvnPack*, uint32_t) | image index (%u) is out of range, the pack has %u images", index, (uint32_t)pack->header.images.count);
+        return {};
+    }
+
+    // the image is checked before the level sizes are computed, a level count past the mip chain would shift the size by 32 or more
+    if (packImage.width == 0 || packImage.height == 0 || packImage.channels < 1 || packImage.channels > 4 ||
+        packImage.compression > Lvn_TextureCompression_Bc7 ||
+        packImage.levels.count == 0 || packImage.levels.count > lvn::imageGetMipLevelCount(packImage.width, packImage.height) + 1)
+    {
+        LVN_CORE_ERROR("packGetImage(const LvnPack*, uint32_t) | image (%u) has an invalid size (w:%u,h:%u), channel count (%u), compression (%u) or level count (%llu)",
+            index, packImage.width, packImage.height, packImage.channels, packImage.compression, (unsigned long long)packImage.levels.count);
+        return {};
+    }
+
+    LvnVector<LvnPackArray> levels;
+    if (!lvn::packReadTable(file, packImage.levels, &levels))
+        return {};
+
+    // every level must hold exactly the pixels or blocks of its size, the levels are sliced out of the mapping
+    LvnImageData imageData{};
+    LvnVector<LvnImageData> mipLevels(levels.size() - 1);
+    LvnTextureCompression compression = static_cast<LvnTextureCompression>(packImage.compression);
+
+    for (uint32_t i = 0; i < levels.size(); i++)
+    {
+        uint32_t width = packImage.width >> i;
+        uint32_t height = packImage.height >> i;
+        if (width == 0) width = 1;
+        if (height == 0) height = 1;
+
+        if (levels[i].count != lvn::imageGetLevelSize(width, height, packImage.channels, compression) || !lvn::packArrayInFile(file, levels[i], 1))
+        {
+            LVN_CORE_ERROR("packGetImage(const LvnPack*, uint32_t) | level %u of image (%u) does not match its size or is out of the range of the file", i, index);
+            return {};
+        }
+
+        LvnImageData& level = i == 0 ? imageData : mipLevels[i - 1];
+        level.width = width;
+        level.height = height;
+        level.channels = packImage.channels;
+        level.size = levels[i].count;
+        level.compression = compression;
+        level.pixels = file.slice(levels[i].offset, levels[i].count);
+    }
+
+    imageData.mipLevels = lvn::move(mipLevels);
+    return imageData;
+}
+
+LvnFont packGetFont(const LvnPack* pack, uint32_t index)
+{
+    const LvnBin& file = pack->file;
+
+    LvnPackFont packFont;
+    if (!lvn::packReadRecord(file, pack->header.fonts, index, &packFont))
+    {
+        LVN_CORE_ERROR("packGetFont(const LvnPack*, uint32_t) | font index (%u) is out of range, the pack has %u fonts", index, (uint32_t)pack->header.fonts.count);
+        return {};
+    }
+
+    LvnVector<uint32_t> codepoints;
+    LvnVector<LvnPackGlyph> packGlyphs;
+    if (!lvn::packReadTable(file, packFont.codepoints, &codepoints) || !lvn::packReadTable(file, packFont.glyphs, &packGlyphs))
+        return {};
+
+    if (codepoints.size() != packGlyphs.size())
+    {
+        LVN_CORE_ERROR("packGetFont(const LvnPack*, uint32_t) | font (%u) does not have a glyph for each codepoint", index);
+        return {};
+    }
+
+    LvnFont font{};
+    font.atlas = lvn::packGetImage(pack, packFont.atlas);
+    font.fontSize = packFont.fontSize;
+    font.codepoints = LvnData<uint32_t>(codepoints.data(), codepoints.size());
+
+    LvnUniqueData<LvnFontGlyph> glyphs(packGlyphs.size());
+    for (uint32_t i = 0; i < packGlyphs.size(); i++)
+    {
+        const LvnPackGlyph& packGlyph = packGlyphs[i];
+        LvnFontGlyph& glyph = glyphs[i];
+        glyph.uv.x0 = packGlyph.uv[0];
+        glyph.uv.y0 = packGlyph.uv[1];
+        glyph.uv.x1 = packGlyph.uv[2];
+        glyph.uv.y1 = packGlyph.uv[3];
+        glyph.size.x = packGlyph.size[0];
+        glyph.size.y = packGlyph.size[1];
+        glyph.bearing.x = packGlyph.bearing[0];
+        glyph.bearing.y = packGlyph.bearing[1];
+        glyph.unicode = packGlyph.unicode;
+        glyph.advance = packGlyph.advance;
+    }
+
+    font.glyphs = lvn::move(glyphs);
+    return font;
+}
+
+} /* namespace lvn */
@@ -0,0 +1,507 @@
+#include "levikno.h"
+#include "levikno_internal.h"
+
+// [FILE]: lvn_profiler.cpp (CPU Profiler)
+// ------------------------------------------------------------
+//
+// [SECTION]: Profiler
+// -- [SUBSECT]: Profile Clock
+// -- [SUBSECT]: Thread Event Buffers
+// -- [SUBSECT]: Profiler Functions
+// -- [SUBSECT]: Frame Summary
+// -- [SUBSECT]: Chrome Trace Export
+
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define LVN_PROFILE_USE_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define LVN_PROFILE_USE_RDTSC
+#endif
+
+
+// ------------------------------------------------------------
+// [SECTION]: Profiler
+// ------------------------------------------------------------
+// - every thread that records a zone gets its own ring buffer of events, only the owning thread writes to it so recording never takes a lock
+// - a zone is written once when its scope ends with its start and end ticks, the oldest events are overwritten when a buffer is full
+// - readers copy events out of the rings and drop any event the owner overwrote while it was being copied
+// - ticks come from rdtsc on x86 and are converted to nanoseconds against the steady clock when zones are read, not when they are recorded
+// - frames are marked by lvn::profileBeginFrame and lvn::profileEndFrame, the last LVN_PROFILE_FRAME_HISTORY frames are kept
+
+#define LVN_PROFILE_DEFAULT_EVENT_CAPACITY  (65536)
+#define LVN_PROFILE_FRAME_HISTORY           (256)
+#define LVN_PROFILE_THREAD_NAME_SIZE        (32)
+#define LVN_PROFILE_MIN_CALIBRATION_NS      (1000000)                                    /* min time between the base and current clock samples when converting ticks */
+
+namespace lvn
+{
+
+// -- [SUBSECT]: Profile Clock
+// ------------------------------------------------------------
+
+static int64_t profileGetSteadyNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t profileGetTicks()
+{
+#ifdef LVN_PROFILE_USE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(lvn::profileGetSteadyNs());
+#endif
+}
+
+
+// -- [SUBSECT]: Thread Event Buffers
+// ------------------------------------------------------------
+
+// event fields are atomic since a reader may copy an event while the owner overwrites it, the copy is discarded when that happens
+struct LvnProfileEvent
+{
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> start;
+    std::atomic<uint64_t> end;
+    std::atomic<uint32_t> depth;
+};
+
+struct LvnProfileEventData
+{
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+    uint32_t depth;
+};
+
+struct LvnProfileThreadBuffer
+{
+    LvnProfileEvent* events;
+    uint32_t capacity;                         /* power of two */
+    uint32_t threadIndex;                      /* tid in the exported trace, 0 is used for the frame markers */
+    std::atomic<uint64_t> head;                /* number of events written since the buffer was created */
+    char name[LVN_PROFILE_THREAD_NAME_SIZE];
+};
+
+struct LvnProfileFrame
+{
+    uint64_t index;
+    uint64_t begin, end;
+    uint64_t previousBegin;                    /* start of the previous frame, 0 for the first frame */
+};
+
+struct LvnProfilerState
+{
+    std::atomic<bool> enabled;
+    std::atomic<uint32_t> generation;          /* incremented when the buffers are released, threads holding an older generation register again */
+
+    std::mutex lock;                           /* guards the thread list, the frames and the clock base */
+    LvnVector<LvnProfileThreadBuffer*> threads;
+    uint32_t eventCapacity;
+
+    LvnProfileFrame frames[LVN_PROFILE_FRAME_HISTORY];
+    uint64_t frameCount;                       /* frames completed */
+    uint64_t frameBegin, previousFrameBegin;
+    bool inFrame;
+
+    uint64_t baseTicks;
+    int64_t baseNs;
+};
+
+struct LvnProfileThreadState
+{
+    LvnProfileThreadBuffer* buffer;
+    uint32_t generation;
+    uint32_t depth;
+    char name[LVN_PROFILE_THREAD_NAME_SIZE];
+};
+
+static LvnProfilerState s_Profiler{};
+static thread_local LvnProfileThreadState s_ProfileThread{};
+
+// the caller holds s_Profiler.lock
+static void profileSetTimeBaseLocked()
+{
+    if (s_Profiler.baseTicks != 0) { return; }
+
+    s_Profiler.baseTicks = lvn::profileGetTicks();
+    s_Profiler.baseNs = lvn::profileGetSteadyNs();
+}
+
+// nanoseconds per tick measured from the clock base to now, the caller holds s_Profiler.lock
+static double profileGetNsPerTickLocked()
+{
+#ifdef LVN_PROFILE_USE_RDTSC
+    lvn::profileSetTimeBaseLocked();
+
+    // a short interval makes the conversion imprecise, only happens when zones are read right after profiling starts
+    int64_t ns = lvn::profileGetSteadyNs();
+    while (ns - s_Profiler.baseNs < LVN_PROFILE_MIN_CALIBRATION_NS)
+        ns = lvn::profileGetSteadyNs();
+
+    uint64_t ticks = lvn::profileGetTicks();
+    if (ticks <= s_Profiler.baseTicks) { return 1.0; }
+
+    return static_cast<double>(ns - s_Profiler.baseNs) / static_cast<double>(ticks - s_Profiler.baseTicks);
+#else
+    return 1.0;
+#endif
+}
+
+static void profileCopyName(char* dst, const char* name)
+{
+    snprintf(dst, LVN_PROFILE_THREAD_NAME_SIZE, "%s", name);
+}
+
+static LvnProfileThreadBuffer* profileGetThreadBuffer()
+{
+    if (s_ProfileThread.buffer != nullptr && s_ProfileThread.generation == s_Profiler.generation.load(std::memory_order_acquire))
+        return s_ProfileThread.buffer;
+
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+
+    uint32_t capacity = s_Profiler.eventCapacity ? s_Profiler.eventCapacity : LVN_PROFILE_DEFAULT_EVENT_CAPACITY;
+
+    LvnProfileThreadBuffer* buffer = new LvnProfileThreadBuffer();
+    buffer->events = new LvnProfileEvent[capacity]();
+    buffer->capacity = capacity;
+    buffer->threadIndex = static_cast<uint32_t>(s_Profiler.threads.size()) + 1;
+    buffer->head.store(0, std::memory_order_relaxed);
+
+    if (s_ProfileThread.name[0] != '\0')
+        lvn::profileCopyName(buffer->name, s_ProfileThread.name);
+    else
+        snprintf(buffer->name, LVN_PROFILE_THREAD_NAME_SIZE, "thread %u", buffer->threadIndex);
+
+    s_Profiler.threads.push_back(buffer);
+
+    s_ProfileThread.buffer = buffer;
+    s_ProfileThread.generation = s_Profiler.generation.load(std::memory_order_relaxed);
+    return buffer;
+}
+
+// copies the events still held by the buffer into events, the caller holds s_Profiler.lock
+static void profileCollectEvents(LvnProfileThreadBuffer* buffer, LvnVector<LvnProfileEventData>& events)
+{
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t first = head > buffer->capacity ? head - buffer->capacity : 0;
+    size_t offset = events.size();
+
+    for (uint64_t i = first; i < head; i++)
+    {
+        const LvnProfileEvent& event = buffer->events[i & (buffer->capacity - 1)];
+
+        LvnProfileEventData data;
+        data.name = event.name.load(std::memory_order_relaxed);
+        data.start = event.start.load(std::memory_order_relaxed);
+        data.end = event.end.load(std::memory_order_relaxed);
+        data.depth = event.depth.load(std::memory_order_relaxed);
+        events.push_back(data);
+    }
+
+    // events the owner wrote over while they were copied are dropped, those are the oldest ones
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t headAfter = buffer->head.load(std::memory_order_relaxed);
+    uint64_t firstValid = headAfter > buffer->capacity ? headAfter - buffer->capacity : 0;
+
+    if (firstValid > first)
+    {
+        size_t overwritten = static_cast<size_t>(firstValid - first < head - first ? firstValid - first : head - first);
+        for (size_t i = offset + overwritten; i < events.size(); i++)
+            events[i - overwritten] = events[i];
+        events.resize(events.size() - overwritten);
+    }
+}
+
+
+// -- [SUBSECT]: Profiler Functions
+// ------------------------------------------------------------
+
+void profilerInit(bool enable, uint32_t eventCapacity)
+{
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+
+    uint32_t capacity = 1;
+    while (capacity < eventCapacity)
+        capacity <<= 1;
+
+    s_Profiler.eventCapacity = eventCapacity ? capacity : LVN_PROFILE_DEFAULT_EVENT_CAPACITY;
+    s_Profiler.frameCount = 0;
+    s_Profiler.inFrame = false;
+    s_Profiler.frameBegin = s_Profiler.previousFrameBegin = 0;
+    s_Profiler.baseTicks = 0;
+    lvn::profileSetTimeBaseLocked();
+
+    lvn::profileCopyName(s_ProfileThread.name, "main");
+    s_Profiler.enabled.store(enable, std::memory_order_release);
+}
+
+void profilerTerminate()
+{
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+
+    s_Profiler.enabled.store(false, std::memory_order_release);
+    s_Profiler.generation.fetch_add(1, std::memory_order_acq_rel);
+
+    for (LvnProfileThreadBuffer* buffer : s_Profiler.threads)
+    {
+        delete[] buffer->events;
+        delete buffer;
+    }
+
+    s_Profiler.threads.clear_free();
+    s_Profiler.frameCount = 0;
+    s_Profiler.inFrame = false;
+}
+
+void profileEnable(bool enable)
+{
+    if (enable)
+    {
+        std::lock_guard<std::mutex> lock(s_Profiler.lock);
+        lvn::profileSetTimeBaseLocked();
+    }
+
+    s_Profiler.enabled.store(enable, std::memory_order_release);
+}
+
+bool profileIsEnabled()
+{
+    return s_Profiler.enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t profileBeginZone()
+{
+    s_ProfileThread.depth++;
+    return lvn::profileGetTicks();
+}
+
+void profileEndZone(const char* name, uint64_t startTicks)
+{
+    uint64_t endTicks = lvn::profileGetTicks();
+    uint32_t depth = --s_ProfileThread.depth;
+
+    // zones still open when profiling is disabled are dropped
+    if (!s_Profiler.enabled.load(std::memory_order_relaxed)) { return; }
+
+    LvnProfileThreadBuffer* buffer = lvn::profileGetThreadBuffer();
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    LvnProfileEvent& event = buffer->events[head & (buffer->capacity - 1)];
+
+    event.name.store(name, std::memory_order_relaxed);
+    event.start.store(startTicks, std::memory_order_relaxed);
+    event.end.store(endTicks, std::memory_order_relaxed);
+    event.depth.store(depth, std::memory_order_relaxed);
+
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void profileSetThreadName(const char* name)
+{
+    lvn::profileCopyName(s_ProfileThread.name, name ? name : "");
+
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+    if (s_ProfileThread.buffer != nullptr && s_ProfileThread.generation == s_Profiler.generation.load(std::memory_order_relaxed))
+        lvn::profileCopyName(s_ProfileThread.buffer->name, s_ProfileThread.name);
+}
+
+void profileBeginFrame()
+{
+    if (!s_Profiler.enabled.load(std::memory_order_relaxed)) { return; }
+
+    uint64_t ticks = lvn::profileGetTicks();
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+
+    s_Profiler.previousFrameBegin = s_Profiler.frameBegin;
+    s_Profiler.frameBegin = ticks;
+    s_Profiler.inFrame = true;
+}
+
+void profileEndFrame()
+{
+    if (!s_Profiler.enabled.load(std::memory_order_relaxed)) { return; }
+
+    uint64_t ticks = lvn::profileGetTicks();
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+    if (!s_Profiler.inFrame) { return; }
+
+    LvnProfileFrame& frame = s_Profiler.frames[s_Profiler.frameCount % LVN_PROFILE_FRAME_HISTORY];
+    frame.index = s_Profiler.frameCount;
+    frame.begin = s_Profiler.frameBegin;
+    frame.end = ticks;
+    frame.previousBegin = s_Profiler.previousFrameBegin;
+
+    s_Profiler.frameCount++;
+    s_Profiler.inFrame = false;
+}
+
+
+// -- [SUBSECT]: Frame Summary
+// ------------------------------------------------------------
+
+LvnResult profileGetFrameSummary(LvnProfileFrameStats* pFrameStats, LvnProfileZoneStats* pZoneStats, uint32_t* zoneCount)
+{
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+
+    if (s_Profiler.frameCount == 0)
+    {
+        if (zoneCount) { *zoneCount = 0; }
+        return Lvn_Result_Failure;
+    }
+
+    const LvnProfileFrame& frame = s_Profiler.frames[(s_Profiler.frameCount - 1) % LVN_PROFILE_FRAME_HISTORY];
+    double nsPerTick = lvn::profileGetNsPerTickLocked();
+
+    // every zone that started during the frame on any thread
+    LvnVector<LvnProfileEventData> events;
+    for (LvnProfileThreadBuffer* buffer : s_Profiler.threads)
+        lvn::profileCollectEvents(buffer, events);
+
+    LvnVector<LvnProfileZoneStats> zones;
+    LvnHashMap<const char*, uint32_t> zoneIndices;
+
+    for (const LvnProfileEventData& event : events)
+    {
+        if (event.start < frame.begin || event.start >= frame.end) { continue; }
+
+        double ms = static_cast<double>(event.end - event.start) * nsPerTick * 0.000001;
+
+        uint32_t* index = zoneIndices.find(event.name);
+        if (index == nullptr)
+        {
+            zoneIndices.insert(event.name, static_cast<uint32_t>(zones.size()));
+            zones.push_back({ event.name, 1, event.depth, ms, ms });
+            continue;
+        }
+
+        LvnProfileZoneStats& zone = zones[*index];
+        zone.callCount++;
+        zone.totalMs += ms;
+        if (ms > zone.maxMs) { zone.maxMs = ms; }
+        if (event.depth < zone.depth) { zone.depth = event.depth; }
+    }
+
+    // sort by total time so that the zones causing a hitch come first
+    for (uint32_t i = 1; i < zones.size(); i++)
+    {
+        LvnProfileZoneStats zone = zones[i];
+        uint32_t j = i;
+        for (; j > 0 && zones[j - 1].totalMs < zone.totalMs; j--)
+            zones[j] = zones[j - 1];
+        zones[j] = zone;
+    }
+
+    if (pFrameStats != nullptr)
+    {
+        pFrameStats->frameIndex = frame.index;
+        pFrameStats->cpuMs = static_cast<double>(frame.end - frame.begin) * nsPerTick * 0.000001;
+        pFrameStats->frameMs = frame.previousBegin ? static_cast<double>(frame.begin - frame.previousBegin) * nsPerTick * 0.000001 : 0.0;
+        pFrameStats->zoneCount = static_cast<uint32_t>(zones.size());
+    }
+
+    if (zoneCount == nullptr) { return Lvn_Result_Success; }
+
+    if (pZoneStats == nullptr)
+    {
+        *zoneCount = static_cast<uint32_t>(zones.size());
+        return Lvn_Result_Success;
+    }
+
+    uint32_t count = *zoneCount < zones.size() ? *zoneCount : static_cast<uint32_t>(zones.size());
+    for (uint32_t i = 0; i < count; i++)
+        pZoneStats[i] = zones[i];
+
+    *zoneCount = count;
+    return Lvn_Result_Success;
+}
+
+
+// -- [SUBSECT]: Chrome Trace Export
+// ------------------------------------------------------------
+
+static void profileWriteJsonString(FILE* fileptr, const char* str)
+{
+    fputc('"', fileptr);
+    for (const char* c = str ? str : ""; *c; c++)
+    {
+        switch (*c)
+        {
+            case '"':  { fputs("\\\"", fileptr); break; }
+            case '\\': { fputs("\\\\", fileptr); break; }
+            case '\n': { fputs("\\n", fileptr); break; }
+            case '\t': { fputs("\\t", fileptr); break; }
+            default:
+            {
+                if (static_cast<unsigned char>(*c) < 0x20)
+                    fprintf(fileptr, "\\u%04x", static_cast<unsigned char>(*c));
+                else
+                    fputc(*c, fileptr);
+                break;
+            }
+        }
+    }
+    fputc('"', fileptr);
+}
+
+LvnResult profileExportChromeTrace(const char* filepath)
+{
+    FILE* fileptr = fopen(filepath, "w");
+    if (!fileptr)
+    {
+        LVN_CORE_ERROR("profileExportChromeTrace(const char*) | failed to open file for the chrome trace: %s", filepath);
+        return Lvn_Result_Failure;
+    }
+
+    std::lock_guard<std::mutex> lock(s_Profiler.lock);
+
+    // timestamps are in microseconds from the clock base
+    double usPerTick = lvn::profileGetNsPerTickLocked() * 0.001;
+    uint64_t baseTicks = s_Profiler.baseTicks;
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", fileptr);
+    fputs("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"frames\"}}", fileptr);
+
+    uint64_t frameCount = s_Profiler.frameCount < LVN_PROFILE_FRAME_HISTORY ? s_Profiler.frameCount : LVN_PROFILE_FRAME_HISTORY;
+    for (uint64_t i = s_Profiler.frameCount - frameCount; i < s_Profiler.frameCount; i++)
+    {
+        const LvnProfileFrame& frame = s_Profiler.frames[i % LVN_PROFILE_FRAME_HISTORY];
+        fprintf(fileptr, ",\n{\"name\":\"frame %llu\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":0}",
+            static_cast<unsigned long long>(frame.index),
+            static_cast<double>(static_cast<int64_t>(frame.begin - baseTicks)) * usPerTick,
+            static_cast<double>(frame.end - frame.begin) * usPerTick);
+    }
+
+    LvnVector<LvnProfileEventData> events;
+    for (LvnProfileThreadBuffer* buffer : s_Profiler.threads)
+    {
+        fprintf(fileptr, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", buffer->threadIndex);
+        lvn::profileWriteJsonString(fileptr, buffer->name);
+        fputs("}}", fileptr);
+
+        events.clear();
+        lvn::profileCollectEvents(buffer, events);
+
+        for (const LvnProfileEventData& event : events)
+        {
+            fputs(",\n{\"name\":", fileptr);
+            lvn::profileWriteJsonString(fileptr, event.name);
+            fprintf(fileptr, ",\"cat\":\"zone\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                static_cast<double>(static_cast<int64_t>(event.start - baseTicks)) * usPerTick,
+                static_cast<double>(event.end - event.start) * usPerTick,
+                buffer->threadIndex);
+        }
+    }
+
+    fputs("\n]}\n", fileptr);
+    fclose(fileptr);
+
+    return Lvn_Result_Success;
+}
+
+} /* namespace lvn */
@@ -575,6 +575,9 @@ static void renderModeDraw2d(LvnRenderer* renderer, LvnRenderMode& renderMode)
     lvn::renderCmdBindIndexBuffer(renderer->window, renderMode.buffer, renderMode.indexOffset);
 
     lvn::renderCmdDrawIndexed(renderer->window, renderMode.drawList.index_count());
+
+    renderer->window->frameCounters.drawListVertexCount += renderMode.drawList.vertex_count();
+    renderer->window->frameCounters.drawListIndexCount += renderMode.drawList.index_count();
 }
 
 
@@ -655,6 +658,8 @@ void drawBegin()
 
 void drawEnd()
 {
+    LVN_PROFILE_SCOPE("drawEnd");
+
     LvnRenderer* renderer = s_Renderer.get();
 
     for (auto& renderMode : renderer->renderModes)
@@ -757,8 +762,8 @@ void drawPolyNgonSector(const LvnVec2& pos, float radius, float startAngle, floa
     if (nSides < minSides)
         nSides = minSides;
 
-    LvnVector<LvnVertexData2d> vertices(nSides + 2);
-    LvnVector<uint32_t> indices((nSides + 2) * 3);
+    LvnFrameVector<LvnVertexData2d> vertices(nSides + 2);
+    LvnFrameVector<uint32_t> indices((nSides + 2) * 3);
 
     float angle = lvn::radians(abs(endAngle - startAngle)) / (float)nSides;
 
@@ -0,0 +1,140 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <levikno/levikno.h>
+
+// NOTE: this program bakes models, images and fonts into a scene pack that lvn::loadPack maps at load without parsing or decoding
+//       usage: levikno-bake -o <pack file> [options] <files...>
+//       files are sorted by their extension: gltf, glb and obj files are models, ttf and otf files are fonts, anything else is an image
+//       options:
+//         -o <file>             the pack file to write
+//         --mips                generate the mip chain of every image
+//         --kaiser              filter the mip levels with the kaiser filter instead of the box filter
+//         --compress <format>   compress every image into none, bc1, bc3, bc5 or bc7 blocks (default none)
+//         --font-size <size>    size of the fonts given after the option (default 32)
+//         --srgb, --unorm       format of the images given after the option (default srgb)
+//       models, images and fonts are stored in the order they are given
+
+
+static const uint32_t s_MaxFiles = 1024;
+
+static bool hasExtension(const char* filepath, const char* extension)
+{
+    const char* dot = strrchr(filepath, '.');
+    return dot && strcmp(dot + 1, extension) == 0;
+}
+
+static bool getCompression(const char* name, LvnTextureCompression* compression)
+{
+    static const char* s_Names[] = { "none", "bc1", "bc3", "bc5", "bc7" };
+    static const LvnTextureCompression s_Compressions[] = { Lvn_TextureCompression_None, Lvn_TextureCompression_Bc1, Lvn_TextureCompression_Bc3, Lvn_TextureCompression_Bc5, Lvn_TextureCompression_Bc7 };
+
+    for (uint32_t i = 0; i < sizeof(s_Names) / sizeof(s_Names[0]); i++)
+    {
+        if (strcmp(name, s_Names[i]) == 0)
+        {
+            *compression = s_Compressions[i];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static int printUsage(const char* program)
+{
+    printf("usage: %s -o <pack file> [--mips] [--kaiser] [--compress none|bc1|bc3|bc5|bc7] [--font-size <size>] [--srgb|--unorm] <files...>\n", program);
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    static const char* modelFilepaths[s_MaxFiles];
+    static LvnPackImageInfo images[s_MaxFiles];
+    static LvnPackFontInfo fonts[s_MaxFiles];
+
+    LvnPackBakeInfo bakeInfo{};
+    bakeInfo.pModelFilepaths = modelFilepaths;
+    bakeInfo.pImages = images;
+    bakeInfo.pFonts = fonts;
+    bakeInfo.mipFilter = Lvn_ImageMipFilter_Box;
+    bakeInfo.compression = Lvn_TextureCompression_None;
+
+    const char* outputFilepath = nullptr;
+    uint32_t fontSize = 32;
+    LvnTextureFormat imageFormat = Lvn_TextureFormat_Srgb;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+
+        if (strcmp(arg, "-o") == 0 && i + 1 < argc)
+            outputFilepath = argv[++i];
+        else if (strcmp(arg, "--mips") == 0)
+            bakeInfo.genMipLevels = true;
+        else if (strcmp(arg, "--kaiser") == 0)
+            bakeInfo.mipFilter = Lvn_ImageMipFilter_Kaiser;
+        else if (strcmp(arg, "--compress") == 0 && i + 1 < argc)
+        {
+            if (!getCompression(argv[++i], &bakeInfo.compression))
+            {
+                printf("unknown compression: %s\n", argv[i]);
+                return printUsage(argv[0]);
+            }
+        }
+        else if (strcmp(arg, "--font-size") == 0 && i + 1 < argc)
+            fontSize = (uint32_t)atoi(argv[++i]);
+        else if (strcmp(arg, "--srgb") == 0)
+            imageFormat = Lvn_TextureFormat_Srgb;
+        else if (strcmp(arg, "--unorm") == 0)
+            imageFormat = Lvn_TextureFormat_Unorm;
+        else if (arg[0] == '-')
+        {
+            printf("unknown option: %s\n", arg);
+            return printUsage(argv[0]);
+        }
+        else if (bakeInfo.modelCount + bakeInfo.imageCount + bakeInfo.fontCount >= s_MaxFiles)
+        {
+            printf("too many files, at most %u files can be baked into one pack\n", s_MaxFiles);
+            return 1;
+        }
+        else if (hasExtension(arg, "gltf") || hasExtension(arg, "glb") || hasExtension(arg, "obj"))
+            modelFilepaths[bakeInfo.modelCount++] = arg;
+        else if (hasExtension(arg, "ttf") || hasExtension(arg, "otf"))
+        {
+            LvnPackFontInfo& font = fonts[bakeInfo.fontCount++];
+            font.filepath = arg;
+            font.fontSize = fontSize;
+        }
+        else
+        {
+            LvnPackImageInfo& image = images[bakeInfo.imageCount++];
+            image.filepath = arg;
+            image.format = imageFormat;
+        }
+    }
+
+    if (!outputFilepath || bakeInfo.modelCount + bakeInfo.imageCount + bakeInfo.fontCount == 0)
+        return printUsage(argv[0]);
+
+    LvnContextCreateInfo lvnCreateInfo{};
+    lvnCreateInfo.logging.enableLogging = true;
+    lvnCreateInfo.enableMultithreading = true;
+
+    lvn::createContext(&lvnCreateInfo);
+
+    LvnTimer timer;
+    timer.begin();
+
+    LvnResult result = lvn::bakePack(&bakeInfo, outputFilepath);
+
+    if (result == Lvn_Result_Success)
+    {
+        printf("baked %u models, %u images and %u fonts into %s in %.2f ms\n",
+            bakeInfo.modelCount, bakeInfo.imageCount, bakeInfo.fontCount, outputFilepath, timer.elapsedms());
+    }
+
+    lvn::terminateContext();
+
+    return result == Lvn_Result_Success ? 0 : 1;
+}